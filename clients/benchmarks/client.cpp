@@ -12,18 +12,32 @@
 #include "type_dispatch.hpp"
 #include "utility.h"
 
+#include "replay.hpp"
+
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <cstring>
+#include <exception>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 // aux
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched.hpp"
+#include "testing_set_get_matrix_ex.hpp"
+#include "testing_set_get_matrix_strided_batched.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
 // blas1
@@ -31,6 +45,7 @@
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
 #include "testing_axpy.hpp"
+#include "testing_axpy_64.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
 #include "testing_axpy_ex.hpp"
@@ -40,6 +55,7 @@
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
+#include "testing_dot_64.hpp"
 #include "testing_dot_batched.hpp"
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
@@ -85,7 +101,9 @@
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
 #include "testing_gemv_strided_batched.hpp"
+#include "testing_gemv_strided_batched_64.hpp"
 #include "testing_ger.hpp"
+#include "testing_ger_64.hpp"
 #include "testing_ger_batched.hpp"
 #include "testing_ger_strided_batched.hpp"
 #include "testing_hbmv.hpp"
@@ -154,9 +172,13 @@
 #include "testing_geam_batched.hpp"
 #include "testing_geam_strided_batched.hpp"
 #include "testing_gemm.hpp"
+#include "testing_gemm_64.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_tune.hpp"
+#include "testing_gemm_grouped_batched_ex.hpp"
+#include "testing_gemm_post_op_ex.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "testing_hemm.hpp"
@@ -178,6 +200,7 @@
 #include "testing_syr2k_batched.hpp"
 #include "testing_syr2k_strided_batched.hpp"
 #include "testing_syrk.hpp"
+#include "testing_syrk_64.hpp"
 #include "testing_syrk_batched.hpp"
 #include "testing_syrk_strided_batched.hpp"
 #include "testing_syrkx.hpp"
@@ -214,6 +237,9 @@
 #include "testing_getrs.hpp"
 #include "testing_getrs_batched.hpp"
 #include "testing_getrs_strided_batched.hpp"
+#include "testing_gesv_batched.hpp"
+#include "testing_gesv_mixed.hpp"
+#include "testing_gesv_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -312,7 +338,9 @@ struct perf_gemm_ex<Ti,
     {
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_ex_tune", testing_gemm_ex_tune_template<Ti, Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_grouped_batched_ex", testing_gemm_grouped_batched_ex_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -343,6 +371,37 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+// Template to dispatch testing_gemm_post_op_ex for performance tests
+// The post-op is run for the real types of C and compute types of hipblasGemmPostOpEx only
+template <typename Ti, typename To = Ti, typename Tc = To, typename = void>
+struct perf_gemm_post_op_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ti, typename To, typename Tc>
+struct perf_gemm_post_op_ex<
+    Ti,
+    To,
+    Tc,
+    std::enable_if_t<std::is_same<Ti, To>{}
+                     && ((std::is_same<To, hipblasHalf>{}
+                          && (std::is_same<Tc, hipblasHalf>{} || std::is_same<Tc, float>{}))
+                         || (std::is_same<To, hipblasBfloat16>{} && std::is_same<Tc, float>{})
+                         || (std::is_same<To, float>{} && std::is_same<Tc, float>{})
+                         || (std::is_same<To, double>{} && std::is_same<Tc, double>{}))>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_post_op_ex", testing_gemm_post_op_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_strided_batched_post_op_ex",
+             testing_gemm_strided_batched_post_op_ex_template<Ti, Ti, To, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename T, typename U = T, typename = void>
 struct perf_blas : hipblas_test_invalid
 {
@@ -360,12 +419,14 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"asum_batched", testing_asum_batched<T>},
             {"asum_strided_batched", testing_asum_strided_batched<T>},
             {"axpy", testing_axpy<T>},
+            {"axpy_64", testing_axpy_64<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
             {"dot", testing_dot<T>},
+            {"dot_64", testing_dot_64<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
             {"iamax", testing_amax<T>},
@@ -400,7 +461,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemv", testing_gemv<T>},
             {"gemv_batched", testing_gemv_batched<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+            {"gemv_strided_batched_64", testing_gemv_strided_batched_64<T>},
             {"ger", testing_ger<T, false>},
+            {"ger_64", testing_ger_64<T, false>},
             {"ger_batched", testing_ger_batched<T, false>},
             {"ger_strided_batched", testing_ger_strided_batched<T, false>},
             {"sbmv", testing_sbmv<T>},
@@ -454,12 +517,14 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"trmm_batched", testing_trmm_batched<T>},
             {"trmm_strided_batched", testing_trmm_strided_batched<T>},
             {"gemm", testing_gemm<T>},
+            {"gemm_64", testing_gemm_64<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
             {"symm", testing_symm<T>},
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
             {"syrk", testing_syrk<T>},
+            {"syrk_64", testing_syrk_64<T>},
             {"syrk_batched", testing_syrk_batched<T>},
             {"syrk_strided_batched", testing_syrk_strided_batched<T>},
             {"syr2k", testing_syr2k<T>},
@@ -493,6 +558,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
 #endif
 
             // Aux
@@ -500,6 +567,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"set_get_vector_async", testing_set_get_vector_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
             {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+            {"set_get_matrix_batched", testing_set_get_matrix_batched<T>},
+            {"set_get_matrix_strided_batched", testing_set_get_matrix_strided_batched<T>},
+            {"set_get_matrix_ex", testing_set_get_matrix_ex<T>},
         };
         run_function(fmap, arg);
     }
@@ -555,12 +625,14 @@ struct perf_blas<
             {"asum_batched", testing_asum_batched<T>},
             {"asum_strided_batched", testing_asum_strided_batched<T>},
             {"axpy", testing_axpy<T>},
+            {"axpy_64", testing_axpy_64<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
             {"dot", testing_dot<T>},
+            {"dot_64", testing_dot_64<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
             {"dotc", testing_dotc<T>},
@@ -589,13 +661,16 @@ struct perf_blas<
             {"gemv", testing_gemv<T>},
             {"gemv_batched", testing_gemv_batched<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+            {"gemv_strided_batched_64", testing_gemv_strided_batched_64<T>},
             {"gbmv", testing_gbmv<T>},
             {"gbmv_batched", testing_gbmv_batched<T>},
             {"gbmv_strided_batched", testing_gbmv_strided_batched<T>},
             {"geru", testing_ger<T, false>},
+            {"geru_64", testing_ger_64<T, false>},
             {"geru_batched", testing_ger_batched<T, false>},
             {"geru_strided_batched", testing_ger_strided_batched<T, false>},
             {"gerc", testing_ger<T, true>},
+            {"gerc_64", testing_ger_64<T, true>},
             {"gerc_batched", testing_ger_batched<T, true>},
             {"gerc_strided_batched", testing_ger_strided_batched<T, true>},
             {"hbmv", testing_hbmv<T>},
@@ -658,6 +733,7 @@ struct perf_blas<
             {"geam_batched", testing_geam_batched<T>},
             {"geam_strided_batched", testing_geam_strided_batched<T>},
             {"gemm", testing_gemm<T>},
+            {"gemm_64", testing_gemm_64<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
             {"hemm", testing_hemm<T>},
@@ -676,6 +752,7 @@ struct perf_blas<
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
             {"syrk", testing_syrk<T>},
+            {"syrk_64", testing_syrk_64<T>},
             {"syrk_batched", testing_syrk_batched<T>},
             {"syrk_strided_batched", testing_syrk_strided_batched<T>},
             {"syr2k", testing_syr2k<T>},
@@ -713,6 +790,34 @@ struct perf_blas<
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
+            {"gesv_batched", testing_gesv_batched<T>},
+            {"gesv_strided_batched", testing_gesv_strided_batched<T>},
+#endif
+        };
+        run_function(map, arg);
+    }
+};
+
+// The mixed precision solvers, of double and double complex systems
+template <typename T, typename U = T, typename = void>
+struct perf_gesv_mixed : hipblas_test_invalid
+{
+};
+
+template <typename T, typename U>
+struct perf_gesv_mixed<
+    T,
+    U,
+    std::enable_if_t<std::is_same<T, double>{} || std::is_same<T, hipblasDoubleComplex>{}>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+#ifdef __HIP_PLATFORM_SOLVER__
+            {"gesv_mixed", testing_gesv_mixed<T>},
+            {"gesv_mixed_batched", testing_gesv_mixed_batched<T>},
+            {"gesv_mixed_strided_batched", testing_gesv_mixed_strided_batched<T>},
 #endif
         };
         run_function(map, arg);
@@ -970,9 +1075,6 @@ int run_bench_test(Arguments& arg)
 {
     //hipblas_initialize(); // Initialize rocBLAS
 
-    std::cout << std::setiosflags(std::ios::fixed)
-              << std::setprecision(7); // Set precision to 7 digits
-
     // disable unit_check in client benchmark, it is only used in gtest unit test
     arg.unit_check = 0;
 
@@ -985,12 +1087,13 @@ int run_bench_test(Arguments& arg)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched")
+       || !strcmp(function, "gemm_64"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
+        int64_t min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
 
         if(arg.lda < min_lda)
         {
@@ -1011,9 +1114,9 @@ int run_bench_test(Arguments& arg)
     else if(!strcmp(function, "gemm_strided_batched"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
+        int64_t min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
         if(arg.lda < min_lda)
         {
             std::cout << "hipblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
@@ -1038,7 +1141,7 @@ int run_bench_test(Arguments& arg)
         //          arg.transA_option == 'N' ? arg.K * arg.lda : arg.M * arg.lda;
         //      hipblas_int min_stride_b =
         //          arg.transB_option == 'N' ? arg.N * arg.ldb : arg.K * arg.ldb;
-        hipblas_int min_stride_c = arg.ldc * arg.N;
+        int64_t min_stride_c = arg.ldc * arg.N;
         //      if (arg.stride_a < min_stride_a)
         //      {
         //          std::cout << "hipblas-bench INFO: stride_a < min_stride_a, set stride_a = " <<
@@ -1059,13 +1162,15 @@ int run_bench_test(Arguments& arg)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_batched_ex") || !strcmp(function, "gemm_post_op_ex")
+       || !strcmp(function, "gemm_ex_tune"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
-        hipblas_int min_ldd = arg.M;
+        int64_t min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
+        int64_t min_ldd = arg.M;
 
         if(arg.lda < min_lda)
         {
@@ -1087,15 +1192,19 @@ int run_bench_test(Arguments& arg)
             std::cout << "hipblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        hipblas_gemm_dispatch<perf_gemm_ex>(arg);
+        if(!strcmp(function, "gemm_post_op_ex"))
+            hipblas_gemm_dispatch<perf_gemm_post_op_ex>(arg);
+        else
+            hipblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
-    else if(!strcmp(function, "gemm_strided_batched_ex"))
+    else if(!strcmp(function, "gemm_strided_batched_ex")
+            || !strcmp(function, "gemm_strided_batched_post_op_ex"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
-        hipblas_int min_ldd = arg.M;
+        int64_t min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB_option == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
+        int64_t min_ldd = arg.M;
         if(arg.lda < min_lda)
         {
             std::cout << "hipblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
@@ -1116,7 +1225,7 @@ int run_bench_test(Arguments& arg)
             std::cout << "hipblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        hipblas_int min_stride_c = arg.ldc * arg.N;
+        int64_t min_stride_c = arg.ldc * arg.N;
         if(arg.stride_c < min_stride_c)
         {
             std::cout << "hipblas-bench INFO: stride_c < min_stride_c, set stride_c = "
@@ -1124,7 +1233,10 @@ int run_bench_test(Arguments& arg)
             arg.stride_c = min_stride_c;
         }
 
-        hipblas_gemm_dispatch<perf_gemm_strided_batched_ex>(arg);
+        if(!strcmp(function, "gemm_strided_batched_post_op_ex"))
+            hipblas_gemm_dispatch<perf_gemm_post_op_ex>(arg);
+        else
+            hipblas_gemm_dispatch<perf_gemm_strided_batched_ex>(arg);
     }
     else
     {
@@ -1153,6 +1265,9 @@ int run_bench_test(Arguments& arg)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+        else if(!strcmp(function, "gesv_mixed") || !strcmp(function, "gesv_mixed_batched")
+                || !strcmp(function, "gesv_mixed_strided_batched"))
+            hipblas_simple_dispatch<perf_gesv_mixed>(arg);
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
@@ -1184,11 +1299,14 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
-int main(int argc, char* argv[])
-try
+// Parse the command line into arg. Returns false if there is nothing to run.
+bool parse_bench_arguments(int          argc,
+                           char*        argv[],
+                           Arguments&   arg,
+                           hipblas_int& device_id,
+                           std::string& replay,
+                           bool         datafile)
 {
-    fix_batch(argc, argv);
-    Arguments   arg;
     std::string function;
     std::string precision;
     std::string a_type;
@@ -1197,11 +1315,7 @@ try
     std::string d_type;
     std::string compute_type;
     std::string initialization;
-    hipblas_int device_id;
-
-    // TODO: currently hipblas_parse_data not implemented
-    bool datafile            = hipblas_parse_data(argc, argv);
-    bool atomics_not_allowed = false;
+    bool        atomics_not_allowed = false;
 
     options_description desc("hipblas-bench command line options");
 
@@ -1209,17 +1323,17 @@ try
     desc.add_options()
 
         ("sizem,m",
-         value<hipblas_int>(&arg.M)->default_value(128),
+         value<int64_t>(&arg.M)->default_value(128),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
          "rows or columns in matrix.")
 
         ("sizen,n",
-         value<hipblas_int>(&arg.N)->default_value(128),
+         value<int64_t>(&arg.N)->default_value(128),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
          "BLAS-3: the number of rows or columns in matrix")
 
         ("sizek,k",
-         value<hipblas_int>(&arg.K)->default_value(128),
+         value<int64_t>(&arg.K)->default_value(128),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
          "the number of columns in A and rows in B.")
 
@@ -1234,19 +1348,19 @@ try
          "of the banded matrix A.")
 
         ("lda",
-         value<hipblas_int>(&arg.lda)->default_value(128),
+         value<int64_t>(&arg.lda)->default_value(128),
          "Leading dimension of matrix A, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldb",
-         value<hipblas_int>(&arg.ldb)->default_value(128),
+         value<int64_t>(&arg.ldb)->default_value(128),
          "Leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldc",
-         value<hipblas_int>(&arg.ldc)->default_value(128),
+         value<int64_t>(&arg.ldc)->default_value(128),
          "Leading dimension of matrix C, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldd",
-         value<hipblas_int>(&arg.ldd)->default_value(128),
+         value<int64_t>(&arg.ldd)->default_value(128),
          "Leading dimension of matrix D, is only applicable to BLAS-EX ")
 
         ("stride_a",
@@ -1280,11 +1394,11 @@ try
          "BLAS_2: leading dimension.")
 
         ("incx",
-         value<hipblas_int>(&arg.incx)->default_value(1),
+         value<int64_t>(&arg.incx)->default_value(1),
          "increment between values in x vector")
 
         ("incy",
-         value<hipblas_int>(&arg.incy)->default_value(1),
+         value<int64_t>(&arg.incy)->default_value(1),
          "increment between values in y vector")
 
         ("alpha",
@@ -1353,7 +1467,7 @@ try
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
         ("batch_count",
-         value<hipblas_int>(&arg.batch_count)->default_value(1),
+         value<int64_t>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
 
         ("verify,v",
@@ -1396,14 +1510,27 @@ try
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
 
+        ("graph",
+         bool_switch(&arg.graph)->default_value(false),
+         "Capture the timed iterations into a graph and time a single launch of it, "
+         "instead of timing each call in turn")
+
+        ("workspace",
+         value<size_t>(&arg.user_allocated_workspace)->default_value(0),
+         "Bytes of device memory to allocate and give the handle with hipblasSetWorkspace, "
+         "or 0 for the workspace hipBLAS allocates")
+
+        ("replay",
+         value<std::string>(&replay),
+         "Replay the calls of a trace recorded with HIPBLAS_LAYER=16, each on the stream it "
+         "was recorded on. Other options apply to every call")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
 
     // clang-format on
 
-    arg.atomics_mode = atomics_not_allowed ? HIPBLAS_ATOMICS_NOT_ALLOWED : HIPBLAS_ATOMICS_ALLOWED;
-
     variables_map vm;
     store(parse_command_line(argc, argv, desc), vm);
     notify(vm);
@@ -1411,9 +1538,11 @@ try
     if((argc <= 1 && !datafile) || vm.count("help"))
     {
         std::cout << desc << std::endl;
-        return 0;
+        return false;
     }
 
+    arg.atomics_mode = atomics_not_allowed ? HIPBLAS_ATOMICS_NOT_ALLOWED : HIPBLAS_ATOMICS_ALLOWED;
+
     // if(vm.find("version") != vm.end())
     // {
     //     char blas_version[100];
@@ -1422,17 +1551,6 @@ try
     //     return 0;
     // }
 
-    // Device Query
-    hipblas_int device_count = query_device_property();
-
-    std::cout << std::endl;
-    if(device_count <= device_id)
-        throw std::invalid_argument("Invalid Device ID");
-    set_device(device_id);
-
-    if(datafile)
-        return hipblas_bench_datafile();
-
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
     if(prec == static_cast<hipblasDatatype_t>(-1))
@@ -1469,10 +1587,248 @@ try
     if(arg.K < 0)
         throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
 
+    // The function of each call comes from the data file or the trace
+    if(datafile || !replay.empty())
+        return true;
+
     int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    return true;
+}
+
+// A call of a trace written by the replay log, see replay.hpp
+struct replay_call
+{
+    uint64_t sequence;
+    uint32_t stream;
+    // hipblas-bench options which repeat the call
+    std::vector<std::string> options;
+};
+
+replay_call parse_replay_record(const std::string& record)
+{
+    size_t pos  = 0;
+    auto   take = [&](void* value, size_t size) {
+        if(record.size() - pos < size)
+            throw std::invalid_argument("Invalid record in --replay trace");
+        memcpy(value, record.data() + pos, size);
+        pos += size;
+    };
+
+    replay_call call;
+    uint8_t     pointer_mode, length;
+    take(&call.sequence, sizeof(call.sequence));
+    take(&call.stream, sizeof(call.stream));
+    // The tests set the pointer mode themselves
+    take(&pointer_mode, sizeof(pointer_mode));
+    take(&length, sizeof(length));
+    std::string function(length, '\0');
+    take(&function[0], length);
+    call.options = {"-f", function};
+
+    while(pos < record.size())
+    {
+        uint8_t tag;
+        take(&tag, sizeof(tag));
+        if(tag >= hipblas_replay_tag_count)
+            throw std::invalid_argument("Invalid field in --replay trace");
+
+        const hipblas_replay_field& field = hipblas_replay_fields[tag];
+        std::ostringstream          value;
+        switch(field.kind)
+        {
+        case hipblas_replay_kind::integer:
+        {
+            int64_t i;
+            take(&i, sizeof(i));
+            value << i;
+            break;
+        }
+        case hipblas_replay_kind::real:
+        {
+            double d;
+            take(&d, sizeof(d));
+            value << std::setprecision(std::numeric_limits<double>::max_digits10) << d;
+            break;
+        }
+        case hipblas_replay_kind::letter:
+        {
+            char c;
+            take(&c, sizeof(c));
+            value << c;
+            break;
+        }
+        case hipblas_replay_kind::datatype:
+        {
+            uint8_t type;
+            take(&type, sizeof(type));
+            value << hipblas_datatype2string(hipblasDatatype_t(type));
+            break;
+        }
+        case hipblas_replay_kind::flag:
+            break;
+        }
+
+        call.options.push_back(field.option);
+        if(field.kind != hipblas_replay_kind::flag)
+            call.options.push_back(value.str());
+    }
+    return call;
+}
+
+// The calls of a trace, in the order they were made
+std::vector<replay_call> read_replay_trace(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    char          magic[sizeof(hipblas_replay_magic)];
+    if(!file.read(magic, sizeof(magic)) || memcmp(magic, hipblas_replay_magic, sizeof(magic)))
+        throw std::invalid_argument("Invalid value for --replay " + path);
+
+    std::vector<replay_call> calls;
+    std::string              record;
+    uint32_t                 size;
+    while(file.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    {
+        record.resize(size);
+        if(!file.read(&record[0], size))
+            throw std::invalid_argument("Truncated --replay trace " + path);
+        calls.push_back(parse_replay_record(record));
+    }
+
+    std::sort(calls.begin(), calls.end(), [](const replay_call& a, const replay_call& b) {
+        return a.sequence < b.sequence;
+    });
+    return calls;
+}
+
+// Replay a trace with the calls of each recorded stream run in order on a
+// stream and thread of their own, so that calls on different streams overlap
+// as they did when recorded. Each call prints its timing, named by its
+// position in the trace and its stream, and the wall time of the whole
+// replay is printed last.
+int hipblas_bench_replay(const std::string& path, int argc, char* argv[], hipblas_int device_id)
+{
+    // Options given along with --replay come first, so the trace overrides them
+    std::vector<std::string> common;
+    for(int i = 1; i < argc; i++)
+    {
+        if(!strcmp(argv[i], "--replay"))
+            i++;
+        else
+            common.push_back(argv[i]);
+    }
+
+    std::vector<replay_call> calls = read_replay_trace(path);
+
+    std::map<uint32_t, std::vector<Arguments>> streams;
+    for(const replay_call& call : calls)
+    {
+        std::vector<std::string> options = {argv[0]};
+        options.insert(options.end(), common.begin(), common.end());
+        options.insert(options.end(), call.options.begin(), call.options.end());
+
+        std::vector<char*> args;
+        for(std::string& option : options)
+            args.push_back(&option[0]);
+
+        Arguments   arg;
+        hipblas_int device;
+        std::string replay;
+        parse_bench_arguments(int(args.size()), args.data(), arg, device, replay, false);
+
+        snprintf(arg.name,
+                 sizeof(arg.name),
+                 "call_%llu_stream_%u",
+                 (unsigned long long)call.sequence,
+                 unsigned(call.stream));
+        streams[call.stream].push_back(arg);
+    }
+
+    // Stream 0 is the null stream
+    std::vector<hipStream_t> created;
+    for(auto& stream : streams)
+    {
+        hipStream_t hip_stream = nullptr;
+        if(stream.first)
+        {
+            CHECK_HIP_ERROR(hipStreamCreate(&hip_stream));
+            created.push_back(hip_stream);
+        }
+        for(Arguments& arg : stream.second)
+            arg.stream = hip_stream;
+    }
+
+    std::exception_ptr       error;
+    std::mutex               error_mutex;
+    std::vector<std::thread> threads;
+
+    auto start = std::chrono::steady_clock::now();
+    for(auto& stream : streams)
+    {
+        std::vector<Arguments>& stream_calls = stream.second;
+        threads.emplace_back([&, device_id] {
+            try
+            {
+                set_device(device_id);
+                for(Arguments& arg : stream_calls)
+                    run_bench_test(arg);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if(!error)
+                    error = std::current_exception();
+            }
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    for(hipStream_t hip_stream : created)
+        CHECK_HIP_ERROR(hipStreamDestroy(hip_stream));
+
+    if(error)
+        std::rethrow_exception(error);
+
+    std::cout << "replayed " << calls.size() << " calls on " << streams.size()
+              << " streams, end to end ms: " << elapsed.count() << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[])
+try
+{
+    fix_batch(argc, argv);
+    Arguments   arg;
+    hipblas_int device_id;
+    std::string replay;
+
+    // TODO: currently hipblas_parse_data not implemented
+    bool datafile = hipblas_parse_data(argc, argv);
+
+    if(!parse_bench_arguments(argc, argv, arg, device_id, replay, datafile))
+        return 0;
+
+    // Device Query
+    hipblas_int device_count = query_device_property();
+
+    std::cout << std::endl;
+    if(device_count <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    std::cout << std::setiosflags(std::ios::fixed)
+              << std::setprecision(7); // Set precision to 7 digits
+
+    if(datafile)
+        return hipblas_bench_datafile();
+
+    if(!replay.empty())
+        return hipblas_bench_replay(replay, argc, argv, device_id);
+
     return run_bench_test(arg);
 }
 catch(const std::invalid_argument& exp)
@@ -2644,6 +2644,306 @@ void cblas_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
         C[i] = static_cast<int32_t>(C_double[i]);
 }
 
+// gemm post-op
+inline float post_op_load(hipblasHalf x)
+{
+    return half_to_float(x);
+}
+
+inline float post_op_load(hipblasBfloat16 x)
+{
+    return bfloat16_to_float(x);
+}
+
+inline float post_op_load(float x)
+{
+    return x;
+}
+
+inline double post_op_load(double x)
+{
+    return x;
+}
+
+inline void post_op_store(hipblasHalf& y, float x)
+{
+    y = float_to_half(x);
+}
+
+inline void post_op_store(hipblasBfloat16& y, float x)
+{
+    y = float_to_bfloat16(x);
+}
+
+inline void post_op_store(float& y, float x)
+{
+    y = x;
+}
+
+inline void post_op_store(double& y, double x)
+{
+    y = x;
+}
+
+template <typename W>
+W post_op_activation(hipblasActivation_t activation, W x)
+{
+    switch(activation)
+    {
+    case HIPBLAS_ACTIVATION_RELU:
+        return x > W(0) ? x : W(0);
+    case HIPBLAS_ACTIVATION_GELU:
+        return W(0.5) * x
+               * (W(1) + std::tanh(W(0.7978845608028654) * (x + W(0.044715) * x * x * x)));
+    case HIPBLAS_ACTIVATION_TANH:
+        return std::tanh(x);
+    default:
+        return x;
+    }
+}
+
+// The post-op is computed like the library does, in float for half and
+// bfloat16, aux holding the rounded sum and the activation taking the
+// unrounded one
+template <typename Ti, typename To, typename Tc>
+void cblas_gemm_post_op_local(hipblasOperation_t  transA,
+                              hipblasOperation_t  transB,
+                              int                 m,
+                              int                 n,
+                              int                 k,
+                              Tc                  alpha,
+                              Ti*                 A,
+                              int                 lda,
+                              Ti*                 B,
+                              int                 ldb,
+                              Tc                  beta,
+                              To*                 C,
+                              int                 ldc,
+                              hipblasActivation_t activation,
+                              const To*           bias,
+                              const Tc*           scale,
+                              To*                 aux,
+                              int                 ld_aux)
+{
+    cblas_gemm<Ti, To, Tc>(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+
+    using W = decltype(post_op_load(*C));
+    for(int j = 0; j < n; j++)
+    {
+        W s = scale ? W(post_op_load(scale[j])) : W(1);
+        for(int i = 0; i < m; i++)
+        {
+            W z = post_op_load(C[i + size_t(j) * ldc]);
+            if(bias)
+                z += post_op_load(bias[i]);
+            if(aux)
+                post_op_store(aux[i + size_t(j) * ld_aux], z);
+            post_op_store(C[i + size_t(j) * ldc], post_op_activation(activation, z) * s);
+        }
+    }
+}
+
+template <>
+void cblas_gemm_post_op<hipblasHalf>(hipblasOperation_t  transA,
+                                     hipblasOperation_t  transB,
+                                     int                 m,
+                                     int                 n,
+                                     int                 k,
+                                     hipblasHalf         alpha,
+                                     hipblasHalf*        A,
+                                     int                 lda,
+                                     hipblasHalf*        B,
+                                     int                 ldb,
+                                     hipblasHalf         beta,
+                                     hipblasHalf*        C,
+                                     int                 ldc,
+                                     hipblasActivation_t activation,
+                                     const hipblasHalf*  bias,
+                                     const hipblasHalf*  scale,
+                                     hipblasHalf*        aux,
+                                     int                 ld_aux)
+{
+    cblas_gemm_post_op_local(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             activation,
+                             bias,
+                             scale,
+                             aux,
+                             ld_aux);
+}
+
+template <>
+void cblas_gemm_post_op<hipblasHalf, hipblasHalf, float>(hipblasOperation_t  transA,
+                                                         hipblasOperation_t  transB,
+                                                         int                 m,
+                                                         int                 n,
+                                                         int                 k,
+                                                         float               alpha,
+                                                         hipblasHalf*        A,
+                                                         int                 lda,
+                                                         hipblasHalf*        B,
+                                                         int                 ldb,
+                                                         float               beta,
+                                                         hipblasHalf*        C,
+                                                         int                 ldc,
+                                                         hipblasActivation_t activation,
+                                                         const hipblasHalf*  bias,
+                                                         const float*        scale,
+                                                         hipblasHalf*        aux,
+                                                         int                 ld_aux)
+{
+    cblas_gemm_post_op_local(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             activation,
+                             bias,
+                             scale,
+                             aux,
+                             ld_aux);
+}
+
+template <>
+void
+    cblas_gemm_post_op<hipblasBfloat16, hipblasBfloat16, float>(hipblasOperation_t     transA,
+                                                                hipblasOperation_t     transB,
+                                                                int                    m,
+                                                                int                    n,
+                                                                int                    k,
+                                                                float                  alpha,
+                                                                hipblasBfloat16*       A,
+                                                                int                    lda,
+                                                                hipblasBfloat16*       B,
+                                                                int                    ldb,
+                                                                float                  beta,
+                                                                hipblasBfloat16*       C,
+                                                                int                    ldc,
+                                                                hipblasActivation_t    activation,
+                                                                const hipblasBfloat16* bias,
+                                                                const float*           scale,
+                                                                hipblasBfloat16*       aux,
+                                                                int                    ld_aux)
+{
+    cblas_gemm_post_op_local(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             activation,
+                             bias,
+                             scale,
+                             aux,
+                             ld_aux);
+}
+
+template <>
+void cblas_gemm_post_op<float>(hipblasOperation_t  transA,
+                               hipblasOperation_t  transB,
+                               int                 m,
+                               int                 n,
+                               int                 k,
+                               float               alpha,
+                               float*              A,
+                               int                 lda,
+                               float*              B,
+                               int                 ldb,
+                               float               beta,
+                               float*              C,
+                               int                 ldc,
+                               hipblasActivation_t activation,
+                               const float*        bias,
+                               const float*        scale,
+                               float*              aux,
+                               int                 ld_aux)
+{
+    cblas_gemm_post_op_local(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             activation,
+                             bias,
+                             scale,
+                             aux,
+                             ld_aux);
+}
+
+template <>
+void cblas_gemm_post_op<double>(hipblasOperation_t  transA,
+                                hipblasOperation_t  transB,
+                                int                 m,
+                                int                 n,
+                                int                 k,
+                                double              alpha,
+                                double*             A,
+                                int                 lda,
+                                double*             B,
+                                int                 ldb,
+                                double              beta,
+                                double*             C,
+                                int                 ldc,
+                                hipblasActivation_t activation,
+                                const double*       bias,
+                                const double*       scale,
+                                double*             aux,
+                                int                 ld_aux)
+{
+    cblas_gemm_post_op_local(transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             lda,
+                             B,
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             activation,
+                             bias,
+                             scale,
+                             aux,
+                             ld_aux);
+}
+
 // hemm
 template <>
 void cblas_hemm(hipblasSideMode_t side,
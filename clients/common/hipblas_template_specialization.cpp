@@ -10091,8 +10091,625 @@ hipblasStatus_t hipblasGeqrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
+// gesv_batched
+template <>
+hipblasStatus_t hipblasGesvBatched<float>(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          float* const    A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          float* const    B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount)
+{
+    return hipblasSgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<double>(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasDgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount)
+{
+    return hipblasCgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         int*                        ipiv,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         const int                   batchCount)
+{
+    return hipblasZgesvBatched(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+// gesv_strided_batched
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<float>(hipblasHandle_t     handle,
+                                                 const int           n,
+                                                 const int           nrhs,
+                                                 float*              A,
+                                                 const int           lda,
+                                                 const hipblasStride strideA,
+                                                 int*                ipiv,
+                                                 const hipblasStride strideP,
+                                                 float*              B,
+                                                 const int           ldb,
+                                                 const hipblasStride strideB,
+                                                 int*                info,
+                                                 const int           batchCount)
+{
+    return hipblasSgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<double>(hipblasHandle_t     handle,
+                                                  const int           n,
+                                                  const int           nrhs,
+                                                  double*             A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  int*                ipiv,
+                                                  const hipblasStride strideP,
+                                                  double*             B,
+                                                  const int           ldb,
+                                                  const hipblasStride strideB,
+                                                  int*                info,
+                                                  const int           batchCount)
+{
+    return hipblasDgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasComplex>(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount)
+{
+    return hipblasCgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                const int             n,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* A,
+                                                                const int             lda,
+                                                                const hipblasStride   strideA,
+                                                                int*                  ipiv,
+                                                                const hipblasStride   strideP,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const hipblasStride   strideB,
+                                                                int*                  info,
+                                                                const int             batchCount)
+{
+    return hipblasZgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
 #endif
 
+/////////
+// _64 //
+/////////
+// axpy_64
+template <>
+hipblasStatus_t hipblasAxpy_64<float>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy)
+{
+    return hipblasSaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<double>(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy)
+{
+    return hipblasDaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+// dot_64
+template <>
+hipblasStatus_t hipblasDot_64<float>(hipblasHandle_t handle,
+                                     int64_t         n,
+                                     const float*    x,
+                                     int64_t         incx,
+                                     const float*    y,
+                                     int64_t         incy,
+                                     float*          result)
+{
+    return hipblasSdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<double>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result)
+{
+    return hipblasDdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasComplex>(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasComplex*       result)
+{
+    return hipblasCdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    const hipblasDoubleComplex* y,
+                                                    int64_t                     incy,
+                                                    hipblasDoubleComplex*       result)
+{
+    return hipblasZdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+// gemv_strided_batched_64
+template <>
+hipblasStatus_t hipblasGemvStridedBatched_64<float>(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    int64_t            m,
+                                                    int64_t            n,
+                                                    const float*       alpha,
+                                                    const float*       A,
+                                                    int64_t            lda,
+                                                    hipblasStride      strideA,
+                                                    const float*       x,
+                                                    int64_t            incx,
+                                                    hipblasStride      stridex,
+                                                    const float*       beta,
+                                                    float*             y,
+                                                    int64_t            incy,
+                                                    hipblasStride      stridey,
+                                                    int64_t            batch_count)
+{
+    return hipblasSgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         beta,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched_64<double>(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     int64_t            m,
+                                                     int64_t            n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int64_t            lda,
+                                                     hipblasStride      strideA,
+                                                     const double*      x,
+                                                     int64_t            incx,
+                                                     hipblasStride      stridex,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int64_t            incy,
+                                                     hipblasStride      stridey,
+                                                     int64_t            batch_count)
+{
+    return hipblasDgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         beta,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched_64<hipblasComplex>(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batch_count)
+{
+    return hipblasCgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         beta,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                   hipblasOperation_t          transA,
+                                                                   int64_t                     m,
+                                                                   int64_t                     n,
+                                                                   const hipblasDoubleComplex* alpha,
+                                                                   const hipblasDoubleComplex* A,
+                                                                   int64_t                     lda,
+                                                                   hipblasStride               strideA,
+                                                                   const hipblasDoubleComplex* x,
+                                                                   int64_t                     incx,
+                                                                   hipblasStride               stridex,
+                                                                   const hipblasDoubleComplex* beta,
+                                                                   hipblasDoubleComplex*       y,
+                                                                   int64_t                     incy,
+                                                                   hipblasStride               stridey,
+                                                                   int64_t                     batch_count)
+{
+    return hipblasZgemvStridedBatched_64(handle,
+                                         transA,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         beta,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         batch_count);
+}
+
+// ger_64
+template <>
+hipblasStatus_t hipblasGer_64<float, false>(hipblasHandle_t handle,
+                                            int64_t         m,
+                                            int64_t         n,
+                                            const float*    alpha,
+                                            const float*    x,
+                                            int64_t         incx,
+                                            const float*    y,
+                                            int64_t         incy,
+                                            float*          A,
+                                            int64_t         lda)
+{
+    return hipblasSger_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer_64<double, false>(hipblasHandle_t handle,
+                                             int64_t         m,
+                                             int64_t         n,
+                                             const double*   alpha,
+                                             const double*   x,
+                                             int64_t         incx,
+                                             const double*   y,
+                                             int64_t         incy,
+                                             double*         A,
+                                             int64_t         lda)
+{
+    return hipblasDger_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer_64<hipblasComplex, false>(hipblasHandle_t       handle,
+                                                     int64_t               m,
+                                                     int64_t               n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int64_t               incx,
+                                                     const hipblasComplex* y,
+                                                     int64_t               incy,
+                                                     hipblasComplex*       A,
+                                                     int64_t               lda)
+{
+    return hipblasCgeru_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer_64<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                    int64_t               m,
+                                                    int64_t               n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int64_t               incx,
+                                                    const hipblasComplex* y,
+                                                    int64_t               incy,
+                                                    hipblasComplex*       A,
+                                                    int64_t               lda)
+{
+    return hipblasCgerc_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer_64<hipblasDoubleComplex, false>(hipblasHandle_t             handle,
+                                                           int64_t                     m,
+                                                           int64_t                     n,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           const hipblasDoubleComplex* x,
+                                                           int64_t                     incx,
+                                                           const hipblasDoubleComplex* y,
+                                                           int64_t                     incy,
+                                                           hipblasDoubleComplex*       A,
+                                                           int64_t                     lda)
+{
+    return hipblasZgeru_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer_64<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                          int64_t                     m,
+                                                          int64_t                     n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int64_t                     incx,
+                                                          const hipblasDoubleComplex* y,
+                                                          int64_t                     incy,
+                                                          hipblasDoubleComplex*       A,
+                                                          int64_t                     lda)
+{
+    return hipblasZgerc_64(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+// gemm_64
+template <>
+hipblasStatus_t hipblasGemm_64<float>(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       B,
+                                      int64_t            ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int64_t            ldc)
+{
+    return hipblasSgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<double>(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      B,
+                                       int64_t            ldb,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+{
+    return hipblasDgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* B,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc)
+{
+    return hipblasCgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int64_t                     m,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     const hipblasDoubleComplex* B,
+                                                     int64_t                     ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc)
+{
+    return hipblasZgemm_64(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// syrk_64
+template <>
+hipblasStatus_t hipblasSyrk_64<float>(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int64_t            lda,
+                                      const float*       beta,
+                                      float*             C,
+                                      int64_t            ldc)
+{
+    return hipblasSsyrk_64(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyrk_64<double>(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const double*      alpha,
+                                       const double*      A,
+                                       int64_t            lda,
+                                       const double*      beta,
+                                       double*            C,
+                                       int64_t            ldc)
+{
+    return hipblasDsyrk_64(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyrk_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc)
+{
+    return hipblasCsyrk_64(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyrk_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int64_t                     n,
+                                                     int64_t                     k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int64_t                     lda,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int64_t                     ldc)
+{
+    return hipblasZsyrk_64(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
 /////////////
 // FORTRAN //
 /////////////
@@ -127,25 +127,32 @@ hipblasLocalHandle::hipblasLocalHandle()
 hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
     : hipblasLocalHandle()
 {
-    // for future customization of handle based on arguments, example from rocblas below
+    hipStream_t stream = arg.stream;
 
-    /*
-    auto status = rocblas_set_atomics_mode(m_handle, arg.atomics_mode);
+    // The null stream cannot be captured into a graph
+    if(!stream && arg.graph)
+    {
+        if(hipStreamCreate(&m_stream) != hipSuccess)
+            throw std::runtime_error("hipStreamCreate failed");
+        stream = m_stream;
+    }
 
-    if(status == rocblas_status_success)
+    if(stream)
     {
-        // If the test specifies user allocated workspace, allocate and use it
-        if(arg.user_allocated_workspace)
-        {
-            if((hipMalloc)(&m_memory, arg.user_allocated_workspace) != hipSuccess)
-                throw std::bad_alloc();
-            status = rocblas_set_workspace(m_handle, m_memory, arg.user_allocated_workspace);
-        }
+        auto status = hipblasSetStream(m_handle, stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
     }
 
-    if(status != rocblas_status_success)
-        throw std::runtime_error(rocblas_status_to_string(status));
-    */
+    // If the test specifies user allocated workspace, allocate and use it
+    if(arg.user_allocated_workspace)
+    {
+        if((hipMalloc)(&m_memory, arg.user_allocated_workspace) != hipSuccess)
+            throw std::bad_alloc();
+        auto status = hipblasSetWorkspace(m_handle, m_memory, arg.user_allocated_workspace);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
 }
 
 hipblasLocalHandle::~hipblasLocalHandle()
@@ -153,6 +160,8 @@ hipblasLocalHandle::~hipblasLocalHandle()
     if(m_memory)
         (hipFree)(m_memory);
     hipblasDestroy(m_handle);
+    if(m_stream)
+        hipStreamDestroy(m_stream);
 }
 
 #ifdef __cplusplus
@@ -3,7 +3,13 @@
  *
  * ************************************************************************ */
 
+#include "testing_coalescing.hpp"
 #include "testing_exceptions.hpp"
+#include "testing_graph.hpp"
+#include "testing_handle_counters.hpp"
+#include "testing_handle_pool.hpp"
+#include "testing_pointer_array_cache.hpp"
+#include "testing_workspace_cache.hpp"
 #include "utility.h"
 #include <math.h>
 #include <stdexcept>
@@ -29,4 +35,46 @@ namespace
         EXPECT_EQ(testing_handle(), HIPBLAS_STATUS_SUCCESS);
     }
 
+    TEST(hipblas_auxiliary, handlePool)
+    {
+        EXPECT_EQ(testing_handle_pool(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, handleCounters)
+    {
+        EXPECT_EQ(testing_handle_counters(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, handleCountersSyr2k)
+    {
+        EXPECT_EQ(testing_handle_counters_syr2k(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, graph)
+    {
+        EXPECT_EQ(testing_graph(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, coalescing)
+    {
+        EXPECT_EQ(testing_coalescing(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, coalescingSync)
+    {
+        EXPECT_EQ(testing_coalescing_sync(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+    TEST(hipblas_auxiliary, pointerArrayCache)
+    {
+        EXPECT_EQ(testing_pointer_array_cache(), HIPBLAS_STATUS_SUCCESS);
+    }
+
+#if defined(__HIP_PLATFORM_SOLVER__) && !defined(__HIP_PLATFORM_NVCC__)
+    TEST(hipblas_auxiliary, workspaceCache)
+    {
+        EXPECT_EQ(testing_workspace_cache(), HIPBLAS_STATUS_SUCCESS);
+    }
+#endif
+
 } // namespace
@@ -7,12 +7,14 @@
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
 #include "testing_axpy.hpp"
+#include "testing_axpy_64.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_copy.hpp"
 #include "testing_copy_batched.hpp"
 #include "testing_copy_strided_batched.hpp"
 #include "testing_dot.hpp"
+#include "testing_dot_64.hpp"
 #include "testing_dot_batched.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_iamax_iamin.hpp"
@@ -200,6 +202,28 @@ TEST_P(blas1_gtest, axpy_float)
     }
 }
 
+TEST_P(blas1_gtest, axpy_64_float)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_axpy_64<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(!arg.incx || !arg.incy)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 TEST_P(blas1_gtest, axpy_float_complex)
 {
     Arguments       arg    = setup_blas1_arguments(GetParam());
@@ -222,7 +246,27 @@ TEST_P(blas1_gtest, axpy_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+TEST_P(blas1_gtest, axpy_64_float_complex)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_axpy_64<hipblasComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(!arg.incx || !arg.incy)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
 
 // axpy_batched
 TEST_P(blas1_gtest, axpy_batched_float)
@@ -330,8 +374,6 @@ TEST_P(blas1_gtest, axpy_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // copy tests
 TEST_P(blas1_gtest, copy_float)
 {
@@ -377,8 +419,6 @@ TEST_P(blas1_gtest, copy_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // copy_batched tests
 TEST_P(blas1_gtest, copy_batched_float)
 {
@@ -485,8 +525,6 @@ TEST_P(blas1_gtest, copy_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // scal tests
 TEST_P(blas1_gtest, scal_float)
 {
@@ -567,8 +605,6 @@ TEST_P(blas1_gtest, scal_float_complex_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // scal_batched tests
 TEST_P(blas1_gtest, scal_batched_float)
 {
@@ -757,8 +793,6 @@ TEST_P(blas1_gtest, scal_strided_batched_float_complex_float)
     }
 }
 
-#endif
-
 // swap tests
 TEST_P(blas1_gtest, swap_float)
 {
@@ -804,8 +838,6 @@ TEST_P(blas1_gtest, swap_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // swap_batched tests
 TEST_P(blas1_gtest, swap_batched_float)
 {
@@ -912,8 +944,6 @@ TEST_P(blas1_gtest, swap_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // dot tests
 #ifndef __HIP_PLATFORM_NVCC__
 TEST_P(blas1_gtest, dot_half)
@@ -1009,6 +1039,36 @@ TEST_P(blas1_gtest, dot_float)
     }
 }
 
+TEST_P(blas1_gtest, dot_64_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_dot_64<float>(arg);
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incx < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incy < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
 TEST_P(blas1_gtest, dotu_float_complex)
 {
     Arguments       arg    = setup_blas1_arguments(GetParam());
@@ -1035,6 +1095,32 @@ TEST_P(blas1_gtest, dotu_float_complex)
     }
 }
 
+TEST_P(blas1_gtest, dotu_64_float_complex)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_dot_64<hipblasComplex>(arg);
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incx < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incy < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 TEST_P(blas1_gtest, dotc_float_complex)
 {
     Arguments       arg    = setup_blas1_arguments(GetParam());
@@ -1061,9 +1147,8 @@ TEST_P(blas1_gtest, dotc_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // dot_batched tests
+#ifndef __HIP_PLATFORM_NVCC__
 TEST_P(blas1_gtest, dot_batched_half)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -1134,6 +1219,8 @@ TEST_P(blas1_gtest, dot_batched_bfloat16)
     }
 }
 
+#endif
+
 TEST_P(blas1_gtest, dot_batched_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -1229,6 +1316,7 @@ TEST_P(blas1_gtest, dotc_batched_float_complex)
 }
 
 // dot_strided_batched tests
+#ifndef __HIP_PLATFORM_NVCC__
 TEST_P(blas1_gtest, dot_strided_batched_half)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -1299,6 +1387,8 @@ TEST_P(blas1_gtest, dot_strided_batched_bfloat16)
     }
 }
 
+#endif
+
 TEST_P(blas1_gtest, dot_strided_batched_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -1393,8 +1483,6 @@ TEST_P(blas1_gtest, dotc_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // nrm2 tests
 TEST_P(blas1_gtest, nrm2_float)
 {
@@ -1448,8 +1536,6 @@ TEST_P(blas1_gtest, nrm2_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // nrm2_batched tests
 TEST_P(blas1_gtest, nrm2_batched_float)
 {
@@ -1572,8 +1658,6 @@ TEST_P(blas1_gtest, nrm2_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // rot
 TEST_P(blas1_gtest, rot_float)
 {
@@ -1620,8 +1704,6 @@ TEST_P(blas1_gtest, rot_float_complex_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // rot_batched
 TEST_P(blas1_gtest, rot_batched_float)
 {
@@ -1756,8 +1838,6 @@ TEST_P(blas1_gtest, rot_strided_batched_float_complex_float)
     }
 }
 
-#endif
-
 // rotg
 TEST_P(blas1_gtest, rotg_float)
 {
@@ -1781,8 +1861,6 @@ TEST_P(blas1_gtest, rotg_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // rotg_batched
 TEST_P(blas1_gtest, rotg_batched_float)
 {
@@ -1857,8 +1935,6 @@ TEST_P(blas1_gtest, rotg_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // rotm
 TEST_P(blas1_gtest, rotm_float)
 {
@@ -1871,8 +1947,6 @@ TEST_P(blas1_gtest, rotm_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // rotm_batched
 TEST_P(blas1_gtest, rotm_batched_float)
 {
@@ -1911,8 +1985,6 @@ TEST_P(blas1_gtest, rotm_strided_batched_float)
     }
 }
 
-#endif
-
 // rotmg
 TEST_P(blas1_gtest, rotmg_float)
 {
@@ -1925,8 +1997,6 @@ TEST_P(blas1_gtest, rotmg_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // rotmg_batched
 TEST_P(blas1_gtest, rotmg_batched_float)
 {
@@ -1965,8 +2035,6 @@ TEST_P(blas1_gtest, rotmg_strided_batched_float)
     }
 }
 
-#endif
-
 // asum
 TEST_P(blas1_gtest, asum_float)
 {
@@ -2038,8 +2106,6 @@ TEST_P(blas1_gtest, asum_double_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // asum_batched
 TEST_P(blas1_gtest, asum_batched_float)
 {
@@ -2198,8 +2264,6 @@ TEST_P(blas1_gtest, asum_strided_batched_double_complex)
     }
 }
 
-#endif
-
 // amax
 TEST_P(blas1_gtest, amax_float)
 {
@@ -2229,8 +2293,6 @@ TEST_P(blas1_gtest, amax_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // amax_batched
 TEST_P(blas1_gtest, amax_batched_float)
 {
@@ -2305,8 +2367,6 @@ TEST_P(blas1_gtest, amax_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // amin
 TEST_P(blas1_gtest, amin_float)
 {
@@ -2326,8 +2386,6 @@ TEST_P(blas1_gtest, amin_float_complex)
     EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // amin_batched
 TEST_P(blas1_gtest, amin_batched_float)
 {
@@ -2402,8 +2460,6 @@ TEST_P(blas1_gtest, amin_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // Values is for a single item; ValuesIn is for an array
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
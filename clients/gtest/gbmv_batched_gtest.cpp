@@ -143,8 +143,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(gbmv_gtest_batched, gbmv_gtest_float)
 {
     Arguments arg = setup_gbmv_arguments(GetParam());
@@ -187,8 +185,6 @@ TEST_P(gbmv_gtest_batched, gbmv_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
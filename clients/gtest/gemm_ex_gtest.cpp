@@ -4,6 +4,9 @@
 
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_tune.hpp"
+#include "testing_gemm_grouped_batched_ex.hpp"
+#include "testing_gemm_post_op_ex.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "utility.h"
 #include <math.h>
@@ -459,6 +462,132 @@ TEST_P(parameterized_gemm_batched_ex, standard_strided_batched)
     }
 }
 
+TEST_P(parameterized_gemm_batched_ex, standard_grouped_batched)
+{
+    // Groups of the shape of the arguments and of shapes derived from it, checked
+    // against one cblas_gemm per matrix
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_grouped_batched_ex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA_option == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB_option == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(status == HIPBLAS_STATUS_ARCH_MISMATCH)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_ARCH_MISMATCH, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+    }
+}
+
+TEST_P(parameterized_gemm_ex, post_op)
+{
+    // Every activation with a bias, a scale and an aux output, checked against
+    // cblas_gemm_post_op
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_post_op_ex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA_option == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB_option == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            // the post-op is not run for complex and integer types
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+    }
+}
+
+TEST_P(parameterized_gemm_ex, tune)
+{
+    // hipblasGemmExTune, then hipblasGemmEx with the solution it recorded
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_tune(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA_option == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB_option == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            // no solutions to choose from
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+    }
+}
+
+TEST_P(parameterized_gemm_batched_ex, strided_batched_post_op)
+{
+    // Every activation with a bias, a scale and an aux output per matrix, checked
+    // against cblas_gemm_post_op
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_strided_batched_post_op_ex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA_option == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB_option == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            // the post-op is not run for complex and integer types
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+    }
+}
+
 // TODO: Disabling some gemm int8 tests as not supported by rocBLAS for all architectures
 // class parameterized_chunk_gemm_ex : public ::TestWithParam<gemm_ex_tuple>
 // {
@@ -141,8 +141,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(gemv_gtest_batched, gemv_gtest_float)
 {
     Arguments arg = setup_gemv_arguments(GetParam());
@@ -211,8 +209,6 @@ TEST_P(gemv_gtest_batched, gemv_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
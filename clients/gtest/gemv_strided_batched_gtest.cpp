@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_gemv_strided_batched.hpp"
+#include "testing_gemv_strided_batched_64.hpp"
 #include "utility.h"
 #include <math.h>
 #include <stdexcept>
@@ -152,8 +153,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(gemv_gtest_strided_batched, gemv_gtest_float)
 {
     Arguments arg = setup_gemv_arguments(GetParam());
@@ -224,7 +223,71 @@ TEST_P(gemv_gtest_strided_batched, gemv_gtest_float_complex)
     }
 }
 
-#endif
+TEST_P(gemv_gtest_strided_batched, gemv_64_gtest_float)
+{
+    Arguments arg = setup_gemv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemv_strided_batched_64<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.lda < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incx <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incy <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+    }
+}
+
+TEST_P(gemv_gtest_strided_batched, gemv_64_gtest_float_complex)
+{
+    Arguments arg = setup_gemv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemv_strided_batched_64<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.lda < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incx <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.incy <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+    }
+}
 
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
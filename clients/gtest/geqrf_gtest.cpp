@@ -57,8 +57,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(geqrf_gtest, geqrf_gtest_float)
 {
     // GetParam returns a tuple. The setup routine unpacks the tuple
@@ -147,8 +145,6 @@ TEST_P(geqrf_gtest, geqrf_gtest_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a vector,
 // ValuesIn takes each element (a vector), combines them, and feeds them to test_p
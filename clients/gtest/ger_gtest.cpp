@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_ger.hpp"
+#include "testing_ger_64.hpp"
 #include "testing_ger_batched.hpp"
 #include "testing_ger_strided_batched.hpp"
 #include "utility.h"
@@ -202,7 +203,56 @@ TEST_P(blas2_ger_gtest, gerc_gtest_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+// ger_64
+TEST_P(blas2_ger_gtest, ger_64_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_ger_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ger_64<float, false>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < arg.M || arg.incx <= 0 || arg.incy <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_ger_gtest, gerc_64_gtest_float_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_ger_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ger_64<hipblasComplex, true>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < arg.M || arg.incx <= 0 || arg.incy <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
 
 // ger_batched
 TEST_P(blas2_ger_gtest, ger_batched_gtest_float)
@@ -362,8 +412,6 @@ TEST_P(blas2_ger_gtest, gerc_strided_batched_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesv_mixed.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, double, int> gesv_mixed_tuple;
+
+// {N, nrhs, lda, ldb, ldx}
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1, 1, 1},
+                                               {10, -1, 10, 10, 10},
+                                               {10, 2, 20, 100, 30},
+                                               {0, 1, 1, 1, 1},
+                                               {500, 1, 600, 600, 500},
+                                               {1024, 3, 1024, 1024, 1024}};
+
+const vector<double> stride_scale_range = {2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_gesv_mixed_arguments(gesv_mixed_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    double      stride_scale = std::get<1>(tup);
+    int         batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class gesv_mixed_gtest : public ::TestWithParam<gesv_mixed_tuple>
+{
+protected:
+    gesv_mixed_gtest() {}
+    virtual ~gesv_mixed_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+static bool gesv_mixed_invalid(const Arguments& arg, bool batched)
+{
+    return arg.N < 0 || arg.K < 0 || arg.lda < arg.N || arg.ldb < arg.N || arg.ldc < arg.N
+           || (batched && arg.batch_count < 0);
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, false))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, false))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_batched_gtest_double)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, true))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, true))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_strided_batched_gtest_double)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, true))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gesv_mixed_gtest, gesv_mixed_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gesv_mixed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesv_mixed_strided_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(gesv_mixed_invalid(arg, true))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {N, nrhs, lda, ldb, ldx}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasGesvMixed,
+                         gesv_mixed_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
@@ -61,8 +61,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(getrf_gtest, getrf_gtest_float)
 {
     // GetParam returns a tuple. The setup routine unpacks the tuple
@@ -239,8 +237,6 @@ TEST_P(getrf_gtest, getrf_npvt_gtest_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a vector,
 // ValuesIn takes each element (a vector), combines them, and feeds them to test_p
@@ -166,8 +166,6 @@ TEST_P(hbmv_gtest, hbmv_gtest_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(hbmv_gtest, hbmv_gtest_batched_float_complex)
 {
     Arguments arg = setup_hbmv_arguments(GetParam());
@@ -208,8 +206,6 @@ TEST_P(hbmv_gtest, hbmv_gtest_strided_batched_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -140,8 +140,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(hemv_gtest_batched, hemv_gtest_float_complex)
 {
     Arguments arg = setup_hemv_arguments(GetParam());
@@ -163,8 +161,6 @@ TEST_P(hemv_gtest_batched, hemv_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
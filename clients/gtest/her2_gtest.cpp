@@ -173,8 +173,6 @@ TEST_P(blas2_her2_gtest, her2_gtest_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // her2_batched
 TEST_P(blas2_her2_gtest, her2_batched_gtest_float)
 {
@@ -277,8 +275,6 @@ TEST_P(blas2_her2_gtest, her2_strided_batched_gtest_double)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
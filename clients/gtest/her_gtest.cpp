@@ -171,8 +171,6 @@ TEST_P(blas2_her_gtest, her_gtest_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // her_batched
 TEST_P(blas2_her_gtest, her_batched_gtest_float)
 {
@@ -275,8 +273,6 @@ TEST_P(blas2_her_gtest, her_strided_batched_gtest_double)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -178,8 +178,6 @@ TEST_P(blas2_herk_gtest, herk_gtest_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // herk_batched
 TEST_P(blas2_herk_gtest, herk_batched_gtest_float)
 {
@@ -290,8 +288,6 @@ TEST_P(blas2_herk_gtest, herk_strided_batched_gtest_double)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -164,8 +164,6 @@ TEST_P(hpmv_gtest, hpmv_gtest_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(hpmv_gtest, hpmv_batched_gtest_float_complex)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -216,8 +214,6 @@ TEST_P(hpmv_gtest, hpmv_strided_batched_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
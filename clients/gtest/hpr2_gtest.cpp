@@ -172,8 +172,6 @@ TEST_P(blas2_hpr2_gtest, hpr2_gtest_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // hpr2_batched
 TEST_P(blas2_hpr2_gtest, hpr2_batched_gtest_float)
 {
@@ -276,8 +274,6 @@ TEST_P(blas2_hpr2_gtest, hpr2_strided_batched_gtest_double)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
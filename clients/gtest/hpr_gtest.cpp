@@ -153,8 +153,6 @@ TEST_P(blas2_hpr_gtest, hpr_gtest_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // hpr_batched
 TEST_P(blas2_hpr_gtest, hpr_batched_gtest_float)
 {
@@ -257,8 +255,6 @@ TEST_P(blas2_hpr_gtest, hpr_strided_batched_gtest_double)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -178,8 +178,6 @@ TEST_P(blas2_sbmv_gtest, sbmv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_sbmv_gtest, sbmv_batched_float)
 {
     Arguments arg = setup_sbmv_arguments(GetParam());
@@ -220,8 +218,6 @@ TEST_P(blas2_sbmv_gtest, sbmv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
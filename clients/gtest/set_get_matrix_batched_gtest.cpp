@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_set_get_matrix_batched.hpp"
+#include "testing_set_get_matrix_strided_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, double, int> set_get_matrix_batched_tuple;
+
+// {M, N}: small matrices, several slots of them, and matrices larger than a slot
+const vector<vector<int>> rows_cols_range = {{-1, 1}, {3, 30}, {16, 16}, {64, 64}};
+
+const vector<vector<int>> rows_cols_large_range = {{1100, 1000}};
+
+// {lda, ldb, ldc} relative to M: packed, and padded on either side
+const vector<vector<int>> ld_pad_range = {{0, 0, 0}, {0, 3, 5}, {5, 0, 3}};
+
+// A stride_scale of 1 leaves packed device matrices without gaps between them
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 600};
+
+Arguments setup_set_get_matrix_batched_arguments(set_get_matrix_batched_tuple tup)
+{
+    vector<int> rows_cols    = std::get<0>(tup);
+    vector<int> ld_pad       = std::get<1>(tup);
+    double      stride_scale = std::get<2>(tup);
+    int         batch_count  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.M = rows_cols[0];
+    arg.N = rows_cols[1];
+
+    arg.lda = arg.M + ld_pad[0];
+    arg.ldb = arg.M + ld_pad[1];
+    arg.ldc = arg.M + ld_pad[2];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class set_get_matrix_batched_gtest : public ::TestWithParam<set_get_matrix_batched_tuple>
+{
+protected:
+    set_get_matrix_batched_gtest() {}
+    virtual ~set_get_matrix_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+bool set_get_matrix_batched_invalid(const Arguments& arg)
+{
+    int64_t min_ld = std::max<int64_t>(1, arg.M);
+    return arg.M < 0 || arg.N < 0 || arg.lda < min_ld || arg.ldb < min_ld || arg.ldc < min_ld
+           || arg.batch_count < 0;
+}
+
+TEST_P(set_get_matrix_batched_gtest, batched_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_batched_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(set_get_matrix_batched_gtest, batched_double_complex)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_batched_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(set_get_matrix_batched_gtest, strided_batched_float)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_batched_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(set_get_matrix_batched_gtest, strided_batched_double_complex)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_strided_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_batched_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are { {M, N}, {lda, ldb, ldc} - M, stride_scale, batch_count }
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_small,
+                         set_get_matrix_batched_gtest,
+                         Combine(ValuesIn(rows_cols_range),
+                                 ValuesIn(ld_pad_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_large,
+                         set_get_matrix_batched_gtest,
+                         Combine(ValuesIn(rows_cols_large_range),
+                                 ValuesIn(ld_pad_range),
+                                 Values(1.0),
+                                 Values(3)));
@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_set_get_matrix_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, hipblasDatatype_t> set_get_matrix_ex_tuple;
+
+// {M, N}: matrices within a staging chunk, and larger than one
+const vector<vector<int>> rows_cols_range = {{-1, 1}, {0, 5}, {3, 30}, {600, 500}, {1100, 2000}};
+
+// {lda, ldb, ldc} relative to M: packed, and padded on either side
+const vector<vector<int>> ld_pad_range = {{0, 0, 0}, {0, 3, 5}, {5, 0, 3}};
+
+// Device types narrower than float, converted on the host, and wider, converted
+// on the device
+const vector<hipblasDatatype_t> dev_type_range
+    = {HIPBLAS_R_16F, HIPBLAS_R_16B, HIPBLAS_R_8I, HIPBLAS_R_32F, HIPBLAS_R_64F};
+
+Arguments setup_set_get_matrix_ex_arguments(set_get_matrix_ex_tuple tup)
+{
+    vector<int>       rows_cols = std::get<0>(tup);
+    vector<int>       ld_pad    = std::get<1>(tup);
+    hipblasDatatype_t dev_type  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M = rows_cols[0];
+    arg.N = rows_cols[1];
+
+    arg.lda = arg.M + ld_pad[0];
+    arg.ldb = arg.M + ld_pad[1];
+    arg.ldc = arg.M + ld_pad[2];
+
+    arg.b_type = dev_type;
+
+    return arg;
+}
+
+class set_get_matrix_ex_gtest : public ::TestWithParam<set_get_matrix_ex_tuple>
+{
+protected:
+    set_get_matrix_ex_gtest() {}
+    virtual ~set_get_matrix_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+bool set_get_matrix_ex_invalid(const Arguments& arg)
+{
+    int64_t min_ld = std::max<int64_t>(1, arg.M);
+    return arg.M < 0 || arg.N < 0 || arg.lda < min_ld || arg.ldb < min_ld || arg.ldc < min_ld;
+}
+
+TEST_P(set_get_matrix_ex_gtest, float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_set_get_matrix_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_ex<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_ex_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(set_get_matrix_ex_gtest, double)
+{
+    Arguments arg = setup_set_get_matrix_ex_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_ex<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(set_get_matrix_ex_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are { {M, N}, {lda, ldb, ldc} - M, device type }
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary,
+                         set_get_matrix_ex_gtest,
+                         Combine(ValuesIn(rows_cols_range),
+                                 ValuesIn(ld_pad_range),
+                                 ValuesIn(dev_type_range)));
@@ -67,6 +67,18 @@ const vector<vector<int>> lda_ldb_ldc_range = {{3, 3, 3},
                                                {5, 5, 4},
                                                {5, 5, 5}};
 
+// large sizes, with padded host matrices that are copied through pinned staging
+// memory: several chunks of whole columns, and long columns split across chunks
+
+const vector<vector<int>> rows_cols_staged_range = {{1500, 3000}};
+
+const vector<vector<int>> lda_ldb_ldc_staged_range = {{1600, 1500, 1500}, {1600, 1700, 1600}};
+
+const vector<vector<int>> rows_cols_long_range = {{2200000, 3}};
+
+const vector<vector<int>> lda_ldb_ldc_long_range = {{2200016, 2200032, 2200000},
+                                                    {2200016, 2200000, 2200032}};
+
 const bool is_fortran[] = {false, true};
 
 /* ===============Google Unit Test==================================================== */
@@ -172,3 +184,15 @@ INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_small,
                          Combine(ValuesIn(rows_cols_range),
                                  ValuesIn(lda_ldb_ldc_range),
                                  ValuesIn(is_fortran)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_staged,
+                         set_matrix_get_matrix_gtest,
+                         Combine(ValuesIn(rows_cols_staged_range),
+                                 ValuesIn(lda_ldb_ldc_staged_range),
+                                 Values(false)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_long,
+                         set_matrix_get_matrix_gtest,
+                         Combine(ValuesIn(rows_cols_long_range),
+                                 ValuesIn(lda_ldb_ldc_long_range),
+                                 Values(false)));
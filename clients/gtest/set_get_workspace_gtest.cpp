@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#ifdef GOOGLE_TEST
+#include <gtest/gtest.h>
+#endif
+#include <stdexcept>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_workspace:
+=================================================================== */
+
+TEST(hipblas_set_workspace, hipblas_get_workspace_size)
+{
+    const size_t bytes = size_t(1) << 20;
+    size_t       size  = 0;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    void* workspace = nullptr;
+    ASSERT_EQ(hipMalloc(&workspace, bytes), hipSuccess);
+
+    EXPECT_EQ(hipblasSetWorkspace(nullptr, workspace, bytes), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetWorkspace(handle, nullptr, bytes), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasStatus_t status = hipblasSetWorkspace(handle, workspace, bytes);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    status = hipblasGetWorkspaceSize(handle, &size);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_GE(size, bytes);
+
+    // A call runs with the workspace of the application
+    const int   n        = 64;
+    const float alpha    = 1.0f, beta = 0.0f;
+    float*      matrices = nullptr;
+    ASSERT_EQ(hipMalloc(&matrices, sizeof(float) * n * n * 3), hipSuccess);
+    ASSERT_EQ(hipMemset(matrices, 0, sizeof(float) * n * n * 3), hipSuccess);
+    status = hipblasSgemm(handle,
+                          HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          n,
+                          n,
+                          n,
+                          &alpha,
+                          matrices,
+                          n,
+                          matrices + n * n,
+                          n,
+                          &beta,
+                          matrices + 2 * n * n,
+                          n);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    // Back to the workspace hipBLAS allocates
+    status = hipblasSetWorkspace(handle, nullptr, 0);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    hipblasDestroy(handle);
+    hipFree(matrices);
+    hipFree(workspace);
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+// A solver call needing more workspace than the application gave fails, and the workspace
+// size then reported is enough for it
+TEST(hipblas_set_workspace, hipblas_workspace_too_small)
+{
+    const size_t bytes = 64;
+    const int    n     = 512;
+    size_t       size  = 0;
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    void*  workspace = nullptr;
+    float* A         = nullptr;
+    int*   ipiv      = nullptr;
+    int    info      = 0;
+    ASSERT_EQ(hipMalloc(&workspace, bytes), hipSuccess);
+    ASSERT_EQ(hipMalloc(&A, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&ipiv, sizeof(int) * n), hipSuccess);
+    ASSERT_EQ(hipMemset(A, 0, sizeof(float) * n * n), hipSuccess);
+
+    hipblasStatus_t status = hipblasSetWorkspace(handle, workspace, bytes);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+        // The solvers of the CUDA backend run on scratch memory of hipBLAS' own
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+#else
+        EXPECT_EQ(hipblasSgetrf(handle, n, A, n, ipiv, &info), HIPBLAS_STATUS_ALLOC_FAILED);
+
+        EXPECT_EQ(hipblasGetWorkspaceSize(handle, &size), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_GT(size, bytes);
+
+        void* larger = nullptr;
+        ASSERT_EQ(hipMalloc(&larger, size), hipSuccess);
+        EXPECT_EQ(hipblasSetWorkspace(handle, larger, size), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasSgetrf(handle, n, A, n, ipiv, &info), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(hipblasSetWorkspace(handle, nullptr, 0), HIPBLAS_STATUS_SUCCESS);
+        hipFree(larger);
+#endif
+    }
+
+    hipblasDestroy(handle);
+    hipFree(ipiv);
+    hipFree(A);
+    hipFree(workspace);
+
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        GTEST_SKIP() << "the backend does not run solvers on the application's workspace";
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+}
+#endif
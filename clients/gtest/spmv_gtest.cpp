@@ -176,8 +176,6 @@ TEST_P(blas2_spmv_gtest, spmv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_spmv_gtest, spmv_batched_float)
 {
     Arguments arg = setup_spmv_arguments(GetParam());
@@ -218,8 +216,6 @@ TEST_P(blas2_spmv_gtest, spmv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
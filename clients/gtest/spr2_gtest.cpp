@@ -139,8 +139,6 @@ TEST_P(blas2_spr2_gtest, spr2_gtest_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // spr2_batched
 TEST_P(blas2_spr2_gtest, spr2_batched_gtest_float)
 {
@@ -193,8 +191,6 @@ TEST_P(blas2_spr2_gtest, spr2_strided_batched_gtest_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -127,8 +127,6 @@ TEST_P(blas2_spr_gtest, spr_gtest_float)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_spr_gtest, spr_gtest_float_complex)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -256,8 +254,6 @@ TEST_P(blas2_spr_gtest, spr_strided_batched_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
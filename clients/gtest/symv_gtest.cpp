@@ -177,8 +177,6 @@ TEST_P(blas2_symv_gtest, symv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_symv_gtest, symv_batched_float)
 {
     Arguments arg = setup_symv_arguments(GetParam());
@@ -219,8 +217,6 @@ TEST_P(blas2_symv_gtest, symv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -165,8 +165,6 @@ TEST_P(blas2_syr2_gtest, syr2_gtest_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // syr2_batched
 TEST_P(blas2_syr2_gtest, syr2_batched_gtest_float)
 {
@@ -269,8 +267,6 @@ TEST_P(blas2_syr2_gtest, syr2_strided_batched_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
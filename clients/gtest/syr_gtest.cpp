@@ -173,8 +173,6 @@ TEST_P(blas2_syr_gtest, syr_gtest_float_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 // syr_batched
 TEST_P(blas2_syr_gtest, syr_batched_gtest_float)
 {
@@ -281,8 +279,6 @@ TEST_P(blas2_syr_gtest, syr_strided_batched_gtest_float_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
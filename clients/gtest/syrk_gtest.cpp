@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_syrk.hpp"
+#include "testing_syrk_64.hpp"
 #include "testing_syrk_batched.hpp"
 #include "testing_syrk_strided_batched.hpp"
 #include "utility.h"
@@ -180,7 +181,35 @@ TEST_P(blas3_syrk_gtest, syrk_gtest_double_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
+// syrk_64
+TEST_P(blas3_syrk_gtest, syrk_64_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_syrk_arguments(GetParam());
+    if(arg.transA_option == 'C')
+        arg.transA_option = 'T';
+
+    hipblasStatus_t status = testing_syrk_64<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N
+           || (arg.transA_option == 'N' && arg.lda < arg.N)
+           || (arg.transA_option != 'N' && arg.lda < arg.K))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
 
 // syrk_batched
 TEST_P(blas3_syrk_gtest, syrk_batched_gtest_float)
@@ -296,8 +325,6 @@ TEST_P(blas3_syrk_gtest, syrk_strided_batched_gtest_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -167,8 +167,6 @@ TEST_P(blas2_tbsv_gtest, tbsv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_tbsv_gtest, tbsv_batched_float)
 {
     Arguments arg = setup_tbsv_arguments(GetParam());
@@ -209,8 +207,6 @@ TEST_P(blas2_tbsv_gtest, tbsv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
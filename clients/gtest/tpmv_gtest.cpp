@@ -165,8 +165,6 @@ TEST_P(blas2_tpmv_gtest, tpmv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_tpmv_gtest, tpmv_batched_float)
 {
     Arguments arg = setup_tpmv_arguments(GetParam());
@@ -207,8 +205,6 @@ TEST_P(blas2_tpmv_gtest, tpmv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
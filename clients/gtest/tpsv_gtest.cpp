@@ -153,8 +153,6 @@ TEST_P(blas2_tpsv_gtest, tpsv_double_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_tpsv_gtest, tpsv_batched_float)
 {
     Arguments arg = setup_tpsv_arguments(GetParam());
@@ -235,8 +233,6 @@ TEST_P(blas2_tpsv_gtest, tpsv_strided_batched_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
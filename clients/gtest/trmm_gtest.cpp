@@ -214,8 +214,6 @@ TEST_P(trmm_gtest, trmm_gtest_double_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(trmm_gtest, trmm_batched_gtest_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -324,8 +322,6 @@ TEST_P(trmm_gtest, trmm_strided_batched_gtest_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
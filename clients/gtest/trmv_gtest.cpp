@@ -166,8 +166,6 @@ TEST_P(blas2_trmv_gtest, trmv_double)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_trmv_gtest, trmv_batched_float)
 {
     Arguments arg = setup_trmv_arguments(GetParam());
@@ -208,8 +206,6 @@ TEST_P(blas2_trmv_gtest, trmv_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
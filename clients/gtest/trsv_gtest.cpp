@@ -154,8 +154,6 @@ TEST_P(blas2_trsv_gtest, trsv_double_complex)
     }
 }
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(blas2_trsv_gtest, trsv_batched_float)
 {
     Arguments arg = setup_trsv_arguments(GetParam());
@@ -236,8 +234,6 @@ TEST_P(blas2_trsv_gtest, trsv_strided_batched_double_complex)
     }
 }
 
-#endif
-
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
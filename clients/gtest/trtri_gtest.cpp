@@ -100,8 +100,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(trtri_gtest, trtri_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -179,8 +177,6 @@ TEST_P(trtri_gtest, trtri_strided_batched_float)
     }
 }
 
-#endif
-
 // notice we are using vector of vector for matrix size, and vector for uplo, diag
 // ValuesIn take each element (a vector or a char) and combine them and feed them to test_p
 // The combinations are  { {N, lda}, uplo, diag }
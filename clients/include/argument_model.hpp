@@ -7,11 +7,17 @@
 
 #include "hipblas_arguments.hpp"
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace ArgumentLogging
 {
     const double NA_value = -1.0; // invalid for time, GFlop, GB
+
+    // Performance fields of a test beyond its Gflops, GB/s and us
+    using extra_perf = std::vector<std::pair<const char*, double>>;
 }
 
 // ArgumentModel template has a variadic list of argument enums
@@ -33,14 +39,15 @@ class ArgumentModel
     }
 
 public:
-    void log_perf(std::stringstream& name_line,
-                  std::stringstream& val_line,
-                  const Arguments&   arg,
-                  double             gpu_us,
-                  double             gflops,
-                  double             gbytes,
-                  double             norm1,
-                  double             norm2)
+    void log_perf(std::stringstream&                 name_line,
+                  std::stringstream&                 val_line,
+                  const Arguments&                   arg,
+                  double                             gpu_us,
+                  double                             gflops,
+                  double                             gbytes,
+                  double                             norm1,
+                  double                             norm2,
+                  const ArgumentLogging::extra_perf& extra)
     {
         bool has_batch_count = has(e_batch_count, Args...);
         int  batch_count     = has_batch_count ? arg.batch_count : 1;
@@ -57,6 +64,11 @@ public:
         if(val_line.rdbuf()->in_avail())
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
+        for(const auto& field : extra)
+        {
+            name_line << field.first << ",";
+            val_line << field.second << ", ";
+        }
 
         if(arg.unit_check || arg.norm_check)
         {
@@ -69,13 +81,14 @@ public:
     }
 
     template <typename T>
-    void log_args(std::ostream&    str,
-                  const Arguments& arg,
-                  double           gpu_us,
-                  double           gflops,
-                  double           gpu_bytes = 0,
-                  double           norm1     = 0,
-                  double           norm2     = 0)
+    void log_args(std::ostream&                      str,
+                  const Arguments&                   arg,
+                  double                             gpu_us,
+                  double                             gflops,
+                  double                             gpu_bytes = 0,
+                  double                             norm1     = 0,
+                  double                             norm2     = 0,
+                  const ArgumentLogging::extra_perf& extra     = {})
     {
         std::stringstream name_list;
         std::stringstream value_list;
@@ -87,6 +100,11 @@ public:
             delim = ",";
         };
 
+        // Named tests, such as the calls replayed by hipblas-bench --replay,
+        // lead with their name
+        if(arg.name[0])
+            print("name", arg.name);
+
         // Args is a parameter pack of type:   hipblas_argument...
         // The hipblas_argument enum values in Args correspond to the function arguments that
         // will be printed by hipblas_test or hipblas_bench. For example, the function:
@@ -121,8 +139,11 @@ public:
 #endif
 
         if(arg.timing)
-            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2);
+            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2, extra);
 
+        // Tests may run on several threads at once, so keep each pair of lines together
+        static std::mutex           mutex;
+        std::lock_guard<std::mutex> lock(mutex);
         str << name_list.str() << "\n" << value_list.str() << std::endl;
     }
 };
@@ -50,7 +50,7 @@ constexpr double asum_gbyte_count(int n)
 
 /* \brief byte counts of AXPY */
 template <typename T>
-constexpr double axpy_gbyte_count(int n)
+constexpr double axpy_gbyte_count(int64_t n)
 {
     return (sizeof(T) * 3.0 * n) / 1e9;
 }
@@ -64,7 +64,7 @@ constexpr double copy_gbyte_count(int n)
 
 /* \brief byte counts of DOT */
 template <typename T>
-constexpr double dot_gbyte_count(int n)
+constexpr double dot_gbyte_count(int64_t n)
 {
     return (sizeof(T) * 2.0 * n) / 1e9;
 }
@@ -132,7 +132,7 @@ inline size_t tri_count(int n)
 
 /* \brief byte counts of GEMV */
 template <typename T>
-constexpr double gemv_gbyte_count(hipblasOperation_t transA, int m, int n)
+constexpr double gemv_gbyte_count(hipblasOperation_t transA, int64_t m, int64_t n)
 {
     return (sizeof(T) * (m * n + 2 * (transA == HIPBLAS_OP_N ? n : m))) / 1e9;
 }
@@ -314,7 +314,7 @@ constexpr double trsv_gbyte_count(int n)
 
 /* \brief byte counts of GEMM */
 template <typename T>
-constexpr double gemm_gbyte_count(int m, int n, int k)
+constexpr double gemm_gbyte_count(int64_t m, int64_t n, int64_t k)
 {
     return (sizeof(T) * (m * k + n * k + m * n)) / 1e9;
 }
@@ -345,7 +345,7 @@ template <typename T>
 constexpr double syr2k_gbyte_count(int n, int k)
 {
     // Read A, B, C, write C
-    return (sizeof(T) * (2 * n * k + 2 * tri_count(n)));
+    return (sizeof(T) * (2 * n * k + 2 * tri_count(n))) / 1e9;
 }
 
 /* \brief byte counts of HERK */
@@ -380,7 +380,7 @@ template <typename T>
 constexpr double dgmm_gbyte_count(int n, int m, int k)
 {
     // read A, read x, write C
-    return (sizeof(T) * (2 * m * n) + (k));
+    return (sizeof(T) * (2.0 * m * n + k)) / 1e9;
 }
 
 /* \brief byte counts of GEAM */
@@ -388,7 +388,7 @@ template <typename T>
 constexpr double geam_gbyte_count(int n, int m)
 {
     // read A, read B, write to C
-    return (sizeof(T) * 3 * m * n);
+    return (sizeof(T) * 3.0 * m * n) / 1e9;
 }
 
 /* \brief byte counts of HEMM */
@@ -396,7 +396,7 @@ template <typename T>
 constexpr double hemm_gbyte_count(int n, int m, int k)
 {
     // read A, B, C, write C
-    return (sizeof(T) * (3 * m * n + tri_count(k)));
+    return (sizeof(T) * (3.0 * m * n + tri_count(k))) / 1e9;
 }
 
 /* \brief byte counts of SYMM */
@@ -404,7 +404,7 @@ template <typename T>
 constexpr double symm_gbyte_count(int n, int m, int k)
 {
     // read A, B, C, write C
-    return (sizeof(T) * (3 * m * n + tri_count(k)));
+    return (sizeof(T) * (3.0 * m * n + tri_count(k))) / 1e9;
 }
 
 /* \brief byte counts of TRTRI */
@@ -412,7 +412,7 @@ template <typename T>
 constexpr double trtri_gbyte_count(int n)
 {
     // read A, write invA
-    return (sizeof(T) * (2 * tri_count(n)));
+    return (sizeof(T) * (2.0 * tri_count(n))) / 1e9;
 }
 
 #endif /* _HIPBLAS_BYTES_H_ */
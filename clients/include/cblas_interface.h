@@ -327,6 +327,28 @@ void cblas_gemm(hipblasOperation_t transA,
                 To*                C,
                 int                ldc);
 
+// gemm followed by the post-op of hipblasGemmPostOpEx, bias, scale and aux
+// being optional
+template <typename Ti, typename To = Ti, typename Tc = To>
+void cblas_gemm_post_op(hipblasOperation_t  transA,
+                        hipblasOperation_t  transB,
+                        int                 m,
+                        int                 n,
+                        int                 k,
+                        Tc                  alpha,
+                        Ti*                 A,
+                        int                 lda,
+                        Ti*                 B,
+                        int                 ldb,
+                        Tc                  beta,
+                        To*                 C,
+                        int                 ldc,
+                        hipblasActivation_t activation,
+                        const To*           bias,
+                        const Tc*           scale,
+                        To*                 aux,
+                        int                 ld_aux);
+
 // hemm
 template <typename T>
 void cblas_hemm(hipblasSideMode_t side,
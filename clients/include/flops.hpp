@@ -44,17 +44,17 @@ constexpr double asum_gflop_count<hipblasDoubleComplex>(int n)
 
 // axpy
 template <typename T>
-constexpr double axpy_gflop_count(int n)
+constexpr double axpy_gflop_count(int64_t n)
 {
     return (2.0 * n) / 1e9;
 }
 template <>
-constexpr double axpy_gflop_count<hipblasComplex>(int n)
+constexpr double axpy_gflop_count<hipblasComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9; // 6 for complex-complex multiply, 2 for c-c add
 }
 template <>
-constexpr double axpy_gflop_count<hipblasDoubleComplex>(int n)
+constexpr double axpy_gflop_count<hipblasDoubleComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9;
 }
@@ -68,27 +68,27 @@ constexpr double copy_gflop_count(int n)
 
 // dot
 template <bool CONJ, typename T>
-constexpr double dot_gflop_count(int n)
+constexpr double dot_gflop_count(int64_t n)
 {
     return (2.0 * n) / 1e9;
 }
 template <>
-constexpr double dot_gflop_count<false, hipblasComplex>(int n)
+constexpr double dot_gflop_count<false, hipblasComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9; // 6 for each c-c multiply, 2 for each c-c add
 }
 template <>
-constexpr double dot_gflop_count<false, hipblasDoubleComplex>(int n)
+constexpr double dot_gflop_count<false, hipblasDoubleComplex>(int64_t n)
 {
     return (8.0 * n) / 1e9;
 }
 template <>
-constexpr double dot_gflop_count<true, hipblasComplex>(int n)
+constexpr double dot_gflop_count<true, hipblasComplex>(int64_t n)
 {
     return (9.0 * n) / 1e9; // regular dot (8n) + 1n for complex conjugate
 }
 template <>
-constexpr double dot_gflop_count<true, hipblasDoubleComplex>(int n)
+constexpr double dot_gflop_count<true, hipblasDoubleComplex>(int64_t n)
 {
     return (9.0 * n) / 1e9;
 }
@@ -290,18 +290,19 @@ constexpr double
 
 /* \brief floating point counts of GEMV */
 template <typename T>
-constexpr double gemv_gflop_count(hipblasOperation_t transA, int m, int n)
+constexpr double gemv_gflop_count(hipblasOperation_t transA, int64_t m, int64_t n)
 {
     return (2.0 * m * n + 2.0 * (transA == HIPBLAS_OP_N ? m : n)) / 1e9;
 }
 template <>
-constexpr double gemv_gflop_count<hipblasComplex>(hipblasOperation_t transA, int m, int n)
+constexpr double gemv_gflop_count<hipblasComplex>(hipblasOperation_t transA, int64_t m, int64_t n)
 {
     return (8.0 * m * n + 6.0 * (transA == HIPBLAS_OP_N ? m : n)) / 1e9;
 }
 
 template <>
-constexpr double gemv_gflop_count<hipblasDoubleComplex>(hipblasOperation_t transA, int m, int n)
+constexpr double
+    gemv_gflop_count<hipblasDoubleComplex>(hipblasOperation_t transA, int64_t m, int64_t n)
 {
     return (8.0 * m * n + 6.0 * (transA == HIPBLAS_OP_N ? m : n)) / 1e9;
 }
@@ -562,19 +563,19 @@ constexpr double syr2_gflop_count<hipblasDoubleComplex>(int n)
 
 /* \brief floating point counts of GEMM */
 template <typename T>
-constexpr double gemm_gflop_count(int m, int n, int k)
+constexpr double gemm_gflop_count(int64_t m, int64_t n, int64_t k)
 {
     return (2.0 * m * n * k) / 1e9;
 }
 
 template <>
-constexpr double gemm_gflop_count<hipblasComplex>(int m, int n, int k)
+constexpr double gemm_gflop_count<hipblasComplex>(int64_t m, int64_t n, int64_t k)
 {
     return (8.0 * m * n * k) / 1e9;
 }
 
 template <>
-constexpr double gemm_gflop_count<hipblasDoubleComplex>(int m, int n, int k)
+constexpr double gemm_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n, int64_t k)
 {
     return (8.0 * m * n * k) / 1e9;
 }
@@ -2050,4 +2050,110 @@ hipblasStatus_t hipblasTrtri_trsm(hipblasHandle_t   handle,
                                   int               lda,
                                   T*                invA);
 
+// _64 variants, which take 64-bit sizes and have no Fortran interface
+template <typename T>
+hipblasStatus_t hipblasAxpy_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        alpha,
+                               const T*        x,
+                               int64_t         incx,
+                               T*              y,
+                               int64_t         incy);
+
+template <typename T>
+hipblasStatus_t hipblasDot_64(hipblasHandle_t handle,
+                              int64_t         n,
+                              const T*        x,
+                              int64_t         incx,
+                              const T*        y,
+                              int64_t         incy,
+                              T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasGemvStridedBatched_64(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             int64_t            m,
+                                             int64_t            n,
+                                             const T*           alpha,
+                                             const T*           A,
+                                             int64_t            lda,
+                                             hipblasStride      strideA,
+                                             const T*           x,
+                                             int64_t            incx,
+                                             hipblasStride      stridex,
+                                             const T*           beta,
+                                             T*                 y,
+                                             int64_t            incy,
+                                             hipblasStride      stridey,
+                                             int64_t            batch_count);
+
+template <typename T, bool CONJ>
+hipblasStatus_t hipblasGer_64(hipblasHandle_t handle,
+                              int64_t         m,
+                              int64_t         n,
+                              const T*        alpha,
+                              const T*        x,
+                              int64_t         incx,
+                              const T*        y,
+                              int64_t         incy,
+                              T*              A,
+                              int64_t         lda);
+
+template <typename T>
+hipblasStatus_t hipblasGemm_64(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           B,
+                               int64_t            ldb,
+                               const T*           beta,
+                               T*                 C,
+                               int64_t            ldc);
+
+template <typename T>
+hipblasStatus_t hipblasSyrk_64(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int64_t            n,
+                               int64_t            k,
+                               const T*           alpha,
+                               const T*           A,
+                               int64_t            lda,
+                               const T*           beta,
+                               T*                 C,
+                               int64_t            ldc);
+
+// gesv, which has no Fortran interface
+template <typename T>
+hipblasStatus_t hipblasGesvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T* const        A[],
+                                   const int       lda,
+                                   int*            ipiv,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGesvStridedBatched(hipblasHandle_t     handle,
+                                          const int           n,
+                                          const int           nrhs,
+                                          T*                  A,
+                                          const int           lda,
+                                          const hipblasStride strideA,
+                                          int*                ipiv,
+                                          const hipblasStride strideP,
+                                          T*                  B,
+                                          const int           ldb,
+                                          const hipblasStride strideB,
+                                          int*                info,
+                                          const int           batchCount);
+
 #endif // _ROCBLAS_HPP_
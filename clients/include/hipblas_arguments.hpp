@@ -25,19 +25,19 @@ enum hipblas_argument : int;
 struct Arguments
 {
 
-    int M  = 128;
-    int N  = 128;
-    int K  = 128;
-    int KL = 128;
-    int KU = 128;
+    int64_t M  = 128;
+    int64_t N  = 128;
+    int64_t K  = 128;
+    int     KL = 128;
+    int     KU = 128;
 
     int rows = 128;
     int cols = 128;
 
-    int lda = 128;
-    int ldb = 128;
-    int ldc = 128;
-    int ldd = 128;
+    int64_t lda = 128;
+    int64_t ldb = 128;
+    int64_t ldc = 128;
+    int64_t ldd = 128;
 
     hipblasDatatype_t a_type       = HIPBLAS_R_32F;
     hipblasDatatype_t b_type       = HIPBLAS_R_32F;
@@ -45,10 +45,10 @@ struct Arguments
     hipblasDatatype_t d_type       = HIPBLAS_R_32F;
     hipblasDatatype_t compute_type = HIPBLAS_R_32F;
 
-    int incx = 1;
-    int incy = 1;
-    int incd = 1;
-    int incb = 1;
+    int64_t incx = 1;
+    int64_t incy = 1;
+    int     incd = 1;
+    int     incb = 1;
 
     double        stride_scale = 1.0;
     hipblasStride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
@@ -73,8 +73,8 @@ struct Arguments
     char uplo_option   = 'L';
     char diag_option   = 'N';
 
-    int apiCallCount = 1;
-    int batch_count  = 10;
+    int     apiCallCount = 1;
+    int64_t batch_count  = 10;
 
     bool fortran = false;
 
@@ -88,13 +88,25 @@ struct Arguments
     int32_t  solution_index;
     uint32_t flags;
     char     function[64];
-    char     name[64];
+    char     name[64] = "";
     char     category[64];
 
     int atomics_mode;
 
     hipblas_initialization initialization;
 
+    // Stream for the handle of the test to use, or nullptr for the default
+    // stream. Set by hipblas-bench --replay rather than read from data.
+    hipStream_t stream = nullptr;
+
+    // Time the calls of the test as one launch of a graph capturing them
+    // rather than calling each in turn. Set by hipblas-bench --graph.
+    bool graph = false;
+
+    // Bytes of device memory the handle of the test is given as its workspace
+    // with hipblasSetWorkspace, or 0. Set by hipblas-bench --workspace.
+    size_t user_allocated_workspace = 0;
+
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Binary call traces, written by the replay log and read by
+// hipblas-bench --replay. A trace is hipblas_replay_magic followed by
+// records, in host byte order, of
+//
+//   uint32  size of the rest of the record
+//   uint64  sequence number of the call, counted across all threads
+//   uint32  stream of the handle, numbered from 1 in order of first use;
+//           0 is the null stream
+//   uint8   pointer mode of the handle
+//   uint8   length of the hipblas-bench function name, then the name
+//   fields, until the end of the record
+//
+// A field is a uint8 tag indexing hipblas_replay_fields, followed by a value
+// of the tag's kind. Each field gives the value of one hipblas-bench option.
+
+constexpr char hipblas_replay_magic[8] = {'H', 'B', 'R', 'E', 'P', 'L', 'Y', '1'};
+
+enum class hipblas_replay_kind : uint8_t
+{
+    integer, // int64_t
+    real, // double
+    letter, // char
+    datatype, // uint8_t holding a hipblasDatatype_t
+    flag, // no value
+};
+
+struct hipblas_replay_field
+{
+    const char*         option;
+    hipblas_replay_kind kind;
+};
+
+enum hipblas_replay_tag : uint8_t
+{
+    hipblas_replay_precision,
+    hipblas_replay_a_type,
+    hipblas_replay_b_type,
+    hipblas_replay_c_type,
+    hipblas_replay_d_type,
+    hipblas_replay_compute_type,
+    hipblas_replay_m,
+    hipblas_replay_n,
+    hipblas_replay_k,
+    hipblas_replay_kl,
+    hipblas_replay_ku,
+    hipblas_replay_lda,
+    hipblas_replay_ldb,
+    hipblas_replay_ldc,
+    hipblas_replay_ldd,
+    hipblas_replay_incx,
+    hipblas_replay_incy,
+    hipblas_replay_stride_a,
+    hipblas_replay_stride_b,
+    hipblas_replay_stride_c,
+    hipblas_replay_stride_d,
+    hipblas_replay_stride_x,
+    hipblas_replay_stride_y,
+    hipblas_replay_batch_count,
+    hipblas_replay_alpha,
+    hipblas_replay_alphai,
+    hipblas_replay_beta,
+    hipblas_replay_betai,
+    hipblas_replay_transA,
+    hipblas_replay_transB,
+    hipblas_replay_uplo,
+    hipblas_replay_diag,
+    hipblas_replay_side,
+    hipblas_replay_atomics_not_allowed,
+    hipblas_replay_tag_count,
+};
+
+// Indexed by hipblas_replay_tag. Tags are only ever appended, so that older
+// traces keep their meaning.
+constexpr hipblas_replay_field hipblas_replay_fields[hipblas_replay_tag_count] = {
+    {"-r", hipblas_replay_kind::datatype},
+    {"--a_type", hipblas_replay_kind::datatype},
+    {"--b_type", hipblas_replay_kind::datatype},
+    {"--c_type", hipblas_replay_kind::datatype},
+    {"--d_type", hipblas_replay_kind::datatype},
+    {"--compute_type", hipblas_replay_kind::datatype},
+    {"-m", hipblas_replay_kind::integer},
+    {"-n", hipblas_replay_kind::integer},
+    {"-k", hipblas_replay_kind::integer},
+    {"--kl", hipblas_replay_kind::integer},
+    {"--ku", hipblas_replay_kind::integer},
+    {"--lda", hipblas_replay_kind::integer},
+    {"--ldb", hipblas_replay_kind::integer},
+    {"--ldc", hipblas_replay_kind::integer},
+    {"--ldd", hipblas_replay_kind::integer},
+    {"--incx", hipblas_replay_kind::integer},
+    {"--incy", hipblas_replay_kind::integer},
+    {"--stride_a", hipblas_replay_kind::integer},
+    {"--stride_b", hipblas_replay_kind::integer},
+    {"--stride_c", hipblas_replay_kind::integer},
+    {"--stride_d", hipblas_replay_kind::integer},
+    {"--stride_x", hipblas_replay_kind::integer},
+    {"--stride_y", hipblas_replay_kind::integer},
+    {"--batch_count", hipblas_replay_kind::integer},
+    {"--alpha", hipblas_replay_kind::real},
+    {"--alphai", hipblas_replay_kind::real},
+    {"--beta", hipblas_replay_kind::real},
+    {"--betai", hipblas_replay_kind::real},
+    {"--transposeA", hipblas_replay_kind::letter},
+    {"--transposeB", hipblas_replay_kind::letter},
+    {"--uplo", hipblas_replay_kind::letter},
+    {"--diag", hipblas_replay_kind::letter},
+    {"--side", hipblas_replay_kind::letter},
+    {"--atomics_not_allowed", hipblas_replay_kind::flag},
+};
+
+// Size of a field's value
+constexpr size_t hipblas_replay_value_size(hipblas_replay_kind kind)
+{
+    return kind == hipblas_replay_kind::integer || kind == hipblas_replay_kind::real ? 8
+           : kind == hipblas_replay_kind::flag                                       ? 0
+                                                                                     : 1;
+}
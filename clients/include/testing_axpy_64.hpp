@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_axpy_64(const Arguments& argus)
+{
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+    int64_t incy = argus.incy;
+
+    int64_t abs_incx = incx < 0 ? -incx : incx;
+    int64_t abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, nullptr, nullptr, incx, nullptr, incy));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(N) * abs_incy;
+    if(!sizeX)
+        sizeX = 1;
+    if(!sizeY)
+        sizeY = 1;
+
+    T alpha = argus.get_alpha<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> d_alpha(1);
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < sizeX; i++)
+        hx[i] = random_generator<T>();
+    for(size_t i = 0; i < sizeY; i++)
+        hy_host[i] = random_generator<T>();
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && sizeX <= INT_MAX && sizeY <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, d_alpha, dx, incx, dy_device, incy));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy_host, incy));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_axpy<T>(N, alpha, hx.data(), incx, hy_cpu.data(), incy);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_device.data());
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_device.data());
+        }
+
+    } // end of if unit check
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasAxpy_64<T>(handle, N, d_alpha, dx, incx, dy_device, incy);
+        }));
+
+        ArgumentModel<e_N, e_incx, e_incy>{}.log_args<T>(std::cout,
+                                                         argus,
+                                                         gpu_time_used,
+                                                         axpy_gflop_count<T>(N),
+                                                         axpy_gbyte_count<T>(N),
+                                                         hipblas_error_host,
+                                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
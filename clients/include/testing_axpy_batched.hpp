@@ -122,26 +122,18 @@ hipblasStatus_t testing_axpy_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedFn(handle,
-                                                     N,
-                                                     d_alpha,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     dy_device.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasAxpyBatchedFn(handle,
+                                        N,
+                                        d_alpha,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dy_device.ptr_on_device(),
+                                        incy,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<T>(std::cout,
                                                                         argus,
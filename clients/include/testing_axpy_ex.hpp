@@ -124,20 +124,12 @@ hipblasStatus_t testing_axpy_ex_template(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
-                handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasAxpyExFn(
+                handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType);
+        }));
 
         ArgumentModel<e_N, e_incx, e_incy>{}.log_args<Ta>(std::cout,
                                                           argus,
@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+// Collected gemm calls give the results of the calls made one by one, including a call
+// reading the output of an earlier one
+hipblasStatus_t testing_coalescing()
+{
+    hipblasLocalHandle handle;
+
+    int   N     = 16;
+    int   calls = 8;
+    float alpha = 2.0f;
+    float beta  = 1.0f;
+
+    // calls + 1 matrices of each, the last C being written from the first C
+    size_t             size = size_t(N) * N;
+    host_vector<float> hA(size * (calls + 1));
+    host_vector<float> hB(size * (calls + 1));
+    host_vector<float> hC(size * (calls + 1));
+    hipblas_init<float>(hA, N, N * (calls + 1), N);
+    hipblas_init<float>(hB, N, N * (calls + 1), N);
+    hipblas_init<float>(hC, N, N * (calls + 1), N);
+    host_vector<float> hC_gold = hC;
+
+    device_vector<float> dA(size * (calls + 1));
+    device_vector<float> dB(size * (calls + 1));
+    device_vector<float> dC(size * (calls + 1));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+
+    bool pass = hipblasSetCoalescingMode(handle, hipblasCoalescingMode_t(2))
+                == HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasCoalescingMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetCoalescingMode(handle, HIPBLAS_COALESCING_ON));
+    CHECK_HIPBLAS_ERROR(hipblasGetCoalescingMode(handle, &mode));
+    pass = pass && mode == HIPBLAS_COALESCING_ON;
+
+    for(int i = 0; i < calls; i++)
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_T,
+                                         N,
+                                         N,
+                                         N,
+                                         &alpha,
+                                         dA + i * size,
+                                         N,
+                                         dB + i * size,
+                                         N,
+                                         &beta,
+                                         dC + i * size,
+                                         N));
+
+    // Reads the output of the first call
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_OP_N,
+                                     N,
+                                     N,
+                                     N,
+                                     &alpha,
+                                     dC,
+                                     N,
+                                     dB + calls * size,
+                                     N,
+                                     &beta,
+                                     dC + calls * size,
+                                     N));
+
+    CHECK_HIPBLAS_ERROR(hipblasFlushCoalescedCalls(handle));
+    CHECK_HIPBLAS_ERROR(hipblasSetCoalescingMode(handle, HIPBLAS_COALESCING_OFF));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+
+    for(int i = 0; i < calls; i++)
+        cblas_gemm<float>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_T,
+                          N,
+                          N,
+                          N,
+                          alpha,
+                          hA + i * size,
+                          N,
+                          hB + i * size,
+                          N,
+                          beta,
+                          hC_gold + i * size,
+                          N);
+    cblas_gemm<float>(HIPBLAS_OP_N,
+                      HIPBLAS_OP_N,
+                      N,
+                      N,
+                      N,
+                      alpha,
+                      hC_gold,
+                      N,
+                      hB + calls * size,
+                      N,
+                      beta,
+                      hC_gold + calls * size,
+                      N);
+
+    // Small integers, so exact
+    for(size_t i = 0; i < hC.size(); i++)
+        pass = pass && hC[i] == hC_gold[i];
+
+    return pass ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+// Collected calls run once the application gets the stream of the handle, so that
+// synchronizing with it sees their results without a flush, and calls in device pointer
+// mode use the alpha and beta they were made with
+hipblasStatus_t testing_coalescing_sync()
+{
+    hipblasLocalHandle handle;
+
+    int   N     = 16;
+    int   calls = 4;
+    float alpha = 2.0f;
+    float beta  = 1.0f;
+    float other = 3.0f;
+
+    size_t             size = size_t(N) * N;
+    host_vector<float> hA(size * calls);
+    host_vector<float> hB(size * calls);
+    host_vector<float> hC(size * calls);
+    hipblas_init<float>(hA, N, N * calls, N);
+    hipblas_init<float>(hB, N, N * calls, N);
+    hipblas_init<float>(hC, N, N * calls, N);
+    host_vector<float> hC_gold = hC;
+
+    device_vector<float> dA(size * calls);
+    device_vector<float> dB(size * calls);
+    device_vector<float> dC(size * calls);
+    device_vector<float> d_alpha(1);
+    device_vector<float> d_beta(1);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasSetCoalescingMode(handle, HIPBLAS_COALESCING_ON));
+
+    for(int i = 0; i < calls; i++)
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         N,
+                                         N,
+                                         N,
+                                         d_alpha,
+                                         dA + i * size,
+                                         N,
+                                         dB + i * size,
+                                         N,
+                                         d_beta,
+                                         dC + i * size,
+                                         N));
+
+    // Changed after the calls, before they have run
+    CHECK_HIP_ERROR(hipMemcpyAsync(d_alpha, &other, sizeof(float), hipMemcpyHostToDevice, stream));
+
+    hipStream_t handle_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(handle_stream));
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetCoalescingMode(handle, HIPBLAS_COALESCING_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, nullptr));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    for(int i = 0; i < calls; i++)
+        cblas_gemm<float>(HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          N,
+                          N,
+                          N,
+                          alpha,
+                          hA + i * size,
+                          N,
+                          hB + i * size,
+                          N,
+                          beta,
+                          hC_gold + i * size,
+                          N);
+
+    // Small integers, so exact
+    bool pass = handle_stream == stream;
+    for(size_t i = 0; i < hC.size(); i++)
+        pass = pass && hC[i] == hC_gold[i];
+
+    return pass ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
@@ -140,28 +140,19 @@ hipblasStatus_t testing_dgmm_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(handle,
-                                                     side,
-                                                     M,
-                                                     N,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasDgmmBatchedFn(handle,
+                                        side,
+                                        M,
+                                        N,
+                                        dA.ptr_on_device(),
+                                        lda,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        dC.ptr_on_device(),
+                                        ldc,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_side_option, e_M, e_N, e_lda, e_incx, e_ldc, e_batch_count>{}.log_args<T>(
             std::cout,
@@ -167,31 +167,22 @@ hipblasStatus_t testing_dgmm_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasDgmmStridedBatchedFn(handle,
-                                                            side,
-                                                            M,
-                                                            N,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            dC,
-                                                            ldc,
-                                                            stride_C,
-                                                            batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasDgmmStridedBatchedFn(handle,
+                                               side,
+                                               M,
+                                               N,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               dC,
+                                               ldc,
+                                               stride_C,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_side_option,
                       e_M,
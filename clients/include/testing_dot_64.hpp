@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_dot_64(const Arguments& argus)
+{
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+    int64_t incy = argus.incy;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(1);
+        host_vector<T>   h_hipblas_result_0(1);
+        hipblas_init_nan(h_hipblas_result_0.data(), 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasDot_64<T>(handle, N, nullptr, incx, nullptr, incy, d_hipblas_result_0));
+
+        host_vector<T> cpu_0(1);
+        host_vector<T> gpu_0(1);
+
+        CHECK_HIP_ERROR(hipMemcpy(gpu_0, d_hipblas_result_0, sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, 1, 1, cpu_0, gpu_0);
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t  sizeX    = size_t(N) * abs_incx;
+    size_t  sizeY    = size_t(N) * abs_incy;
+    if(!sizeX)
+        sizeX = 1;
+    if(!sizeY)
+        sizeY = 1;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy(sizeY);
+
+    T                cpu_result, h_hipblas_result_1, h_hipblas_result_2;
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+    device_vector<T> d_hipblas_result(1);
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < sizeX; i++)
+        hx[i] = random_generator<T>();
+    for(size_t i = 0; i < sizeY; i++)
+        hy[i] = random_generator<T>();
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && sizeX <= INT_MAX && sizeY <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDot_64<T>(handle, N, dx, incx, dy, incy, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDot_64<T>(handle, N, dx, incx, dy, incy, &h_hipblas_result_1));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&h_hipblas_result_2, d_hipblas_result, sizeof(T), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &cpu_result);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, &cpu_result, &h_hipblas_result_1);
+            unit_check_general<T>(1, 1, 1, &cpu_result, &h_hipblas_result_2);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, 1, 1, &cpu_result, &h_hipblas_result_1);
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, 1, 1, &cpu_result, &h_hipblas_result_2);
+        }
+
+    } // end of if unit/norm check
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasDot_64<T>(handle, N, dx, incx, dy, incy, d_hipblas_result);
+        }));
+
+        ArgumentModel<e_N, e_incx, e_incy>{}.log_args<T>(std::cout,
+                                                         argus,
+                                                         gpu_time_used,
+                                                         dot_gflop_count<false, T>(N),
+                                                         dot_gbyte_count<T>(N),
+                                                         hipblas_error_host,
+                                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -158,30 +158,22 @@ hipblasStatus_t testing_dot_batched_ex_template(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasDotBatchedExFn(handle,
-                                                      N,
-                                                      dx.ptr_on_device(),
-                                                      xType,
-                                                      incx,
-                                                      dy.ptr_on_device(),
-                                                      yType,
-                                                      incy,
-                                                      batch_count,
-                                                      d_hipblas_result,
-                                                      resultType,
-                                                      executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasDotBatchedExFn(handle,
+                                         N,
+                                         dx.ptr_on_device(),
+                                         xType,
+                                         incx,
+                                         dy.ptr_on_device(),
+                                         yType,
+                                         incy,
+                                         batch_count,
+                                         d_hipblas_result,
+                                         resultType,
+                                         executionType);
+        }));
 
         ArgumentModel<e_N, e_incx, e_incy, e_batch_count>{}.log_args<Tx>(
             std::cout,
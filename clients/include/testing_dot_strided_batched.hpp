@@ -162,28 +162,12 @@ hipblasStatus_t testing_dot_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR((hipblasDotStridedBatchedFn)(handle,
-                                                             N,
-                                                             dx,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             incy,
-                                                             stridey,
-                                                             batch_count,
-                                                             d_hipblas_result));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return (hipblasDotStridedBatchedFn)(
+                handle, N, dx, incx, stridex, dy, incy, stridey, batch_count, d_hipblas_result);
+        }));
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_incy, e_stride_y, e_batch_count>{}.log_args<T>(
             std::cout,
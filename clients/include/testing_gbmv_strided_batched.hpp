@@ -216,36 +216,28 @@ hipblasStatus_t testing_gbmv_strided_batched(const Arguments& argus)
     if(argus.timing)
     {
         hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice);
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGbmvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            KL,
-                                                            KU,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            d_beta,
-                                                            dy,
-                                                            incy,
-                                                            stride_y,
-                                                            batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGbmvStridedBatchedFn(handle,
+                                               transA,
+                                               M,
+                                               N,
+                                               KL,
+                                               KU,
+                                               d_alpha,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               d_beta,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_M,
                       e_N,
@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_gemm_64(const Arguments& argus)
+{
+    int64_t M = argus.M;
+    int64_t N = argus.N;
+    int64_t K = argus.K;
+
+    int64_t lda = argus.lda;
+    int64_t ldb = argus.ldb;
+    int64_t ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    T h_alpha = argus.get_alpha<T>();
+    T h_beta  = argus.get_beta<T>();
+
+    int64_t A_row = transA == HIPBLAS_OP_N ? M : K;
+    int64_t A_col = transA == HIPBLAS_OP_N ? K : M;
+    int64_t B_row = transB == HIPBLAS_OP_N ? K : N;
+    int64_t B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(argus);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_copy(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = random_generator<T>();
+    for(size_t i = 0; i < B_size; i++)
+        hB[i] = random_generator<T>();
+    for(size_t i = 0; i < C_size; i++)
+        hC_host[i] = random_generator<T>();
+
+    hC_copy   = hC_host;
+    hC_device = hC_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && A_size <= INT_MAX && B_size <= INT_MAX
+                 && C_size <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemm_64<T>(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemm_64<T>(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data(),
+                      lda,
+                      hB.data(),
+                      ldb,
+                      h_beta,
+                      hC_copy.data(),
+                      ldc);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_copy, hC_host);
+            unit_check_general<T>(M, N, ldc, hC_copy, hC_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = std::abs(norm_check_general<T>('F', M, N, ldc, hC_copy, hC_host));
+            hipblas_error_device
+                = std::abs(norm_check_general<T>('F', M, N, ldc, hC_copy, hC_device));
+        }
+
+    } // end of if unit/norm check
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemm_64<T>(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc);
+        }));
+
+        ArgumentModel<e_transA_option,
+                      e_transB_option,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_ldb,
+                      e_beta,
+                      e_ldc>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         gemm_gflop_count<T>(M, N, K),
+                         gemm_gbyte_count<T>(M, N, K),
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
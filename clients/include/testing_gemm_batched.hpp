@@ -216,37 +216,27 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
         // gemm has better performance in host mode. In rocBLAS in device mode
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
-                                                     transA,
-                                                     transB,
-                                                     M,
-                                                     N,
-                                                     K,
-                                                     &h_alpha,
-                                                     (const T* const*)dA.ptr_on_device(),
-                                                     lda,
-                                                     (const T* const*)dB.ptr_on_device(),
-                                                     ldb,
-                                                     &h_beta,
-                                                     dC.ptr_on_device(),
-                                                     ldc,
-                                                     batch_count));
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemmBatchedFn(handle,
+                                        transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        &h_alpha,
+                                        (const T* const*)dA.ptr_on_device(),
+                                        lda,
+                                        (const T* const*)dB.ptr_on_device(),
+                                        ldb,
+                                        &h_beta,
+                                        dC.ptr_on_device(),
+                                        ldc,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_transA_option,
                       e_transB_option,
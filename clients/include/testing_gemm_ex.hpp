@@ -202,37 +202,29 @@ hipblasStatus_t testing_gemm_ex_template(const Arguments& argus)
 
     if(timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
-                                                transA,
-                                                transB,
-                                                M,
-                                                N,
-                                                K,
-                                                &h_alpha_Tc,
-                                                dA,
-                                                a_type,
-                                                lda,
-                                                dB,
-                                                b_type,
-                                                ldb,
-                                                &h_beta_Tc,
-                                                dC,
-                                                c_type,
-                                                ldc,
-                                                compute_type,
-                                                algo));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemmExFn(handle,
+                                   transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   &h_alpha_Tc,
+                                   dA,
+                                   a_type,
+                                   lda,
+                                   dB,
+                                   b_type,
+                                   ldb,
+                                   &h_beta_Tc,
+                                   dC,
+                                   c_type,
+                                   ldc,
+                                   compute_type,
+                                   algo);
+        }));
 
         ArgumentModel<e_transA_option, e_transA_option, e_M, e_N, e_K, e_lda, e_ldb, e_ldc>{}
             .log_args<Tc>(std::cout,
@@ -0,0 +1,351 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Three groups of batch_count matrices each. Group 0 is the gemm described by the arguments;
+// the others grow m, n and k, flip one operation and swap alpha and beta, so that every group
+// is a different shape.
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+hipblasStatus_t testing_gemm_grouped_batched_ex_template(const Arguments& argus)
+{
+    const int group_count = 3;
+
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    int batch_count = argus.batch_count;
+
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    Tex h_alpha_Tc = argus.get_alpha<Tex>();
+    Tex h_beta_Tc  = argus.get_beta<Tex>();
+
+    int norm_check = argus.norm_check;
+    int unit_check = argus.unit_check;
+    int timing     = argus.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    auto flip = [](hipblasOperation_t trans) {
+        return trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    };
+
+    host_vector<hipblasOperation_t> transA_array(group_count);
+    host_vector<hipblasOperation_t> transB_array(group_count);
+    host_vector<int>                m_array(group_count);
+    host_vector<int>                n_array(group_count);
+    host_vector<int>                k_array(group_count);
+    host_vector<int>                lda_array(group_count);
+    host_vector<int>                ldb_array(group_count);
+    host_vector<int>                ldc_array(group_count);
+    host_vector<int>                group_size(group_count, batch_count);
+    host_vector<Tex>                h_alpha(group_count);
+    host_vector<Tex>                h_beta(group_count);
+
+    // Offsets of the first matrix of each group in the A, B and C buffers
+    std::vector<size_t> size_A(group_count), size_B(group_count), size_C(group_count);
+    std::vector<size_t> offset_A(group_count + 1), offset_B(group_count + 1),
+        offset_C(group_count + 1);
+
+    for(int g = 0; g < group_count; g++)
+    {
+        transA_array[g] = g == 1 ? flip(transA) : transA;
+        transB_array[g] = g == 2 ? flip(transB) : transB;
+        m_array[g]      = M + g;
+        n_array[g]      = N + 2 * g;
+        k_array[g]      = K + g;
+        h_alpha[g]      = g % 2 ? h_beta_Tc : h_alpha_Tc;
+        h_beta[g]       = g % 2 ? h_alpha_Tc : h_beta_Tc;
+
+        int a_row = transA_array[g] == HIPBLAS_OP_N ? m_array[g] : k_array[g];
+        int a_col = transA_array[g] == HIPBLAS_OP_N ? k_array[g] : m_array[g];
+        int b_row = transB_array[g] == HIPBLAS_OP_N ? k_array[g] : n_array[g];
+        int b_col = transB_array[g] == HIPBLAS_OP_N ? n_array[g] : k_array[g];
+
+        // Keep the padding of the leading dimensions of group 0
+        lda_array[g] = std::max(a_row + (lda - A_row), 1);
+        ldb_array[g] = std::max(b_row + (ldb - B_row), 1);
+        ldc_array[g] = std::max(m_array[g] + (ldc - M), 1);
+
+        size_A[g] = size_t(lda_array[g]) * a_col;
+        size_B[g] = size_t(ldb_array[g]) * b_col;
+        size_C[g] = size_t(ldc_array[g]) * n_array[g];
+
+        offset_A[g + 1] = offset_A[g] + size_A[g] * batch_count;
+        offset_B[g + 1] = offset_B[g] + size_B[g] * batch_count;
+        offset_C[g + 1] = offset_C[g] + size_C[g] * batch_count;
+    }
+
+    int total = group_count * batch_count;
+
+    host_vector<Ta> hA(std::max<size_t>(offset_A[group_count], 1));
+    host_vector<Tb> hB(std::max<size_t>(offset_B[group_count], 1));
+    host_vector<Tc> hC_host(std::max<size_t>(offset_C[group_count], 1));
+    host_vector<Tc> hC_device(hC_host.size());
+    host_vector<Tc> hC_gold(hC_host.size());
+
+    device_vector<Ta>  dA(hA.size());
+    device_vector<Tb>  dB(hB.size());
+    device_vector<Tc>  dC(hC_host.size());
+    device_vector<Ta*> dA_array(std::max(total, 1));
+    device_vector<Tb*> dB_array(std::max(total, 1));
+    device_vector<Tc*> dC_array(std::max(total, 1));
+    device_vector<Tex> d_alpha(group_count);
+    device_vector<Tex> d_beta(group_count);
+    host_vector<Ta*>   hA_array(std::max(total, 1));
+    host_vector<Tb*>   hB_array(std::max(total, 1));
+    host_vector<Tc*>   hC_array(std::max(total, 1));
+
+    double             gpu_time_used, hipblas_error_host = 0.0, hipblas_error_device = 0.0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    hipblas_seedrand();
+    for(int g = 0; g < group_count; g++)
+        for(int b = 0; b < batch_count; b++)
+        {
+            int i = g * batch_count + b;
+
+            hA_array[i] = dA + offset_A[g] + b * size_A[g];
+            hB_array[i] = dB + offset_B[g] + b * size_B[g];
+            hC_array[i] = dC + offset_C[g] + b * size_C[g];
+
+            hipblas_init<Ta>(hA + offset_A[g] + b * size_A[g], 1, size_A[g], 1);
+            hipblas_init<Tb>(hB + offset_B[g] + b * size_B[g], 1, size_B[g], 1);
+            hipblas_init<Tc>(hC_host + offset_C[g] + b * size_C[g], 1, size_C[g], 1);
+        }
+
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * hC_host.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA_array, sizeof(Ta*) * hA_array.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB_array, hB_array, sizeof(Tb*) * hB_array.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dC_array, hC_array, sizeof(Tc*) * hC_array.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, h_alpha, sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, h_beta, sizeof(Tex) * group_count, hipMemcpyHostToDevice));
+
+    auto hipblasGemmGroupedBatchedExFn = [&](const Tex* alpha, const Tex* beta) {
+        return hipblasGemmGroupedBatchedEx(handle,
+                                           transA_array,
+                                           transB_array,
+                                           m_array,
+                                           n_array,
+                                           k_array,
+                                           alpha,
+                                           (const void* const*)(Ta**)dA_array,
+                                           a_type,
+                                           lda_array,
+                                           (const void* const*)(Tb**)dB_array,
+                                           b_type,
+                                           ldb_array,
+                                           beta,
+                                           (void* const*)(Tc**)dC_array,
+                                           c_type,
+                                           ldc_array,
+                                           group_count,
+                                           group_size,
+                                           compute_type,
+                                           algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedExFn(h_alpha, h_beta));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_host, dC, sizeof(Tc) * hC_host.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dC, hC_device, sizeof(Tc) * hC_device.size(), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedExFn(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_device, dC, sizeof(Tc) * hC_device.size(), hipMemcpyDeviceToHost));
+
+        // CPU BLAS, one gemm per matrix
+        for(int g = 0; g < group_count; g++)
+            for(int b = 0; b < batch_count; b++)
+            {
+                cblas_gemm<Ta, Tc, Tex>(transA_array[g],
+                                        transB_array[g],
+                                        m_array[g],
+                                        n_array[g],
+                                        k_array[g],
+                                        h_alpha[g],
+                                        hA + offset_A[g] + b * size_A[g],
+                                        lda_array[g],
+                                        hB + offset_B[g] + b * size_B[g],
+                                        ldb_array[g],
+                                        h_beta[g],
+                                        hC_gold + offset_C[g] + b * size_C[g],
+                                        ldc_array[g]);
+            }
+
+        for(int g = 0; g < group_count; g++)
+            for(int b = 0; b < batch_count; b++)
+            {
+                size_t offset = offset_C[g] + b * size_C[g];
+                if(unit_check)
+                {
+                    unit_check_general<Tc>(m_array[g],
+                                           n_array[g],
+                                           ldc_array[g],
+                                           hC_gold + offset,
+                                           hC_host + offset);
+                    unit_check_general<Tc>(m_array[g],
+                                           n_array[g],
+                                           ldc_array[g],
+                                           hC_gold + offset,
+                                           hC_device + offset);
+                }
+
+                if(norm_check)
+                {
+                    hipblas_error_host
+                        = std::max(hipblas_error_host,
+                                   norm_check_general<Tc>('F',
+                                                          m_array[g],
+                                                          n_array[g],
+                                                          ldc_array[g],
+                                                          hC_gold + offset,
+                                                          hC_host + offset));
+                    hipblas_error_device
+                        = std::max(hipblas_error_device,
+                                   norm_check_general<Tc>('F',
+                                                          m_array[g],
+                                                          n_array[g],
+                                                          ldc_array[g],
+                                                          hC_gold + offset,
+                                                          hC_device + offset));
+                }
+            }
+    }
+
+    if(timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemmGroupedBatchedExFn(h_alpha, h_beta);
+        }));
+
+        double gflops = 0.0, gbytes = 0.0;
+        for(int g = 0; g < group_count; g++)
+        {
+            gflops += gemm_gflop_count<Tex>(m_array[g], n_array[g], k_array[g]) * batch_count;
+            gbytes += gemm_gbyte_count<Tex>(m_array[g], n_array[g], k_array[g]) * batch_count;
+        }
+
+        ArgumentModel<e_transA_option,
+                      e_transB_option,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_lda,
+                      e_ldb,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<Tc>(std::cout,
+                          argus,
+                          gpu_time_used,
+                          gflops,
+                          gbytes,
+                          hipblas_error_host,
+                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t testing_gemm_grouped_batched_ex(const Arguments& argus)
+{
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+       && compute_type == HIPBLAS_R_16F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf,
+                                                          hipblasHalf,
+                                                          hipblasHalf,
+                                                          float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<double>(argus);
+    }
+    else if(a_type == HIPBLAS_C_32F && b_type == HIPBLAS_C_32F && c_type == HIPBLAS_C_32F
+            && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasComplex>(argus);
+    }
+    else if(a_type == HIPBLAS_C_64F && b_type == HIPBLAS_C_64F && c_type == HIPBLAS_C_64F
+            && compute_type == HIPBLAS_C_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasDoubleComplex>(argus);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
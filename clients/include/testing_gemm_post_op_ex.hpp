@@ -0,0 +1,395 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <limits>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+// Machine epsilon of the type C is stored in, which bounds the error of the post-op
+template <typename T>
+double gemm_post_op_eps()
+{
+    return std::numeric_limits<T>::epsilon();
+}
+
+template <>
+inline double gemm_post_op_eps<hipblasHalf>()
+{
+    return 0.0009765625;
+}
+
+template <>
+inline double gemm_post_op_eps<hipblasBfloat16>()
+{
+    return 0.0078125;
+}
+
+// Every activation is checked with a bias, a scale and an aux output, both for C and aux.
+// STRIDED runs hipblasGemmStridedBatchedPostOpEx on batch_count matrices, and
+// hipblasGemmPostOpEx on one matrix otherwise.
+template <bool STRIDED, typename Ta, typename Tb, typename Tc, typename Tex>
+hipblasStatus_t testing_gemm_post_op_ex_common(const Arguments& argus)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    int batch_count = STRIDED ? argus.batch_count : 1;
+
+    Tex h_alpha_Tc = argus.get_alpha<Tex>();
+    Tex h_beta_Tc  = argus.get_beta<Tex>();
+
+    int norm_check = argus.norm_check;
+    int unit_check = argus.unit_check;
+    int timing     = argus.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t stride_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t stride_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t stride_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    const size_t size_A     = stride_A * batch_count;
+    const size_t size_B     = stride_B * batch_count;
+    const size_t size_C     = stride_C * batch_count;
+    const size_t size_bias  = static_cast<size_t>(M) * batch_count;
+    const size_t size_scale = static_cast<size_t>(N) * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta>  hA(size_A);
+    host_vector<Tb>  hB(size_B);
+    host_vector<Tc>  hC(size_C);
+    host_vector<Tc>  hC_host(size_C);
+    host_vector<Tc>  hC_device(size_C);
+    host_vector<Tc>  hC_gold(size_C);
+    host_vector<Tc>  hAux_host(size_C);
+    host_vector<Tc>  hAux_device(size_C);
+    host_vector<Tc>  hAux_gold(size_C);
+    host_vector<Tc>  hbias(size_bias);
+    host_vector<Tex> hscale(size_scale);
+
+    device_vector<Ta>  dA(size_A);
+    device_vector<Tb>  dB(size_B);
+    device_vector<Tc>  dC(size_C);
+    device_vector<Tc>  dAux(size_C);
+    device_vector<Tc>  dbias(size_bias);
+    device_vector<Tex> dscale(size_scale);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    double             gpu_time_used, hipblas_error_host = 0.0, hipblas_error_device = 0.0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Ta>(hA, A_row, A_col, lda, stride_A, batch_count);
+    hipblas_init_alternating_sign<Tb>(hB, B_row, B_col, ldb, stride_B, batch_count);
+    hipblas_init<Tc>(hC, M, N, ldc, stride_C, batch_count);
+    hipblas_init_alternating_sign<Tc>(hbias, M, 1, M, M, batch_count);
+    hipblas_init<Tex>(hscale, N, 1, N, N, batch_count);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbias, hbias, sizeof(Tc) * size_bias, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dscale, hscale, sizeof(Tex) * size_scale, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+
+    hipblasPostOp_t post_op;
+    post_op.bias         = dbias;
+    post_op.stride_bias  = M;
+    post_op.scale        = dscale;
+    post_op.stride_scale = N;
+    post_op.aux          = dAux;
+    post_op.ld_aux       = ldc;
+    post_op.stride_aux   = stride_C;
+
+    auto hipblasGemmPostOpExFn = [&](const Tex* alpha, const Tex* beta) {
+        if(STRIDED)
+            return hipblasGemmStridedBatchedPostOpEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     alpha,
+                                                     dA,
+                                                     a_type,
+                                                     lda,
+                                                     stride_A,
+                                                     dB,
+                                                     b_type,
+                                                     ldb,
+                                                     stride_B,
+                                                     beta,
+                                                     dC,
+                                                     c_type,
+                                                     ldc,
+                                                     stride_C,
+                                                     batch_count,
+                                                     &post_op,
+                                                     compute_type,
+                                                     algo);
+        return hipblasGemmPostOpEx(handle,
+                                   transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   alpha,
+                                   dA,
+                                   a_type,
+                                   lda,
+                                   dB,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   dC,
+                                   c_type,
+                                   ldc,
+                                   &post_op,
+                                   compute_type,
+                                   algo);
+    };
+
+    if(unit_check || norm_check)
+    {
+        const hipblasActivation_t activations[] = {HIPBLAS_ACTIVATION_NONE,
+                                                   HIPBLAS_ACTIVATION_RELU,
+                                                   HIPBLAS_ACTIVATION_GELU,
+                                                   HIPBLAS_ACTIVATION_TANH};
+
+        for(hipblasActivation_t activation : activations)
+        {
+            post_op.activation = activation;
+
+            // hipBLAS
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmPostOpExFn(&h_alpha_Tc, &h_beta_Tc));
+
+            CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hAux_host, dAux, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            CHECK_HIPBLAS_ERROR(hipblasGemmPostOpExFn(d_alpha, d_beta));
+
+            CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hAux_device, dAux, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+
+            // CPU BLAS
+            hC_gold = hC;
+            for(int b = 0; b < batch_count; b++)
+            {
+                cblas_gemm_post_op<Ta, Tc, Tex>(transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                h_alpha_Tc,
+                                                hA.data() + b * stride_A,
+                                                lda,
+                                                hB.data() + b * stride_B,
+                                                ldb,
+                                                h_beta_Tc,
+                                                hC_gold.data() + b * stride_C,
+                                                ldc,
+                                                activation,
+                                                hbias.data() + b * M,
+                                                hscale.data() + b * N,
+                                                hAux_gold.data() + b * stride_C,
+                                                ldc);
+            }
+
+            // The activations are computed with the device's own tanh, so the results
+            // are compared within a tolerance rather than bitwise
+            double error_host
+                = norm_check_general<Tc>('F', M, N, ldc, stride_C, hC_gold, hC_host, batch_count)
+                  + norm_check_general<Tc>(
+                      'F', M, N, ldc, stride_C, hAux_gold, hAux_host, batch_count);
+            double error_device
+                = norm_check_general<Tc>('F', M, N, ldc, stride_C, hC_gold, hC_device, batch_count)
+                  + norm_check_general<Tc>(
+                      'F', M, N, ldc, stride_C, hAux_gold, hAux_device, batch_count);
+
+            if(unit_check)
+            {
+                double tolerance = gemm_post_op_eps<Tc>() * 10 * batch_count;
+                unit_check_error(error_host, tolerance);
+                unit_check_error(error_device, tolerance);
+            }
+
+            hipblas_error_host   = std::max(hipblas_error_host, error_host);
+            hipblas_error_device = std::max(hipblas_error_device, error_device);
+        }
+    }
+
+    if(timing)
+    {
+        post_op.activation = HIPBLAS_ACTIVATION_RELU;
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemmPostOpExFn(&h_alpha_Tc, &h_beta_Tc);
+        }));
+
+        ArgumentModel<e_transA_option,
+                      e_transB_option,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_lda,
+                      e_ldb,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<Tc>(std::cout,
+                          argus,
+                          gpu_time_used,
+                          gemm_gflop_count<Tex>(M, N, K) * batch_count,
+                          gemm_gbyte_count<Tex>(M, N, K) * batch_count,
+                          hipblas_error_host,
+                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+hipblasStatus_t testing_gemm_post_op_ex_template(const Arguments& argus)
+{
+    return testing_gemm_post_op_ex_common<false, Ta, Tb, Tc, Tex>(argus);
+}
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+hipblasStatus_t testing_gemm_strided_batched_post_op_ex_template(const Arguments& argus)
+{
+    return testing_gemm_post_op_ex_common<true, Ta, Tb, Tc, Tex>(argus);
+}
+
+// The post-op runs for the real types only
+hipblasStatus_t testing_gemm_post_op_ex(const Arguments& argus)
+{
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+       && compute_type == HIPBLAS_R_16F)
+    {
+        status = testing_gemm_post_op_ex_template<hipblasHalf>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_post_op_ex_template<hipblasHalf,
+                                                   hipblasHalf,
+                                                   hipblasHalf,
+                                                   float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_post_op_ex_template<hipblasBfloat16,
+                                                   hipblasBfloat16,
+                                                   hipblasBfloat16,
+                                                   float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_post_op_ex_template<float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_post_op_ex_template<double>(argus);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
+
+hipblasStatus_t testing_gemm_strided_batched_post_op_ex(const Arguments& argus)
+{
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+       && compute_type == HIPBLAS_R_16F)
+    {
+        status = testing_gemm_strided_batched_post_op_ex_template<hipblasHalf>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_post_op_ex_template<hipblasHalf,
+                                                                   hipblasHalf,
+                                                                   hipblasHalf,
+                                                                   float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_post_op_ex_template<hipblasBfloat16,
+                                                                   hipblasBfloat16,
+                                                                   hipblasBfloat16,
+                                                                   float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_post_op_ex_template<float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_strided_batched_post_op_ex_template<double>(argus);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
@@ -178,31 +178,22 @@ hipblasStatus_t testing_gemv_batched(const Arguments& argus)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIP_ERROR(dy.transfer_from(hy));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
-            CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
-                                                     transA,
-                                                     M,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemvBatchedFn(handle,
+                                        transA,
+                                        M,
+                                        N,
+                                        d_alpha,
+                                        dA.ptr_on_device(),
+                                        lda,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        d_beta,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_transA_option,
                       e_M,
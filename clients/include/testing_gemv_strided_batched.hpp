@@ -206,35 +206,25 @@ hipblasStatus_t testing_gemv_strided_batched(const Arguments& argus)
     {
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
-            CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatchedFn(handle,
-                                                            transA,
-                                                            M,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            d_beta,
-                                                            dy,
-                                                            incy,
-                                                            stride_y,
-                                                            batch_count));
-        }
-
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemvStridedBatchedFn(handle,
+                                               transA,
+                                               M,
+                                               N,
+                                               d_alpha,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               d_beta,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_transA_option,
                       e_M,
@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_gemv_strided_batched_64(const Arguments& argus)
+{
+    int64_t M            = argus.M;
+    int64_t N            = argus.N;
+    int64_t lda          = argus.lda;
+    int64_t incx         = argus.incx;
+    int64_t incy         = argus.incy;
+    double  stride_scale = argus.stride_scale;
+    int64_t batch_count  = argus.batch_count;
+
+    hipblasStride stride_A = lda * N * stride_scale;
+    hipblasStride stride_x;
+    hipblasStride stride_y;
+
+    size_t A_size = stride_A * batch_count;
+    size_t X_size, dim_x;
+    size_t Y_size, dim_y;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    if(transA == HIPBLAS_OP_N)
+    {
+        dim_x = N;
+        dim_y = M;
+    }
+    else
+    {
+        dim_x = M;
+        dim_y = N;
+    }
+
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+
+    stride_x = dim_x * abs_incx * stride_scale;
+    stride_y = dim_y * abs_incy * stride_scale;
+    X_size   = stride_x * batch_count;
+    Y_size   = stride_y * batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || lda < M || lda < 1 || !incx || !incy || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemvStridedBatched_64<T>(handle,
+                                                                 transA,
+                                                                 M,
+                                                                 N,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 nullptr,
+                                                                 incx,
+                                                                 stride_x,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 incy,
+                                                                 stride_y,
+                                                                 batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hx(X_size);
+    host_vector<T> hy(Y_size);
+    host_vector<T> hy_cpu(Y_size);
+    host_vector<T> hy_host(Y_size);
+    host_vector<T> hy_device(Y_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dx(X_size);
+    device_vector<T> dy(Y_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    T h_alpha = argus.get_alpha<T>();
+    T h_beta  = argus.get_beta<T>();
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = random_generator<T>();
+    for(size_t i = 0; i < X_size; i++)
+        hx[i] = random_generator<T>();
+    for(size_t i = 0; i < Y_size; i++)
+        hy[i] = random_generator<T>();
+
+    // copy vector is easy in STL; hy_cpu = hy: save a copy in hy_cpu which will be output of CPU BLAS
+    hy_cpu = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * X_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && A_size <= INT_MAX && X_size <= INT_MAX
+                 && Y_size <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatched_64<T>(handle,
+                                                            transA,
+                                                            M,
+                                                            N,
+                                                            &h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dx,
+                                                            incx,
+                                                            stride_x,
+                                                            &h_beta,
+                                                            dy,
+                                                            incy,
+                                                            stride_y,
+                                                            batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemvStridedBatched_64<T>(handle,
+                                                            transA,
+                                                            M,
+                                                            N,
+                                                            d_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dx,
+                                                            incx,
+                                                            stride_x,
+                                                            d_beta,
+                                                            dy,
+                                                            incy,
+                                                            stride_y,
+                                                            batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hy_device.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemv<T>(transA,
+                          M,
+                          N,
+                          h_alpha,
+                          hA.data() + b * stride_A,
+                          lda,
+                          hx.data() + b * stride_x,
+                          incx,
+                          h_beta,
+                          hy_cpu.data() + b * stride_y,
+                          incy);
+        }
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, dim_y, batch_count, abs_incy, stride_y, hy_cpu, hy_host);
+            unit_check_general<T>(1, dim_y, batch_count, abs_incy, stride_y, hy_cpu, hy_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, stride_y, hy_cpu, hy_host, batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, dim_y, abs_incy, stride_y, hy_cpu, hy_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGemvStridedBatched_64<T>(handle,
+                                                   transA,
+                                                   M,
+                                                   N,
+                                                   d_alpha,
+                                                   dA,
+                                                   lda,
+                                                   stride_A,
+                                                   dx,
+                                                   incx,
+                                                   stride_x,
+                                                   d_beta,
+                                                   dy,
+                                                   incy,
+                                                   stride_y,
+                                                   batch_count);
+        }));
+
+        ArgumentModel<e_transA_option,
+                      e_M,
+                      e_N,
+                      e_stride_a,
+                      e_alpha,
+                      e_lda,
+                      e_incx,
+                      e_stride_x,
+                      e_beta,
+                      e_incy,
+                      e_stride_y,
+                      e_batch_count>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         gemv_gflop_count<T>(transA, M, N),
+                         gemv_gbyte_count<T>(transA, M, N),
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -125,19 +125,10 @@ hipblasStatus_t testing_geqrf_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGeqrfStridedBatchedFn(
-                handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGeqrfStridedBatchedFn(
+                handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count);
+        }));
 
         ArgumentModel<e_M, e_N, e_lda, e_stride_a, e_batch_count>{}.log_args<T>(
             std::cout,
@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T, bool CONJ>
+hipblasStatus_t testing_ger_64(const Arguments& argus)
+{
+    auto hipblasGerFn = hipblasGer_64<T, CONJ>;
+
+    int64_t M    = argus.M;
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+    int64_t incy = argus.incy;
+    int64_t lda  = argus.lda;
+
+    int64_t abs_incx = incx >= 0 ? incx : -incx;
+    int64_t abs_incy = incy >= 0 ? incy : -incy;
+    size_t  x_size   = size_t(M) * abs_incx;
+    size_t  y_size   = size_t(N) * abs_incy;
+    size_t  A_size   = size_t(lda) * N;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || !incx || !incy || lda < M || lda < 1;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual
+            = hipblasGerFn(handle, M, N, nullptr, nullptr, incx, nullptr, incy, nullptr, lda);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_host(A_size);
+    host_vector<T> hA_device(A_size);
+    host_vector<T> hA_cpu(A_size);
+    host_vector<T> hx(x_size);
+    host_vector<T> hy(y_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dx(x_size);
+    device_vector<T> dy(y_size);
+    device_vector<T> d_alpha(1);
+
+    double gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+
+    T h_alpha = argus.get_alpha<T>();
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = random_generator<T>();
+    for(size_t i = 0; i < x_size; i++)
+        hx[i] = random_generator<T>();
+    for(size_t i = 0; i < y_size; i++)
+        hy[i] = random_generator<T>();
+
+    hA_cpu = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && A_size <= INT_MAX && x_size <= INT_MAX
+                 && y_size <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGerFn(handle, M, N, &h_alpha, dx, incx, dy, incy, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_host, dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGerFn(handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA_device, dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_ger<T, CONJ>(M, N, h_alpha, hx.data(), incx, hy.data(), incy, hA_cpu.data(), lda);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, lda, hA_cpu.data(), hA_host.data());
+            unit_check_general<T>(M, N, lda, hA_cpu.data(), hA_device.data());
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', M, N, lda, hA_cpu.data(), hA_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', M, N, lda, hA_cpu.data(), hA_device.data());
+        }
+
+    } // end of if unit/norm check
+
+    if(argus.timing)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGerFn(handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda);
+        }));
+
+        ArgumentModel<e_M, e_N, e_alpha, e_incx, e_incy, e_lda>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ger_gflop_count<T>(M, N),
+            ger_gbyte_count<T>(M, N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -176,32 +176,24 @@ hipblasStatus_t testing_ger_strided_batched(const Arguments& argus)
     if(argus.timing)
     {
         CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * N, hipMemcpyHostToDevice));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGerStridedBatchedFn(handle,
-                                                           M,
-                                                           N,
-                                                           d_alpha,
-                                                           dx,
-                                                           incx,
-                                                           stride_x,
-                                                           dy,
-                                                           incy,
-                                                           stride_y,
-                                                           dA,
-                                                           lda,
-                                                           stride_A,
-                                                           batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGerStridedBatchedFn(handle,
+                                              M,
+                                              N,
+                                              d_alpha,
+                                              dx,
+                                              incx,
+                                              stride_x,
+                                              dy,
+                                              incy,
+                                              stride_y,
+                                              dA,
+                                              lda,
+                                              stride_A,
+                                              batch_count);
+        }));
 
         ArgumentModel<e_M,
                       e_N,
@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+enum class gesv_mixed_form
+{
+    single,
+    batched,
+    strided_batched,
+};
+
+// hipblasDSgesv for double, hipblasZCgesv for double complex, in each form
+inline hipblasStatus_t hipblasGesvMixed(gesv_mixed_form form,
+                                        hipblasHandle_t handle,
+                                        int             n,
+                                        int             nrhs,
+                                        double*         A,
+                                        double* const   A_array[],
+                                        int             lda,
+                                        hipblasStride   strideA,
+                                        int*            ipiv,
+                                        hipblasStride   strideP,
+                                        double*         B,
+                                        double* const   B_array[],
+                                        int             ldb,
+                                        hipblasStride   strideB,
+                                        double*         X,
+                                        double* const   X_array[],
+                                        int             ldx,
+                                        hipblasStride   strideX,
+                                        int*            iter,
+                                        int*            info,
+                                        int             batch_count)
+{
+    if(form == gesv_mixed_form::single)
+        return hipblasDSgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+    if(form == gesv_mixed_form::batched)
+        return hipblasDSgesvBatched(
+            handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, X_array, ldx, iter, info, batch_count);
+    return hipblasDSgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       batch_count);
+}
+
+inline hipblasStatus_t hipblasGesvMixed(gesv_mixed_form              form,
+                                        hipblasHandle_t              handle,
+                                        int                          n,
+                                        int                          nrhs,
+                                        hipblasDoubleComplex*        A,
+                                        hipblasDoubleComplex* const  A_array[],
+                                        int                          lda,
+                                        hipblasStride                strideA,
+                                        int*                         ipiv,
+                                        hipblasStride                strideP,
+                                        hipblasDoubleComplex*        B,
+                                        hipblasDoubleComplex* const  B_array[],
+                                        int                          ldb,
+                                        hipblasStride                strideB,
+                                        hipblasDoubleComplex*        X,
+                                        hipblasDoubleComplex* const  X_array[],
+                                        int                          ldx,
+                                        hipblasStride                strideX,
+                                        int*                         iter,
+                                        int*                         info,
+                                        int                          batch_count)
+{
+    if(form == gesv_mixed_form::single)
+        return hipblasZCgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+    if(form == gesv_mixed_form::batched)
+        return hipblasZCgesvBatched(
+            handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, X_array, ldx, iter, info, batch_count);
+    return hipblasZCgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       batch_count);
+}
+
+// Solves diagonally dominant systems with known solutions, which the mixed precision
+// solvers must solve by refinement to double precision accuracy, leaving A unchanged.
+// nrhs is taken from K and ldx from ldc. The systems are laid out as in the strided
+// batched form in every form; the batched form gets arrays of pointers to them.
+template <typename T>
+hipblasStatus_t testing_gesv_mixed_template(const Arguments& argus, gesv_mixed_form form)
+{
+    using U = real_t<T>;
+
+    int    N            = argus.N;
+    int    nrhs         = argus.K;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldx          = argus.ldc;
+    int    batch_count  = form == gesv_mixed_form::single ? 1 : argus.batch_count;
+    double stride_scale = form == gesv_mixed_form::strided_batched ? argus.stride_scale : 1;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || ldx < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStride strideA   = size_t(lda) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * nrhs * stride_scale;
+    hipblasStride strideX   = size_t(ldx) * nrhs * stride_scale;
+    hipblasStride strideP   = size_t(N) * stride_scale;
+    size_t        A_size    = strideA * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        X_size    = strideX * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX(X_size);
+    host_vector<T>   hX1(X_size);
+    host_vector<int> iter(batch_count);
+    host_vector<int> info(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<T*>  dA_array(batch_count);
+    device_vector<T*>  dB_array(batch_count);
+    device_vector<T*>  dX_array(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(argus);
+
+    // Initial hA, hB, hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideX;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, nrhs, ldx);
+
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, nrhs, N, (T)1, hAb, lda, hXb, ldx, (T)0, hBb, ldb);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    host_vector<T*> hA_array(batch_count), hB_array(batch_count), hX_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = dA + b * strideA;
+        hB_array[b] = dB + b * strideB;
+        hX_array[b] = dX + b * strideX;
+    }
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_array, hA_array, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB_array, hB_array, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dX_array, hX_array, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+
+    auto gesv = [&] {
+        return hipblasGesvMixed(form,
+                                handle,
+                                N,
+                                nrhs,
+                                dA,
+                                dA_array,
+                                lda,
+                                strideA,
+                                dIpiv,
+                                strideP,
+                                dB,
+                                dB_array,
+                                ldb,
+                                strideB,
+                                dX,
+                                dX_array,
+                                ldx,
+                                strideX,
+                                iter,
+                                info,
+                                batch_count);
+    };
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(gesv());
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hA1, dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+
+        // The systems are well conditioned: each must be solved by refinement, which
+        // leaves A as it was
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(info[b] != 0 || iter[b] < 0)
+            {
+                cerr << "system " << b << " was not solved by refinement: iter " << iter[b]
+                     << ", info " << info[b] << endl;
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldx, strideX, hX, hX1, batch_count);
+
+        if(argus.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general<T>(N, N, batch_count, lda, strideA, hA, hA1);
+        }
+    }
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, gesv));
+
+        ArgumentModel<e_N, e_K, e_lda, e_ldb, e_ldc, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            (getrf_gflop_count<T>(N, N) + getrs_gflop_count<T>(N, nrhs)) * batch_count,
+            ArgumentLogging::NA_value,
+            hipblas_error);
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_gesv_mixed(const Arguments& argus)
+{
+    return testing_gesv_mixed_template<T>(argus, gesv_mixed_form::single);
+}
+
+template <typename T>
+hipblasStatus_t testing_gesv_mixed_batched(const Arguments& argus)
+{
+    return testing_gesv_mixed_template<T>(argus, gesv_mixed_form::batched);
+}
+
+template <typename T>
+hipblasStatus_t testing_gesv_mixed_strided_batched(const Arguments& argus)
+{
+    return testing_gesv_mixed_template<T>(argus, gesv_mixed_form::strided_batched);
+}
@@ -118,19 +118,10 @@ hipblasStatus_t testing_getrf_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
-                handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGetrfStridedBatchedFn(
+                handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count);
+        }));
 
         ArgumentModel<e_N, e_lda, e_stride_a, e_batch_count>{}.log_args<T>(
             std::cout,
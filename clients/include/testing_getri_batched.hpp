@@ -131,26 +131,17 @@ hipblasStatus_t testing_getri_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasGetriBatchedFn(handle,
-                                                      N,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      dIpiv,
-                                                      dC.ptr_on_device(),
-                                                      lda,
-                                                      dInfo,
-                                                      batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasGetriBatchedFn(handle,
+                                         N,
+                                         dA.ptr_on_device(),
+                                         lda,
+                                         dIpiv,
+                                         dC.ptr_on_device(),
+                                         lda,
+                                         dInfo,
+                                         batch_count);
+        }));
 
         ArgumentModel<e_N, e_lda, e_batch_count>{}.log_args<T>(std::cout,
                                                                argus,
@@ -0,0 +1,62 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+// A captured graph replays its calls, host pointer mode results included, on each launch
+hipblasStatus_t testing_graph()
+{
+    Arguments argus;
+    argus.graph = true;
+    hipblasLocalHandle handle(argus);
+
+    int   N     = 100;
+    float alpha = 2.0f;
+
+    host_vector<float> hx(N, 1.0f);
+    host_vector<float> hy(N, 0.0f);
+
+    device_vector<float> dx(N);
+    device_vector<float> dy(N);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * N, hipMemcpyHostToDevice));
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    float result = 0.0f;
+    CHECK_HIPBLAS_ERROR(hipblasGraphBegin(handle));
+    bool pass = hipblasSetStream(handle, nullptr) == HIPBLAS_STATUS_INVALID_VALUE;
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, dx, 1, dy, 1));
+    CHECK_HIPBLAS_ERROR(hipblasSdot(handle, N, dx, 1, dy, 1, &result));
+
+    hipblasGraph_t graph;
+    CHECK_HIPBLAS_ERROR(hipblasGraphEnd(handle, &graph));
+
+    // Nothing ran while capturing
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    pass = pass && result == 0.0f;
+
+    for(int launch = 1; launch <= 2; launch++)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGraphLaunch(handle, graph));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * N, hipMemcpyDeviceToHost));
+
+        float expected = alpha * launch;
+        for(int i = 0; i < N; i++)
+            pass = pass && hy[i] == expected;
+        pass = pass && result == expected * N;
+    }
+
+    // A graph only runs on the handle it was captured on
+    hipblasLocalHandle other;
+    pass = pass && hipblasGraphLaunch(other, graph) == HIPBLAS_STATUS_INVALID_VALUE;
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphDestroy(graph));
+
+    return pass ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
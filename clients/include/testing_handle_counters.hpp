@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <cstring>
+#include <thread>
+
+#include "testing_common.hpp"
+
+// Calls are counted per family across threads, reset to zero, and not counted once turned off
+hipblasStatus_t testing_handle_counters()
+{
+    Arguments          argus;
+    hipblasLocalHandle handle(argus);
+
+    const int N       = 1000;
+    const int threads = 4;
+    const int calls   = 5;
+
+    float                alpha = 2.0f;
+    device_vector<float> dx(N * threads);
+    CHECK_HIP_ERROR(hipMemset(dx, 0, N * threads * sizeof(float)));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    int count = -1;
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleCounters(handle, nullptr, &count));
+    if(count != 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleCountersMode(handle, HIPBLAS_COUNTERS_DEVICE_TIME));
+
+    // Each thread counts into a shard of its own. The threads take turns, as a
+    // handle must not be used by two threads at once.
+    for(int t = 0; t < threads; t++)
+    {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        std::thread     worker([&] {
+            for(int i = 0; i < calls && status == HIPBLAS_STATUS_SUCCESS; i++)
+                status = hipblasSscal(handle, N, &alpha, dx + t * N, 1);
+        });
+        worker.join();
+        CHECK_HIPBLAS_ERROR(status);
+    }
+
+    hipblasRoutineCounters_t counters[2];
+    count = 2;
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleCounters(handle, counters, &count));
+    if(count != 1 || strcmp(counters[0].routine, "scal") != 0
+       || counters[0].calls != uint64_t(threads * calls))
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    double gflop = threads * calls * scal_gflop_count<float, float>(N);
+    double gbyte = threads * calls * scal_gbyte_count<float>(N);
+    if(std::abs(counters[0].gflop - gflop) > 1e-6 * gflop
+       || std::abs(counters[0].gbyte - gbyte) > 1e-6 * gbyte || counters[0].device_time_ms <= 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    CHECK_HIPBLAS_ERROR(hipblasResetHandleCounters(handle));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleCounters(handle, nullptr, &count));
+    if(count != 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleCountersMode(handle, HIPBLAS_COUNTERS_OFF));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, N, &alpha, dx, 1));
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleCounters(handle, nullptr, &count));
+    if(count != 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// syr2k and her2k count the bytes of A and B read and of the triangle of C
+// read and written, in GB
+hipblasStatus_t testing_handle_counters_syr2k()
+{
+    Arguments          argus;
+    hipblasLocalHandle handle(argus);
+
+    const int      N       = 300;
+    const int      K       = 200;
+    const size_t   size_ab = size_t(N) * K;
+    const size_t   size_c  = size_t(N) * N;
+    float          alpha   = 1.0f;
+    float          beta    = 1.0f;
+    hipblasComplex calpha  = {1.0f, 0.0f};
+
+    device_vector<float>          dA(size_ab), dB(size_ab), dC(size_c);
+    device_vector<hipblasComplex> dcA(size_ab), dcB(size_ab), dcC(size_c);
+    CHECK_HIP_ERROR(hipMemset(dA, 0, size_ab * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, size_ab * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dC, 0, size_c * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dcA, 0, size_ab * sizeof(hipblasComplex)));
+    CHECK_HIP_ERROR(hipMemset(dcB, 0, size_ab * sizeof(hipblasComplex)));
+    CHECK_HIP_ERROR(hipMemset(dcC, 0, size_c * sizeof(hipblasComplex)));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSetHandleCountersMode(handle, HIPBLAS_COUNTERS_ON));
+
+    CHECK_HIPBLAS_ERROR(hipblasSsyr2k(
+        handle, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_OP_N, N, K, &alpha, dA, N, dB, N, &beta, dC, N));
+    CHECK_HIPBLAS_ERROR(hipblasCher2k(handle,
+                                      HIPBLAS_FILL_MODE_UPPER,
+                                      HIPBLAS_OP_N,
+                                      N,
+                                      K,
+                                      &calpha,
+                                      dcA,
+                                      N,
+                                      dcB,
+                                      N,
+                                      &beta,
+                                      dcC,
+                                      N));
+
+    // Counters come back sorted by family name
+    hipblasRoutineCounters_t counters[3];
+    int                      count = 3;
+    CHECK_HIPBLAS_ERROR(hipblasGetHandleCounters(handle, counters, &count));
+    if(count != 2 || strcmp(counters[0].routine, "her2k") != 0
+       || strcmp(counters[1].routine, "syr2k") != 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    double elements = 2.0 * size_ab + 2.0 * N * (N + 1) / 2;
+    double gbyte[]  = {sizeof(hipblasComplex) * elements / 1e9, sizeof(float) * elements / 1e9};
+    for(int i = 0; i < count; i++)
+        if(counters[i].calls != 1 || std::abs(counters[i].gbyte - gbyte[i]) > 1e-6 * gbyte[i])
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <thread>
+#include <vector>
+
+#include "testing_common.hpp"
+
+// Released handles come back with default settings, per-thread handles are stable, and a
+// thread's handle goes back to the pool when the thread exits
+hipblasStatus_t testing_handle_pool()
+{
+    hipblasHandlePool_t pool;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&pool, 4));
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    hipblasHandle_t handle;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, &handle));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, handle));
+
+    hipblasHandle_t      recycled;
+    hipStream_t          recycled_stream;
+    hipblasPointerMode_t recycled_mode;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, &recycled));
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(recycled, &recycled_stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(recycled, &recycled_mode));
+
+    bool pass = recycled == handle && recycled_stream == nullptr
+                && recycled_mode == HIPBLAS_POINTER_MODE_HOST;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, recycled));
+
+    // Many threads acquiring and releasing at once
+    std::vector<std::thread> threads;
+    std::vector<int>         thread_pass(8, 0);
+    for(int t = 0; t < 8; t++)
+        threads.emplace_back([&, t] {
+            hipblasHandle_t thread_handle, thread_handle2, pooled;
+            int             ok = 1;
+            for(int iter = 0; iter < 100 && ok; iter++)
+            {
+                ok = hipblasHandlePoolAcquire(pool, &pooled) == HIPBLAS_STATUS_SUCCESS
+                     && hipblasHandlePoolRelease(pool, pooled) == HIPBLAS_STATUS_SUCCESS;
+            }
+            ok = ok && hipblasHandlePoolGetThreadHandle(pool, &thread_handle)
+                           == HIPBLAS_STATUS_SUCCESS
+                 && hipblasHandlePoolGetThreadHandle(pool, &thread_handle2)
+                        == HIPBLAS_STATUS_SUCCESS
+                 && thread_handle == thread_handle2;
+            thread_pass[t] = ok;
+        });
+    for(auto& thread : threads)
+        thread.join();
+    for(int ok : thread_pass)
+        pass = pass && ok;
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+
+    // The pool has no free handle, so the next one acquired is the exited thread's
+    hipblasHandlePool_t exit_pool;
+    hipblasHandle_t     exited = nullptr;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolCreate(&exit_pool, 1));
+    std::thread([&] {
+        if(hipblasHandlePoolGetThreadHandle(exit_pool, &exited) == HIPBLAS_STATUS_SUCCESS)
+            (void)hipblasSetPointerMode(exited, HIPBLAS_POINTER_MODE_DEVICE);
+    }).join();
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(exit_pool, &recycled));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(recycled, &recycled_mode));
+    pass = pass && exited && recycled == exited && recycled_mode == HIPBLAS_POINTER_MODE_HOST;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(exit_pool, recycled));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(exit_pool));
+
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    return pass ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
@@ -160,30 +160,22 @@ hipblasStatus_t testing_hemv_batched(const Arguments& argus)
     if(argus.timing)
     {
         CHECK_HIP_ERROR(dy.transfer_from(hy));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasHemvBatchedFn(handle,
-                                                     uplo,
-                                                     N,
-                                                     d_alpha,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     d_beta,
-                                                     dy.ptr_on_device(),
-                                                     incy,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasHemvBatchedFn(handle,
+                                        uplo,
+                                        N,
+                                        d_alpha,
+                                        dA.ptr_on_device(),
+                                        lda,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        d_beta,
+                                        dy.ptr_on_device(),
+                                        incy,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_N, e_alpha, e_lda, e_incx, e_beta, e_incy, e_batch_count>{}.log_args<T>(
             std::cout,
@@ -184,33 +184,25 @@ hipblasStatus_t testing_hemv_strided_batched(const Arguments& argus)
     if(argus.timing)
     {
         CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasHemvStridedBatchedFn(handle,
-                                                            uplo,
-                                                            N,
-                                                            d_alpha,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            d_beta,
-                                                            dy,
-                                                            incy,
-                                                            stride_y,
-                                                            batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasHemvStridedBatchedFn(handle,
+                                               uplo,
+                                               N,
+                                               d_alpha,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               d_beta,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_N,
                       e_alpha,
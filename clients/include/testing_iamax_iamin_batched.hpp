@@ -117,20 +117,11 @@ hipblasStatus_t testing_iamax_iamin_batched(const Arguments&                 arg
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(
-                func(handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result_device));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return func(handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result_device);
+        }));
 
         ArgumentModel<e_N, e_incx, e_batch_count>{}.log_args<T>(std::cout,
                                                                 argus,
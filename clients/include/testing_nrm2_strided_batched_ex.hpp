@@ -150,28 +150,20 @@ hipblasStatus_t testing_nrm2_strided_batched_ex_template(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
-                                                              N,
-                                                              dx,
-                                                              xType,
-                                                              incx,
-                                                              stridex,
-                                                              batch_count,
-                                                              d_hipblas_result,
-                                                              resultType,
-                                                              executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasNrm2StridedBatchedExFn(handle,
+                                                 N,
+                                                 dx,
+                                                 xType,
+                                                 incx,
+                                                 stridex,
+                                                 batch_count,
+                                                 d_hipblas_result,
+                                                 resultType,
+                                                 executionType);
+        }));
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_batch_count>{}.log_args<Tx>(
             std::cout,
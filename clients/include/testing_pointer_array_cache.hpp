@@ -0,0 +1,72 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+// Requesting the same host pointer array again should return the cached device copy
+hipblasStatus_t testing_pointer_array_cache()
+{
+    Arguments          argus;
+    hipblasLocalHandle handle(argus);
+
+    int   N           = 100;
+    int   batch_count = 4;
+    float alpha       = 2.0f;
+
+    host_vector<float>   hx(N * batch_count, 1.0f);
+    host_vector<float>   hy(N * batch_count, 0.0f);
+    device_vector<float> dx(N * batch_count);
+    device_vector<float> dy(N * batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+
+    std::vector<const void*> x_array(batch_count);
+    std::vector<const void*> y_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        x_array[b] = dx + b * N;
+        y_array[b] = dy + b * N;
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    void** first_x = nullptr;
+    for(int step = 0; step < 3; step++)
+    {
+        void** dx_array;
+        void** dy_array;
+        CHECK_HIPBLAS_ERROR(
+            hipblasGetDevicePointerArray(handle, x_array.data(), batch_count, &dx_array));
+        CHECK_HIPBLAS_ERROR(
+            hipblasGetDevicePointerArray(handle, y_array.data(), batch_count, &dy_array));
+        CHECK_HIPBLAS_ERROR(hipblasSaxpyBatched(
+            handle, N, &alpha, (float* const*)dx_array, 1, (float* const*)dy_array, 1, batch_count));
+
+        if(!first_x)
+            first_x = dx_array;
+        else if(dx_array != first_x)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(float) * hy.size(), hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < hy.size(); i++)
+        if(hy[i] != 3 * alpha)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    size_t hits, misses;
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerArrayCacheStats(handle, &hits, &misses));
+    if(hits != 4 || misses != 2)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // Changed content is a new entry
+    std::swap(x_array[0], x_array[1]);
+    void** swapped;
+    CHECK_HIPBLAS_ERROR(hipblasGetDevicePointerArray(handle, x_array.data(), batch_count, &swapped));
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerArrayCacheStats(handle, &hits, &misses));
+    if(swapped == first_x || hits != 4 || misses != 3)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    CHECK_HIPBLAS_ERROR(hipblasClearPointerArrayCache(handle));
+    return HIPBLAS_STATUS_SUCCESS;
+}
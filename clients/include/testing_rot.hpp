@@ -130,19 +130,11 @@ hipblasStatus_t testing_rot(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dc, hc, sizeof(U), hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(ds, hs, sizeof(V), hipMemcpyHostToDevice));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotFn(handle, N, dx, incx, dy, incy, dc, ds));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotFn(handle, N, dx, incx, dy, incy, dc, ds);
+        }));
 
         ArgumentModel<e_N, e_incx, e_incy>{}.log_args<T>(std::cout,
                                                          arg,
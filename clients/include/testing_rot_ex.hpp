@@ -138,20 +138,12 @@ hipblasStatus_t testing_rot_ex_template(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotExFn(
-                handle, N, dx, xType, incx, dy, yType, incy, dc, ds, csType, executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotExFn(
+                handle, N, dx, xType, incx, dy, yType, incy, dc, ds, csType, executionType);
+        }));
 
         ArgumentModel<e_N, e_incx, e_incy>{}.log_args<Tx>(std::cout,
                                                           arg,
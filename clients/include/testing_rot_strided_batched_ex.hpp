@@ -172,33 +172,25 @@ hipblasStatus_t testing_rot_strided_batched_ex_template(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotStridedBatchedExFn(handle,
-                                                             N,
-                                                             dx,
-                                                             xType,
-                                                             incx,
-                                                             stridex,
-                                                             dy,
-                                                             yType,
-                                                             incy,
-                                                             stridey,
-                                                             dc,
-                                                             ds,
-                                                             csType,
-                                                             batch_count,
-                                                             executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotStridedBatchedExFn(handle,
+                                                N,
+                                                dx,
+                                                xType,
+                                                incx,
+                                                stridex,
+                                                dy,
+                                                yType,
+                                                incy,
+                                                stridey,
+                                                dc,
+                                                ds,
+                                                csType,
+                                                batch_count,
+                                                executionType);
+        }));
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_incy, e_stride_y>{}.log_args<Tx>(
             std::cout,
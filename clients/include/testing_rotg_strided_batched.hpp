@@ -142,20 +142,12 @@ hipblasStatus_t testing_rotg_strided_batched(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR((hipblasRotgStridedBatchedFn(
-                handle, da, stride_a, db, stride_b, dc, stride_c, ds, stride_s, batch_count)));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotgStridedBatchedFn(
+                handle, da, stride_a, db, stride_b, dc, stride_c, ds, stride_s, batch_count);
+        }));
 
         ArgumentModel<e_batch_count>{}.log_args<T>(std::cout,
                                                    arg,
@@ -148,32 +148,24 @@ hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
     {
         for(int b = 0; b < batch_count; b++)
             (hparam + b * stride_param)[0] = 0;
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
         CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * size_x, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dparam, hparam, sizeof(T) * size_param, hipMemcpyHostToDevice));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR((hipblasRotmStridedBatchedFn(handle,
-                                                             N,
-                                                             dx,
-                                                             incx,
-                                                             stride_x,
-                                                             dy,
-                                                             incy,
-                                                             stride_y,
-                                                             dparam,
-                                                             stride_param,
-                                                             batch_count)));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotmStridedBatchedFn(handle,
+                                               N,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               dparam,
+                                               stride_param,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_N, e_incx, e_stride_x, e_incy, e_stride_y, e_batch_count>{}.log_args<T>(
             std::cout,
@@ -66,20 +66,12 @@ hipblasStatus_t testing_rotmg(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotmgFn(
-                handle, dparams, dparams + 1, dparams + 2, dparams + 3, dparams + 4));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotmgFn(
+                handle, dparams, dparams + 1, dparams + 2, dparams + 3, dparams + 4);
+        }));
 
         ArgumentModel<>{}.log_args<T>(std::cout,
                                       arg,
@@ -154,25 +154,17 @@ hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotmgBatchedFn(handle,
-                                                      dd1.ptr_on_device(),
-                                                      dd2.ptr_on_device(),
-                                                      dx1.ptr_on_device(),
-                                                      dy1.ptr_on_device(),
-                                                      dparams.ptr_on_device(),
-                                                      batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotmgBatchedFn(handle,
+                                         dd1.ptr_on_device(),
+                                         dd2.ptr_on_device(),
+                                         dx1.ptr_on_device(),
+                                         dy1.ptr_on_device(),
+                                         dparams.ptr_on_device(),
+                                         batch_count);
+        }));
 
         ArgumentModel<e_batch_count>{}.log_args<T>(std::cout,
                                                    arg,
@@ -182,30 +182,22 @@ hipblasStatus_t testing_rotmg_strided_batched(const Arguments& arg)
 
     if(arg.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasRotmgStridedBatchedFn(handle,
-                                                             dd1,
-                                                             stride_d1,
-                                                             dd2,
-                                                             stride_d2,
-                                                             dx1,
-                                                             stride_x1,
-                                                             dy1,
-                                                             stride_y1,
-                                                             dparams,
-                                                             stride_param,
-                                                             batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, arg, gpu_time_used, [&] {
+            return hipblasRotmgStridedBatchedFn(handle,
+                                                dd1,
+                                                stride_d1,
+                                                dd2,
+                                                stride_d2,
+                                                dx1,
+                                                stride_x1,
+                                                dy1,
+                                                stride_y1,
+                                                dparams,
+                                                stride_param,
+                                                batch_count);
+        }));
 
         ArgumentModel<e_batch_count>{}.log_args<T>(std::cout,
                                                    arg,
@@ -91,19 +91,9 @@ hipblasStatus_t testing_scal_batched(const Arguments& argus)
 
     if(timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(
-                hipblasScalBatchedFn(handle, N, &alpha, dx.ptr_on_device(), incx, batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasScalBatchedFn(handle, N, &alpha, dx.ptr_on_device(), incx, batch_count);
+        }));
 
         ArgumentModel<e_N, e_incx, e_batch_count>{}.log_args<T>(std::cout,
                                                                 argus,
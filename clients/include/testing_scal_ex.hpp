@@ -106,20 +106,11 @@ hipblasStatus_t testing_scal_ex_template(const Arguments& argus)
 
     if(timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(
-                hipblasScalExFn(handle, N, d_alpha, alphaType, dx, xType, incx, executionType));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasScalExFn(handle, N, d_alpha, alphaType, dx, xType, incx, executionType);
+        }));
 
         ArgumentModel<e_N, e_alpha, e_incx>{}.log_args<Tx>(std::cout,
                                                            argus,
@@ -98,18 +98,34 @@ hipblasStatus_t testing_set_get_matrix(const Arguments& argus)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = argus.cold_iters + argus.iters;
+        // Each direction is timed on its own, as their bandwidths differ
+        double set_time_used = 0.0, get_time_used = 0.0;
+        int    runs          = argus.cold_iters + argus.iters;
         for(int iter = 0; iter < runs; iter++)
         {
             if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+                set_time_used = get_time_us_sync(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSetMatrixFn(rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc));
+        }
+        set_time_used = get_time_us_sync(stream) - set_time_used;
+
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                get_time_used = get_time_us_sync(stream);
+
             CHECK_HIPBLAS_ERROR(
                 hipblasGetMatrixFn(rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        get_time_used = get_time_us_sync(stream) - get_time_used;
+        gpu_time_used = set_time_used + get_time_used;
+
+        // GB moved each way by the timed calls: the rows x cols elements,
+        // whatever lda, ldb and ldc are
+        int    hot_calls = argus.iters < 1 ? 1 : argus.iters;
+        double gbytes    = set_get_matrix_gbyte_count<T>(rows, cols) / 2 * hot_calls;
 
         ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc>{}.log_args<T>(
             std::cout,
@@ -117,7 +133,10 @@ hipblasStatus_t testing_set_get_matrix(const Arguments& argus)
             gpu_time_used,
             ArgumentLogging::NA_value,
             set_get_matrix_gbyte_count<T>(rows, cols),
-            hipblas_error);
+            hipblas_error,
+            0,
+            {{"set-GB/s", gbytes / set_time_used * 1e6},
+             {"get-GB/s", gbytes / get_time_used * 1e6}});
     }
 
     return HIPBLAS_STATUS_SUCCESS;
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_set_get_matrix_batched(const Arguments& argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M) || ldc < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> ha(size_t(lda) * N, 1, batch_count);
+    host_batch_vector<T> hb(size_t(ldb) * N, 1, batch_count);
+    host_batch_vector<T> hb_ref(size_t(ldb) * N, 1, batch_count);
+    host_batch_vector<T> hc(size_t(ldc) * N, 1, batch_count);
+
+    device_batch_vector<T> dc(size_t(ldc) * N, 1, batch_count);
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    hipblas_init(ha, true);
+    hipblas_init(hb);
+    hipblas_init(hc);
+    hb_ref.copy_from(hb);
+    CHECK_HIP_ERROR(dc.transfer_from(hc));
+
+    auto set_batched = [&] {
+        return hipblasSetMatrixBatched(handle,
+                                       M,
+                                       N,
+                                       sizeof(T),
+                                       (const void* const*)(T**)ha,
+                                       lda,
+                                       (void* const*)dc.ptr_on_device(),
+                                       ldc,
+                                       batch_count);
+    };
+    auto get_batched = [&] {
+        return hipblasGetMatrixBatched(handle,
+                                       M,
+                                       N,
+                                       sizeof(T),
+                                       (const void* const*)dc.ptr_on_device(),
+                                       ldc,
+                                       (void* const*)(T**)hb,
+                                       ldb,
+                                       batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(set_batched());
+    CHECK_HIPBLAS_ERROR(get_batched());
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int i1 = 0; i1 < M; i1++)
+            {
+                for(int i2 = 0; i2 < N; i2++)
+                {
+                    hb_ref[b][i1 + i2 * ldb] = ha[b][i1 + i2 * lda];
+                }
+            }
+        }
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldb, hb_ref, hb);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', M, N, ldb, hb_ref, hb, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        // Each direction is timed on its own, as their bandwidths differ, and
+        // against a copy of each matrix on its own
+        double set_time_used = 0.0, get_time_used = 0.0;
+        double set_loop_time_used = 0.0, get_loop_time_used = 0.0;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_time_used, set_batched));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_time_used, get_batched));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_loop_time_used, [&] {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = hipblasSetMatrixAsync(M, N, sizeof(T), ha[b], lda, dc[b], ldc, stream);
+            return status;
+        }));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_loop_time_used, [&] {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = hipblasGetMatrixAsync(M, N, sizeof(T), dc[b], ldc, hb[b], ldb, stream);
+            return status;
+        }));
+        gpu_time_used = set_time_used + get_time_used;
+
+        // GB moved each way by the timed calls: the M x N elements of each
+        // matrix, whatever lda, ldb and ldc are
+        int    hot_calls = argus.iters < 1 ? 1 : argus.iters;
+        double gbytes    = set_get_matrix_gbyte_count<T>(M, N) / 2 * batch_count * hot_calls;
+
+        ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(M, N) * batch_count,
+            hipblas_error,
+            0,
+            {{"set-GB/s", gbytes / set_time_used * 1e6},
+             {"get-GB/s", gbytes / get_time_used * 1e6},
+             {"set-loop-GB/s", gbytes / set_loop_time_used * 1e6},
+             {"get-loop-GB/s", gbytes / get_loop_time_used * 1e6}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+inline size_t set_get_matrix_ex_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+        return 2;
+    case HIPBLAS_R_32F:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+// Stores x as element i of an array of the given type, one element at a time
+// as the clients convert without hipblasSetMatrixEx
+template <typename T>
+void set_get_matrix_ex_store(T x, hipblasDatatype_t type, void* dst, size_t i)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+        static_cast<int8_t*>(dst)[i]
+            = int8_t(std::min(std::max(std::nearbyint(x), T(-128)), T(127)));
+        break;
+    case HIPBLAS_R_16F:
+        static_cast<hipblasHalf*>(dst)[i] = float_to_half(float(x));
+        break;
+    case HIPBLAS_R_16B:
+        static_cast<hipblasBfloat16*>(dst)[i] = float_to_bfloat16(float(x));
+        break;
+    case HIPBLAS_R_32F:
+        static_cast<float*>(dst)[i] = float(x);
+        break;
+    default:
+        static_cast<double*>(dst)[i] = double(x);
+        break;
+    }
+}
+
+template <typename T>
+T set_get_matrix_ex_load(hipblasDatatype_t type, const void* src, size_t i)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+        return T(static_cast<const int8_t*>(src)[i]);
+    case HIPBLAS_R_16F:
+        return T(half_to_float(static_cast<const hipblasHalf*>(src)[i]));
+    case HIPBLAS_R_16B:
+        return T(bfloat16_to_float(static_cast<const hipblasBfloat16*>(src)[i]));
+    case HIPBLAS_R_32F:
+        return T(static_cast<const float*>(src)[i]);
+    default:
+        return T(static_cast<const double*>(src)[i]);
+    }
+}
+
+// Copies a float or double matrix to a device matrix of type argus.b_type and
+// back again
+template <typename T>
+hipblasStatus_t testing_set_get_matrix_ex(const Arguments& argus)
+{
+    int               M         = argus.M;
+    int               N         = argus.N;
+    int               lda       = argus.lda;
+    int               ldb       = argus.ldb;
+    int               ldc       = argus.ldc;
+    hipblasDatatype_t host_type = std::is_same<T, double>{} ? HIPBLAS_R_64F : HIPBLAS_R_32F;
+    hipblasDatatype_t dev_type  = argus.b_type;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    size_t dev_size = set_get_matrix_ex_size(dev_type);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>      ha(size_t(lda) * N);
+    host_vector<T>      hb(size_t(ldb) * N);
+    host_vector<T>      hb_ref(size_t(ldb) * N);
+    host_vector<int8_t> hc(size_t(ldc) * N * dev_size);
+
+    device_vector<int8_t> dc(size_t(ldc) * N * dev_size);
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(ha, M, N, lda);
+    hipblas_init<T>(hb, M, N, ldb);
+    hb_ref = hb;
+
+    auto set_ex = [&] {
+        return hipblasSetMatrixEx(handle, M, N, host_type, ha, lda, dev_type, dc, ldc);
+    };
+    auto get_ex = [&] {
+        return hipblasGetMatrixEx(handle, M, N, dev_type, dc, ldc, host_type, hb, ldb);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(set_ex());
+    CHECK_HIPBLAS_ERROR(get_ex());
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation: each element rounded to the device type and back
+        for(int i1 = 0; i1 < M; i1++)
+        {
+            for(int i2 = 0; i2 < N; i2++)
+            {
+                set_get_matrix_ex_store(ha[i1 + i2 * lda], dev_type, hc.data(), i1 + i2 * ldc);
+                hb_ref[i1 + i2 * ldb]
+                    = set_get_matrix_ex_load<T>(dev_type, hc.data(), i1 + i2 * ldc);
+            }
+        }
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, ldb, hb_ref, hb);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', M, N, ldb, hb_ref, hb);
+        }
+    }
+
+    if(argus.timing)
+    {
+        // Each direction is timed on its own, and against converting one
+        // element at a time on the host around a copy of the device type
+        size_t dev_bytes     = size_t(ldc) * N * dev_size;
+        double set_time_used = 0.0, get_time_used = 0.0;
+        double set_host_time_used = 0.0, get_host_time_used = 0.0;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_time_used, set_ex));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_time_used, get_ex));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_host_time_used, [&] {
+            for(int i2 = 0; i2 < N; i2++)
+                for(int i1 = 0; i1 < M; i1++)
+                    set_get_matrix_ex_store(
+                        ha[i1 + i2 * lda], dev_type, hc.data(), i1 + i2 * ldc);
+            return hipMemcpy(dc, hc.data(), dev_bytes, hipMemcpyHostToDevice) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_INTERNAL_ERROR;
+        }));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_host_time_used, [&] {
+            if(hipMemcpy(hc.data(), dc, dev_bytes, hipMemcpyDeviceToHost) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            for(int i2 = 0; i2 < N; i2++)
+                for(int i1 = 0; i1 < M; i1++)
+                    hb[i1 + i2 * ldb]
+                        = set_get_matrix_ex_load<T>(dev_type, hc.data(), i1 + i2 * ldc);
+            return HIPBLAS_STATUS_SUCCESS;
+        }));
+        gpu_time_used = set_time_used + get_time_used;
+
+        // GB of host matrix moved each way by the timed calls: the M x N
+        // elements, whatever the device type and the leading dimensions are
+        int    hot_calls = argus.iters < 1 ? 1 : argus.iters;
+        double gbytes    = set_get_matrix_gbyte_count<T>(M, N) / 2 * hot_calls;
+
+        ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc, e_b_type>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(M, N),
+            hipblas_error,
+            0,
+            {{"set-GB/s", gbytes / set_time_used * 1e6},
+             {"get-GB/s", gbytes / get_time_used * 1e6},
+             {"set-host-GB/s", gbytes / set_host_time_used * 1e6},
+             {"get-host-GB/s", gbytes / get_host_time_used * 1e6}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
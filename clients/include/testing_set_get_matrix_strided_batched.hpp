@@ -0,0 +1,180 @@
+/* ************************************************************************
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_set_get_matrix_strided_batched(const Arguments& argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldc          = argus.ldc;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M) || ldc < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // A stride_scale of 1 leaves the device matrices packed when ldc == M,
+    // which the library copies to and from directly
+    hipblasStride stride_a = size_t(lda) * N * stride_scale;
+    hipblasStride stride_b = size_t(ldb) * N * stride_scale;
+    hipblasStride stride_c = size_t(ldc) * N * stride_scale;
+    size_t        A_size   = stride_a * batch_count;
+    size_t        B_size   = stride_b * batch_count;
+    size_t        C_size   = stride_c * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> ha(A_size);
+    host_vector<T> hb(B_size);
+    host_vector<T> hb_ref(B_size);
+    host_vector<T> hc(C_size);
+
+    device_vector<T> dc(C_size);
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(ha, 1, A_size, 1);
+    hipblas_init<T>(hb, 1, B_size, 1);
+    hipblas_init<T>(hc, 1, C_size, 1);
+    hb_ref = hb;
+    CHECK_HIP_ERROR(hipMemcpy(dc, hc.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+    auto set_strided_batched = [&] {
+        return hipblasSetMatrixStridedBatched(
+            handle, M, N, sizeof(T), ha, lda, stride_a, dc, ldc, stride_c, batch_count);
+    };
+    auto get_strided_batched = [&] {
+        return hipblasGetMatrixStridedBatched(
+            handle, M, N, sizeof(T), dc, ldc, stride_c, hb, ldb, stride_b, batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(set_strided_batched());
+    CHECK_HIPBLAS_ERROR(get_strided_batched());
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hab     = ha.data() + b * stride_a;
+            T* hb_refb = hb_ref.data() + b * stride_b;
+            for(int i1 = 0; i1 < M; i1++)
+            {
+                for(int i2 = 0; i2 < N; i2++)
+                {
+                    hb_refb[i1 + i2 * ldb] = hab[i1 + i2 * lda];
+                }
+            }
+        }
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldb, stride_b, hb_ref, hb);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error
+                = norm_check_general<T>('F', M, N, ldb, stride_b, hb_ref, hb, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        // Each direction is timed on its own, as their bandwidths differ, and
+        // against a copy of each matrix on its own
+        double set_time_used = 0.0, get_time_used = 0.0;
+        double set_loop_time_used = 0.0, get_loop_time_used = 0.0;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_time_used, set_strided_batched));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_time_used, get_strided_batched));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, set_loop_time_used, [&] {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = hipblasSetMatrixAsync(M,
+                                               N,
+                                               sizeof(T),
+                                               ha.data() + b * stride_a,
+                                               lda,
+                                               (T*)dc + b * stride_c,
+                                               ldc,
+                                               stream);
+            return status;
+        }));
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, get_loop_time_used, [&] {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = hipblasGetMatrixAsync(M,
+                                               N,
+                                               sizeof(T),
+                                               (T*)dc + b * stride_c,
+                                               ldc,
+                                               hb.data() + b * stride_b,
+                                               ldb,
+                                               stream);
+            return status;
+        }));
+        gpu_time_used = set_time_used + get_time_used;
+
+        // GB moved each way by the timed calls: the M x N elements of each
+        // matrix, whatever the leading dimensions and strides are
+        int    hot_calls = argus.iters < 1 ? 1 : argus.iters;
+        double gbytes    = set_get_matrix_gbyte_count<T>(M, N) / 2 * batch_count * hot_calls;
+
+        ArgumentModel<e_M,
+                      e_N,
+                      e_lda,
+                      e_stride_a,
+                      e_ldb,
+                      e_stride_b,
+                      e_ldc,
+                      e_stride_c,
+                      e_batch_count>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         ArgumentLogging::NA_value,
+                         set_get_matrix_gbyte_count<T>(M, N) * batch_count,
+                         hipblas_error,
+                         0,
+                         {{"set-GB/s", gbytes / set_time_used * 1e6},
+                          {"get-GB/s", gbytes / get_time_used * 1e6},
+                          {"set-loop-GB/s", gbytes / set_loop_time_used * 1e6},
+                          {"get-loop-GB/s", gbytes / get_loop_time_used * 1e6}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
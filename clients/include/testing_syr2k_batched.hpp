@@ -154,32 +154,24 @@ hipblasStatus_t testing_syr2k_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasSyr2kBatchedFn(handle,
-                                                      uplo,
-                                                      transA,
-                                                      N,
-                                                      K,
-                                                      d_alpha,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      dB.ptr_on_device(),
-                                                      ldb,
-                                                      d_beta,
-                                                      dC.ptr_on_device(),
-                                                      ldc,
-                                                      batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasSyr2kBatchedFn(handle,
+                                         uplo,
+                                         transA,
+                                         N,
+                                         K,
+                                         d_alpha,
+                                         dA.ptr_on_device(),
+                                         lda,
+                                         dB.ptr_on_device(),
+                                         ldb,
+                                         d_beta,
+                                         dC.ptr_on_device(),
+                                         ldc,
+                                         batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
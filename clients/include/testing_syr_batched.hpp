@@ -130,27 +130,19 @@ hipblasStatus_t testing_syr_batched(const Arguments& argus)
     if(argus.timing)
     {
         CHECK_HIP_ERROR(dA.transfer_from(hA));
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasSyrBatchedFn(handle,
-                                                    uplo,
-                                                    N,
-                                                    d_alpha,
-                                                    dx.ptr_on_device(),
-                                                    incx,
-                                                    dA.ptr_on_device(),
-                                                    lda,
-                                                    batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasSyrBatchedFn(handle,
+                                       uplo,
+                                       N,
+                                       d_alpha,
+                                       dx.ptr_on_device(),
+                                       incx,
+                                       dA.ptr_on_device(),
+                                       lda,
+                                       batch_count);
+        }));
 
         ArgumentModel<e_N, e_alpha, e_incx, e_lda, e_batch_count>{}.log_args<T>(
             std::cout,
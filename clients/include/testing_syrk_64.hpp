@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <climits>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_syrk_64(const Arguments& argus)
+{
+    int64_t N   = argus.N;
+    int64_t K   = argus.K;
+    int64_t lda = argus.lda;
+    int64_t ldc = argus.ldc;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int64_t K1     = (transA == HIPBLAS_OP_N ? K : N);
+    size_t  A_size = size_t(lda) * K1;
+    size_t  C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    T h_alpha = argus.get_alpha<T>();
+    T h_beta  = argus.get_beta<T>();
+
+    double             gpu_time_used, hipblas_error_host = 0, hipblas_error_device = 0;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU, element by element as the sizes may not fit hipblas_init
+    srand(1);
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = random_generator<T>();
+    for(size_t i = 0; i < C_size; i++)
+        hC_host[i] = random_generator<T>();
+
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // The CPU reference takes int sizes, so larger problems are only timed
+    bool check = (argus.unit_check || argus.norm_check) && A_size <= INT_MAX && C_size <= INT_MAX;
+    if(check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSyrk_64<T>(handle, uplo, transA, N, K, &h_alpha, dA, lda, &h_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSyrk_64<T>(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_syrk<T>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_host);
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host   = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_host);
+            hipblas_error_device = norm_check_general<T>('F', N, N, ldc, hC_gold, hC_device);
+        }
+
+    } // end of if unit/norm check
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasSyrk_64<T>(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc);
+        }));
+
+        ArgumentModel<e_uplo_option, e_transA_option, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         syrk_gflop_count<T>(N, K),
+                         syrk_gbyte_count<T>(N, K),
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -172,35 +172,27 @@ hipblasStatus_t testing_syrkx_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasSyrkxStridedBatchedFn(handle,
-                                                             uplo,
-                                                             transA,
-                                                             N,
-                                                             K,
-                                                             d_alpha,
-                                                             dA,
-                                                             lda,
-                                                             stride_A,
-                                                             dB,
-                                                             ldb,
-                                                             stride_B,
-                                                             d_beta,
-                                                             dC,
-                                                             ldc,
-                                                             stride_C,
-                                                             batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasSyrkxStridedBatchedFn(handle,
+                                                uplo,
+                                                transA,
+                                                N,
+                                                K,
+                                                d_alpha,
+                                                dA,
+                                                lda,
+                                                stride_A,
+                                                dB,
+                                                ldb,
+                                                stride_B,
+                                                d_beta,
+                                                dC,
+                                                ldc,
+                                                stride_C,
+                                                batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
@@ -115,28 +115,20 @@ hipblasStatus_t testing_tbmv_batched(const Arguments& argus)
     {
         CHECK_HIP_ERROR(dx.transfer_from(hx));
 
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTbmvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     K,
-                                                     dA.ptr_on_device(),
-                                                     lda,
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTbmvBatchedFn(handle,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        M,
+                                        K,
+                                        dA.ptr_on_device(),
+                                        lda,
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
@@ -129,30 +129,22 @@ hipblasStatus_t testing_tbmv_strided_batched(const Arguments& argus)
     {
         CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * x_size, hipMemcpyHostToDevice));
 
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTbmvStridedBatchedFn(handle,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            K,
-                                                            dA,
-                                                            lda,
-                                                            stride_A,
-                                                            dx,
-                                                            incx,
-                                                            stride_x,
-                                                            batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTbmvStridedBatchedFn(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               M,
+                                               K,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
@@ -131,28 +131,19 @@ hipblasStatus_t testing_tbsv_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTbsvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     K,
-                                                     dAB.ptr_on_device(),
-                                                     lda,
-                                                     dx_or_b.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTbsvBatchedFn(handle,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        M,
+                                        K,
+                                        dAB.ptr_on_device(),
+                                        lda,
+                                        dx_or_b.ptr_on_device(),
+                                        incx,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
@@ -108,26 +108,17 @@ hipblasStatus_t testing_tpmv_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTpmvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     M,
-                                                     dA.ptr_on_device(),
-                                                     dx.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTpmvBatchedFn(handle,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        M,
+                                        dA.ptr_on_device(),
+                                        dx.ptr_on_device(),
+                                        incx,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_uplo_option, e_transA_option, e_diag_option, e_M, e_incx, e_batch_count>{}
             .log_args<T>(std::cout,
@@ -172,27 +172,19 @@ hipblasStatus_t testing_tpsv_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTpsvBatchedFn(handle,
-                                                     uplo,
-                                                     transA,
-                                                     diag,
-                                                     N,
-                                                     dAP.ptr_on_device(),
-                                                     dx_or_b.ptr_on_device(),
-                                                     incx,
-                                                     batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTpsvBatchedFn(handle,
+                                        uplo,
+                                        transA,
+                                        diag,
+                                        N,
+                                        dAP.ptr_on_device(),
+                                        dx_or_b.ptr_on_device(),
+                                        incx,
+                                        batch_count);
+        }));
 
         ArgumentModel<e_uplo_option, e_transA_option, e_diag_option, e_N, e_incx, e_batch_count>{}
             .log_args<T>(std::cout,
@@ -122,19 +122,10 @@ hipblasStatus_t testing_trmv_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTrmvStridedBatchedFn(
-                handle, uplo, transA, diag, M, dA, lda, stride_A, dx, incx, stride_x, batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTrmvStridedBatchedFn(
+                handle, uplo, transA, diag, M, dA, lda, stride_A, dx, incx, stride_x, batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
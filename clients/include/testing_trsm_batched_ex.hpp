@@ -240,37 +240,26 @@ hipblasStatus_t testing_trsm_batched_ex(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
-
-            CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
-                                                       side,
-                                                       uplo,
-                                                       transA,
-                                                       diag,
-                                                       M,
-                                                       N,
-                                                       d_alpha,
-                                                       dA.ptr_on_device(),
-                                                       lda,
-                                                       dB.ptr_on_device(),
-                                                       ldb,
-                                                       batch_count,
-                                                       dinvA.ptr_on_device(),
-                                                       TRSM_BLOCK * K,
-                                                       argus.compute_type));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTrsmBatchedExFn(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          M,
+                                          N,
+                                          d_alpha,
+                                          dA.ptr_on_device(),
+                                          lda,
+                                          dB.ptr_on_device(),
+                                          ldb,
+                                          batch_count,
+                                          dinvA.ptr_on_device(),
+                                          TRSM_BLOCK * K,
+                                          argus.compute_type);
+        }));
 
         ArgumentModel<e_side_option,
                       e_uplo_option,
@@ -165,30 +165,22 @@ hipblasStatus_t testing_trsv_strided_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTrsvStridedBatchedFn(handle,
-                                                            uplo,
-                                                            transA,
-                                                            diag,
-                                                            M,
-                                                            dA,
-                                                            lda,
-                                                            strideA,
-                                                            dx_or_b,
-                                                            incx,
-                                                            stridex,
-                                                            batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTrsvStridedBatchedFn(handle,
+                                               uplo,
+                                               transA,
+                                               diag,
+                                               M,
+                                               dA,
+                                               lda,
+                                               strideA,
+                                               dx_or_b,
+                                               incx,
+                                               stridex,
+                                               batch_count);
+        }));
 
         ArgumentModel<e_uplo_option,
                       e_transA_option,
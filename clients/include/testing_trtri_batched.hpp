@@ -125,26 +125,17 @@ hipblasStatus_t testing_trtri_batched(const Arguments& argus)
 
     if(argus.timing)
     {
-        hipStream_t stream;
-        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
-
-        int runs = argus.cold_iters + argus.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == argus.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
-            CHECK_HIPBLAS_ERROR(hipblasTrtriBatchedFn(handle,
-                                                      uplo,
-                                                      diag,
-                                                      N,
-                                                      dA.ptr_on_device(),
-                                                      lda,
-                                                      dinvA.ptr_on_device(),
-                                                      ldinvA,
-                                                      batch_count));
-        }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        CHECK_HIPBLAS_ERROR(hipblas_time_calls(handle, argus, gpu_time_used, [&] {
+            return hipblasTrtriBatchedFn(handle,
+                                         uplo,
+                                         diag,
+                                         N,
+                                         dA.ptr_on_device(),
+                                         lda,
+                                         dinvA.ptr_on_device(),
+                                         ldinvA,
+                                         batch_count);
+        }));
 
         ArgumentModel<e_uplo_option, e_diag_option, e_N, e_lda, e_batch_count>{}.log_args<T>(
             std::cout,
@@ -0,0 +1,50 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_common.hpp"
+
+// Repeated solver calls with the same shape should reuse the cached workspace size
+hipblasStatus_t testing_workspace_cache()
+{
+    Arguments          argus;
+    hipblasLocalHandle handle(argus);
+
+    int    N      = 64;
+    int    lda    = N;
+    size_t A_size = size_t(lda) * N;
+
+    host_vector<float> hA(A_size);
+    srand(1);
+    hipblas_init<float>(hA, N, N, lda);
+    for(int i = 0; i < N; i++)
+        hA[i + i * lda] += 400;
+
+    device_vector<float> dA(A_size);
+    device_vector<int>   dIpiv(N);
+    device_vector<int>   dInfo(1);
+
+    size_t hits, misses;
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceCacheStats(handle, &hits, &misses));
+    if(hits != 0 || misses != 0)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    for(int iter = 0; iter < 3; iter++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(float), hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSgetrf(handle, N, dA, lda, dIpiv, dInfo));
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceCacheStats(handle, &hits, &misses));
+    if(hits != 2 || misses != 1)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // A new size is a new cache entry
+    CHECK_HIPBLAS_ERROR(hipblasSgetrf(handle, N / 2, dA, lda, dIpiv, dInfo));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceCacheStats(handle, &hits, &misses));
+    if(hits != 2 || misses != 2)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
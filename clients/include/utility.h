@@ -511,6 +511,14 @@ inline void hipblas_init_nan(T* A, size_t N)
         A[i] = T(hipblas_nan_rng());
 }
 
+// Arrays of pointers, as for the device arrays of the batched routines, have no NaN
+template <typename T>
+inline void hipblas_init_nan(T** A, size_t N)
+{
+    for(size_t i = 0; i < N; ++i)
+        A[i] = nullptr;
+}
+
 template <typename T>
 inline void hipblass_init_nan(
     std::vector<T>& A, size_t M, size_t N, size_t lda, size_t stride = 0, size_t batch_count = 1)
@@ -742,6 +750,7 @@ class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    hipStream_t     m_stream = nullptr;
 
 public:
     hipblasLocalHandle();
@@ -768,5 +777,52 @@ public:
 
 #include "hipblas_arguments.hpp"
 
+/* ============================================================================================ */
+/*! \brief  Make arg.cold_iters calls of call, then time arg.iters more, in microseconds. With
+ *          arg.graph the timed calls are captured into a graph and timed as one launch of it. */
+template <typename F>
+hipblasStatus_t
+    hipblas_time_calls(hipblasHandle_t handle, const Arguments& arg, double& time_us, F&& call)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    for(int iter = 0; iter < arg.cold_iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+        status = call();
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(!arg.graph)
+    {
+        time_us = get_time_us_sync(stream);
+        for(int iter = 0; iter < arg.iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+            status = call();
+        time_us = get_time_us_sync(stream) - time_us;
+        return status;
+    }
+
+    status = hipblasGraphBegin(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    for(int iter = 0; iter < arg.iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+        status = call();
+
+    // End the capture even if a call failed
+    hipblasGraph_t  graph      = nullptr;
+    hipblasStatus_t end_status = hipblasGraphEnd(handle, &graph);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = end_status;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasGraphDestroy(graph);
+        return status;
+    }
+
+    time_us = get_time_us_sync(stream);
+    status  = hipblasGraphLaunch(handle, graph);
+    time_us = get_time_us_sync(stream) - time_us;
+    hipblasGraphDestroy(graph);
+    return status;
+}
+
 #endif // __cplusplus
 #endif
@@ -0,0 +1,296 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+// hipblas-overhead: host time per call of every hipBLAS entry point, for
+// hipBLAS built with HIPBLAS_BACKEND=null. The backend does nothing, so the
+// time is that of hipBLAS itself and no GPU is needed. Every argument is
+// generated from its type: pointers point at a zeroed scratch buffer, sizes
+// and increments are 1 and enums take their first valid value. HIPBLAS_LAYER
+// may be set to measure the cost of logging.
+//
+// Prints one CSV line per entry point: function,ns_per_call,status
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "hipblas.h"
+
+namespace
+{
+    // Target of every pointer argument; zeroed before each entry point is timed
+    alignas(64) char scratch[1 << 16];
+
+    hipblasHandle_t     handle;
+    hipblasHandlePool_t pool;
+
+    // Value passed for an argument of type T. first is set for the first
+    // argument, which is the handle when it is a hipblasHandle_t.
+    template <typename T>
+    struct argument
+    {
+        static T get(bool)
+        {
+            static_assert(std::is_arithmetic<T>{}, "no value for this argument type");
+            return T(1);
+        }
+    };
+
+    template <typename T>
+    struct argument<T*>
+    {
+        static T* get(bool)
+        {
+            return reinterpret_cast<T*>(scratch);
+        }
+    };
+
+    template <>
+    struct argument<void*>
+    {
+        static void* get(bool first)
+        {
+            return first ? handle : scratch;
+        }
+    };
+
+    template <>
+    struct argument<hipblasHandlePool_t>
+    {
+        static hipblasHandlePool_t get(bool)
+        {
+            return pool;
+        }
+    };
+
+    // Graphs are only ever made by a capture, which the null stream cannot do
+    template <>
+    struct argument<hipblasGraph_t>
+    {
+        static hipblasGraph_t get(bool)
+        {
+            return nullptr;
+        }
+    };
+
+    template <>
+    struct argument<hipStream_t>
+    {
+        static hipStream_t get(bool)
+        {
+            return nullptr;
+        }
+    };
+
+#define HIPBLAS_ENUM_ARGUMENT(type__, value__) \
+    template <>                                \
+    struct argument<type__>                    \
+    {                                          \
+        static type__ get(bool)                \
+        {                                      \
+            return value__;                    \
+        }                                      \
+    };
+
+    HIPBLAS_ENUM_ARGUMENT(hipblasStatus_t, HIPBLAS_STATUS_SUCCESS)
+    HIPBLAS_ENUM_ARGUMENT(hipblasOperation_t, HIPBLAS_OP_N)
+    HIPBLAS_ENUM_ARGUMENT(hipblasFillMode_t, HIPBLAS_FILL_MODE_UPPER)
+    HIPBLAS_ENUM_ARGUMENT(hipblasDiagType_t, HIPBLAS_DIAG_NON_UNIT)
+    HIPBLAS_ENUM_ARGUMENT(hipblasSideMode_t, HIPBLAS_SIDE_LEFT)
+    HIPBLAS_ENUM_ARGUMENT(hipblasDatatype_t, HIPBLAS_R_32F)
+    HIPBLAS_ENUM_ARGUMENT(hipblasGemmAlgo_t, HIPBLAS_GEMM_DEFAULT)
+    HIPBLAS_ENUM_ARGUMENT(hipblasPointerMode_t, HIPBLAS_POINTER_MODE_HOST)
+    HIPBLAS_ENUM_ARGUMENT(hipblasAtomicsMode_t, HIPBLAS_ATOMICS_ALLOWED)
+    HIPBLAS_ENUM_ARGUMENT(hipblasCountersMode_t, HIPBLAS_COUNTERS_OFF)
+    HIPBLAS_ENUM_ARGUMENT(hipblasCoalescingMode_t, HIPBLAS_COALESCING_OFF)
+
+#undef HIPBLAS_ENUM_ARGUMENT
+
+    const char* status_name(hipblasStatus_t status)
+    {
+        return hipblasStatusToString(status);
+    }
+
+    template <typename R>
+    const char* status_name(R)
+    {
+        return "-";
+    }
+
+    struct timing
+    {
+        double      ns_per_call;
+        const char* status;
+    };
+
+    // Best time of three runs of calls calls, after a warm up
+    template <typename F>
+    timing time_calls(F call, int calls)
+    {
+        const char* status = status_name(call());
+        for(int i = 0; i < calls / 10; i++)
+            call();
+
+        double best = 0;
+        for(int run = 0; run < 3; run++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < calls; i++)
+                call();
+            auto   end = std::chrono::steady_clock::now();
+            double ns  = std::chrono::duration<double, std::nano>(end - start).count();
+            best       = run ? std::min(best, ns) : ns;
+        }
+        return {best / calls, status};
+    }
+
+    template <typename R, typename... Ts, size_t... I>
+    R call_with_arguments(R (*f)(Ts...), std::index_sequence<I...>)
+    {
+        return f(argument<Ts>::get(I == 0)...);
+    }
+
+    template <typename R, typename... Ts>
+    timing time_entry_point(R (*f)(Ts...), int calls)
+    {
+        return time_calls([f] { return call_with_arguments(f, std::index_sequence_for<Ts...>{}); },
+                          calls);
+    }
+
+    // Entry points which create or take something are timed together with
+    // the entry point which releases it, so the runs do not leak
+    timing time_create_destroy(int calls)
+    {
+        return time_calls(
+            [] {
+                hipblasHandle_t created;
+                hipblasStatus_t status = hipblasCreate(&created);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasDestroy(created);
+                return status;
+            },
+            calls);
+    }
+
+    timing time_pool_create_destroy(int calls)
+    {
+        return time_calls(
+            [] {
+                hipblasHandlePool_t created;
+                hipblasStatus_t     status = hipblasHandlePoolCreate(&created, 1);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasHandlePoolDestroy(created);
+                return status;
+            },
+            calls);
+    }
+
+    timing time_pool_acquire_release(int calls)
+    {
+        return time_calls(
+            [] {
+                hipblasHandle_t acquired;
+                hipblasStatus_t status = hipblasHandlePoolAcquire(pool, &acquired);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasHandlePoolRelease(pool, acquired);
+                return status;
+            },
+            calls);
+    }
+
+    struct entry_point
+    {
+        const char* name;
+        timing (*time)(int calls);
+    };
+
+    struct paired_entry_point
+    {
+        const char* name;
+        const char* release;
+        timing (*time)(int calls);
+    };
+
+    const entry_point entry_points[] = {
+#define HIPBLAS_ENTRY_POINT(name__) \
+    {#name__, [](int calls) { return time_entry_point(name__, calls); }},
+#include "hipblas_entry_points.hpp"
+#undef HIPBLAS_ENTRY_POINT
+    };
+
+    const paired_entry_point paired_entry_points[] = {
+        {"hipblasCreate", "hipblasDestroy", time_create_destroy},
+        {"hipblasHandlePoolCreate", "hipblasHandlePoolDestroy", time_pool_create_destroy},
+        {"hipblasHandlePoolAcquire", "hipblasHandlePoolRelease", time_pool_acquire_release},
+    };
+
+    void usage(const char* program)
+    {
+        std::printf("Usage: %s [--calls N] [--filter substring]\n"
+                    "  --calls N           calls per timed run (default 100000)\n"
+                    "  --filter substring  only time entry points whose name contains substring\n",
+                    program);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    int         calls  = 100000;
+    const char* filter = "";
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(!std::strcmp(argv[i], "--calls") && i + 1 < argc)
+            calls = std::max(1, std::atoi(argv[++i]));
+        else if(!std::strcmp(argv[i], "--filter") && i + 1 < argc)
+            filter = argv[++i];
+        else
+        {
+            usage(argv[0]);
+            return !std::strcmp(argv[i], "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if(hipblasCreate(&handle) != HIPBLAS_STATUS_SUCCESS
+       || hipblasHandlePoolCreate(&pool, 1) != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::fprintf(stderr, "hipblas-overhead: cannot create a handle\n");
+        return EXIT_FAILURE;
+    }
+
+    std::printf("function,ns_per_call,status\n");
+    for(const entry_point& entry : entry_points)
+    {
+        std::string name = entry.name;
+        auto        time = entry.time;
+
+        bool released = false;
+        for(const paired_entry_point& paired : paired_entry_points)
+        {
+            if(name == paired.release)
+                released = true;
+            else if(name == paired.name)
+            {
+                name = name + "+" + paired.release;
+                time = paired.time;
+            }
+        }
+        if(released || name.find(filter) == std::string::npos)
+            continue;
+
+        std::memset(scratch, 0, sizeof(scratch));
+        timing t = time(calls);
+        std::printf("%s,%.1f,%s\n", name.c_str(), t.ns_per_call, t.status);
+    }
+
+    hipblasHandlePoolDestroy(pool);
+    hipblasDestroy(handle);
+    return EXIT_SUCCESS;
+}
@@ -45,6 +45,10 @@
 
 typedef void* hipblasHandle_t;
 
+typedef struct _hipblasHandlePool* hipblasHandlePool_t;
+
+typedef struct _hipblasGraph* hipblasGraph_t;
+
 typedef uint16_t hipblasHalf;
 
 typedef int8_t hipblasInt8;
@@ -306,6 +310,54 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED     = 1,
 } hipblasAtomicsMode_t;
 
+/*! \brief What the per-handle call counters record */
+typedef enum
+{
+    HIPBLAS_COUNTERS_OFF         = 0, /**< nothing is recorded; the default */
+    HIPBLAS_COUNTERS_ON          = 1, /**< calls, floating point operations and bytes moved */
+    HIPBLAS_COUNTERS_DEVICE_TIME = 2, /**< as above, plus device time measured with events */
+} hipblasCountersMode_t;
+
+/*! \brief Whether a handle defers gemm calls to merge them into batched calls */
+typedef enum
+{
+    HIPBLAS_COALESCING_OFF = 0, /**< gemm calls are made when they are called; the default */
+    HIPBLAS_COALESCING_ON  = 1, /**< independent small gemm calls of the same shape are merged */
+} hipblasCoalescingMode_t;
+
+/*! \brief Activation applied after the gemm by hipblasGemmPostOpEx */
+typedef enum
+{
+    HIPBLAS_ACTIVATION_NONE = 0, /**< x */
+    HIPBLAS_ACTIVATION_RELU = 1, /**< max(x, 0) */
+    HIPBLAS_ACTIVATION_GELU = 2, /**< x/2 (1 + tanh(sqrt(2/pi) (x + 0.044715 x^3))) */
+    HIPBLAS_ACTIVATION_TANH = 3, /**< tanh(x) */
+} hipblasActivation_t;
+
+/*! \brief What hipblasGemmPostOpEx applies to each element D(i, j) of a result, in order:
+    D(i, j) + bias[i], stored to aux(i, j), then activation, then times scale[j] */
+typedef struct hipblasPostOp_t
+{
+    hipblasActivation_t activation;   /**< activation function */
+    const void*         bias;         /**< m values of c_type on the device, or nullptr */
+    hipblasStride       stride_bias;  /**< from the bias of one matrix to the next */
+    const void*         scale;        /**< n values of alpha's type on the device, or nullptr */
+    hipblasStride       stride_scale; /**< from the scale of one matrix to the next */
+    void*               aux;          /**< m by n matrix of c_type on the device, or nullptr */
+    int                 ld_aux;       /**< leading dimension of aux, at least m */
+    hipblasStride       stride_aux;   /**< from one aux matrix to the next */
+} hipblasPostOp_t;
+
+/*! \brief Totals of the calls of one routine family made on a handle */
+typedef struct hipblasRoutineCounters_t
+{
+    char     routine[32];    /**< family name as used by hipblas-bench, e.g. gemm or trsv */
+    uint64_t calls;          /**< number of calls */
+    double   gflop;          /**< billions of floating point operations */
+    double   gbyte;          /**< billions of bytes read and written */
+    double   device_time_ms; /**< zero unless the mode is HIPBLAS_COUNTERS_DEVICE_TIME */
+} hipblasRoutineCounters_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -360,210 +412,694 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixAsync(int         rows,
                                                      int         ldb,
                                                      hipStream_t stream);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
-                                                     hipblasAtomicsMode_t atomics_mode);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
-                                                     hipblasAtomicsMode_t* atomics_mode);
-
-//amax
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
-
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
+/*! HIPBLAS Auxiliary API
 
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
+    \details
+    hipblasSetMatrixBatched
 
-/*! \brief BLAS Level 1 API
+    Copies a batch of rows x cols matrices of elemSize byte elements from host memory to
+    device memory on the stream of the handle: B_i = A_i for i = 1 to batchCount. Rather
+    than one copy per matrix, the matrices are gathered into pinned staging memory and
+    moved with one copy per 8 MB of data, then spread over the device matrices. Matrices
+    larger than that are copied one at a time, as by hipblasSetMatrixAsync.
 
-    \details
-    amax finds the first index of the element of maximum magnitude of a vector x.
+    The host matrices can be changed once the function returns. The copy is not
+    supported while the stream of the handle is being captured.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
     @param[in]
-    n         [int]
-              the number of elements in x.
+    rows        [int]
+                number of rows of each matrix.
     @param[in]
-    x         device pointer storing vector x.
+    cols        [int]
+                number of columns of each matrix.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of y.
-    @param[inout]
-    result
-              device pointer or host pointer to store the amax index.
-              return is 0.0 if n, incx<=0.
-    ********************************************************************/
+    elemSize    [int]
+                size of an element in bytes.
+    @param[in]
+    AP          [const void* const*]
+                host array of batchCount pointers to the host matrices A_i.
+    @param[in]
+    lda         [int]
+                leading dimension of each A_i, lda >= rows.
+    @param[out]
+    BP          [void* const*]
+                device array of batchCount pointers to the device matrices B_i.
+    @param[in]
+    ldb         [int]
+                leading dimension of each B_i, ldb >= rows.
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixBatched(hipblasHandle_t   handle,
+                                                       int               rows,
+                                                       int               cols,
+                                                       int               elemSize,
+                                                       const void* const AP[],
+                                                       int               lda,
+                                                       void* const       BP[],
+                                                       int               ldb,
+                                                       int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+/*! HIPBLAS Auxiliary API
 
-//amax_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
+    \details
+    hipblasGetMatrixBatched
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
+    Copies a batch of matrices from device memory to host memory as hipblasSetMatrixBatched
+    copies them the other way: AP is a device array of pointers to the device matrices and
+    BP a host array of pointers to the host matrices. Returns once the host matrices hold
+    the copy.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixBatched(hipblasHandle_t   handle,
+                                                       int               rows,
+                                                       int               cols,
+                                                       int               elemSize,
+                                                       const void* const AP[],
+                                                       int               lda,
+                                                       void* const       BP[],
+                                                       int               ldb,
+                                                       int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
-                                                    int                         n,
-                                                    const hipblasComplex* const x[],
-                                                    int                         incx,
-                                                    int                         batchCount,
-                                                    int*                        result);
+/*! HIPBLAS Auxiliary API
 
-/*! \brief BLAS Level 1 API
+    \details
+    hipblasSetMatrixStridedBatched
+
+    Copies a batch of matrices from host memory to device memory as
+    hipblasSetMatrixBatched, with A_i at A + i * strideA and B_i at B + i * strideB
+    elements. A batch of device matrices without gaps between them, with ldb = rows and
+    strideB = rows * cols, is copied to directly.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixStridedBatched(hipblasHandle_t handle,
+                                                              int             rows,
+                                                              int             cols,
+                                                              int             elemSize,
+                                                              const void*     A,
+                                                              int             lda,
+                                                              hipblasStride   strideA,
+                                                              void*           B,
+                                                              int             ldb,
+                                                              hipblasStride   strideB,
+                                                              int             batchCount);
+
+/*! HIPBLAS Auxiliary API
 
     \details
-     amaxBatched finds the first index of the element of maximum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+    hipblasGetMatrixStridedBatched
 
-    @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    n         [int]
-              number of elements in each vector x_i
-    @param[in]
-    x         device array of device pointers storing each vector x_i.
-    @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i. incx must be > 0.
-    @param[in]
-    batchCount [int]
-              number of instances in the batch, must be > 0.
-    @param[out]
-    result
-              device or host array of pointers of batchCount size for results.
-              return is 0 if n, incx<=0.
-    ********************************************************************/
+    Copies a batch of matrices from device memory at A to host memory at B as
+    hipblasGetMatrixBatched, with A_i at A + i * strideA and B_i at B + i * strideB
+    elements.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixStridedBatched(hipblasHandle_t handle,
+                                                              int             rows,
+                                                              int             cols,
+                                                              int             elemSize,
+                                                              const void*     A,
+                                                              int             lda,
+                                                              hipblasStride   strideA,
+                                                              void*           B,
+                                                              int             ldb,
+                                                              hipblasStride   strideB,
+                                                              int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
-                                                    int                               n,
-                                                    const hipblasDoubleComplex* const x[],
-                                                    int                               incx,
-                                                    int                               batchCount,
-                                                    int*                              result);
-//amaxStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
-                                                           int             n,
-                                                           const float*    x,
-                                                           int             incx,
-                                                           hipblasStride   stridex,
-                                                           int             batchCount,
-                                                           int*            result);
+/*! HIPBLAS Auxiliary API
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
-                                                           int             n,
-                                                           const double*   x,
-                                                           int             incx,
-                                                           hipblasStride   stridex,
-                                                           int             batchCount,
-                                                           int*            result);
+    \details
+    hipblasSetMatrixEx
+
+    Copies a rows x cols matrix A of type srcType in host memory to the matrix B of
+    type dstType in device memory, converting each element. The supported pairs are
+    HIPBLAS_R_32F or HIPBLAS_R_64F with any of HIPBLAS_R_16F, HIPBLAS_R_16B, HIPBLAS_R_8I,
+    HIPBLAS_R_32F and HIPBLAS_R_64F, and HIPBLAS_C_32F with HIPBLAS_C_64F. Elements are
+    rounded to nearest; those beyond the range of HIPBLAS_R_8I saturate. The narrower of
+    the two types is the one copied across the bus: the library converts on the host
+    while staging the copy, or on the device after it. Returns once B holds the copy;
+    returns HIPBLAS_STATUS_NOT_SUPPORTED while the stream of the handle is captured.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixEx(hipblasHandle_t   handle,
+                                                  int               rows,
+                                                  int               cols,
+                                                  hipblasDatatype_t srcType,
+                                                  const void*       A,
+                                                  int               lda,
+                                                  hipblasDatatype_t dstType,
+                                                  void*             B,
+                                                  int               ldb);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
-                                                           int                   n,
-                                                           const hipblasComplex* x,
-                                                           int                   incx,
-                                                           hipblasStride         stridex,
-                                                           int                   batchCount,
-                                                           int*                  result);
+/*! HIPBLAS Auxiliary API
 
-/*! \brief BLAS Level 1 API
+    \details
+    hipblasGetMatrixEx
+
+    Copies a rows x cols matrix A of type srcType in device memory to the matrix B of
+    type dstType in host memory, converting each element as hipblasSetMatrixEx does.
+    Returns once B holds the copy.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixEx(hipblasHandle_t   handle,
+                                                  int               rows,
+                                                  int               cols,
+                                                  hipblasDatatype_t srcType,
+                                                  const void*       A,
+                                                  int               lda,
+                                                  hipblasDatatype_t dstType,
+                                                  void*             B,
+                                                  int               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
+                                                     hipblasAtomicsMode_t atomics_mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
+                                                     hipblasAtomicsMode_t* atomics_mode);
+
+/*! HIPBLAS Auxiliary API
 
     \details
-     amaxStridedBatched finds the first index of the element of maximum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+    hipblasSetWorkspace
+
+    Gives the handle device memory of the application's as the workspace of the backend
+    routines, in place of the workspace hipBLAS otherwise allocates and grows as calls need
+    more. hipBLAS never replaces memory set this way: a call needing more workspace than
+    it holds fails with HIPBLAS_STATUS_ALLOC_FAILED, and hipblasGetWorkspaceSize then
+    reports how much it needed. The memory must stay valid until the work using it has
+    completed and the handle is destroyed or given another workspace. Graphs captured on
+    the handle before the call refer to the old workspace. hipBLAS' own kernels keep
+    using scratch memory of their own.
+
+    On the ROCm backend, a workspace of 0 bytes or nullptr returns the handle to
+    workspace hipBLAS allocates. On the CUDA backend the call is cublasSetWorkspace.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    n         [int]
-              number of elements in each vector x_i
-    @param[in]
-    x         device pointer to the first vector x_1.
-    @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i. incx must be > 0.
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
     @param[in]
-    stridex   [hipblasStride]
-              specifies the pointer increment between one x_i and the next x_(i + 1).
+    workspace   [void*]
+                device memory, or nullptr if sizeInBytes is 0.
     @param[in]
-    batchCount [int]
-              number of instances in the batch
-    @param[out]
-    result
-              device or host pointer for storing contiguous batchCount results.
-              return is 0 if n <= 0, incx<=0.
+    sizeInBytes [size_t]
+                size of the workspace in bytes.
 
-    ********************************************************************/
+    Returns HIPBLAS_STATUS_INVALID_VALUE while the handle's stream is being captured.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle,
+                                                   void*           workspace,
+                                                   size_t          sizeInBytes);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
-                                                           int                         n,
-                                                           const hipblasDoubleComplex* x,
-                                                           int                         incx,
-                                                           hipblasStride               stridex,
-                                                           int                         batchCount,
-                                                           int*                        result);
+/*! HIPBLAS Auxiliary API
 
-//amin
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
+    \details
+    hipblasGetWorkspaceSize
 
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
+    Returns the size of the handle's backend workspace, or the most workspace any call on
+    the handle has needed if that is more. Making the calls of an application once with
+    the workspace hipBLAS allocates, or with one too small, tells how large a workspace to
+    give the handle with hipblasSetWorkspace. On the CUDA backend only a workspace set by
+    hipblasSetWorkspace is reported; the size is 0 otherwise.
 
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    sizeInBytes [size_t*]
+                host pointer to store the size in bytes.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle,
+                                                       size_t*         sizeInBytes);
 
-/*! \brief BLAS Level 1 API
+/*! HIPBLAS Auxiliary API
 
     \details
-    amin finds the first index of the element of minimum magnitude of a vector x.
+    hipblasGetWorkspaceCacheStats
+
+    Returns the hit and miss counts of the handle's solver workspace size cache.
+    The first getrf, getrs, getri or geqrf call with a given routine, precision, size and
+    batch count is a miss and queries the required workspace; later calls with the same
+    values are hits and pre-size the workspace before running.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[out]
+    hits    [size_t*]
+            host pointer to store the number of cache hits. May be nullptr.
+    @param[out]
+    misses  [size_t*]
+            host pointer to store the number of cache misses. May be nullptr.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceCacheStats(hipblasHandle_t handle,
+                                                             size_t*         hits,
+                                                             size_t*         misses);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGetDevicePointerArray
+
+    Returns a device copy of an array of pointers held in host memory, such as the A, B and
+    C arrays of the batched routines. The copies are cached on the handle by content: the
+    first request for an array is a miss, which copies it to the device on the stream of
+    the handle without waiting for the copy. Later requests for an array with the same
+    pointers are hits and return the same copy without copying anything.
+
+    The copy stays valid until 1024 other arrays have been requested on the handle since it
+    was last requested, hipblasClearPointerArrayCache is called or the handle is destroyed.
+    Graphs captured on the handle before a copy is freed can no longer be launched.
+
     @param[in]
-    n         [int]
-              the number of elements in x.
+    handle        [hipblasHandle_t]
+                  handle to the hipblas library context queue.
     @param[in]
-    x         device pointer storing vector x.
+    host_array    [const void* const*]
+                  host array of count pointers. It may be changed or freed once the
+                  function returns.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of y.
-    @param[inout]
-    result
-              device pointer or host pointer to store the amin index.
-              return is 0.0 if n, incx<=0.
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+    count         [int]
+                  number of pointers, count > 0.
+    @param[out]
+    device_array  [void***]
+                  host pointer to store the device copy of the array.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetDevicePointerArray(hipblasHandle_t    handle,
+                                                            const void* const* host_array,
+                                                            int                count,
+                                                            void***            device_array);
 
-//aminBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
+/*! HIPBLAS Auxiliary API
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminBatched(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
+    \details
+    hipblasGetPointerArrayCacheStats
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
-                                                    int                         n,
-                                                    const hipblasComplex* const x[],
-                                                    int                         incx,
-                                                    int                         batchCount,
-                                                    int*                        result);
+    Returns the hit and miss counts of hipblasGetDevicePointerArray on the handle.
 
-/*! \brief BLAS Level 1 API
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[out]
+    hits    [size_t*]
+            host pointer to store the number of cache hits. May be nullptr.
+    @param[out]
+    misses  [size_t*]
+            host pointer to store the number of cache misses. May be nullptr.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetPointerArrayCacheStats(hipblasHandle_t handle,
+                                                                size_t*         hits,
+                                                                size_t*         misses);
+
+/*! HIPBLAS Auxiliary API
 
     \details
-    aminBatched finds the first index of the element of minimum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+    hipblasClearPointerArrayCache
+
+    Frees the device copies made by hipblasGetDevicePointerArray on the handle, waiting for
+    the device to finish using them.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasClearPointerArrayCache(hipblasHandle_t handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasHandlePoolCreate
+
+    Creates a pool which recycles fully initialized handles. Handles are created on demand
+    the first time the pool has none to hand out, and are destroyed with the pool.
+
+    @param[out]
+    pool      [hipblasHandlePool_t*]
+              the created pool.
+    @param[in]
+    capacity  [int]
+              maximum number of free handles kept by the pool. If capacity <= 0, twice the
+              number of hardware threads is used.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool, int capacity);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasHandlePoolDestroy
+
+    Destroys the pool, its free handles and the per-thread handles of threads which have
+    not exited. Handles which are still acquired are not destroyed and must be destroyed by
+    the user with hipblasDestroy.
+
+    @param[in]
+    pool    [hipblasHandlePool_t]
+            the pool to destroy.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasHandlePoolAcquire
+
+    Takes a handle from the pool, creating one if the pool is empty. Taking a recycled handle
+    does not lock and keeps any workspace the handle already allocated.
+
+    @param[in]
+    pool    [hipblasHandlePool_t]
+            the pool to take the handle from.
+    @param[out]
+    handle  [hipblasHandle_t*]
+            the acquired handle.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t*    handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasHandlePoolRelease
+
+    Returns a handle to the pool. Collected gemm calls are run, and their errors returned, as
+    by hipblasFlushCoalescedCalls. Coalescing and the handle counters are then turned off, the
+    stream is reset to the default stream, a workspace set with hipblasSetWorkspace is released
+    to the application, and the pointer mode and atomics mode are reset to the values of a newly
+    created handle. If the pool is full the handle is destroyed.
+
+    @param[in]
+    pool    [hipblasHandlePool_t]
+            the pool to return the handle to.
+    @param[in]
+    handle  [hipblasHandle_t]
+            a handle obtained from hipblasHandlePoolAcquire.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t     handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasHandlePoolGetThreadHandle
+
+    Returns the handle the pool keeps for the calling thread, acquiring it on the thread's
+    first call. Later calls from the same thread return the same handle without locking.
+    The handle is owned by the pool: it must not be released or destroyed by the user.
+    It goes back to the pool when the thread exits, and is reset as by
+    hipblasHandlePoolRelease when it is next acquired, or it is destroyed with the pool if
+    the pool is destroyed first.
+
+    @param[in]
+    pool    [hipblasHandlePool_t]
+            the pool to get the handle from.
+    @param[out]
+    handle  [hipblasHandle_t*]
+            the calling thread's handle.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolGetThreadHandle(hipblasHandlePool_t pool,
+                                                                hipblasHandle_t*    handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasSetHandleCountersMode
+
+    Starts or stops counting the calls made on a handle. Calls are grouped by routine family,
+    so that e.g. hipblasSgemm, hipblasZgemmStridedBatched and hipblasGemmEx all count towards
+    gemm, and each call adds the floating point operations and bytes of its sizes and batch
+    count. Counting is done per thread without locking. With HIPBLAS_COUNTERS_DEVICE_TIME
+    every call is also bracketed by a pair of events on the handle's stream.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    mode    [hipblasCountersMode_t]
+            what to record from now on. Totals recorded so far are kept.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetHandleCountersMode(hipblasHandle_t       handle,
+                                                            hipblasCountersMode_t mode);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGetHandleCounters
+
+    Returns the totals of every routine family called on the handle since it was created or
+    last reset, sorted by family name. Device times are only final once the work has completed;
+    this call waits for the events of calls which are still running.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[out]
+    counters    [hipblasRoutineCounters_t*]
+                host array of at least *count entries. May be nullptr to query the count.
+    @param[inout]
+    count       [int*]
+                on input, the size of counters; on output, the number of families called.
+                If the array is too small, it is filled and HIPBLAS_STATUS_INVALID_VALUE
+                is returned.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetHandleCounters(hipblasHandle_t           handle,
+                                                        hipblasRoutineCounters_t* counters,
+                                                        int*                      count);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasResetHandleCounters
+
+    Sets every total of the handle back to zero. The counters mode is unchanged.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetHandleCounters(hipblasHandle_t handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasWriteHandleCounters
+
+    Writes the totals returned by hipblasGetHandleCounters as comma separated text, one
+    family per line after a header, with the achieved GFLOP/s and GB/s when device time
+    was recorded.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    path    [const char*]
+            file to write, which is replaced. If nullptr, the text goes to stderr.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasWriteHandleCounters(hipblasHandle_t handle,
+                                                          const char*     path);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGraphBegin
+
+    Starts capturing the calls made on a handle into a graph, so that a sequence of calls can
+    later be replayed with a single launch. Calls made while capturing are recorded rather
+    than run, and must not be interleaved with calls on other handles sharing the stream.
+
+    - The handle's stream must not be the null stream, and cannot be changed until
+      hipblasGraphEnd.
+    - Scalars passed in host pointer mode are captured by value. Results returned in host
+      pointer mode, e.g. by hipblasSdot, are written to the same host memory each time the
+      graph runs. Routines working on host data only, such as hipblasSrotg in host pointer
+      mode, run at capture time.
+    - The workspace the captured calls use is reserved before the capture starts and cannot
+      grow during it. If a call needs more, it returns HIPBLAS_STATUS_ALLOC_FAILED, as does
+      hipblasGraphEnd, and the next capture on the handle reserves the larger size. Running
+      the sequence once before capturing it avoids this.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphBegin(hipblasHandle_t handle);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGraphEnd
+
+    Stops the capture started by hipblasGraphBegin and instantiates the graph of the calls
+    captured since. On failure no graph is returned and the handle is no longer capturing.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[out]
+    graph   [hipblasGraph_t*]
+            the captured graph, to be destroyed with hipblasGraphDestroy.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphEnd(hipblasHandle_t handle, hipblasGraph_t* graph);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGraphLaunch
+
+    Runs the calls captured in a graph on the handle's current stream. The graph uses the
+    workspace of the handle it was captured on, so it must be launched with that handle.
+    If the handle's workspace has been reallocated since the capture, the graph is not run
+    and HIPBLAS_STATUS_INVALID_VALUE is returned; capture the sequence again.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            the handle the graph was captured on.
+    @param[in]
+    graph   [hipblasGraph_t]
+            the graph to run.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphLaunch(hipblasHandle_t handle, hipblasGraph_t graph);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGraphDestroy
+
+    Destroys a graph returned by hipblasGraphEnd. Launches of the graph must have completed.
+
+    @param[in]
+    graph   [hipblasGraph_t]
+            the graph to destroy.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasSetCoalescingMode
+
+    With HIPBLAS_COALESCING_ON, calls of hipblasSgemm, hipblasDgemm, hipblasCgemm,
+    hipblasZgemm and hipblasGemmEx made on the handle are not run right away. Calls with the
+    same operations, sizes, leading dimensions, types, alpha and beta are collected and run
+    together as a single hipblasGemmBatchedEx call. Collected calls are run, in one batched
+    call per shape,
+
+    - before any other BLAS or solver call on any handle, and before hipblasSetStream,
+      hipblasGetStream, hipblasSetPointerMode, hipblasDestroy and hipblasGraphBegin on the
+      handle,
+    - before hipblasSetMatrix, hipblasGetMatrix, hipblasSetVector, hipblasGetVector and
+      their Async forms on any handle,
+    - before a gemm on another handle, and before a gemm on the handle whose output overlaps
+      an input or output of a collected call, or whose inputs overlap the output of a
+      collected call,
+    - when 256 calls of a shape, or 256 calls in HIPBLAS_POINTER_MODE_DEVICE, have been
+      collected,
+    - by hipblasFlushCoalescedCalls, and when the mode is set back to HIPBLAS_COALESCING_OFF.
+
+    A gemm of more than 128 x 128 x 128 multiply-adds is run right away, after the collected
+    calls. An application synchronizing with a stream it kept from before the collected calls,
+    rather than one hipblasGetStream returns after them, must call hipblasFlushCoalescedCalls
+    first. In HIPBLAS_POINTER_MODE_DEVICE, alpha and beta are copied on the stream when a call
+    is collected, so they may be changed afterwards, and such calls are run one by one rather
+    than merged. Errors of collected calls are returned by the next hipblasFlushCoalescedCalls
+    on the handle, or by setting the mode to HIPBLAS_COALESCING_OFF. Calls are not collected
+    while capturing a graph.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    mode    [hipblasCoalescingMode_t]
+            whether to collect gemm calls from now on.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetCoalescingMode(hipblasHandle_t         handle,
+                                                        hipblasCoalescingMode_t mode);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasGetCoalescingMode
+
+    Returns whether a handle collects gemm calls, see hipblasSetCoalescingMode.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[out]
+    mode    [hipblasCoalescingMode_t*]
+            the current mode.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCoalescingMode(hipblasHandle_t          handle,
+                                                        hipblasCoalescingMode_t* mode);
+
+/*! HIPBLAS Auxiliary API
+
+    \details
+    hipblasFlushCoalescedCalls
+
+    Runs the gemm calls collected on a handle in HIPBLAS_COALESCING_ON mode on its stream.
+    Returns the first error of a collected call since the last flush, if any.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasFlushCoalescedCalls(hipblasHandle_t handle);
+
+//amax
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    amax finds the first index of the element of maximum magnitude of a vector x.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the amax index.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+//amax_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    int                         batchCount,
+                                                    int*                        result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+     amaxBatched finds the first index of the element of maximum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
     n         [int]
               number of elements in each vector x_i
@@ -577,19 +1113,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t
               number of instances in the batch, must be > 0.
     @param[out]
     result
-              device or host pointers to array of batchCount size for results.
+              device or host array of pointers of batchCount size for results.
               return is 0 if n, incx<=0.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
                                                     int                               incx,
                                                     int                               batchCount,
                                                     int*                              result);
-
-//aminStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
+//amaxStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const float*    x,
                                                            int             incx,
@@ -597,7 +1132,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const double*   x,
                                                            int             incx,
@@ -605,17 +1140,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
                                                            int                   incx,
                                                            hipblasStride         stridex,
                                                            int                   batchCount,
                                                            int*                  result);
+
 /*! \brief BLAS Level 1 API
 
     \details
-     aminStridedBatched finds the first index of the element of minimum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+     amaxStridedBatched finds the first index of the element of maximum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -630,18 +1166,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t
               specifies the increment for the elements of each x_i. incx must be > 0.
     @param[in]
     stridex   [hipblasStride]
-              specifies the pointer increment between one x_i and the next x_(i + 1)
+              specifies the pointer increment between one x_i and the next x_(i + 1).
     @param[in]
     batchCount [int]
               number of instances in the batch
     @param[out]
     result
-              device or host pointer to array for storing contiguous batchCount results.
+              device or host pointer for storing contiguous batchCount results.
               return is 0 if n <= 0, incx<=0.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
                                                            int                         incx,
@@ -649,41 +1185,182 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t
                                                            int                         batchCount,
                                                            int*                        result);
 
-//asum
+//amin
 HIPBLAS_EXPORT hipblasStatus_t
-    hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
+    hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
 
 HIPBLAS_EXPORT hipblasStatus_t
-    hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
+    hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
 
 HIPBLAS_EXPORT hipblasStatus_t
-    hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
+    hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
 
 /*! \brief BLAS Level 1 API
 
     \details
-    asum computes the sum of the magnitudes of elements of a real vector x,
-         or the sum of magnitudes of the real and imaginary parts of elements if x is a complex vector.
+    amin finds the first index of the element of minimum magnitude of a vector x.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     n         [int]
-              the number of elements in x and y.
+              the number of elements in x.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x. incx must be > 0.
+              specifies the increment for the elements of y.
     @param[inout]
     result
-              device pointer or host pointer to store the asum product.
-              return is 0.0 if n <= 0.
-
+              device pointer or host pointer to store the amin index.
+              return is 0.0 if n, incx<=0.
     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
+//aminBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    int                         batchCount,
+                                                    int*                        result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    aminBatched finds the first index of the element of minimum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              number of elements in each vector x_i
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i. incx must be > 0.
+    @param[in]
+    batchCount [int]
+              number of instances in the batch, must be > 0.
+    @param[out]
+    result
+              device or host pointers to array of batchCount size for results.
+              return is 0 if n, incx<=0.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    int                               batchCount,
+                                                    int*                              result);
+
+//aminStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const float*    x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           int             batchCount,
+                                                           int*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const double*   x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           int             batchCount,
+                                                           int*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           int                   batchCount,
+                                                           int*                  result);
+/*! \brief BLAS Level 1 API
+
+    \details
+     aminStridedBatched finds the first index of the element of minimum magnitude of each vector x_i in a batch, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              number of elements in each vector x_i
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i. incx must be > 0.
+    @param[in]
+    stridex   [hipblasStride]
+              specifies the pointer increment between one x_i and the next x_(i + 1)
+    @param[in]
+    batchCount [int]
+              number of instances in the batch
+    @param[out]
+    result
+              device or host pointer to array for storing contiguous batchCount results.
+              return is 0 if n <= 0, incx<=0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           hipblasStride               stridex,
+                                                           int                         batchCount,
+                                                           int*                        result);
+
+//asum
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    asum computes the sum of the magnitudes of elements of a real vector x,
+         or the sum of magnitudes of the real and imaginary parts of elements if x is a complex vector.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x. incx must be > 0.
+    @param[inout]
+    result
+              device pointer or host pointer to store the asum product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
 
 //asumBatched
@@ -15307,193 +15984,679 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          han
     \details getrsBatched solves a batch of systems of n linear equations on n
     variables in its factorized forms.
 
-    For each instance i in the batch, it solves one of the following systems, depending on the value of trans:
+    For each instance i in the batch, it solves one of the following systems, depending on the value of trans:
+
+    \f[
+        \begin{array}{cl}
+        A_i X_i = B_i & \: \text{not transposed,}\\
+        A_i^T X_i = B_i & \: \text{transposed, or}\\
+        A_i^H X_i = B_i & \: \text{conjugate transposed.}
+        \end{array}
+    \f]
+
+    Matrix \f$A_i\f$ is defined by its triangular factors as returned by \ref hipblasSgetrfBatched "getrfBatched".
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations of each instance in the batch.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfBatched "getrfBatched".
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[in]
+    ipiv        pointer to int. Array on the GPU.\n
+                Contains the vectors ipiv_i of pivot indices returned by \ref hipblasSgetrfBatched "getrfBatched".
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the j-th argument is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasOperation_t    trans,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    const int*                  ipiv,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           float*                   A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           const int*               ipiv,
+                                                           const hipblasStride      strideP,
+                                                           float*                   B,
+                                                           const int                ldb,
+                                                           const hipblasStride      strideB,
+                                                           int*                     info,
+                                                           const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           double*                  A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           const int*               ipiv,
+                                                           const hipblasStride      strideP,
+                                                           double*                  B,
+                                                           const int                ldb,
+                                                           const hipblasStride      strideB,
+                                                           int*                     info,
+                                                           const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           hipblasComplex*          A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           const int*               ipiv,
+                                                           const hipblasStride      strideP,
+                                                           hipblasComplex*          B,
+                                                           const int                ldb,
+                                                           const hipblasStride      strideB,
+                                                           int*                     info,
+                                                           const int                batchCount);
+
+/*! \brief SOLVER API
+
+    \details
+    getrsStridedBatched solves a batch of systems of n linear equations
+    on n variables in its factorized forms.
+
+    For each instance i in the batch, it solves one of the following systems, depending on the value of trans:
+
+    \f[
+        \begin{array}{cl}
+        A_i X_i = B_i & \: \text{not transposed,}\\
+        A_i^T X_i = B_i & \: \text{transposed, or}\\
+        A_i^H X_i = B_i & \: \text{conjugate transposed.}
+        \end{array}
+    \f]
+
+    Matrix \f$A_i\f$ is defined by its triangular factors as returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    trans       hipblasOperation_t.\n
+                Specifies the form of the system of equations of each instance in the batch.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                Contains the vectors ipiv_i of pivot indices returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+    @param[in]
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the j-th argument is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           hipblasDoubleComplex*    A,
+                                                           const int                lda,
+                                                           const hipblasStride      strideA,
+                                                           const int*               ipiv,
+                                                           const hipblasStride      strideP,
+                                                           hipblasDoubleComplex*    B,
+                                                           const int                ldb,
+                                                           const hipblasStride      strideB,
+                                                           int*                     info,
+                                                           const int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   float* const    A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   float* const    B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   double* const   A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   double* const   B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount);
+
+/*! \brief SOLVER API
+
+    \details
+    gesvBatched solves a batch of systems of n linear equations on n variables,
+    A_i X_i = B_i, factoring each A_i as \ref hipblasSgetrfBatched "getrfBatched"
+    does and solving with the factors as \ref hipblasSgetrsBatched "getrsBatched"
+    does, in one call.
+
+    It takes the place of a getrfBatched call followed by a getrsBatched call. The
+    pivots of the factorizations are kept in memory of handle unless they are
+    requested, and whether each A_i is singular is left on the GPU, so that the call
+    does not synchronize with the host.
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in,out]
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_i.
+                On exit, the factors L_i and U_i of the factorizations A_i = P_i*L_i*U_i.
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount, or nullptr.\n
+                If not nullptr, the pivot indices of the factorization of A_i, at ipiv + i*n.
+                If nullptr, A_i is still factored with partial pivoting and the pivots are
+                discarded.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrices X_i.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[out]
+    info        pointer to int. Array on the GPU of dimension batchCount.\n
+                If info[i] = 0, successful exit for system i.
+                If info[i] = j > 0, U_i(j,j) is zero; A_i is singular and B_i does not
+                hold a solution.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of systems in the batch.
+
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                                   const int                   n,
+                                                   const int                   nrhs,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   int*                        ipiv,
+                                                   hipblasDoubleComplex* const B[],
+                                                   const int                   ldb,
+                                                   int*                        info,
+                                                   const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          float*              A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          float*              B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          double*             A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          double*             B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          const int           nrhs,
+                                                          hipblasComplex*     A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          int*                ipiv,
+                                                          const hipblasStride strideP,
+                                                          hipblasComplex*     B,
+                                                          const int           ldb,
+                                                          const hipblasStride strideB,
+                                                          int*                info,
+                                                          const int           batchCount);
+
+/*! \brief SOLVER API
+
+    \details
+    gesvStridedBatched solves a batch of systems of n linear equations on n
+    variables, A_i X_i = B_i, factoring each A_i as \ref hipblasSgetrfStridedBatched
+    "getrfStridedBatched" does and solving with the factors as
+    \ref hipblasSgetrsStridedBatched "getrsStridedBatched" does, in one call.
+
+    The pivots of the factorizations are kept in memory of handle unless they are
+    requested, and whether each A_i is singular is left on the GPU, so that the call
+    does not synchronize with the host.
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the systems, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_i.
+                On exit, the factors L_i and U_i of the factorizations A_i = P_i*L_i*U_i.
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP), or nullptr.\n
+                If not nullptr, the vectors ipiv_i of pivot indices of the factorizations.
+                If nullptr, A_i is still factored with partial pivoting and the pivots are
+                discarded.
+    @param[in]
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+                Ignored if ipiv is nullptr.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrices X_i.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info        pointer to int. Array on the GPU of dimension batchCount.\n
+                If info[i] = 0, successful exit for system i.
+                If info[i] = j > 0, U_i(j,j) is zero; A_i is singular and B_i does not
+                hold a solution.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of systems in the batch.
+
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                                          const int             n,
+                                                          const int             nrhs,
+                                                          hipblasDoubleComplex* A,
+                                                          const int             lda,
+                                                          const hipblasStride   strideA,
+                                                          int*                  ipiv,
+                                                          const hipblasStride   strideP,
+                                                          hipblasDoubleComplex* B,
+                                                          const int             ldb,
+                                                          const hipblasStride   strideB,
+                                                          int*                  info,
+                                                          const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             double*         A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             const double*   B,
+                                             const int       ldb,
+                                             double*         X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             int*            info);
+
+/*! \brief SOLVER API
+
+    \details
+    gesv solves a system of n linear equations on n variables, A X = B, by
+    mixed precision iterative refinement, as LAPACK's dsgesv and zcgesv do.
+
+    A is factored in single precision by \ref hipblasSgetrf "getrf", and the
+    solution refined in double precision until the residual B - A X of each
+    column of X is within sqrt(n) * eps * ||A||_inf * ||X||_inf, the bound of a
+    double precision solve. If A cannot be factored in single precision, or the
+    refinement does not converge in 30 iterations, A is factored and the system
+    solved in double precision instead. DSgesv factors a double precision A in
+    single precision, ZCgesv a double complex A in single complex precision.
+
+    Each refinement step is checked on the host, so that the call synchronizes
+    with the stream of handle, and it returns HIPBLAS_STATUS_NOT_SUPPORTED while
+    the stream is being captured.
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrices B and X.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The matrix A. Left unchanged if iter >= 0; on exit, the factors L and U
+                of the double precision factorization A = P*L*U if iter < 0.
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of A.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n.\n
+                The pivot indices of the factorization used, of the single precision
+                one if iter >= 0 and of the double precision one otherwise. May be
+                nullptr, in which case the pivots are not returned; A is still
+                factored with partial pivoting.
+    @param[in]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                The right hand side matrix B.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                The solution matrix X.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                The leading dimension of X.
+    @param[out]
+    iter        pointer to a int on the host.\n
+                If iter >= 0, the number of refinement iterations the solution took.
+                If iter < 0, the system was solved in double precision because
+                the conversion of A, B or a correction to single precision overflowed
+                (iter = -2), single precision U is singular (iter = -3), or the
+                refinement did not converge (iter = -31).
+    @param[out]
+    info        pointer to a int on the host.\n
+                If info = 0, successful exit.
+                If info = j > 0, U(j,j) of the double precision factorization is zero;
+                A is singular and X was not computed.
+
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             const int                   nrhs,
+                                             hipblasDoubleComplex*       A,
+                                             const int                   lda,
+                                             int*                        ipiv,
+                                             const hipblasDoubleComplex* B,
+                                             const int                   ldb,
+                                             hipblasDoubleComplex*       X,
+                                             const int                   ldx,
+                                             int*                        iter,
+                                             int*                        info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    const int           nrhs,
+                                                    double* const       A[],
+                                                    const int           lda,
+                                                    int*                ipiv,
+                                                    const double* const B[],
+                                                    const int           ldb,
+                                                    double* const       X[],
+                                                    const int           ldx,
+                                                    int*                iter,
+                                                    int*                info,
+                                                    const int           batchCount);
 
-    \f[
-        \begin{array}{cl}
-        A_i X_i = B_i & \: \text{not transposed,}\\
-        A_i^T X_i = B_i & \: \text{transposed, or}\\
-        A_i^H X_i = B_i & \: \text{conjugate transposed.}
-        \end{array}
-    \f]
+/*! \brief SOLVER API
 
-    Matrix \f$A_i\f$ is defined by its triangular factors as returned by \ref hipblasSgetrfBatched "getrfBatched".
+    \details
+    gesvBatched solves a batch of systems of n linear equations on n variables,
+    A_i X_i = B_i, by mixed precision iterative refinement, as \ref hipblasZCgesv "gesv"
+    does. The systems are refined together; one which has to be solved in double
+    precision is solved on its own once the others are done.
 
     @param[in]
     handle      hipblasHandle_t.
     @param[in]
-    trans       hipblasOperation_t.\n
-                Specifies the form of the system of equations of each instance in the batch.
-    @param[in]
     n           int. n >= 0.\n
-                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+                The order of the systems, i.e. the number of columns and rows of all A_i matrices.
     @param[in]
     nrhs        int. nrhs >= 0.\n
                 The number of right hand sides, i.e., the number of columns
-                of all the matrices B_i.
-    @param[in]
+                of all the matrices B_i and X_i.
+    @param[in,out]
     A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
-                The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfBatched "getrfBatched".
+                The matrices A_i. Left unchanged if iter[i] >= 0; on exit, the factors L_i and U_i
+                of the double precision factorization A_i = P_i*L_i*U_i if iter[i] < 0.
     @param[in]
     lda         int. lda >= n.\n
                 The leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount.\n
+                The pivot indices of the factorization used for A_i, at ipiv + i*n. May be nullptr.
     @param[in]
-    ipiv        pointer to int. Array on the GPU.\n
-                Contains the vectors ipiv_i of pivot indices returned by \ref hipblasSgetrfBatched "getrfBatched".
-    @param[in,out]
     B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
-                On entry, the right hand side matrices B_i.
-                On exit, the solution matrix X_i of each system in the batch.
+                The right hand side matrices B_i.
     @param[in]
     ldb         int. ldb >= n.\n
                 The leading dimension of matrices B_i.
     @param[out]
-    info      pointer to a int on the host.\n
-              If info = 0, successful exit.
-              If info = j < 0, the j-th argument is invalid.
+    X           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                The leading dimension of matrices X_i.
+    @param[out]
+    iter        pointer to int. Array on the host of dimension batchCount.\n
+                The refinement iterations of each system, or how it fell back to double
+                precision, as for \ref hipblasZCgesv "gesv".
+    @param[out]
+    info        pointer to int. Array on the host of dimension batchCount.\n
+                If info[i] = 0, successful exit for system i.
+                If info[i] = j > 0, A_i is singular and X_i was not computed.
     @param[in]
     batchCount int. batchCount >= 0.\n
-                Number of instances (systems) in the batch.
+                Number of systems in the batch.
 
    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
-                                                    const hipblasOperation_t    trans,
-                                                    const int                   n,
-                                                    const int                   nrhs,
-                                                    hipblasDoubleComplex* const A[],
-                                                    const int                   lda,
-                                                    const int*                  ipiv,
-                                                    hipblasDoubleComplex* const B[],
-                                                    const int                   ldb,
-                                                    int*                        info,
-                                                    const int                   batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
-                                                           const hipblasOperation_t trans,
-                                                           const int                n,
-                                                           const int                nrhs,
-                                                           float*                   A,
-                                                           const int                lda,
-                                                           const hipblasStride      strideA,
-                                                           const int*               ipiv,
-                                                           const hipblasStride      strideP,
-                                                           float*                   B,
-                                                           const int                ldb,
-                                                           const hipblasStride      strideB,
-                                                           int*                     info,
-                                                           const int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
-                                                           const hipblasOperation_t trans,
-                                                           const int                n,
-                                                           const int                nrhs,
-                                                           double*                  A,
-                                                           const int                lda,
-                                                           const hipblasStride      strideA,
-                                                           const int*               ipiv,
-                                                           const hipblasStride      strideP,
-                                                           double*                  B,
-                                                           const int                ldb,
-                                                           const hipblasStride      strideB,
-                                                           int*                     info,
-                                                           const int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
-                                                           const hipblasOperation_t trans,
-                                                           const int                n,
-                                                           const int                nrhs,
-                                                           hipblasComplex*          A,
-                                                           const int                lda,
-                                                           const hipblasStride      strideA,
-                                                           const int*               ipiv,
-                                                           const hipblasStride      strideP,
-                                                           hipblasComplex*          B,
-                                                           const int                ldb,
-                                                           const hipblasStride      strideB,
-                                                           int*                     info,
-                                                           const int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                                    const int                         n,
+                                                    const int                         nrhs,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    const int                         lda,
+                                                    int*                              ipiv,
+                                                    const hipblasDoubleComplex* const B[],
+                                                    const int                         ldb,
+                                                    hipblasDoubleComplex* const       X[],
+                                                    const int                         ldx,
+                                                    int*                              iter,
+                                                    int*                              info,
+                                                    const int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           const double*       B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           double*             X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           int*                info,
+                                                           const int           batchCount);
 
 /*! \brief SOLVER API
 
     \details
-    getrsStridedBatched solves a batch of systems of n linear equations
-    on n variables in its factorized forms.
-
-    For each instance i in the batch, it solves one of the following systems, depending on the value of trans:
-
-    \f[
-        \begin{array}{cl}
-        A_i X_i = B_i & \: \text{not transposed,}\\
-        A_i^T X_i = B_i & \: \text{transposed, or}\\
-        A_i^H X_i = B_i & \: \text{conjugate transposed.}
-        \end{array}
-    \f]
-
-    Matrix \f$A_i\f$ is defined by its triangular factors as returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+    gesvStridedBatched solves a batch of systems of n linear equations on n
+    variables, A_i X_i = B_i, by mixed precision iterative refinement, as
+    \ref hipblasZCgesv "gesv" does. The systems are refined together; one which
+    has to be solved in double precision is solved on its own once the others are done.
 
     @param[in]
     handle      hipblasHandle_t.
     @param[in]
-    trans       hipblasOperation_t.\n
-                Specifies the form of the system of equations of each instance in the batch.
-    @param[in]
     n           int. n >= 0.\n
-                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+                The order of the systems, i.e. the number of columns and rows of all A_i matrices.
     @param[in]
     nrhs        int. nrhs >= 0.\n
                 The number of right hand sides, i.e., the number of columns
-                of all the matrices B_i.
-    @param[in]
+                of all the matrices B_i and X_i.
+    @param[in,out]
     A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
-                The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+                The matrices A_i. Left unchanged if iter[i] >= 0; on exit, the factors L_i and U_i
+                of the double precision factorization A_i = P_i*L_i*U_i if iter[i] < 0.
     @param[in]
     lda         int. lda >= n.\n
                 The leading dimension of matrices A_i.
     @param[in]
     strideA     hipblasStride.\n
                 Stride from the start of one matrix A_i to the next one A_(i+1).
-                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
-    @param[in]
+    @param[out]
     ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
-                Contains the vectors ipiv_i of pivot indices returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+                The pivot indices of the factorization used for each A_i. May be nullptr.
     @param[in]
     strideP     hipblasStride.\n
                 Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
-                There is no restriction for the value of strideP. Normal use case is strideP >= n.
-    @param[in,out]
-    B           pointer to type. Array on the GPU (size depends on the value of strideB).\n
-                On entry, the right hand side matrices B_i.
-                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                The right hand side matrices B_i.
     @param[in]
     ldb         int. ldb >= n.\n
                 The leading dimension of matrices B_i.
     @param[in]
     strideB     hipblasStride.\n
                 Stride from the start of one matrix B_i to the next one B_(i+1).
-                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
     @param[out]
-    info      pointer to a int on the host.\n
-              If info = 0, successful exit.
-              If info = j < 0, the j-th argument is invalid.
+    X           pointer to type. Array on the GPU (the size depends on the value of strideX).\n
+                The solution matrices X_i.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                The leading dimension of matrices X_i.
+    @param[in]
+    strideX     hipblasStride.\n
+                Stride from the start of one matrix X_i to the next one X_(i+1).
+    @param[out]
+    iter        pointer to int. Array on the host of dimension batchCount.\n
+                The refinement iterations of each system, or how it fell back to double
+                precision, as for \ref hipblasZCgesv "gesv".
+    @param[out]
+    info        pointer to int. Array on the host of dimension batchCount.\n
+                If info[i] = 0, successful exit for system i.
+                If info[i] = j > 0, A_i is singular and X_i was not computed.
     @param[in]
     batchCount int. batchCount >= 0.\n
-                Number of instances (systems) in the batch.
+                Number of systems in the batch.
 
    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
-                                                           const hipblasOperation_t trans,
-                                                           const int                n,
-                                                           const int                nrhs,
-                                                           hipblasDoubleComplex*    A,
-                                                           const int                lda,
-                                                           const hipblasStride      strideA,
-                                                           const int*               ipiv,
-                                                           const hipblasStride      strideP,
-                                                           hipblasDoubleComplex*    B,
-                                                           const int                ldb,
-                                                           const hipblasStride      strideB,
-                                                           int*                     info,
-                                                           const int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                                           const int                   n,
+                                                           const int                   nrhs,
+                                                           hipblasDoubleComplex*       A,
+                                                           const int                   lda,
+                                                           const hipblasStride         strideA,
+                                                           int*                        ipiv,
+                                                           const hipblasStride         strideP,
+                                                           const hipblasDoubleComplex* B,
+                                                           const int                   ldb,
+                                                           const hipblasStride         strideB,
+                                                           hipblasDoubleComplex*       X,
+                                                           const int                   ldx,
+                                                           const hipblasStride         strideX,
+                                                           int*                        iter,
+                                                           int*                        info,
+                                                           const int                   batchCount);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                                     const int       n,
@@ -15937,6 +17100,301 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    ha
                                                            hipblasDatatype_t  compute_type,
                                                            hipblasGemmAlgo_t  algo);
 
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasGemmGroupedBatchedEx performs the matrix-matrix operations of several batched gemm
+    calls of different shapes at once:
+
+        C_i = alpha_g*op( A_i )*op( B_i ) + beta_g*C_i, for each matrix i of each group g,
+
+    where op( X ) is one of op( X ) = X, op( X ) = X**T or op( X ) = X**H. The matrices of a
+    group share its operations, sizes, leading dimensions and scalars, and every group shares
+    the data types. Group g holds group_size[g] matrices of each operand, which follow those
+    of groups 0 to g - 1 in a_array, b_array and c_array.
+
+    Groups are spread over streams of the handle's own, which wait for the work submitted to
+    the stream of the handle before and which the stream of the handle waits for after, so
+    that groups too small to fill the device on their own run concurrently. While capturing
+    a graph the groups run one after the other on the stream of the handle.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    trans_a_array [const hipblasOperation_t*]
+              host array of group_count operations op( A_i ).
+    @param[in]
+    trans_b_array [const hipblasOperation_t*]
+              host array of group_count operations op( B_i ).
+    @param[in]
+    m_array   [const int*]
+              host array of group_count numbers of rows of op( A_i ) and C_i.
+    @param[in]
+    n_array   [const int*]
+              host array of group_count numbers of columns of op( B_i ) and C_i.
+    @param[in]
+    k_array   [const int*]
+              host array of group_count numbers of columns of op( A_i ) and rows of op( B_i ).
+    @param[in]
+    alpha_array [const void*]
+              group_count values of compute_type, on the host or the device according to
+              the pointer mode.
+    @param[in]
+    a_array   [const void* const*]
+              device array of the device pointers to every matrix A_i.
+    @param[in]
+    a_type    [hipblasDatatype_t]
+              type of the matrices A_i.
+    @param[in]
+    lda_array [const int*]
+              host array of group_count leading dimensions of the matrices A_i.
+    @param[in]
+    b_array   [const void* const*]
+              device array of the device pointers to every matrix B_i.
+    @param[in]
+    b_type    [hipblasDatatype_t]
+              type of the matrices B_i.
+    @param[in]
+    ldb_array [const int*]
+              host array of group_count leading dimensions of the matrices B_i.
+    @param[in]
+    beta_array [const void*]
+              group_count values of compute_type, on the host or the device according to
+              the pointer mode.
+    @param[inout]
+    c_array   [void* const*]
+              device array of the device pointers to every matrix C_i.
+    @param[in]
+    c_type    [hipblasDatatype_t]
+              type of the matrices C_i.
+    @param[in]
+    ldc_array [const int*]
+              host array of group_count leading dimensions of the matrices C_i.
+    @param[in]
+    group_count [int]
+              number of groups.
+    @param[in]
+    group_size [const int*]
+              host array of group_count numbers of matrices of each operand in each group.
+    @param[in]
+    compute_type [hipblasDatatype_t]
+              type of alpha, beta and the computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans_a_array[],
+                                                           const hipblasOperation_t trans_b_array[],
+                                                           const int                m_array[],
+                                                           const int                n_array[],
+                                                           const int                k_array[],
+                                                           const void*              alpha_array,
+                                                           const void* const        a_array[],
+                                                           hipblasDatatype_t        a_type,
+                                                           const int                lda_array[],
+                                                           const void* const        b_array[],
+                                                           hipblasDatatype_t        b_type,
+                                                           const int                ldb_array[],
+                                                           const void*              beta_array,
+                                                           void* const              c_array[],
+                                                           hipblasDatatype_t        c_type,
+                                                           const int                ldc_array[],
+                                                           int                      group_count,
+                                                           const int                group_size[],
+                                                           hipblasDatatype_t        compute_type,
+                                                           hipblasGemmAlgo_t        algo);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasGemmPostOpEx performs the matrix-matrix operation of hipblasGemmEx followed by
+    the elementwise operations described by post_op, in place on C:
+
+        D = alpha*op( A )*op( B ) + beta*C,
+        Z(i, j) = D(i, j) + bias[i],
+        aux(i, j) = Z(i, j),
+        C(i, j) = activation( Z(i, j) ) * scale[j],
+
+    where a null bias adds nothing, a null aux is not written and a null scale multiplies by
+    one. Neither backend's gemm takes these operations, so they are not fused into it: the
+    gemm runs as hipblasGemmStridedBatchedEx, and the post-op follows as one separate pass
+    on the stream of the handle, reading and writing C once more. Z is rounded to c_type
+    before aux is written and the activation is computed in single precision for half and
+    bfloat16 results.
+
+    The post-op is supported for c_type HIPBLAS_R_16F, HIPBLAS_R_16B, HIPBLAS_R_32F and
+    HIPBLAS_R_64F with the compute types hipblasGemmEx takes for them; other types return
+    HIPBLAS_STATUS_NOT_SUPPORTED before anything runs. A null post_op makes the call
+    hipblasGemmEx. The other arguments are those of hipblasGemmEx.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    post_op   [const hipblasPostOp_t*]
+              host pointer to the post-op, or nullptr. stride_bias, stride_scale and
+              stride_aux are ignored.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPostOpEx(hipblasHandle_t        handle,
+                                                   hipblasOperation_t     trans_a,
+                                                   hipblasOperation_t     trans_b,
+                                                   int                    m,
+                                                   int                    n,
+                                                   int                    k,
+                                                   const void*            alpha,
+                                                   const void*            a,
+                                                   hipblasDatatype_t      a_type,
+                                                   int                    lda,
+                                                   const void*            b,
+                                                   hipblasDatatype_t      b_type,
+                                                   int                    ldb,
+                                                   const void*            beta,
+                                                   void*                  c,
+                                                   hipblasDatatype_t      c_type,
+                                                   int                    ldc,
+                                                   const hipblasPostOp_t* post_op,
+                                                   hipblasDatatype_t      compute_type,
+                                                   hipblasGemmAlgo_t      algo);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasGemmStridedBatchedPostOpEx performs the matrix-matrix operations of
+    hipblasGemmStridedBatchedEx, each followed by the post-op of hipblasGemmPostOpEx. The
+    bias, scale and aux of matrix i start stride_bias, stride_scale and stride_aux elements
+    after those of matrix i - 1; a stride of 0 shares them across the batch.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    post_op   [const hipblasPostOp_t*]
+              host pointer to the post-op, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedPostOpEx(hipblasHandle_t        handle,
+                                                                 hipblasOperation_t     trans_a,
+                                                                 hipblasOperation_t     trans_b,
+                                                                 int                    m,
+                                                                 int                    n,
+                                                                 int                    k,
+                                                                 const void*            alpha,
+                                                                 const void*            a,
+                                                                 hipblasDatatype_t      a_type,
+                                                                 int                    lda,
+                                                                 hipblasStride          stride_A,
+                                                                 const void*            b,
+                                                                 hipblasDatatype_t      b_type,
+                                                                 int                    ldb,
+                                                                 hipblasStride          stride_B,
+                                                                 const void*            beta,
+                                                                 void*                  c,
+                                                                 hipblasDatatype_t      c_type,
+                                                                 int                    ldc,
+                                                                 hipblasStride          stride_C,
+                                                                 int                    batch_count,
+                                                                 const hipblasPostOp_t* post_op,
+                                                                 hipblasDatatype_t      compute_type,
+                                                                 hipblasGemmAlgo_t      algo);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasGemmExGetSolutions lists the backend solutions, kernels or algorithms, able to run
+    the hipblasGemmEx call with the same arguments, for hipblasGemmExTune to choose from.
+    Nothing is computed.
+
+    If solutions is nullptr, size is set to the number of solutions. Otherwise up to size
+    solutions are written to solutions and size is set to the number written.
+    HIPBLAS_STATUS_NOT_SUPPORTED is returned by backends which cannot choose a solution.
+
+    @param[out]
+    solutions [int*]
+              host array of size solutions, or nullptr.
+    @param[inout]
+    size      [int*]
+              host pointer to the size of solutions on entry, and the number of solutions
+              on exit.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExGetSolutions(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans_a,
+                                                         hipblasOperation_t trans_b,
+                                                         int                m,
+                                                         int                n,
+                                                         int                k,
+                                                         const void*        alpha,
+                                                         const void*        a,
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         const void*        b,
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         const void*        beta,
+                                                         void*              c,
+                                                         hipblasDatatype_t  c_type,
+                                                         int                ldc,
+                                                         hipblasDatatype_t  compute_type,
+                                                         hipblasGemmAlgo_t  algo,
+                                                         int*               solutions,
+                                                         int*               size);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasGemmExTune times every solution hipblasGemmExGetSolutions lists for the
+    hipblasGemmEx call with the same arguments, synchronizing the stream of the handle, and
+    records the fastest for the device of the handle. hipblasGemmEx calls of the same
+    operations, sizes, leading dimensions and types with algo HIPBLAS_GEMM_DEFAULT then use
+    it. A tuning file set with hipblasSetGemmTuningFile keeps the choice for later processes.
+
+    On return C holds the result of one hipblasGemmEx call. Tuning cannot be captured into
+    a graph.
+
+    @param[out]
+    solution  [int*]
+              host pointer to the fastest solution, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExTune(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans_a,
+                                                 hipblasOperation_t trans_b,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 const void*        alpha,
+                                                 const void*        a,
+                                                 hipblasDatatype_t  a_type,
+                                                 int                lda,
+                                                 const void*        b,
+                                                 hipblasDatatype_t  b_type,
+                                                 int                ldb,
+                                                 const void*        beta,
+                                                 void*              c,
+                                                 hipblasDatatype_t  c_type,
+                                                 int                ldc,
+                                                 hipblasDatatype_t  compute_type,
+                                                 hipblasGemmAlgo_t  algo,
+                                                 int*               solution);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    hipblasSetGemmTuningFile sets where the solutions chosen by hipblasGemmExTune are kept.
+    Each device model has a file of its own, path followed by a dot and the architecture
+    and compute unit count of the device, memory mapped when hipBLAS first runs a gemm on
+    such a device. Any number of processes can share the files. A lookup in them costs a
+    hash of the arguments of the call.
+
+    The path defaults to the value of the environment variable HIPBLAS_GEMM_TUNING_FILE.
+    A nullptr or empty path keeps the solutions in memory only. Must not be called while
+    other threads make hipBLAS calls.
+
+    @param[in]
+    path      [const char*]
+              path prefix of the tuning files, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmTuningFile(const char* path);
+
 // trsm_ex
 HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                                              hipblasSideMode_t  side,
@@ -16249,6 +17707,851 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   han
                                                            int               batch_count,
                                                            hipblasDatatype_t executionType);
 
+/*! \brief 64-bit size interface
+
+    \details
+    The _64 variants of a routine take int64_t sizes, increments, leading
+    dimensions and batch counts, and otherwise behave as the routine does;
+    iamax and iamin return 64-bit indices. They are provided for:
+
+    - axpy, copy, swap, scal, dot, asum, nrm2, iamax and iamin
+    - gemv, gemvStridedBatched, ger, geru, gerc, symv and trsv
+    - gemm, gemmBatched, gemmStridedBatched, hipblasGemmEx, syrk, herk and
+      trsm
+
+    A call whose sizes all fit an int runs the 32-bit routine. A larger call
+    is split into calls of at most 2^30 elements, columns or batches. Split
+    dot, asum, nrm2, iamax and iamin calls, and split gemv (with
+    HIPBLAS_OP_N), gemm, syrk and herk calls summing over the split
+    dimension, combine the pieces on the host: they wait for the device, and
+    return HIPBLAS_STATUS_NOT_SUPPORTED during graph capture. Increments and
+    leading dimensions which do not fit an int return
+    HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    Some sizes cannot be split, as the leading dimension of a matrix is at
+    least its number of rows. symv and trsv run only when n fits an int, trsm
+    splits only the columns of B with HIPBLAS_SIDE_LEFT, and syrk and herk
+    split only k with HIPBLAS_OP_N. gemmBatched takes arrays of pointers,
+    which cannot point into pieces of the matrices, so it splits only
+    batchCount.
+*/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t trans,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    trans,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          trans,
+                                                             int64_t                     m,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* A,
+                                                             int64_t                     lda,
+                                                             hipblasStride               strideA,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          A,
+                                              int64_t         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDger_64(hipblasHandle_t handle,
+                                              int64_t         m,
+                                              int64_t         n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         A,
+                                              int64_t         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       A,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc_64(hipblasHandle_t       handle,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       A,
+                                               int64_t               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       A,
+                                               int64_t                     lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc_64(hipblasHandle_t             handle,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       A,
+                                               int64_t                     lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const float*      alpha,
+                                               const float*      A,
+                                               int64_t           lda,
+                                               const float*      x,
+                                               int64_t           incx,
+                                               const float*      beta,
+                                               float*            y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv_64(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int64_t           n,
+                                               const double*     alpha,
+                                               const double*     A,
+                                               int64_t           lda,
+                                               const double*     x,
+                                               int64_t           incx,
+                                               const double*     beta,
+                                               double*           y,
+                                               int64_t           incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const float*       A,
+                                               int64_t            lda,
+                                               float*             x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               const double*      A,
+                                               int64_t            lda,
+                                               double*            x,
+                                               int64_t            incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int64_t            lda,
+                                               const float*       B,
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float*             C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int64_t            lda,
+                                               const double*      B,
+                                               int64_t            ldb,
+                                               const double*      beta,
+                                               double*            C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transa,
+                                               hipblasOperation_t    transb,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* B,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transa,
+                                               hipblasOperation_t          transb,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* B,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       C,
+                                               int64_t                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transa,
+                                                      hipblasOperation_t transb,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int64_t            lda,
+                                                      const float* const B[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       C[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transa,
+                                                      hipblasOperation_t  transb,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int64_t             lda,
+                                                      const double* const B[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       C[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transa,
+                                                      hipblasOperation_t          transb,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const B[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       C[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transa,
+                                                      hipblasOperation_t                transb,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const B[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       C[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transa,
+                                                             hipblasOperation_t transb,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       B,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             const float*       beta,
+                                                             float*             C,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transa,
+                                                             hipblasOperation_t transb,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      B,
+                                                             int64_t            ldb,
+                                                             hipblasStride      strideB,
+                                                             const double*      beta,
+                                                             double*            C,
+                                                             int64_t            ldc,
+                                                             hipblasStride      strideC,
+                                                             int64_t            batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transa,
+                                                             hipblasOperation_t    transb,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* B,
+                                                             int64_t               ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       C,
+                                                             int64_t               ldc,
+                                                             hipblasStride         strideC,
+                                                             int64_t               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          transa,
+                                                             hipblasOperation_t          transb,
+                                                             int64_t                     m,
+                                                             int64_t                     n,
+                                                             int64_t                     k,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* A,
+                                                             int64_t                     lda,
+                                                             hipblasStride               strideA,
+                                                             const hipblasDoubleComplex* B,
+                                                             int64_t                     ldb,
+                                                             hipblasStride               strideB,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       C,
+                                                             int64_t                     ldc,
+                                                             hipblasStride               strideC,
+                                                             int64_t                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int64_t            lda,
+                                               const float*       beta,
+                                               float*             C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk_64(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int64_t            lda,
+                                               const double*      beta,
+                                               double*            C,
+                                               int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       C,
+                                               int64_t                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherk_64(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const float*          alpha,
+                                               const hipblasComplex* A,
+                                               int64_t               lda,
+                                               const float*          beta,
+                                               hipblasComplex*       C,
+                                               int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherk_64(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const double*               alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int64_t                     lda,
+                                               const double*               beta,
+                                               hipblasDoubleComplex*       C,
+                                               int64_t                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               float*             A,
+                                               int64_t            lda,
+                                               float*             B,
+                                               int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               double*            A,
+                                               int64_t            lda,
+                                               double*            B,
+                                               int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       A,
+                                               int64_t               lda,
+                                               hipblasComplex*       B,
+                                               int64_t               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       A,
+                                               int64_t                     lda,
+                                               hipblasDoubleComplex*       B,
+                                               int64_t                     ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans_a,
+                                                hipblasOperation_t trans_b,
+                                                int64_t            m,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const void*        alpha,
+                                                const void*        a,
+                                                hipblasDatatype_t  a_type,
+                                                int64_t            lda,
+                                                const void*        b,
+                                                hipblasDatatype_t  b_type,
+                                                int64_t            ldb,
+                                                const void*        beta,
+                                                void*              c,
+                                                hipblasDatatype_t  c_type,
+                                                int64_t            ldc,
+                                                hipblasDatatype_t  compute_type,
+                                                hipblasGemmAlgo_t  algo);
+
 /*! HIPBLAS Auxiliary API
 
     \details
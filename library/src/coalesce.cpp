@@ -0,0 +1,498 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstring>
+
+thread_local bool hipblas_coalescer_running = false;
+
+namespace
+{
+    // A shape is run once this many calls of it are waiting, and the device
+    // pointer mode calls once this many of them are
+    constexpr size_t max_coalesced_calls = 256;
+
+    // Bytes of the device copies of the alpha and beta of a call
+    constexpr size_t scalars_size = 2 * sizeof(hipblas_gemm_shape::alpha);
+
+    // Calls with more multiply-adds than this keep the device busy on their
+    // own, and are run right away
+    constexpr double max_coalesced_work = 128.0 * 128.0 * 128.0;
+
+    // Handles in HIPBLAS_COALESCING_ON mode, for the calls which may depend on
+    // the deferred calls of any handle
+    std::mutex                   coalescing_mutex;
+    std::vector<hipblasHandle_t> coalescing_handles;
+
+    void set_coalescing(hipblasHandle_t handle, bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(coalescing_mutex);
+        auto it = std::find(coalescing_handles.begin(), coalescing_handles.end(), handle);
+        if(enabled && it == coalescing_handles.end())
+            coalescing_handles.push_back(handle);
+        else if(!enabled && it != coalescing_handles.end())
+            coalescing_handles.erase(it);
+
+        if(!coalescing_handles.empty())
+            hipblas_log_layer.fetch_or(hipblas_layer_mode_coalescing);
+        else
+            hipblas_log_layer.fetch_and(~hipblas_layer_mode_coalescing);
+    }
+
+    hipblas_memory_range matrix_range(const void* data, int rows, int cols, int ld, size_t size)
+    {
+        const char* begin = static_cast<const char*>(data);
+        return {begin, begin + ((size_t(ld) * (cols - 1)) + rows) * size};
+    }
+
+    bool overlaps(const std::vector<hipblas_memory_range>& ranges,
+                  const hipblas_memory_range&              range)
+    {
+        for(const hipblas_memory_range& other : ranges)
+            if(range.overlaps(other))
+                return true;
+        return false;
+    }
+
+    // alpha or beta as stored in a shape
+    const void* shape_scalar(const hipblas_gemm_shape& shape, const unsigned char* scalar)
+    {
+        if(shape.pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+            return scalar;
+
+        const void* address;
+        memcpy(&address, scalar, sizeof(address));
+        return address;
+    }
+
+    // Sets hipblas_coalescer_running for the scope
+    class running_scope
+    {
+    public:
+        running_scope()
+        {
+            hipblas_coalescer_running = true;
+        }
+
+        ~running_scope()
+        {
+            hipblas_coalescer_running = false;
+        }
+    };
+}
+
+bool hipblas_gemm_shape::operator==(const hipblas_gemm_shape& other) const
+{
+    return trans_a == other.trans_a && trans_b == other.trans_b && m == other.m
+           && n == other.n && k == other.k && lda == other.lda && ldb == other.ldb
+           && ldc == other.ldc && a_type == other.a_type && b_type == other.b_type
+           && c_type == other.c_type && compute_type == other.compute_type
+           && algo == other.algo && pointer_mode == other.pointer_mode
+           && !memcmp(alpha, other.alpha, sizeof(alpha)) && !memcmp(beta, other.beta, sizeof(beta));
+}
+
+hipblas_gemm_coalescer::~hipblas_gemm_coalescer()
+{
+    // The handle is being destroyed, and hipblasDestroy has run the calls
+    if(m_enabled)
+        set_coalescing(m_handle, false);
+    if(m_scalars)
+        (void)hipFree(m_scalars);
+}
+
+hipblasStatus_t hipblas_gemm_coalescer::set_mode(hipblasHandle_t         handle,
+                                                 hipblasCoalescingMode_t mode)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    bool enabled = mode == HIPBLAS_COALESCING_ON;
+    if(enabled != m_enabled)
+        set_coalescing(handle, enabled);
+    m_enabled = enabled;
+    m_handle  = handle;
+
+    if(enabled)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    run(handle);
+    hipblasStatus_t status = m_status;
+    m_status               = HIPBLAS_STATUS_SUCCESS;
+    return status;
+}
+
+hipblasCoalescingMode_t hipblas_gemm_coalescer::mode()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_enabled ? HIPBLAS_COALESCING_ON : HIPBLAS_COALESCING_OFF;
+}
+
+bool hipblas_gemm_coalescer::defer(hipblasHandle_t           handle,
+                                   const hipblas_gemm_shape& shape,
+                                   const void*               A,
+                                   const void*               B,
+                                   void*                     C,
+                                   hipblasStatus_t&          status)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!m_enabled)
+        return false;
+
+    size_t a_size = hipblas_datatype_size(shape.a_type);
+    size_t b_size = hipblas_datatype_size(shape.b_type);
+    size_t c_size = hipblas_datatype_size(shape.c_type);
+
+    // Invalid calls run now to report their error, and large ones gain
+    // nothing from being merged
+    int  a_rows = shape.trans_a == HIPBLAS_OP_N ? shape.m : shape.k;
+    int  b_rows = shape.trans_b == HIPBLAS_OP_N ? shape.k : shape.n;
+    bool deferrable
+        = shape.m > 0 && shape.n > 0 && shape.k > 0 && shape.lda >= a_rows && shape.ldb >= b_rows
+          && shape.ldc >= shape.m && A && B && C && a_size && b_size && c_size
+          && double(shape.m) * shape.n * shape.k <= max_coalesced_work;
+    if(!deferrable || hipblas_is_capturing(handle))
+    {
+        run(handle);
+        return false;
+    }
+
+    hipblas_memory_range a = matrix_range(
+        A, a_rows, shape.trans_a == HIPBLAS_OP_N ? shape.k : shape.m, shape.lda, a_size);
+    hipblas_memory_range b = matrix_range(
+        B, b_rows, shape.trans_b == HIPBLAS_OP_N ? shape.n : shape.k, shape.ldb, b_size);
+    hipblas_memory_range c = matrix_range(C, shape.m, shape.n, shape.ldc, c_size);
+
+    // The call must see the results of the deferred calls writing its inputs,
+    // and must not overwrite what the deferred calls read or write
+    if(overlaps(m_writes, a) || overlaps(m_writes, b) || overlaps(m_writes, c)
+       || overlaps(m_reads, c))
+        run(handle);
+
+    hipblas_gemm_shape deferred = shape;
+    if(shape.pointer_mode == HIPBLAS_POINTER_MODE_DEVICE && !copy_scalars(handle, deferred))
+    {
+        run(handle);
+        return false;
+    }
+
+    auto group = std::find_if(m_groups.begin(), m_groups.end(), [&](const hipblas_gemm_group& g) {
+        return g.shape == deferred;
+    });
+    if(group == m_groups.end())
+    {
+        m_groups.push_back({deferred, {}, {}, {}});
+        group = m_groups.end() - 1;
+    }
+
+    group->a.push_back(A);
+    group->b.push_back(B);
+    group->c.push_back(C);
+    m_reads.push_back(a);
+    m_reads.push_back(b);
+    m_writes.push_back(c);
+
+    if(group->c.size() >= max_coalesced_calls)
+        run(handle);
+
+    status = HIPBLAS_STATUS_SUCCESS;
+    return true;
+}
+
+bool hipblas_gemm_coalescer::copy_scalars(hipblasHandle_t handle, hipblas_gemm_shape& shape)
+{
+    size_t size = hipblas_datatype_size(shape.compute_type);
+    if(!size || size > sizeof(shape.alpha))
+        return false;
+
+    hipStream_t stream;
+    if(hipblas_get_stream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    if(m_scalars_used == max_coalesced_calls)
+        run(handle);
+
+    // Calls on the previous stream may still read the copies. hipFree waits
+    // for the device, so they finish before the copies are replaced.
+    if(m_scalars && stream != m_scalars_stream)
+    {
+        (void)hipFree(m_scalars);
+        m_scalars = nullptr;
+    }
+    if(!m_scalars)
+    {
+        void* scalars;
+        if(hipMalloc(&scalars, scalars_size * max_coalesced_calls) != hipSuccess)
+            return false;
+        m_scalars        = static_cast<unsigned char*>(scalars);
+        m_scalars_stream = stream;
+        m_scalars_used   = 0;
+    }
+
+    const void*    user_alpha = shape_scalar(shape, shape.alpha);
+    const void*    user_beta  = shape_scalar(shape, shape.beta);
+    unsigned char* alpha      = m_scalars + scalars_size * m_scalars_used;
+    unsigned char* beta       = alpha + sizeof(shape.alpha);
+    if(hipMemcpyAsync(alpha, user_alpha, size, hipMemcpyDeviceToDevice, stream) != hipSuccess
+       || hipMemcpyAsync(beta, user_beta, size, hipMemcpyDeviceToDevice, stream) != hipSuccess)
+        return false;
+    m_scalars_used++;
+
+    memcpy(shape.alpha, &alpha, sizeof(alpha));
+    memcpy(shape.beta, &beta, sizeof(beta));
+    return true;
+}
+
+void hipblas_gemm_coalescer::run_deferred(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    run(handle);
+}
+
+hipblasStatus_t hipblas_gemm_coalescer::flush(hipblasHandle_t handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    run(handle);
+
+    hipblasStatus_t status = m_status;
+    m_status               = HIPBLAS_STATUS_SUCCESS;
+    return status;
+}
+
+// Run every group as one batched call, or a plain call for a single call.
+// The pointer arrays of all groups are copied to the device together.
+void hipblas_gemm_coalescer::run(hipblasHandle_t handle)
+{
+    if(m_groups.empty())
+        return;
+
+    running_scope running;
+
+    std::vector<const void*> arrays;
+    for(const hipblas_gemm_group& group : m_groups)
+    {
+        if(group.c.size() < 2)
+            continue;
+        arrays.insert(arrays.end(), group.a.begin(), group.a.end());
+        arrays.insert(arrays.end(), group.b.begin(), group.b.end());
+        arrays.insert(arrays.end(), group.c.begin(), group.c.end());
+    }
+
+    hipblasStatus_t status        = HIPBLAS_STATUS_SUCCESS;
+    const void**    device_arrays = nullptr;
+    if(!arrays.empty())
+    {
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        hipStream_t           stream;
+        status = hipblas_get_stream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            size_t size   = sizeof(void*) * arrays.size();
+            device_arrays = static_cast<const void**>(state->scratch.get(size, state->capture));
+            if(!device_arrays)
+                status = HIPBLAS_STATUS_ALLOC_FAILED;
+            else if(hipMemcpyAsync(
+                        device_arrays, arrays.data(), size, hipMemcpyHostToDevice, stream)
+                    != hipSuccess)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+    }
+
+    size_t offset = 0;
+    for(const hipblas_gemm_group& group : m_groups)
+    {
+        const hipblas_gemm_shape& shape = group.shape;
+        int                       count = int(group.c.size());
+        hipblasStatus_t           call_status;
+        if(count == 1)
+        {
+            call_status = hipblasGemmEx(handle,
+                                        shape.trans_a,
+                                        shape.trans_b,
+                                        shape.m,
+                                        shape.n,
+                                        shape.k,
+                                        shape_scalar(shape, shape.alpha),
+                                        group.a[0],
+                                        shape.a_type,
+                                        shape.lda,
+                                        group.b[0],
+                                        shape.b_type,
+                                        shape.ldb,
+                                        shape_scalar(shape, shape.beta),
+                                        group.c[0],
+                                        shape.c_type,
+                                        shape.ldc,
+                                        shape.compute_type,
+                                        shape.algo);
+        }
+        else if(status != HIPBLAS_STATUS_SUCCESS)
+            continue;
+        else
+        {
+            call_status = hipblasGemmBatchedEx(handle,
+                                               shape.trans_a,
+                                               shape.trans_b,
+                                               shape.m,
+                                               shape.n,
+                                               shape.k,
+                                               shape_scalar(shape, shape.alpha),
+                                               device_arrays + offset,
+                                               shape.a_type,
+                                               shape.lda,
+                                               device_arrays + offset + count,
+                                               shape.b_type,
+                                               shape.ldb,
+                                               shape_scalar(shape, shape.beta),
+                                               (void**)(device_arrays + offset + 2 * count),
+                                               shape.c_type,
+                                               shape.ldc,
+                                               count,
+                                               shape.compute_type,
+                                               shape.algo);
+            offset += 3 * size_t(count);
+        }
+
+        if(m_status == HIPBLAS_STATUS_SUCCESS)
+            m_status = call_status;
+    }
+
+    if(m_status == HIPBLAS_STATUS_SUCCESS)
+        m_status = status;
+
+    m_groups.clear();
+    m_reads.clear();
+    m_writes.clear();
+    m_scalars_used = 0;
+}
+
+bool hipblas_coalesced_entry_point(const char* func)
+{
+    static const char* const entry_points[]
+        = {"hipblasSgemm", "hipblasDgemm", "hipblasCgemm", "hipblasZgemm", "hipblasGemmEx"};
+    for(const char* entry_point : entry_points)
+        if(!strcmp(func, entry_point))
+            return true;
+    return false;
+}
+
+bool hipblas_defer_gemm(hipblasHandle_t    handle,
+                        hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int                m,
+                        int                n,
+                        int                k,
+                        const void*        alpha,
+                        const void*        A,
+                        hipblasDatatype_t  aType,
+                        int                lda,
+                        const void*        B,
+                        hipblasDatatype_t  bType,
+                        int                ldb,
+                        const void*        beta,
+                        void*              C,
+                        hipblasDatatype_t  cType,
+                        int                ldc,
+                        hipblasDatatype_t  computeType,
+                        hipblasGemmAlgo_t  algo,
+                        hipblasStatus_t&   status)
+{
+    if(!handle || !alpha || !beta)
+        return false;
+
+    hipblas_gemm_shape shape = {};
+    shape.trans_a            = transA;
+    shape.trans_b            = transB;
+    shape.m                  = m;
+    shape.n                  = n;
+    shape.k                  = k;
+    shape.lda                = lda;
+    shape.ldb                = ldb;
+    shape.ldc                = ldc;
+    shape.a_type             = aType;
+    shape.b_type             = bType;
+    shape.c_type             = cType;
+    shape.compute_type       = computeType;
+    shape.algo               = algo;
+
+    if(hipblasGetPointerMode(handle, &shape.pointer_mode) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    if(shape.pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+    {
+        size_t size = hipblas_datatype_size(computeType);
+        if(!size)
+            return false;
+        memcpy(shape.alpha, alpha, size);
+        memcpy(shape.beta, beta, size);
+    }
+    else
+    {
+        memcpy(shape.alpha, &alpha, sizeof(alpha));
+        memcpy(shape.beta, &beta, sizeof(beta));
+    }
+
+    return hipblas_get_handle_state(handle)->coalescer.defer(handle, shape, A, B, C, status);
+}
+
+void hipblas_flush_coalesced(hipblasHandle_t handle, bool own_calls)
+{
+    std::vector<hipblasHandle_t> handles;
+    {
+        std::lock_guard<std::mutex> lock(coalescing_mutex);
+        handles = coalescing_handles;
+    }
+    for(hipblasHandle_t coalescing : handles)
+        if(own_calls || coalescing != handle)
+            hipblas_get_handle_state(coalescing)->coalescer.run_deferred(coalescing);
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetCoalescingMode(hipblasHandle_t handle, hipblasCoalescingMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_COALESCING_OFF && mode != HIPBLAS_COALESCING_ON)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_get_handle_state(handle)->coalescer.set_mode(handle, mode);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetCoalescingMode(hipblasHandle_t handle, hipblasCoalescingMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblas_get_handle_state(handle)->coalescer.mode();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasFlushCoalescedCalls(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return hipblas_get_handle_state(handle)->coalescer.flush(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
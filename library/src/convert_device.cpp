@@ -0,0 +1,465 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Type conversions, copies and norms of batches of matrices on the GPU
+// backends, for routines hipBLAS builds from the backend's calls such as the
+// mixed precision solvers and the type converting transfers. A complex matrix
+// is converted as a real matrix of twice as many rows. hipcc compiles this
+// source for the GPU.
+
+#include "convert.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+namespace
+{
+    constexpr int convert_threads = 256;
+    constexpr int norm_threads    = 256;
+    constexpr int max_grid        = 65535;
+
+    // A hipblas_matrix_batch of elements of type T, ld and stride counted in T
+    template <typename T>
+    struct device_batch
+    {
+        T*            data;
+        T* const*     array;
+        int           ld;
+        hipblasStride stride;
+
+        __device__ T* operator[](int b) const
+        {
+            return array ? array[b] : data + b * stride;
+        }
+    };
+
+    template <typename T>
+    device_batch<T> make_batch(const hipblas_matrix_batch& x, int scale)
+    {
+        return {static_cast<T*>(x.data),
+                reinterpret_cast<T* const*>(x.array),
+                x.ld * scale,
+                x.stride * scale};
+    }
+
+    // Elements of type T as loaded to, and stored from, double, and the
+    // largest finite magnitude of T
+    template <typename T>
+    struct device_value
+    {
+        static constexpr double max = std::is_same<T, float>{} ? FLT_MAX : DBL_MAX;
+
+        static __device__ double load(T x)
+        {
+            return x;
+        }
+
+        static __device__ T store(double x)
+        {
+            return T(x);
+        }
+    };
+
+    template <>
+    struct device_value<hipblasHalf>
+    {
+        static constexpr double max = 65504.0;
+
+        static __device__ double load(hipblasHalf x)
+        {
+            return __half2float(__ushort_as_half(x));
+        }
+
+        // Through float, as on the host
+        static __device__ hipblasHalf store(double x)
+        {
+            return __half_as_ushort(__float2half(float(x)));
+        }
+    };
+
+    template <>
+    struct device_value<hipblasBfloat16>
+    {
+        static constexpr double max = 3.38953138925153547590470800371487866880e+38;
+
+        static __device__ double load(hipblasBfloat16 x)
+        {
+            uint32_t bits = uint32_t(x.data) << 16;
+            float    f;
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        // Round to nearest even; NaN stays a quiet NaN
+        static __device__ hipblasBfloat16 store(double x)
+        {
+            float    f = float(x);
+            uint32_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            hipblasBfloat16 b;
+            if((bits & 0x7fffffff) > 0x7f800000)
+                b.data = uint16_t((bits >> 16) | 0x40);
+            else
+                b.data = uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+            return b;
+        }
+    };
+
+    template <>
+    struct device_value<int8_t>
+    {
+        static constexpr double max = 127.0;
+
+        static __device__ double load(int8_t x)
+        {
+            return x;
+        }
+
+        // Round to nearest and saturate; NaN is 0
+        static __device__ int8_t store(double x)
+        {
+            return x != x ? 0 : int8_t(fmin(fmax(rint(x), -128.0), 127.0));
+        }
+    };
+
+    // Whether the finite x is beyond the range of D once rounded to it
+    template <typename D>
+    __device__ bool overflows(double x)
+    {
+        if(fabs(x) > DBL_MAX)
+            return false;
+        if(std::is_same<D, int8_t>{})
+            return x >= 127.5 || x < -128.5;
+        return fabs(x) > device_value<D>::max;
+    }
+
+    template <typename S, typename D>
+    __global__ void convert_kernel(int                   m,
+                                   int                   n,
+                                   device_batch<const S> src,
+                                   device_batch<D>       dst,
+                                   int                   batch_count,
+                                   int*                  overflow)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const S* s    = src[b];
+            D*       d    = dst[b];
+            bool     over = false;
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+            {
+                double x = device_value<S>::load(s[i + int64_t(j) * src.ld]);
+                over |= overflows<D>(x);
+                d[i + int64_t(j) * dst.ld] = device_value<D>::store(x);
+            }
+            if(over && overflow)
+                overflow[b] = 1;
+        }
+    }
+
+    template <typename S, typename D>
+    hipblasStatus_t run_convert(hipStream_t                 stream,
+                                int                         m,
+                                int                         n,
+                                const hipblas_matrix_batch& src,
+                                const hipblas_matrix_batch& dst,
+                                int                         batch_count,
+                                int*                        overflow,
+                                int                         scale)
+    {
+        m *= scale;
+        dim3 grid((m - 1) / convert_threads + 1,
+                  std::min(n, max_grid),
+                  std::min(batch_count, max_grid));
+        hipLaunchKernelGGL((convert_kernel<S, D>),
+                           grid,
+                           dim3(convert_threads),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           make_batch<const S>(src, scale),
+                           make_batch<D>(dst, scale),
+                           batch_count,
+                           overflow);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    template <typename S>
+    hipblasStatus_t convert_from(hipStream_t                 stream,
+                                 int                         m,
+                                 int                         n,
+                                 const hipblas_matrix_batch& src,
+                                 const hipblas_matrix_batch& dst,
+                                 int                         batch_count,
+                                 int*                        overflow,
+                                 int                         scale)
+    {
+        switch(dst.type)
+        {
+        case HIPBLAS_R_16F:
+            return run_convert<S, hipblasHalf>(
+                stream, m, n, src, dst, batch_count, overflow, scale);
+        case HIPBLAS_R_16B:
+            return run_convert<S, hipblasBfloat16>(
+                stream, m, n, src, dst, batch_count, overflow, scale);
+        case HIPBLAS_R_8I:
+            return run_convert<S, int8_t>(stream, m, n, src, dst, batch_count, overflow, scale);
+        case HIPBLAS_R_32F:
+        case HIPBLAS_C_32F:
+            return run_convert<S, float>(stream, m, n, src, dst, batch_count, overflow, scale);
+        default:
+            return run_convert<S, double>(stream, m, n, src, dst, batch_count, overflow, scale);
+        }
+    }
+
+    template <typename W>
+    __global__ void copy_kernel(
+        int m, int n, device_batch<const W> src, device_batch<W> dst, int batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const W* s = src[b];
+            W*       d = dst[b];
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+                d[i + int64_t(j) * dst.ld] = s[i + int64_t(j) * src.ld];
+        }
+    }
+
+    // Copy elements of scale words of type W each
+    template <typename W>
+    hipblasStatus_t run_copy(hipStream_t                 stream,
+                             int                         m,
+                             int                         n,
+                             const hipblas_matrix_batch& src,
+                             const hipblas_matrix_batch& dst,
+                             int                         batch_count,
+                             int                         scale)
+    {
+        m *= scale;
+        dim3 grid((m - 1) / convert_threads + 1,
+                  std::min(n, max_grid),
+                  std::min(batch_count, max_grid));
+        hipLaunchKernelGGL((copy_kernel<W>),
+                           grid,
+                           dim3(convert_threads),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           make_batch<const W>(src, scale),
+                           make_batch<W>(dst, scale),
+                           batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    // |x_ij|, or |re| + |im| of a complex element stored as two reals
+    template <bool COMPLEX>
+    __device__ double element_abs(const double* x, int i, int j, int ld)
+    {
+        if(COMPLEX)
+        {
+            const double* z = x + 2 * (i + int64_t(j) * ld);
+            return fabs(z[0]) + fabs(z[1]);
+        }
+        return fabs(x[i + int64_t(j) * ld]);
+    }
+
+    // The larger of a and b, NaN if either is, so that a NaN residual is
+    // never taken for a small one
+    __device__ double nan_max(double a, double b)
+    {
+        return b > a || b != b ? b : a;
+    }
+
+    template <bool COMPLEX>
+    __global__ void row_sums_kernel(
+        int m, int n, device_batch<const double> x, int batch_count, double* norms)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const double* xb  = x[b];
+            double        sum = 0;
+            for(int j = 0; j < n; j++)
+                sum += element_abs<COMPLEX>(xb, i, j, x.ld);
+            norms[int64_t(b) * m + i] = sum;
+        }
+    }
+
+    template <bool COMPLEX>
+    __global__ void column_max_kernel(
+        int m, int n, device_batch<const double> x, int batch_count, double* norms)
+    {
+        __shared__ double partial[norm_threads];
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+            {
+                const double* xb   = x[b];
+                double        best = 0;
+                for(int i = threadIdx.x; i < m; i += blockDim.x)
+                    best = nan_max(best, element_abs<COMPLEX>(xb, i, j, x.ld));
+
+                partial[threadIdx.x] = best;
+                __syncthreads();
+                for(int s = blockDim.x / 2; s > 0; s /= 2)
+                {
+                    if(threadIdx.x < s)
+                        partial[threadIdx.x]
+                            = nan_max(partial[threadIdx.x], partial[threadIdx.x + s]);
+                    __syncthreads();
+                }
+                if(threadIdx.x == 0)
+                    norms[int64_t(b) * n + j] = partial[0];
+                __syncthreads();
+            }
+    }
+
+    template <bool COMPLEX>
+    hipblasStatus_t run_norms(hipStream_t                 stream,
+                              hipblas_matrix_norm         norm,
+                              int                         m,
+                              int                         n,
+                              const hipblas_matrix_batch& x,
+                              int                         batch_count,
+                              double*                     norms)
+    {
+        // The complex elements are addressed as pairs of reals by element_abs
+        device_batch<const double> batch = make_batch<const double>(x, 1);
+        if(COMPLEX)
+            batch.stride *= 2;
+
+        if(norm == hipblas_matrix_norm::row_sums)
+        {
+            dim3 grid((m - 1) / norm_threads + 1, 1, std::min(batch_count, max_grid));
+            hipLaunchKernelGGL((row_sums_kernel<COMPLEX>),
+                               grid,
+                               dim3(norm_threads),
+                               0,
+                               stream,
+                               m,
+                               n,
+                               batch,
+                               batch_count,
+                               norms);
+        }
+        else
+        {
+            dim3 grid(1, std::min(n, max_grid), std::min(batch_count, max_grid));
+            hipLaunchKernelGGL((column_max_kernel<COMPLEX>),
+                               grid,
+                               dim3(norm_threads),
+                               0,
+                               stream,
+                               m,
+                               n,
+                               batch,
+                               batch_count,
+                               norms);
+        }
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+hipblasStatus_t hipblas_convert_matrices(hipblasHandle_t             handle,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblas_matrix_batch& src,
+                                         const hipblas_matrix_batch& dst,
+                                         int                         batch_count,
+                                         int*                        overflow)
+{
+    if(!hipblas_convert_supported(src.type, dst.type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int scale = src.type == HIPBLAS_C_32F || src.type == HIPBLAS_C_64F ? 2 : 1;
+    switch(src.type)
+    {
+    case HIPBLAS_R_16F:
+        return convert_from<hipblasHalf>(stream, m, n, src, dst, batch_count, overflow, scale);
+    case HIPBLAS_R_16B:
+        return convert_from<hipblasBfloat16>(stream, m, n, src, dst, batch_count, overflow, scale);
+    case HIPBLAS_R_8I:
+        return convert_from<int8_t>(stream, m, n, src, dst, batch_count, overflow, scale);
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return convert_from<float>(stream, m, n, src, dst, batch_count, overflow, scale);
+    default:
+        return convert_from<double>(stream, m, n, src, dst, batch_count, overflow, scale);
+    }
+}
+
+hipblasStatus_t hipblas_copy_matrices(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      int                         elem_size,
+                                      const hipblas_matrix_batch& src,
+                                      const hipblas_matrix_batch& dst,
+                                      int                         batch_count)
+{
+    if(m <= 0 || n <= 0 || elem_size <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // In the widest words an element is made of
+    if(elem_size % 8 == 0)
+        return run_copy<uint64_t>(stream, m, n, src, dst, batch_count, elem_size / 8);
+    if(elem_size % 4 == 0)
+        return run_copy<uint32_t>(stream, m, n, src, dst, batch_count, elem_size / 4);
+    if(elem_size % 2 == 0)
+        return run_copy<uint16_t>(stream, m, n, src, dst, batch_count, elem_size / 2);
+    return run_copy<uint8_t>(stream, m, n, src, dst, batch_count, elem_size);
+}
+
+hipblasStatus_t hipblas_matrix_norms(hipblasHandle_t             handle,
+                                     hipblas_matrix_norm         norm,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblas_matrix_batch& x,
+                                     int                         batch_count,
+                                     double*                     norms)
+{
+    if(x.type != HIPBLAS_R_64F && x.type != HIPBLAS_C_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return x.type == HIPBLAS_C_64F ? run_norms<true>(stream, norm, m, n, x, batch_count, norms)
+                                   : run_norms<false>(stream, norm, m, n, x, batch_count, norms);
+}
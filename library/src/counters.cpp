@@ -0,0 +1,934 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "counters.hpp"
+#include "bytes.hpp"
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "flops.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <unordered_map>
+
+namespace
+{
+    // Routine families, in the order hipblasGetHandleCounters reports them
+    enum hipblas_counter_family : int
+    {
+        family_asum,
+        family_axpy,
+        family_copy,
+        family_dgmm,
+        family_dot,
+        family_dotc,
+        family_gbmv,
+        family_geam,
+        family_gemm,
+        family_gemv,
+        family_geqrf,
+        family_ger,
+        family_getrf,
+        family_getri,
+        family_getrs,
+        family_hbmv,
+        family_hemm,
+        family_hemv,
+        family_her,
+        family_her2,
+        family_her2k,
+        family_herk,
+        family_herkx,
+        family_hpmv,
+        family_hpr,
+        family_hpr2,
+        family_iamax,
+        family_iamin,
+        family_nrm2,
+        family_rot,
+        family_rotg,
+        family_rotm,
+        family_rotmg,
+        family_sbmv,
+        family_scal,
+        family_spmv,
+        family_spr,
+        family_spr2,
+        family_swap,
+        family_symm,
+        family_symv,
+        family_syr,
+        family_syr2,
+        family_syr2k,
+        family_syrk,
+        family_syrkx,
+        family_tbmv,
+        family_tbsv,
+        family_tpmv,
+        family_tpsv,
+        family_trmm,
+        family_trmv,
+        family_trsm,
+        family_trsv,
+        family_trtri,
+        family_count,
+    };
+
+    const char* const family_names[family_count] = {
+        "asum",  "axpy",  "copy",  "dgmm",  "dot",   "dotc",  "gbmv",  "geam",  "gemm",  "gemv",
+        "geqrf", "ger",   "getrf", "getri", "getrs", "hbmv",  "hemm",  "hemv",  "her",   "her2",
+        "her2k", "herk",  "herkx", "hpmv",  "hpr",   "hpr2",  "iamax", "iamin", "nrm2",  "rot",
+        "rotg",  "rotm",  "rotmg", "sbmv",  "scal",  "spmv",  "spr",   "spr2",  "swap",  "symm",
+        "symv",  "syr",   "syr2",  "syr2k", "syrk",  "syrkx", "tbmv",  "tbsv",  "tpmv",  "tpsv",
+        "trmm",  "trmv",  "trsm",  "trsv",  "trtri",
+    };
+
+    // Sizes of a call, with the missing dimensions of square and triangular
+    // routines filled in the way the hipblas-bench testers fill them
+    struct call_dims
+    {
+        int                m;
+        int                n;
+        int                k;
+        int                kl;
+        int                ku;
+        int                nrhs;
+        hipblasOperation_t trans;
+    };
+
+    template <typename T>
+    struct real_type
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_type<hipblasComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_type<hipblasDoubleComplex>
+    {
+        using type = double;
+    };
+
+    // rotm only exists for real types. Its flag is usually in device memory,
+    // so the full update is assumed.
+    template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+    void rotm_counts(int n, double& gflop, double& gbyte)
+    {
+        gflop = rotm_gflop_count<T>(n, T(-1));
+        gbyte = rotm_gbyte_count<T>(n, T(-1));
+    }
+
+    template <typename T, std::enable_if_t<!std::is_floating_point<T>{}, int> = 0>
+    void rotm_counts(int, double&, double&)
+    {
+    }
+
+    // Work of a single call, or of one problem of a batched call
+    template <typename T>
+    void family_counts(int family, const call_dims& d, double& gflop, double& gbyte)
+    {
+        using R = typename real_type<T>::type;
+
+        gflop = 0;
+        gbyte = 0;
+        switch(family)
+        {
+        case family_asum:
+            gflop = asum_gflop_count<T>(d.n);
+            gbyte = asum_gbyte_count<T>(d.n);
+            break;
+        case family_axpy:
+            gflop = axpy_gflop_count<T>(d.n);
+            gbyte = axpy_gbyte_count<T>(d.n);
+            break;
+        case family_copy:
+            gflop = copy_gflop_count<T>(d.n);
+            gbyte = copy_gbyte_count<T>(d.n);
+            break;
+        case family_dot:
+            gflop = dot_gflop_count<false, T>(d.n);
+            gbyte = dot_gbyte_count<T>(d.n);
+            break;
+        case family_dotc:
+            gflop = dot_gflop_count<true, T>(d.n);
+            gbyte = dot_gbyte_count<T>(d.n);
+            break;
+        case family_iamax:
+        case family_iamin:
+            gflop = iamax_gflop_count<T>(d.n);
+            gbyte = iamax_gbyte_count<T>(d.n);
+            break;
+        case family_nrm2:
+            gflop = nrm2_gflop_count<T>(d.n);
+            gbyte = nrm2_gbyte_count<T>(d.n);
+            break;
+        case family_rot:
+            gflop = rot_gflop_count<T, T, R, T>(d.n);
+            gbyte = rot_gbyte_count<T>(d.n);
+            break;
+        case family_rotm:
+            rotm_counts<T>(d.n, gflop, gbyte);
+            break;
+        case family_scal:
+            gflop = scal_gflop_count<T, T>(d.n);
+            gbyte = scal_gbyte_count<T>(d.n);
+            break;
+        case family_swap:
+            gflop = swap_gflop_count<T>(d.n);
+            gbyte = swap_gbyte_count<T>(d.n);
+            break;
+        case family_gbmv:
+            gflop = gbmv_gflop_count<T>(d.trans, d.m, d.n, d.kl, d.ku);
+            gbyte = gbmv_gbyte_count<T>(d.trans, d.m, d.n, d.kl, d.ku);
+            break;
+        case family_gemv:
+            gflop = gemv_gflop_count<T>(d.trans, d.m, d.n);
+            gbyte = gemv_gbyte_count<T>(d.trans, d.m, d.n);
+            break;
+        case family_ger:
+            gflop = ger_gflop_count<T>(d.m, d.n);
+            gbyte = ger_gbyte_count<T>(d.m, d.n);
+            break;
+        case family_hbmv:
+            gflop = hbmv_gflop_count<T>(d.n, d.k);
+            gbyte = hbmv_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_hemv:
+            gflop = hemv_gflop_count<T>(d.n);
+            gbyte = hemv_gbyte_count<T>(d.n);
+            break;
+        case family_her:
+            gflop = her_gflop_count<T>(d.n);
+            gbyte = her_gbyte_count<T>(d.n);
+            break;
+        case family_her2:
+            gflop = her2_gflop_count<T>(d.n);
+            gbyte = her2_gbyte_count<T>(d.n);
+            break;
+        case family_hpmv:
+            gflop = hpmv_gflop_count<T>(d.n);
+            gbyte = hpmv_gbyte_count<T>(d.n);
+            break;
+        case family_hpr:
+            gflop = hpr_gflop_count<T>(d.n);
+            gbyte = hpr_gbyte_count<T>(d.n);
+            break;
+        case family_hpr2:
+            gflop = hpr2_gflop_count<T>(d.n);
+            gbyte = hpr2_gbyte_count<T>(d.n);
+            break;
+        case family_sbmv:
+            gflop = sbmv_gflop_count<T>(d.n, d.k);
+            gbyte = sbmv_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_spmv:
+            gflop = spmv_gflop_count<T>(d.n);
+            gbyte = spmv_gbyte_count<T>(d.n);
+            break;
+        case family_spr:
+            gflop = spr_gflop_count<T>(d.n);
+            gbyte = spr_gbyte_count<T>(d.n);
+            break;
+        case family_spr2:
+            gflop = spr2_gflop_count<T>(d.n);
+            gbyte = spr2_gbyte_count<T>(d.n);
+            break;
+        case family_symv:
+            gflop = symv_gflop_count<T>(d.n);
+            gbyte = symv_gbyte_count<T>(d.n);
+            break;
+        case family_syr:
+            gflop = syr_gflop_count<T>(d.n);
+            gbyte = syr_gbyte_count<T>(d.n);
+            break;
+        case family_syr2:
+            gflop = syr2_gflop_count<T>(d.n);
+            gbyte = syr2_gbyte_count<T>(d.n);
+            break;
+        case family_tbmv:
+            gflop = tbmv_gflop_count<T>(d.m, d.k);
+            gbyte = tbmv_gbyte_count<T>(d.m, d.k);
+            break;
+        case family_tbsv:
+            gflop = tbsv_gflop_count<T>(d.n, d.k);
+            gbyte = tbsv_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_tpmv:
+            gflop = tpmv_gflop_count<T>(d.m);
+            gbyte = tpmv_gbyte_count<T>(d.m);
+            break;
+        case family_tpsv:
+            gflop = tpsv_gflop_count<T>(d.n);
+            gbyte = tpsv_gbyte_count<T>(d.n);
+            break;
+        case family_trmv:
+            gflop = trmv_gflop_count<T>(d.m);
+            gbyte = trmv_gbyte_count<T>(d.m);
+            break;
+        case family_trsv:
+            gflop = trsv_gflop_count<T>(d.m);
+            gbyte = trsv_gbyte_count<T>(d.m);
+            break;
+        case family_dgmm:
+            gflop = dgmm_gflop_count<T>(d.m, d.n);
+            gbyte = dgmm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_geam:
+            gflop = geam_gflop_count<T>(d.m, d.n);
+            gbyte = geam_gbyte_count<T>(d.m, d.n);
+            break;
+        case family_gemm:
+            gflop = gemm_gflop_count<T>(d.m, d.n, d.k);
+            gbyte = gemm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_hemm:
+            gflop = hemm_gflop_count<T>(d.m, d.n, d.k);
+            gbyte = hemm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_her2k:
+            gflop = her2k_gflop_count<T>(d.n, d.k);
+            gbyte = her2k_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_herk:
+            gflop = herk_gflop_count<T>(d.n, d.k);
+            gbyte = herk_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_herkx:
+            gflop = herkx_gflop_count<T>(d.n, d.k);
+            gbyte = herkx_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_symm:
+            gflop = symm_gflop_count<T>(d.m, d.n, d.k);
+            gbyte = symm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_syr2k:
+            gflop = syr2k_gflop_count<T>(d.n, d.k);
+            gbyte = syr2k_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_syrk:
+            gflop = syrk_gflop_count<T>(d.n, d.k);
+            gbyte = syrk_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_syrkx:
+            gflop = syrkx_gflop_count<T>(d.n, d.k);
+            gbyte = syrkx_gbyte_count<T>(d.n, d.k);
+            break;
+        case family_trmm:
+            gflop = trmm_gflop_count<T>(d.m, d.n, d.k);
+            gbyte = trmm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_trsm:
+            gflop = trsm_gflop_count<T>(d.m, d.n, d.k);
+            gbyte = trsm_gbyte_count<T>(d.m, d.n, d.k);
+            break;
+        case family_trtri:
+            gflop = trtri_gflop_count<T>(d.n);
+            gbyte = trtri_gbyte_count<T>(d.n);
+            break;
+        case family_geqrf:
+            gflop = geqrf_gflop_count<T>(d.n, d.m);
+            break;
+        case family_getrf:
+            gflop = getrf_gflop_count<T>(d.n, d.m);
+            break;
+        case family_getri:
+            gflop = getri_gflop_count<T>(d.n);
+            break;
+        case family_getrs:
+            gflop = getrs_gflop_count<T>(d.n, d.nrhs);
+            break;
+        }
+    }
+
+    // Types the counters know the work of; calls in other types only count calls
+    void call_counts(int type, int family, const call_dims& d, double& gflop, double& gbyte)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return family_counts<hipblasHalf>(family, d, gflop, gbyte);
+        case HIPBLAS_R_16B:
+            return family_counts<hipblasBfloat16>(family, d, gflop, gbyte);
+        case HIPBLAS_R_32F:
+            return family_counts<float>(family, d, gflop, gbyte);
+        case HIPBLAS_R_64F:
+            return family_counts<double>(family, d, gflop, gbyte);
+        case HIPBLAS_C_32F:
+            return family_counts<hipblasComplex>(family, d, gflop, gbyte);
+        case HIPBLAS_C_64F:
+            return family_counts<hipblasDoubleComplex>(family, d, gflop, gbyte);
+        case HIPBLAS_R_8I:
+            return family_counts<int8_t>(family, d, gflop, gbyte);
+        case HIPBLAS_R_32I:
+            return family_counts<int32_t>(family, d, gflop, gbyte);
+        }
+        gflop = 0;
+        gbyte = 0;
+    }
+
+    int precision_type(const char* precision)
+    {
+        static const struct
+        {
+            const char*       name;
+            hipblasDatatype_t type;
+        } types[] = {
+            {"f16_r", HIPBLAS_R_16F},
+            {"bf16_r", HIPBLAS_R_16B},
+            {"f32_r", HIPBLAS_R_32F},
+            {"f64_r", HIPBLAS_R_64F},
+            {"f32_c", HIPBLAS_C_32F},
+            {"f64_c", HIPBLAS_C_64F},
+        };
+        for(const auto& type : types)
+            if(strcmp(precision, type.name) == 0)
+                return type.type;
+        return -1;
+    }
+
+    // Lower case, underscores removed
+    std::string normalize(const std::string& name)
+    {
+        std::string key;
+        for(char c : name)
+            if(c != '_')
+                key += char(tolower(c));
+        return key;
+    }
+
+    int64_t integer_arg(const hipblas_log_value* values, int i, int64_t fallback)
+    {
+        return i >= 0 ? values[i].i : fallback;
+    }
+
+    // Handles with counters on; the counters layer bit is set while there are any
+    std::mutex enabled_mutex;
+    int        enabled_handles = 0;
+
+    void count_enabled_handles(int delta)
+    {
+        std::lock_guard<std::mutex> lock(enabled_mutex);
+        enabled_handles += delta;
+        if(enabled_handles)
+            hipblas_log_layer.fetch_or(hipblas_layer_mode_counters);
+        else
+            hipblas_log_layer.fetch_and(~hipblas_layer_mode_counters);
+    }
+}
+
+struct hipblas_call_timer
+{
+    hipblas_counter_shard* shard;
+    int                    family;
+    hipStream_t            stream;
+    hipEvent_t             start;
+    hipEvent_t             stop;
+};
+
+// The counters one thread keeps for one handle. Calls, flops and bytes are
+// only written by the owning thread, so they are relaxed atomics updated
+// without a read-modify-write. Device times are accumulated from event pairs,
+// which the owner and readers harvest under the timer mutex.
+class hipblas_counter_shard
+{
+public:
+    explicit hipblas_counter_shard(hipblasCountersMode_t mode)
+        : mode(mode)
+    {
+    }
+
+    ~hipblas_counter_shard()
+    {
+        for(auto& timer : m_timers)
+        {
+            (void)hipEventDestroy(timer->start);
+            (void)hipEventDestroy(timer->stop);
+        }
+    }
+
+    // Owner only
+    void add(int family, double gflop, double gbyte)
+    {
+        family_counters& counters = m_families[family];
+        counters.calls.store(counters.calls.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+        counters.gflop.store(counters.gflop.load(std::memory_order_relaxed) + gflop,
+                             std::memory_order_relaxed);
+        counters.gbyte.store(counters.gbyte.load(std::memory_order_relaxed) + gbyte,
+                             std::memory_order_relaxed);
+    }
+
+    // Owner only
+    hipblas_call_timer* start_timer(int family, hipStream_t stream)
+    {
+        std::lock_guard<std::mutex> lock(m_timer_mutex);
+        harvest(false);
+
+        hipblas_call_timer* timer;
+        if(!m_free.empty())
+        {
+            timer = m_free.back();
+            m_free.pop_back();
+        }
+        else
+        {
+            std::unique_ptr<hipblas_call_timer> created(
+                new hipblas_call_timer{this, -1, nullptr, nullptr, nullptr});
+            if(hipEventCreate(&created->start) != hipSuccess)
+                return nullptr;
+            if(hipEventCreate(&created->stop) != hipSuccess)
+            {
+                (void)hipEventDestroy(created->start);
+                return nullptr;
+            }
+            timer = created.get();
+            m_timers.push_back(std::move(created));
+        }
+
+        timer->family = family;
+        timer->stream = stream;
+        if(hipEventRecord(timer->start, stream) != hipSuccess)
+        {
+            m_free.push_back(timer);
+            return nullptr;
+        }
+        return timer;
+    }
+
+    // Owner only
+    void finish_timer(hipblas_call_timer* timer)
+    {
+        std::lock_guard<std::mutex> lock(m_timer_mutex);
+        if(hipEventRecord(timer->stop, timer->stream) == hipSuccess)
+            m_pending.push_back(timer);
+        else
+            m_free.push_back(timer);
+    }
+
+    // Add the shard's totals to totals, waiting for any calls still being timed
+    void add_to(std::vector<hipblas_counter_totals>& totals)
+    {
+        std::lock_guard<std::mutex> lock(m_timer_mutex);
+        harvest(true);
+
+        for(int family = 0; family < family_count; family++)
+        {
+            const family_counters&  counters = m_families[family];
+            hipblas_counter_totals& total    = totals[family];
+            total.calls += counters.calls.load(std::memory_order_relaxed);
+            total.gflop += counters.gflop.load(std::memory_order_relaxed);
+            total.gbyte += counters.gbyte.load(std::memory_order_relaxed);
+            total.device_time_ms += counters.device_time_ms;
+        }
+    }
+
+    std::atomic<hipblasCountersMode_t> mode;
+
+    // Set once the handle is destroyed, so the owner stops using the shard
+    std::atomic<bool> dead{false};
+
+private:
+    struct family_counters
+    {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<double>   gflop{0};
+        std::atomic<double>   gbyte{0};
+        double                device_time_ms = 0;
+    };
+
+    // Called with m_timer_mutex held. Pending timers complete in order on
+    // a single stream, so stop at the first one which has not finished.
+    void harvest(bool wait)
+    {
+        while(!m_pending.empty())
+        {
+            hipblas_call_timer* timer = m_pending.front();
+            hipError_t          ready
+                = wait ? hipEventSynchronize(timer->stop) : hipEventQuery(timer->stop);
+            if(ready == hipErrorNotReady)
+                break;
+
+            float ms;
+            if(ready == hipSuccess
+               && hipEventElapsedTime(&ms, timer->start, timer->stop) == hipSuccess)
+                m_families[timer->family].device_time_ms += ms;
+
+            m_pending.pop_front();
+            m_free.push_back(timer);
+        }
+    }
+
+    family_counters m_families[family_count];
+
+    std::mutex                                       m_timer_mutex;
+    std::vector<std::unique_ptr<hipblas_call_timer>> m_timers;
+    std::vector<hipblas_call_timer*>                 m_free;
+    std::deque<hipblas_call_timer*>                  m_pending;
+};
+
+hipblas_handle_counters::~hipblas_handle_counters()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(auto& shard : m_shards)
+        shard->dead.store(true, std::memory_order_relaxed);
+    if(m_mode != HIPBLAS_COUNTERS_OFF)
+        count_enabled_handles(-1);
+}
+
+void hipblas_handle_counters::set_mode(hipblasCountersMode_t mode)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if((m_mode == HIPBLAS_COUNTERS_OFF) != (mode == HIPBLAS_COUNTERS_OFF))
+        count_enabled_handles(mode == HIPBLAS_COUNTERS_OFF ? -1 : 1);
+
+    m_mode = mode;
+    for(auto& shard : m_shards)
+        shard->mode.store(mode, std::memory_order_relaxed);
+}
+
+std::shared_ptr<hipblas_counter_shard> hipblas_handle_counters::add_shard()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Fold in the shards of threads which have exited, so that a handle shared
+    // by short lived threads does not collect a shard for each of them
+    if(m_retired.empty())
+        m_retired.assign(family_count, hipblas_counter_totals());
+    for(auto it = m_shards.begin(); it != m_shards.end();)
+    {
+        if(it->use_count() == 1)
+        {
+            (*it)->add_to(m_retired);
+            it = m_shards.erase(it);
+        }
+        else
+            ++it;
+    }
+
+    auto shard = std::make_shared<hipblas_counter_shard>(m_mode);
+    m_shards.push_back(shard);
+    return shard;
+}
+
+std::vector<hipblas_counter_totals> hipblas_handle_counters::read()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<hipblas_counter_totals> totals = sum();
+
+    if(!m_baseline.empty())
+        for(int family = 0; family < family_count; family++)
+        {
+            totals[family].calls -= m_baseline[family].calls;
+            totals[family].gflop -= m_baseline[family].gflop;
+            totals[family].gbyte -= m_baseline[family].gbyte;
+            totals[family].device_time_ms -= m_baseline[family].device_time_ms;
+        }
+    return totals;
+}
+
+void hipblas_handle_counters::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Shards are only ever written by their owners, so a reset records
+    // where the totals stand and later reads subtract it
+    m_baseline = sum();
+}
+
+// Called with m_mutex held
+std::vector<hipblas_counter_totals> hipblas_handle_counters::sum()
+{
+    std::vector<hipblas_counter_totals> totals(family_count);
+    if(!m_retired.empty())
+        totals = m_retired;
+    for(auto& shard : m_shards)
+        shard->add_to(totals);
+    return totals;
+}
+
+const char* hipblas_counter_family_name(int family)
+{
+    return family_names[family];
+}
+
+int hipblas_counter_family_count()
+{
+    return family_count;
+}
+
+hipblas_counter_model hipblas_make_counter_model(const char*                     func,
+                                                 const std::vector<std::string>& names)
+{
+    hipblas_counter_model model;
+
+    std::string function;
+    const char* precision = hipblas_bench_function(func, function);
+    for(const char* suffix : {"_ex", "_strided_batched", "_batched"})
+    {
+        size_t length = strlen(suffix);
+        if(function.size() > length
+           && function.compare(function.size() - length, length, suffix) == 0)
+            function.erase(function.size() - length);
+    }
+    if(function == "geru" || function == "gerc")
+        function = "ger";
+
+    for(int family = 0; family < family_count; family++)
+        if(function == family_names[family])
+            model.family = family;
+    if(model.family < 0)
+        return model;
+
+    if(precision)
+        model.type = precision_type(precision);
+
+    int count = int(names.size());
+    for(int i = 0; i < count; i++)
+    {
+        std::string key = normalize(names[i]);
+        if(key == "m")
+            model.m = i;
+        else if(key == "n")
+            model.n = i;
+        else if(key == "k")
+            model.k = i;
+        else if(key == "kl")
+            model.kl = i;
+        else if(key == "ku")
+            model.ku = i;
+        else if(key == "nrhs")
+            model.nrhs = i;
+        else if((key == "trans" || key == "transa") && model.trans < 0)
+            model.trans = i;
+        else if(key == "side")
+            model.side = i;
+        else if(key == "batchcount")
+            model.batch_count = i;
+        else if(!precision && key.size() > 4 && key.compare(key.size() - 4, 4, "type") == 0)
+        {
+            // The _ex functions are counted in the type of their first
+            // operand, or in the compute type if that is the only type given
+            bool operand = key != "alphatype" && key != "cstype" && key != "executiontype"
+                           && key != "computetype";
+            if(model.datatype_arg < 0 || (operand && !model.datatype_is_operand))
+            {
+                model.datatype_arg        = i;
+                model.datatype_is_operand = operand;
+            }
+        }
+    }
+
+    // hemm names the rows and columns of C n and k
+    if(model.family == family_hemm)
+    {
+        model.m = model.n;
+        model.n = model.k;
+        model.k = -1;
+    }
+    return model;
+}
+
+hipblas_call_timer* hipblas_count_call(hipblasHandle_t              handle,
+                                       const hipblas_counter_model& model,
+                                       const hipblas_log_value*     values)
+{
+    if(model.family < 0 || !handle)
+        return nullptr;
+
+    // Shards of this thread by handle. A handle's shard is created the first
+    // time the thread calls on it, which is the only time counting locks.
+    thread_local std::unordered_map<hipblasHandle_t, std::shared_ptr<hipblas_counter_shard>>
+        shards;
+
+    auto it = shards.find(handle);
+    if(it == shards.end() || it->second->dead.load(std::memory_order_relaxed))
+    {
+        // Drop the shards of destroyed handles, one of which may be at this address
+        for(auto dead = shards.begin(); dead != shards.end();)
+            if(dead->second->dead.load(std::memory_order_relaxed))
+                dead = shards.erase(dead);
+            else
+                ++dead;
+
+        it = shards.emplace(handle, hipblas_get_handle_state(handle)->counters.add_shard()).first;
+    }
+    hipblas_counter_shard& shard = *it->second;
+
+    hipblasCountersMode_t mode = shard.mode.load(std::memory_order_relaxed);
+    if(mode == HIPBLAS_COUNTERS_OFF)
+        return nullptr;
+
+    call_dims d;
+    d.m     = int(integer_arg(values, model.m, integer_arg(values, model.n, 0)));
+    d.n     = int(integer_arg(values, model.n, d.m));
+    d.kl    = int(integer_arg(values, model.kl, 0));
+    d.ku    = int(integer_arg(values, model.ku, 0));
+    d.nrhs  = int(integer_arg(values, model.nrhs, 1));
+    d.trans = hipblasOperation_t(integer_arg(values, model.trans, HIPBLAS_OP_N));
+
+    // The order of the triangular or diagonal matrix of side dependent routines
+    if(model.k < 0 && model.side >= 0)
+        d.k = values[model.side].i == HIPBLAS_SIDE_LEFT ? d.m : d.n;
+    else
+        d.k = int(integer_arg(values, model.k, 0));
+
+    int type = model.type >= 0 ? model.type : int(integer_arg(values, model.datatype_arg, -1));
+
+    double gflop, gbyte;
+    call_counts(type, model.family, d, gflop, gbyte);
+
+    double batch_count = double(std::max<int64_t>(integer_arg(values, model.batch_count, 1), 0));
+    shard.add(model.family, gflop * batch_count, gbyte * batch_count);
+
+    // Captured calls do not run until their graph does, so cannot be timed
+    if(mode != HIPBLAS_COUNTERS_DEVICE_TIME || hipblas_is_capturing(handle))
+        return nullptr;
+
+    hipStream_t stream;
+    if(hipblas_get_stream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return nullptr;
+    return shard.start_timer(model.family, stream);
+}
+
+void hipblas_finish_call_timer(hipblas_call_timer* timer)
+{
+    timer->shard->finish_timer(timer);
+}
+
+namespace
+{
+    void read_counters(hipblasHandle_t handle, std::vector<hipblasRoutineCounters_t>& out)
+    {
+        std::vector<hipblas_counter_totals> totals
+            = hipblas_get_handle_state(handle)->counters.read();
+
+        out.clear();
+        for(int family = 0; family < family_count; family++)
+        {
+            const hipblas_counter_totals& total = totals[family];
+            if(!total.calls)
+                continue;
+
+            hipblasRoutineCounters_t counters = {};
+            strncpy(counters.routine, family_names[family], sizeof(counters.routine) - 1);
+            counters.calls          = total.calls;
+            counters.gflop          = total.gflop;
+            counters.gbyte          = total.gbyte;
+            counters.device_time_ms = total.device_time_ms;
+            out.push_back(counters);
+        }
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetHandleCountersMode(hipblasHandle_t handle, hipblasCountersMode_t mode)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_COUNTERS_OFF && mode != HIPBLAS_COUNTERS_ON
+       && mode != HIPBLAS_COUNTERS_DEVICE_TIME)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_get_handle_state(handle)->counters.set_mode(mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasGetHandleCounters(hipblasHandle_t handle, hipblasRoutineCounters_t* counters, int* count)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!count || (counters && *count < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<hipblasRoutineCounters_t> families;
+    read_counters(handle, families);
+
+    int found = int(families.size());
+    if(counters)
+        std::copy_n(families.begin(), std::min(found, *count), counters);
+
+    bool fits = !counters || found <= *count;
+    *count   = found;
+    return fits ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INVALID_VALUE;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasResetHandleCounters(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_get_handle_state(handle)->counters.reset();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasWriteHandleCounters(hipblasHandle_t handle, const char* path)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::vector<hipblasRoutineCounters_t> families;
+    read_counters(handle, families);
+
+    // Same layout as the results hipblas-bench prints
+    std::ostringstream text;
+    text << "routine,calls,gflop,gbyte,device_time_ms,hipblas-Gflops,hipblas-GB/s\n";
+    for(const auto& counters : families)
+    {
+        text << counters.routine << ',' << counters.calls << ',' << counters.gflop << ','
+             << counters.gbyte << ',' << counters.device_time_ms << ',';
+        if(counters.device_time_ms > 0)
+            text << counters.gflop / (counters.device_time_ms / 1e3) << ','
+                 << counters.gbyte / (counters.device_time_ms / 1e3);
+        else
+            text << ',';
+        text << '\n';
+    }
+
+    if(!path)
+    {
+        std::cerr << text.str() << std::flush;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    std::ofstream file(path);
+    if(!(file << text.str()))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,222 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    // One group of a grouped gemm: the arguments of the hipblasGemmBatchedEx
+    // call running it
+    struct gemm_group
+    {
+        hipblasOperation_t trans_a;
+        hipblasOperation_t trans_b;
+        int                m;
+        int                n;
+        int                k;
+        const void*        alpha;
+        const void**       a;
+        int                lda;
+        const void**       b;
+        int                ldb;
+        const void*        beta;
+        void**             c;
+        int                ldc;
+        int                count;
+
+        double work() const
+        {
+            return double(m) * n * std::max(k, 1) * count;
+        }
+    };
+
+    hipblasStatus_t run_group(hipblasHandle_t   handle,
+                              const gemm_group& group,
+                              hipblasDatatype_t a_type,
+                              hipblasDatatype_t b_type,
+                              hipblasDatatype_t c_type,
+                              hipblasDatatype_t compute_type,
+                              hipblasGemmAlgo_t algo)
+    {
+        return hipblasGemmBatchedEx(handle,
+                                    group.trans_a,
+                                    group.trans_b,
+                                    group.m,
+                                    group.n,
+                                    group.k,
+                                    group.alpha,
+                                    group.a,
+                                    a_type,
+                                    group.lda,
+                                    group.b,
+                                    b_type,
+                                    group.ldb,
+                                    group.beta,
+                                    group.c,
+                                    c_type,
+                                    group.ldc,
+                                    group.count,
+                                    compute_type,
+                                    algo);
+    }
+
+    void keep_first_error(hipblasStatus_t& status, hipblasStatus_t call_status)
+    {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call_status;
+    }
+}
+
+hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans_a_array[],
+                                            const hipblasOperation_t trans_b_array[],
+                                            const int                m_array[],
+                                            const int                n_array[],
+                                            const int                k_array[],
+                                            const void*              alpha_array,
+                                            const void* const        a_array[],
+                                            hipblasDatatype_t        a_type,
+                                            const int                lda_array[],
+                                            const void* const        b_array[],
+                                            hipblasDatatype_t        b_type,
+                                            const int                ldb_array[],
+                                            const void*              beta_array,
+                                            void* const              c_array[],
+                                            hipblasDatatype_t        c_type,
+                                            const int                ldc_array[],
+                                            int                      group_count,
+                                            const int                group_size[],
+                                            hipblasDatatype_t        compute_type,
+                                            hipblasGemmAlgo_t        algo)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(group_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!group_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!trans_a_array || !trans_b_array || !m_array || !n_array || !k_array || !lda_array
+       || !ldb_array || !ldc_array || !group_size || !alpha_array || !beta_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t scalar_size = hipblas_datatype_size(compute_type);
+    if(!scalar_size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The matrices of group g follow those of the groups before it in the
+    // pointer arrays; alpha and beta hold one value of compute_type per group
+    std::vector<gemm_group> groups;
+    size_t                  offset = 0;
+    for(int g = 0; g < group_count; g++)
+    {
+        if(group_size[g] < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(group_size[g] && m_array[g] && n_array[g])
+        {
+            if(!a_array || !b_array || !c_array)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            groups.push_back({trans_a_array[g],
+                              trans_b_array[g],
+                              m_array[g],
+                              n_array[g],
+                              k_array[g],
+                              static_cast<const char*>(alpha_array) + g * scalar_size,
+                              const_cast<const void**>(a_array + offset),
+                              lda_array[g],
+                              const_cast<const void**>(b_array + offset),
+                              ldb_array[g],
+                              static_cast<const char*>(beta_array) + g * scalar_size,
+                              const_cast<void**>(c_array + offset),
+                              ldc_array[g],
+                              group_size[g]});
+        }
+        offset += group_size[g];
+    }
+    if(groups.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_coalescing_dependency(handle);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    auto            run_on_handle = [&]() {
+        for(const gemm_group& group : groups)
+            keep_first_error(status,
+                             run_group(handle, group, a_type, b_type, c_type, compute_type, algo));
+        return status;
+    };
+
+    // A capture stays on the stream being captured
+    if(groups.size() == 1 || hipblas_is_capturing(handle))
+        return run_on_handle();
+
+    hipblas_handle_state*        state = hipblas_get_handle_state(handle);
+    std::unique_lock<std::mutex> lock(state->workers.mutex, std::try_to_lock);
+    if(!lock.owns_lock())
+        return run_on_handle();
+
+    const std::vector<hipblas_worker_handles::worker>& workers
+        = state->workers.get(int(groups.size()));
+    hipEvent_t fork = state->workers.fork();
+    if(workers.size() < 2 || !fork)
+        return run_on_handle();
+
+    hipStream_t          stream;
+    hipblasPointerMode_t pointer_mode;
+    hipblasAtomicsMode_t atomics_mode;
+    status = hipblasGetStream(handle, &stream);
+    keep_first_error(status, hipblasGetPointerMode(handle, &pointer_mode));
+    keep_first_error(status, hipblasGetAtomicsMode(handle, &atomics_mode));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipEventRecord(fork, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(const hipblas_worker_handles::worker& w : workers)
+    {
+        if(hipStreamWaitEvent(w.stream, fork, 0) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        keep_first_error(status, hipblasSetPointerMode(w.handle, pointer_mode));
+        keep_first_error(status, hipblasSetAtomicsMode(w.handle, atomics_mode));
+    }
+
+    // Largest groups first, each to the worker with the least work so far,
+    // so that the workers finish at about the same time
+    std::vector<size_t> order(groups.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t x, size_t y) {
+        return groups[x].work() > groups[y].work();
+    });
+
+    std::vector<double> load(workers.size(), 0.0);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        for(size_t g : order)
+        {
+            size_t w = std::min_element(load.begin(), load.end()) - load.begin();
+            load[w] += groups[g].work();
+            keep_first_error(
+                status,
+                run_group(
+                    workers[w].handle, groups[g], a_type, b_type, c_type, compute_type, algo));
+        }
+
+    // Whatever was started, the stream of the handle waits for it
+    for(const hipblas_worker_handles::worker& w : workers)
+        if(hipEventRecord(w.done, w.stream) != hipSuccess
+           || hipStreamWaitEvent(stream, w.done, 0) != hipSuccess)
+            keep_first_error(status, HIPBLAS_STATUS_EXECUTION_FAILED);
+
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
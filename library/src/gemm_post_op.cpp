@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "post_op.hpp"
+#include <algorithm>
+
+// Neither backend's gemm takes a post-op, so the gemm runs as
+// hipblasGemmStridedBatchedEx and the whole post-op follows in one pass over
+// C on the same stream. The batched call also runs any gemm calls the handle
+// has deferred, which a deferred hipblasGemmEx would not.
+hipblasStatus_t hipblasGemmStridedBatchedPostOpEx(hipblasHandle_t        handle,
+                                                  hipblasOperation_t     trans_a,
+                                                  hipblasOperation_t     trans_b,
+                                                  int                    m,
+                                                  int                    n,
+                                                  int                    k,
+                                                  const void*            alpha,
+                                                  const void*            a,
+                                                  hipblasDatatype_t      a_type,
+                                                  int                    lda,
+                                                  hipblasStride          stride_A,
+                                                  const void*            b,
+                                                  hipblasDatatype_t      b_type,
+                                                  int                    ldb,
+                                                  hipblasStride          stride_B,
+                                                  const void*            beta,
+                                                  void*                  c,
+                                                  hipblasDatatype_t      c_type,
+                                                  int                    ldc,
+                                                  hipblasStride          stride_C,
+                                                  int                    batch_count,
+                                                  const hipblasPostOp_t* post_op,
+                                                  hipblasDatatype_t      compute_type,
+                                                  hipblasGemmAlgo_t      algo)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(post_op)
+    {
+        if(!hipblas_post_op_supported(c_type, compute_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(!hipblas_valid_activation(post_op->activation)
+           || (post_op->aux && post_op->ld_aux < std::max(m, 1)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasStatus_t status = hipblasGemmStridedBatchedEx(handle,
+                                                         trans_a,
+                                                         trans_b,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         a,
+                                                         a_type,
+                                                         lda,
+                                                         stride_A,
+                                                         b,
+                                                         b_type,
+                                                         ldb,
+                                                         stride_B,
+                                                         beta,
+                                                         c,
+                                                         c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         batch_count,
+                                                         compute_type,
+                                                         algo);
+    if(status != HIPBLAS_STATUS_SUCCESS || !post_op || m <= 0 || n <= 0 || batch_count <= 0)
+        return status;
+
+    return hipblas_run_post_op(
+        handle, {*post_op, m, n, c, c_type, ldc, stride_C, compute_type, batch_count});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmPostOpEx(hipblasHandle_t        handle,
+                                    hipblasOperation_t     trans_a,
+                                    hipblasOperation_t     trans_b,
+                                    int                    m,
+                                    int                    n,
+                                    int                    k,
+                                    const void*            alpha,
+                                    const void*            a,
+                                    hipblasDatatype_t      a_type,
+                                    int                    lda,
+                                    const void*            b,
+                                    hipblasDatatype_t      b_type,
+                                    int                    ldb,
+                                    const void*            beta,
+                                    void*                  c,
+                                    hipblasDatatype_t      c_type,
+                                    int                    ldc,
+                                    const hipblasPostOp_t* post_op,
+                                    hipblasDatatype_t      compute_type,
+                                    hipblasGemmAlgo_t      algo)
+try
+{
+    if(!post_op)
+        return hipblasGemmEx(handle,
+                             trans_a,
+                             trans_b,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             a,
+                             a_type,
+                             lda,
+                             b,
+                             b_type,
+                             ldb,
+                             beta,
+                             c,
+                             c_type,
+                             ldc,
+                             compute_type,
+                             algo);
+
+    // A single matrix, so the strides are unused; those of the matrices are
+    // their sizes, as the backends may check them
+    hipblasPostOp_t single = *post_op;
+    single.stride_bias     = 0;
+    single.stride_scale    = 0;
+    single.stride_aux      = 0;
+
+    hipblasStride stride_A = hipblasStride(lda) * (trans_a == HIPBLAS_OP_N ? k : m);
+    hipblasStride stride_B = hipblasStride(ldb) * (trans_b == HIPBLAS_OP_N ? n : k);
+    hipblasStride stride_C = hipblasStride(ldc) * n;
+    return hipblasGemmStridedBatchedPostOpEx(handle,
+                                             trans_a,
+                                             trans_b,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a,
+                                             a_type,
+                                             lda,
+                                             stride_A,
+                                             b,
+                                             b_type,
+                                             ldb,
+                                             stride_B,
+                                             beta,
+                                             c,
+                                             c_type,
+                                             ldc,
+                                             stride_C,
+                                             1,
+                                             &single,
+                                             compute_type,
+                                             algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
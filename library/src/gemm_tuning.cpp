@@ -0,0 +1,545 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Gemm solutions chosen by hipblasGemmExTune, looked up by hipblasGemmEx.
+//
+// Each device model has a table of its own: an open addressing hash table of
+// fixed capacity, memory mapped from the tuning file of the model or held in
+// memory when there is none. Slots are only ever filled, never emptied, and a
+// slot is marked full after its key and solution are written, so lookups take
+// no lock. Inserts are serialized by a mutex within the process and by flock
+// across the processes sharing the file.
+
+#include "hipblas.h"
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "tuning.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr char     tuning_magic[8]     = {'H', 'I', 'P', 'B', 'L', 'T', 'U', 'N'};
+    constexpr uint32_t tuning_version      = 1;
+    constexpr uint32_t tuning_capacity     = 1 << 14; // a power of two
+    constexpr uint32_t tuning_max_count    = tuning_capacity / 4 * 3;
+    constexpr int      tuning_max_devices  = 64;
+    constexpr int      tuning_iterations   = 10;
+    constexpr size_t   tuning_device_bytes = 96;
+
+    struct tuning_header
+    {
+        char     magic[8];
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t count;
+        uint32_t reserved;
+        char     device[tuning_device_bytes];
+    };
+
+    struct tuning_slot
+    {
+        hipblas_tuning_key key;
+        int32_t            solution;
+        uint32_t           full;
+    };
+
+    constexpr size_t tuning_bytes = sizeof(tuning_header) + sizeof(tuning_slot) * tuning_capacity;
+
+    uint32_t tuning_hash(const hipblas_tuning_key& key)
+    {
+        // FNV-1a
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&key);
+        uint32_t             hash  = 2166136261u;
+        for(size_t i = 0; i < sizeof(key); i++)
+            hash = (hash ^ bytes[i]) * 16777619u;
+        return hash;
+    }
+
+    // Architecture and compute unit count of device, which the solutions are
+    // specific to, in characters safe in a file name
+    std::string tuning_device_name(int device)
+    {
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, device) != hipSuccess)
+            return "";
+
+        std::string arch = props.gcnArchName[0] ? props.gcnArchName : props.name;
+        arch             = arch.substr(0, arch.find(':'));
+        for(char& c : arch)
+            if(!isalnum((unsigned char)c) && c != '-')
+                c = '_';
+        return arch + "_" + std::to_string(props.multiProcessorCount) + "cu";
+    }
+
+    // The solutions of one device model
+    class tuning_table
+    {
+    public:
+        // Map the file at path, or keep the table in memory if path is empty
+        // or the file cannot be used
+        tuning_table(const std::string& path, const std::string& device)
+        {
+            if(path.empty() || !map(path, device))
+            {
+                m_memory.reset(new char[tuning_bytes]());
+                init(m_memory.get(), device);
+                m_header = reinterpret_cast<tuning_header*>(m_memory.get());
+                m_slots  = reinterpret_cast<tuning_slot*>(m_header + 1);
+            }
+        }
+
+        tuning_table(const tuning_table&) = delete;
+        tuning_table& operator=(const tuning_table&) = delete;
+
+        ~tuning_table()
+        {
+#ifndef _WIN32
+            if(m_fd >= 0)
+            {
+                munmap(m_header, tuning_bytes);
+                close(m_fd);
+            }
+#endif
+        }
+
+        bool find(const hipblas_tuning_key& key, int& solution) const
+        {
+            const tuning_slot* slot = probe(key);
+            if(!__atomic_load_n(&slot->full, __ATOMIC_ACQUIRE))
+                return false;
+            solution = __atomic_load_n(&slot->solution, __ATOMIC_RELAXED);
+            return true;
+        }
+
+        hipblasStatus_t insert(const hipblas_tuning_key& key, int solution)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            file_lock                   file(m_fd);
+
+            tuning_slot* slot = probe(key);
+            if(!__atomic_load_n(&slot->full, __ATOMIC_ACQUIRE))
+            {
+                if(m_header->count >= tuning_max_count)
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                slot->key = key;
+                m_header->count++;
+            }
+            __atomic_store_n(&slot->solution, solution, __ATOMIC_RELAXED);
+            __atomic_store_n(&slot->full, 1u, __ATOMIC_RELEASE);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+    private:
+        // Held while the file is initialized or written to
+        struct file_lock
+        {
+            explicit file_lock(int fd)
+                : m_fd(fd)
+            {
+#ifndef _WIN32
+                if(m_fd >= 0)
+                    flock(m_fd, LOCK_EX);
+#endif
+            }
+
+            ~file_lock()
+            {
+#ifndef _WIN32
+                if(m_fd >= 0)
+                    flock(m_fd, LOCK_UN);
+#endif
+            }
+
+            int m_fd;
+        };
+
+        static void init(void* memory, const std::string& device)
+        {
+            tuning_header* header = static_cast<tuning_header*>(memory);
+            memcpy(header->magic, tuning_magic, sizeof(tuning_magic));
+            header->version  = tuning_version;
+            header->capacity = tuning_capacity;
+            strncpy(header->device, device.c_str(), tuning_device_bytes - 1);
+        }
+
+#ifndef _WIN32
+        // Map the file open as fd, initializing it if it is new. A file made
+        // for another version or device model is left alone.
+        static tuning_header* map_locked(int fd, const std::string& device)
+        {
+            struct stat st;
+            if(fstat(fd, &st) != 0)
+                return nullptr;
+            bool created = st.st_size == 0;
+            if(created ? ftruncate(fd, tuning_bytes) != 0 : size_t(st.st_size) != tuning_bytes)
+                return nullptr;
+
+            void* memory = mmap(nullptr, tuning_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if(memory == MAP_FAILED)
+                return nullptr;
+
+            tuning_header* header = static_cast<tuning_header*>(memory);
+            if(created)
+                init(memory, device);
+            else if(memcmp(header->magic, tuning_magic, sizeof(tuning_magic))
+                    || header->version != tuning_version || header->capacity != tuning_capacity
+                    || strncmp(header->device, device.c_str(), tuning_device_bytes))
+            {
+                munmap(memory, tuning_bytes);
+                return nullptr;
+            }
+            return header;
+        }
+#endif
+
+        bool map(const std::string& path, const std::string& device)
+        {
+#ifdef _WIN32
+            return false;
+#else
+            int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+            if(fd < 0)
+                return false;
+
+            tuning_header* header;
+            {
+                file_lock lock(fd);
+                header = map_locked(fd, device);
+            }
+            if(!header)
+            {
+                close(fd);
+                return false;
+            }
+
+            m_header = header;
+            m_slots  = reinterpret_cast<tuning_slot*>(header + 1);
+            m_fd     = fd;
+            return true;
+#endif
+        }
+
+        // The slot holding key, or the empty slot where it would go. The
+        // table is never more than three quarters full, so there is one.
+        tuning_slot* probe(const hipblas_tuning_key& key) const
+        {
+            for(uint32_t i = tuning_hash(key);; i++)
+            {
+                tuning_slot* slot = &m_slots[i & (tuning_capacity - 1)];
+                if(!__atomic_load_n(&slot->full, __ATOMIC_ACQUIRE)
+                   || !memcmp(&slot->key, &key, sizeof(key)))
+                    return slot;
+            }
+        }
+
+        tuning_header*          m_header = nullptr;
+        tuning_slot*            m_slots  = nullptr;
+        int                     m_fd     = -1;
+        std::unique_ptr<char[]> m_memory;
+        std::mutex              m_mutex;
+    };
+
+    // The tables of the devices of the process, opened on first use
+    struct tuning_tables
+    {
+        std::mutex                 mutex;
+        std::string                path;
+        std::atomic<bool>          enabled{false}; // a path is set or a solution recorded
+        std::atomic<tuning_table*> tables[tuning_max_devices] = {};
+
+        tuning_tables()
+        {
+            const char* env = getenv("HIPBLAS_GEMM_TUNING_FILE");
+            if(env && *env)
+            {
+                path    = env;
+                enabled = true;
+            }
+        }
+
+        ~tuning_tables()
+        {
+            clear();
+        }
+
+        // The table of the current device, or nullptr
+        tuning_table* get()
+        {
+            int device;
+            if(hipGetDevice(&device) != hipSuccess || device < 0 || device >= tuning_max_devices)
+                return nullptr;
+
+            tuning_table* table = tables[device].load(std::memory_order_acquire);
+            if(table)
+                return table;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            table = tables[device].load(std::memory_order_relaxed);
+            if(!table)
+            {
+                std::string device_name = tuning_device_name(device);
+                table                   = new tuning_table(
+                    path.empty() ? path : path + "." + device_name, device_name);
+                tables[device].store(table, std::memory_order_release);
+            }
+            return table;
+        }
+
+        void clear()
+        {
+            for(auto& table : tables)
+                delete table.exchange(nullptr);
+        }
+    };
+
+    tuning_tables& hipblas_tuning_tables()
+    {
+        static tuning_tables tables;
+        return tables;
+    }
+
+    // Device resources of a tuning run
+    struct tuning_resources
+    {
+        void*      c_copy = nullptr;
+        hipEvent_t start  = nullptr;
+        hipEvent_t stop   = nullptr;
+
+        ~tuning_resources()
+        {
+            if(c_copy)
+                (void)hipFree(c_copy);
+            if(start)
+                (void)hipEventDestroy(start);
+            if(stop)
+                (void)hipEventDestroy(stop);
+        }
+    };
+}
+
+bool hipblas_find_tuned_gemm(const hipblas_tuning_key& key, int& solution)
+{
+    tuning_tables& tables = hipblas_tuning_tables();
+    if(!tables.enabled.load(std::memory_order_relaxed))
+        return false;
+
+    tuning_table* table = tables.get();
+    return table && table->find(key, solution);
+}
+
+hipblasStatus_t hipblasSetGemmTuningFile(const char* path)
+try
+{
+    tuning_tables&              tables = hipblas_tuning_tables();
+    std::lock_guard<std::mutex> lock(tables.mutex);
+    tables.clear();
+    tables.path    = path ? path : "";
+    tables.enabled = !tables.path.empty();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmExTune(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans_a,
+                                  hipblasOperation_t trans_b,
+                                  int                m,
+                                  int                n,
+                                  int                k,
+                                  const void*        alpha,
+                                  const void*        a,
+                                  hipblasDatatype_t  a_type,
+                                  int                lda,
+                                  const void*        b,
+                                  hipblasDatatype_t  b_type,
+                                  int                ldb,
+                                  const void*        beta,
+                                  void*              c,
+                                  hipblasDatatype_t  c_type,
+                                  int                ldc,
+                                  hipblasDatatype_t  compute_type,
+                                  hipblasGemmAlgo_t  algo,
+                                  int*               solution)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(hipblas_is_capturing(handle))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m < 0 || n < 0 || k < 0 || ldc < std::max(m, 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Deferred gemm calls may write C
+    hipblas_coalescing_dependency(handle);
+
+    int             count  = 0;
+    hipblasStatus_t status = hipblasGemmExGetSolutions(handle,
+                                                       trans_a,
+                                                       trans_b,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       a,
+                                                       a_type,
+                                                       lda,
+                                                       b,
+                                                       b_type,
+                                                       ldb,
+                                                       beta,
+                                                       c,
+                                                       c_type,
+                                                       ldc,
+                                                       compute_type,
+                                                       algo,
+                                                       nullptr,
+                                                       &count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(count <= 0)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    std::vector<int> solutions(count);
+    status = hipblasGemmExGetSolutions(handle,
+                                       trans_a,
+                                       trans_b,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a,
+                                       a_type,
+                                       lda,
+                                       b,
+                                       b_type,
+                                       ldb,
+                                       beta,
+                                       c,
+                                       c_type,
+                                       ldc,
+                                       compute_type,
+                                       algo,
+                                       solutions.data(),
+                                       &count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // C is restored before each solution runs, so that every one of them
+    // starts from the same values and the last leaves the result of one call
+    size_t           c_bytes = n ? (size_t(ldc) * (n - 1) + m) * hipblas_datatype_size(c_type) : 0;
+    tuning_resources resources;
+    if((c_bytes && hipMalloc(&resources.c_copy, c_bytes) != hipSuccess)
+       || hipEventCreate(&resources.start) != hipSuccess
+       || hipEventCreate(&resources.stop) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    auto restore_c = [&](void* dst, const void* src) {
+        return !c_bytes
+               || hipMemcpyAsync(dst, src, c_bytes, hipMemcpyDeviceToDevice, stream) == hipSuccess;
+    };
+    auto run = [&](int s) {
+        return hipblas_gemm_ex_solution(handle,
+                                        trans_a,
+                                        trans_b,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        a,
+                                        a_type,
+                                        lda,
+                                        b,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        c,
+                                        c_type,
+                                        ldc,
+                                        compute_type,
+                                        s);
+    };
+
+    if(!restore_c(resources.c_copy, c))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    int   best      = -1;
+    float best_time = 0;
+    for(int s : solutions)
+    {
+        if(!restore_c(c, resources.c_copy))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        // The first call warms up, and rules out solutions that fail
+        status = run(s);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            continue;
+
+        if(hipEventRecord(resources.start, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        for(int i = 0; i < tuning_iterations && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = run(s);
+        float time;
+        if(hipEventRecord(resources.stop, stream) != hipSuccess
+           || hipEventSynchronize(resources.stop) != hipSuccess
+           || hipEventElapsedTime(&time, resources.start, resources.stop) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(status == HIPBLAS_STATUS_SUCCESS && (best < 0 || time < best_time))
+        {
+            best      = s;
+            best_time = time;
+        }
+    }
+
+    if(!restore_c(c, resources.c_copy))
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(best < 0)
+        return status;
+
+    status = run(best);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    tuning_tables& tables = hipblas_tuning_tables();
+    tuning_table*  table  = tables.get();
+    if(!table)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    status = table->insert(
+        hipblas_make_tuning_key(
+            trans_a, trans_b, m, n, k, lda, ldb, ldc, a_type, b_type, c_type, compute_type),
+        best);
+    tables.enabled = true;
+
+    if(solution)
+        *solution = best;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,1015 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Mixed precision solvers: A is factored in single precision and the solution
+// refined in double precision until its residual is as small as that of a
+// double precision solve, as in LAPACK's dsgesv. The pieces run through the
+// public entry points, so that both backends share this file; only the type
+// conversions and norms are hipBLAS' own (convert.hpp).
+//
+// The matrices of a batch are refined together. One that converges keeps
+// being refined with the others, which leaves its solution as accurate, and
+// one that cannot be solved in single precision is factored and solved again
+// in double precision on its own once the others are done.
+
+#include "hipblas.h"
+#include "convert.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    // Iterations after which refinement gives up, as in LAPACK
+    constexpr int max_iterations = 30;
+
+    // Values of iter when a matrix is solved in double precision instead
+    constexpr int iter_overflow      = -2;
+    constexpr int iter_singular      = -3;
+    constexpr int iter_not_converged = -max_iterations - 1;
+
+    template <typename H>
+    struct gesv_types;
+
+    template <>
+    struct gesv_types<double>
+    {
+        using low                                    = float;
+        static constexpr hipblasDatatype_t high_type = HIPBLAS_R_64F;
+        static constexpr hipblasDatatype_t low_type  = HIPBLAS_R_32F;
+    };
+
+    template <>
+    struct gesv_types<hipblasDoubleComplex>
+    {
+        using low                                    = hipblasComplex;
+        static constexpr hipblasDatatype_t high_type = HIPBLAS_C_64F;
+        static constexpr hipblasDatatype_t low_type  = HIPBLAS_C_32F;
+    };
+
+    template <typename T>
+    T scalar(double value);
+
+    template <>
+    double scalar<double>(double value)
+    {
+        return value;
+    }
+
+    template <>
+    hipblasDoubleComplex scalar<hipblasDoubleComplex>(double value)
+    {
+        return {value, 0};
+    }
+
+    // Matrices of a batch: the device array of them for the batched routines,
+    // the first one and the stride between them otherwise
+    template <typename T>
+    struct operand
+    {
+        T*            data;
+        T* const*     array;
+        int           ld;
+        hipblasStride stride;
+
+        hipblas_matrix_batch batch(hipblasDatatype_t type) const
+        {
+            return {type,
+                    const_cast<void*>(static_cast<const void*>(data)),
+                    reinterpret_cast<void* const*>(const_cast<void**>(
+                        reinterpret_cast<const void* const*>(array))),
+                    ld,
+                    stride};
+        }
+
+        T* matrix(int b, T* const* host_array) const
+        {
+            return host_array ? host_array[b] : data + b * stride;
+        }
+    };
+
+    // The backend calls of each precision, for arrays of matrices or strided
+    // ones. The batched getrf and getrs take the pivots of matrix b at
+    // ipiv + b * n.
+    hipblasStatus_t getrf(hipblasHandle_t       handle,
+                          int                   n,
+                          const operand<float>& a,
+                          int*                  ipiv,
+                          hipblasStride         stride_p,
+                          int*                  info,
+                          int                   batch_count)
+    {
+        return a.array ? hipblasSgetrfBatched(handle, n, a.array, a.ld, ipiv, info, batch_count)
+                       : hipblasSgetrfStridedBatched(
+                           handle, n, a.data, a.ld, a.stride, ipiv, stride_p, info, batch_count);
+    }
+
+    hipblasStatus_t getrf(hipblasHandle_t                handle,
+                          int                            n,
+                          const operand<hipblasComplex>& a,
+                          int*                           ipiv,
+                          hipblasStride                  stride_p,
+                          int*                           info,
+                          int                            batch_count)
+    {
+        return a.array ? hipblasCgetrfBatched(handle, n, a.array, a.ld, ipiv, info, batch_count)
+                       : hipblasCgetrfStridedBatched(
+                           handle, n, a.data, a.ld, a.stride, ipiv, stride_p, info, batch_count);
+    }
+
+    template <typename L>
+    hipblasStatus_t getrs(hipblasHandle_t   handle,
+                          int               n,
+                          int               nrhs,
+                          const operand<L>& a,
+                          const int*        ipiv,
+                          hipblasStride     stride_p,
+                          const operand<L>& b,
+                          int               batch_count);
+
+    template <>
+    hipblasStatus_t getrs(hipblasHandle_t       handle,
+                          int                   n,
+                          int                   nrhs,
+                          const operand<float>& a,
+                          const int*            ipiv,
+                          hipblasStride         stride_p,
+                          const operand<float>& b,
+                          int                   batch_count)
+    {
+        int info;
+        return a.array ? hipblasSgetrsBatched(handle,
+                                              HIPBLAS_OP_N,
+                                              n,
+                                              nrhs,
+                                              a.array,
+                                              a.ld,
+                                              ipiv,
+                                              b.array,
+                                              b.ld,
+                                              &info,
+                                              batch_count)
+                       : hipblasSgetrsStridedBatched(handle,
+                                                     HIPBLAS_OP_N,
+                                                     n,
+                                                     nrhs,
+                                                     a.data,
+                                                     a.ld,
+                                                     a.stride,
+                                                     ipiv,
+                                                     stride_p,
+                                                     b.data,
+                                                     b.ld,
+                                                     b.stride,
+                                                     &info,
+                                                     batch_count);
+    }
+
+    template <>
+    hipblasStatus_t getrs(hipblasHandle_t                handle,
+                          int                            n,
+                          int                            nrhs,
+                          const operand<hipblasComplex>& a,
+                          const int*                     ipiv,
+                          hipblasStride                  stride_p,
+                          const operand<hipblasComplex>& b,
+                          int                            batch_count)
+    {
+        int info;
+        return a.array ? hipblasCgetrsBatched(handle,
+                                              HIPBLAS_OP_N,
+                                              n,
+                                              nrhs,
+                                              a.array,
+                                              a.ld,
+                                              ipiv,
+                                              b.array,
+                                              b.ld,
+                                              &info,
+                                              batch_count)
+                       : hipblasCgetrsStridedBatched(handle,
+                                                     HIPBLAS_OP_N,
+                                                     n,
+                                                     nrhs,
+                                                     a.data,
+                                                     a.ld,
+                                                     a.stride,
+                                                     ipiv,
+                                                     stride_p,
+                                                     b.data,
+                                                     b.ld,
+                                                     b.stride,
+                                                     &info,
+                                                     batch_count);
+    }
+
+    // r = r - a * x
+    hipblasStatus_t residual(hipblasHandle_t        handle,
+                             int                    n,
+                             int                    nrhs,
+                             const operand<double>& a,
+                             const operand<double>& x,
+                             const operand<double>& r,
+                             int                    batch_count)
+    {
+        const double one = 1, minus_one = -1;
+        if(a.array)
+            return hipblasDgemmBatched(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       n,
+                                       &minus_one,
+                                       a.array,
+                                       a.ld,
+                                       x.array,
+                                       x.ld,
+                                       &one,
+                                       r.array,
+                                       r.ld,
+                                       batch_count);
+        return hipblasDgemmStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          nrhs,
+                                          n,
+                                          &minus_one,
+                                          a.data,
+                                          a.ld,
+                                          a.stride,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          &one,
+                                          r.data,
+                                          r.ld,
+                                          r.stride,
+                                          batch_count);
+    }
+
+    hipblasStatus_t residual(hipblasHandle_t                      handle,
+                             int                                  n,
+                             int                                  nrhs,
+                             const operand<hipblasDoubleComplex>& a,
+                             const operand<hipblasDoubleComplex>& x,
+                             const operand<hipblasDoubleComplex>& r,
+                             int                                  batch_count)
+    {
+        const hipblasDoubleComplex one       = scalar<hipblasDoubleComplex>(1);
+        const hipblasDoubleComplex minus_one = scalar<hipblasDoubleComplex>(-1);
+        if(a.array)
+            return hipblasZgemmBatched(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       n,
+                                       &minus_one,
+                                       a.array,
+                                       a.ld,
+                                       x.array,
+                                       x.ld,
+                                       &one,
+                                       r.array,
+                                       r.ld,
+                                       batch_count);
+        return hipblasZgemmStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          nrhs,
+                                          n,
+                                          &minus_one,
+                                          a.data,
+                                          a.ld,
+                                          a.stride,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          &one,
+                                          r.data,
+                                          r.ld,
+                                          r.stride,
+                                          batch_count);
+    }
+
+    // x = x + d
+    hipblasStatus_t update(hipblasHandle_t        handle,
+                           int                    n,
+                           int                    nrhs,
+                           const operand<double>& x,
+                           const operand<double>& d,
+                           int                    batch_count)
+    {
+        const double one = 1;
+        if(x.array)
+            return hipblasDgeamBatched(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       &one,
+                                       x.array,
+                                       x.ld,
+                                       &one,
+                                       d.array,
+                                       d.ld,
+                                       x.array,
+                                       x.ld,
+                                       batch_count);
+        return hipblasDgeamStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          nrhs,
+                                          &one,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          &one,
+                                          d.data,
+                                          d.ld,
+                                          d.stride,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          batch_count);
+    }
+
+    hipblasStatus_t update(hipblasHandle_t                      handle,
+                           int                                  n,
+                           int                                  nrhs,
+                           const operand<hipblasDoubleComplex>& x,
+                           const operand<hipblasDoubleComplex>& d,
+                           int                                  batch_count)
+    {
+        const hipblasDoubleComplex one = scalar<hipblasDoubleComplex>(1);
+        if(x.array)
+            return hipblasZgeamBatched(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       &one,
+                                       x.array,
+                                       x.ld,
+                                       &one,
+                                       d.array,
+                                       d.ld,
+                                       x.array,
+                                       x.ld,
+                                       batch_count);
+        return hipblasZgeamStridedBatched(handle,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          nrhs,
+                                          &one,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          &one,
+                                          d.data,
+                                          d.ld,
+                                          d.stride,
+                                          x.data,
+                                          x.ld,
+                                          x.stride,
+                                          batch_count);
+    }
+
+    // Puts handle in host pointer mode for the scope, for the scalars of the
+    // gemm and geam calls
+    class host_pointer_mode
+    {
+    public:
+        explicit host_pointer_mode(hipblasHandle_t handle)
+            : m_handle(handle)
+        {
+            m_status = hipblasGetPointerMode(handle, &m_mode);
+            if(m_status == HIPBLAS_STATUS_SUCCESS && m_mode == HIPBLAS_POINTER_MODE_DEVICE)
+                m_status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        ~host_pointer_mode()
+        {
+            if(m_status == HIPBLAS_STATUS_SUCCESS && m_mode == HIPBLAS_POINTER_MODE_DEVICE)
+                (void)hipblasSetPointerMode(m_handle, m_mode);
+        }
+
+        hipblasStatus_t status() const
+        {
+            return m_status;
+        }
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_mode;
+        hipblasStatus_t      m_status;
+    };
+
+    hipblasStatus_t copy_sync(
+        hipStream_t stream, void* dst, const void* src, size_t size, hipMemcpyKind kind)
+    {
+        if(hipMemcpyAsync(dst, src, size, kind, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Carves the temporaries of a call out of the handle's scratch memory
+    class scratch_layout
+    {
+    public:
+        template <typename T>
+        size_t reserve(size_t count)
+        {
+            size_t offset = m_size;
+            m_size += (sizeof(T) * count + alignment - 1) / alignment * alignment;
+            return offset;
+        }
+
+        size_t size() const
+        {
+            return m_size;
+        }
+
+    private:
+        static constexpr size_t alignment = 256;
+
+        size_t m_size = 0;
+    };
+
+    void keep_first_error(hipblasStatus_t& status, hipblasStatus_t call_status)
+    {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call_status;
+    }
+
+    template <typename H>
+    hipblasStatus_t gesv_mixed(hipblasHandle_t         handle,
+                               int                     n,
+                               int                     nrhs,
+                               const operand<H>&       a,
+                               int*                    ipiv,
+                               hipblasStride           stride_p,
+                               const operand<const H>& b,
+                               const operand<H>&       x,
+                               int*                    iter,
+                               int*                    info,
+                               int                     batch_count)
+    {
+        using L                            = typename gesv_types<H>::low;
+        constexpr hipblasDatatype_t h_type = gesv_types<H>::high_type;
+        constexpr hipblasDatatype_t l_type = gesv_types<H>::low_type;
+
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || nrhs < 0 || a.ld < std::max(1, n) || b.ld < std::max(1, n)
+           || x.ld < std::max(1, n) || batch_count < 0 || (batch_count && (!iter || !info)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!n || !nrhs)
+        {
+            std::fill(iter, iter + batch_count, 0);
+            std::fill(info, info + batch_count, 0);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if((!a.data && !a.array) || (!b.data && !b.array) || (!x.data && !x.array))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // The convergence test reads the residual on the host
+        if(hipblas_is_capturing(handle))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // Deferred gemm calls may write A or B, and would use the scratch memory
+        hipblas_coalescing_dependency(handle);
+
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        hipStream_t           stream;
+        hipblasStatus_t       status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode pointer_mode(handle);
+        if(pointer_mode.status() != HIPBLAS_STATUS_SUCCESS)
+            return pointer_mode.status();
+
+        // Temporaries of each matrix: A and the right hand sides in single
+        // precision, the residual, and the results read on the host, ints
+        // first. The pivots are only kept if ipiv is null.
+        const size_t   nn = size_t(n) * n, nr = size_t(n) * nrhs;
+        scratch_layout layout;
+        size_t         low_a_at     = layout.reserve<L>(nn * batch_count);
+        size_t         low_r_at     = layout.reserve<L>(nr * batch_count);
+        size_t         r_at         = layout.reserve<H>(nr * batch_count);
+        size_t         row_sums_at  = layout.reserve<double>(size_t(n) * batch_count);
+        size_t         pivots_at    = layout.reserve<int>(ipiv ? 0 : size_t(n) * batch_count);
+        size_t         results_at   = layout.size();
+        size_t         flags_at     = layout.reserve<int>(2 * size_t(batch_count));
+        size_t         norms_at     = layout.reserve<double>((1 + 2 * size_t(nrhs)) * batch_count);
+        size_t         results_size = layout.size() - results_at;
+
+        char* scratch = static_cast<char*>(state->scratch.get(layout.size(), state->capture));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        int*    device_info = reinterpret_cast<int*>(scratch + flags_at);
+        int*    overflow    = device_info + batch_count;
+        double* a_norm      = reinterpret_cast<double*>(scratch + norms_at);
+        double* x_norms     = a_norm + batch_count;
+        double* r_norms     = x_norms + size_t(nrhs) * batch_count;
+        double* row_sums    = reinterpret_cast<double*>(scratch + row_sums_at);
+        int*    pivots      = ipiv ? ipiv : reinterpret_cast<int*>(scratch + pivots_at);
+        if(a.array || !ipiv)
+            stride_p = n;
+
+        operand<L> low_a{reinterpret_cast<L*>(scratch + low_a_at), nullptr, n, hipblasStride(nn)};
+        operand<L> low_r{reinterpret_cast<L*>(scratch + low_r_at), nullptr, n, hipblasStride(nr)};
+        operand<H> r{reinterpret_cast<H*>(scratch + r_at), nullptr, n, hipblasStride(nr)};
+
+        // The batched routines take every operand as an array
+        if(a.array)
+        {
+            std::vector<void*> arrays(3 * size_t(batch_count));
+            for(int i = 0; i < batch_count; i++)
+            {
+                arrays[i]                   = low_a.data + i * low_a.stride;
+                arrays[batch_count + i]     = low_r.data + i * low_r.stride;
+                arrays[2 * batch_count + i] = r.data + i * r.stride;
+            }
+            void** device_arrays;
+            status = hipblasGetDevicePointerArray(
+                handle, arrays.data(), 3 * batch_count, &device_arrays);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            low_a.array = reinterpret_cast<L* const*>(device_arrays);
+            low_r.array = reinterpret_cast<L* const*>(device_arrays + batch_count);
+            r.array     = reinterpret_cast<H* const*>(device_arrays + 2 * batch_count);
+        }
+
+        // r = b - a * x, with the column norms of x and r
+        auto residual_norms = [&]() {
+            hipblasStatus_t status = hipblas_convert_matrices(
+                handle, n, nrhs, b.batch(h_type), r.batch(h_type), batch_count, nullptr);
+            keep_first_error(status, residual(handle, n, nrhs, a, x, r, batch_count));
+            keep_first_error(status,
+                             hipblas_matrix_norms(handle,
+                                                  hipblas_matrix_norm::column_max,
+                                                  n,
+                                                  nrhs,
+                                                  x.batch(h_type),
+                                                  batch_count,
+                                                  x_norms));
+            keep_first_error(status,
+                             hipblas_matrix_norms(handle,
+                                                  hipblas_matrix_norm::column_max,
+                                                  n,
+                                                  nrhs,
+                                                  r.batch(h_type),
+                                                  batch_count,
+                                                  r_norms));
+            return status;
+        };
+
+        std::vector<char> results(results_size);
+        const int*        host_flags = reinterpret_cast<const int*>(results.data());
+        const double*     host_norms
+            = reinterpret_cast<const double*>(results.data() + (norms_at - results_at));
+
+        auto read_results = [&]() {
+            return copy_sync(stream,
+                             results.data(),
+                             scratch + results_at,
+                             results_size,
+                             hipMemcpyDeviceToHost);
+        };
+
+        // The residual is small enough once it is within sqrt(n) rounding
+        // errors of a backward stable solve, for every right hand side
+        const double eps       = std::numeric_limits<double>::epsilon() / 2;
+        auto         converged = [&](int i) {
+            const double* x_norm    = host_norms + batch_count + size_t(i) * nrhs;
+            const double* r_norm    = x_norm + size_t(nrhs) * batch_count;
+            double        tolerance = host_norms[i] * eps * std::sqrt(double(n));
+            for(int j = 0; j < nrhs; j++)
+                if(!(r_norm[j] <= x_norm[j] * tolerance))
+                    return false;
+            return true;
+        };
+
+        // ||A||_inf of each matrix, the largest of its row sums
+        hipblas_matrix_batch sums{HIPBLAS_R_64F, row_sums, nullptr, n, n};
+        status = hipblas_matrix_norms(
+            handle, hipblas_matrix_norm::row_sums, n, n, a.batch(h_type), batch_count, row_sums);
+        keep_first_error(status,
+                         hipblas_matrix_norms(handle,
+                                              hipblas_matrix_norm::column_max,
+                                              n,
+                                              1,
+                                              sums,
+                                              batch_count,
+                                              a_norm));
+
+        // The first solution, in single precision
+        if(hipMemsetAsync(overflow, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        keep_first_error(status,
+                         hipblas_convert_matrices(handle,
+                                                  n,
+                                                  n,
+                                                  a.batch(h_type),
+                                                  low_a.batch(l_type),
+                                                  batch_count,
+                                                  overflow));
+        keep_first_error(status,
+                         hipblas_convert_matrices(handle,
+                                                  n,
+                                                  nrhs,
+                                                  b.batch(h_type),
+                                                  low_r.batch(l_type),
+                                                  batch_count,
+                                                  overflow));
+        keep_first_error(status,
+                         getrf(handle, n, low_a, pivots, stride_p, device_info, batch_count));
+        keep_first_error(status,
+                         getrs(handle, n, nrhs, low_a, pivots, stride_p, low_r, batch_count));
+        keep_first_error(status,
+                         hipblas_convert_matrices(handle,
+                                                  n,
+                                                  nrhs,
+                                                  low_r.batch(l_type),
+                                                  x.batch(h_type),
+                                                  batch_count,
+                                                  nullptr));
+        keep_first_error(status, residual_norms());
+        keep_first_error(status, read_results());
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // iter[i] > 0 is left for the matrices still being refined
+        int refining = 0;
+        for(int i = 0; i < batch_count; i++)
+        {
+            info[i] = 0;
+            if(host_flags[i] > 0)
+                iter[i] = iter_singular;
+            else if(host_flags[batch_count + i])
+                iter[i] = iter_overflow;
+            else if(converged(i))
+                iter[i] = 0;
+            else
+            {
+                iter[i] = 1;
+                refining++;
+            }
+        }
+
+        for(int it = 1; refining && it <= max_iterations; it++)
+        {
+            // x = x + the correction solving a * d = r in single precision
+            if(hipMemsetAsync(overflow, 0, sizeof(int) * batch_count, stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            status = hipblas_convert_matrices(
+                handle, n, nrhs, r.batch(h_type), low_r.batch(l_type), batch_count, overflow);
+            keep_first_error(status,
+                             getrs(handle, n, nrhs, low_a, pivots, stride_p, low_r, batch_count));
+            keep_first_error(status,
+                             hipblas_convert_matrices(handle,
+                                                      n,
+                                                      nrhs,
+                                                      low_r.batch(l_type),
+                                                      r.batch(h_type),
+                                                      batch_count,
+                                                      nullptr));
+            keep_first_error(status, update(handle, n, nrhs, x, r, batch_count));
+            keep_first_error(status, residual_norms());
+            keep_first_error(status, read_results());
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            for(int i = 0; i < batch_count; i++)
+            {
+                // A correction out of range of single precision spoils the
+                // solution even of a matrix which has converged
+                if(iter[i] >= 0 && host_flags[batch_count + i])
+                {
+                    refining -= iter[i] > 0;
+                    iter[i] = iter_overflow;
+                }
+                else if(iter[i] > 0 && converged(i))
+                {
+                    iter[i] = it;
+                    refining--;
+                }
+            }
+        }
+
+        // The rest are solved in double precision, one at a time
+        std::vector<H*> host_a, host_x;
+        int             high = 0;
+        for(int i = 0; i < batch_count; i++)
+        {
+            if(iter[i] > 0)
+                iter[i] = iter_not_converged;
+            high += iter[i] < 0;
+        }
+        if(!high)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        if(a.array)
+        {
+            host_a.resize(batch_count);
+            host_x.resize(batch_count);
+            status = copy_sync(
+                stream, host_a.data(), a.array, sizeof(H*) * batch_count, hipMemcpyDeviceToHost);
+            keep_first_error(status,
+                             copy_sync(stream,
+                                       host_x.data(),
+                                       x.array,
+                                       sizeof(H*) * batch_count,
+                                       hipMemcpyDeviceToHost));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        for(int i = 0; i < batch_count; i++)
+        {
+            if(iter[i] >= 0)
+                continue;
+
+            H*   a_i    = a.matrix(i, host_a.empty() ? nullptr : host_a.data());
+            H*   x_i    = x.matrix(i, host_x.empty() ? nullptr : host_x.data());
+            int* ipiv_i = pivots + i * stride_p;
+
+            // x_i = b_i, overwritten by getrs
+            operand<const H> b_i = b;
+            operand<H>       x_one{x_i, nullptr, x.ld, 0};
+            if(b.array)
+                b_i.array = b.array + i;
+            else
+                b_i.data = b.data + i * b.stride;
+            status = hipblas_convert_matrices(
+                handle, n, nrhs, b_i.batch(h_type), x_one.batch(h_type), 1, nullptr);
+
+            if(std::is_same<H, double>{})
+                keep_first_error(status,
+                                 hipblasDgetrf(handle,
+                                               n,
+                                               reinterpret_cast<double*>(a_i),
+                                               a.ld,
+                                               ipiv_i,
+                                               device_info));
+            else
+                keep_first_error(status,
+                                 hipblasZgetrf(handle,
+                                               n,
+                                               reinterpret_cast<hipblasDoubleComplex*>(a_i),
+                                               a.ld,
+                                               ipiv_i,
+                                               device_info));
+            keep_first_error(
+                status,
+                copy_sync(stream, &info[i], device_info, sizeof(int), hipMemcpyDeviceToHost));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(info[i] > 0)
+                continue;
+
+            int getrs_info;
+            if(std::is_same<H, double>{})
+                status = hipblasDgetrs(handle,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       reinterpret_cast<double*>(a_i),
+                                       a.ld,
+                                       ipiv_i,
+                                       reinterpret_cast<double*>(x_i),
+                                       x.ld,
+                                       &getrs_info);
+            else
+                status = hipblasZgetrs(handle,
+                                       HIPBLAS_OP_N,
+                                       n,
+                                       nrhs,
+                                       reinterpret_cast<hipblasDoubleComplex*>(a_i),
+                                       a.ld,
+                                       ipiv_i,
+                                       reinterpret_cast<hipblasDoubleComplex*>(x_i),
+                                       x.ld,
+                                       &getrs_info);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              double*         A,
+                              const int       lda,
+                              int*            ipiv,
+                              const double*   B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info)
+try
+{
+    return gesv_mixed<double>(handle,
+                              n,
+                              nrhs,
+                              {A, nullptr, lda, hipblasStride(lda) * n},
+                              ipiv,
+                              n,
+                              {B, nullptr, ldb, hipblasStride(ldb) * nrhs},
+                              {X, nullptr, ldx, hipblasStride(ldx) * nrhs},
+                              iter,
+                              info,
+                              1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                              const int                   n,
+                              const int                   nrhs,
+                              hipblasDoubleComplex*       A,
+                              const int                   lda,
+                              int*                        ipiv,
+                              const hipblasDoubleComplex* B,
+                              const int                   ldb,
+                              hipblasDoubleComplex*       X,
+                              const int                   ldx,
+                              int*                        iter,
+                              int*                        info)
+try
+{
+    return gesv_mixed<hipblasDoubleComplex>(handle,
+                                            n,
+                                            nrhs,
+                                            {A, nullptr, lda, hipblasStride(lda) * n},
+                                            ipiv,
+                                            n,
+                                            {B, nullptr, ldb, hipblasStride(ldb) * nrhs},
+                                            {X, nullptr, ldx, hipblasStride(ldx) * nrhs},
+                                            iter,
+                                            info,
+                                            1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                     const int           n,
+                                     const int           nrhs,
+                                     double* const       A[],
+                                     const int           lda,
+                                     int*                ipiv,
+                                     const double* const B[],
+                                     const int           ldb,
+                                     double* const       X[],
+                                     const int           ldx,
+                                     int*                iter,
+                                     int*                info,
+                                     const int           batchCount)
+try
+{
+    return gesv_mixed<double>(handle,
+                              n,
+                              nrhs,
+                              {nullptr, A, lda, 0},
+                              ipiv,
+                              n,
+                              {nullptr, B, ldb, 0},
+                              {nullptr, X, ldx, 0},
+                              iter,
+                              info,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                     const int                         n,
+                                     const int                         nrhs,
+                                     hipblasDoubleComplex* const       A[],
+                                     const int                         lda,
+                                     int*                              ipiv,
+                                     const hipblasDoubleComplex* const B[],
+                                     const int                         ldb,
+                                     hipblasDoubleComplex* const       X[],
+                                     const int                         ldx,
+                                     int*                              iter,
+                                     int*                              info,
+                                     const int                         batchCount)
+try
+{
+    return gesv_mixed<hipblasDoubleComplex>(handle,
+                                            n,
+                                            nrhs,
+                                            {nullptr, A, lda, 0},
+                                            ipiv,
+                                            n,
+                                            {nullptr, B, ldb, 0},
+                                            {nullptr, X, ldx, 0},
+                                            iter,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            const double*       B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            double*             X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    return gesv_mixed<double>(handle,
+                              n,
+                              nrhs,
+                              {A, nullptr, lda, strideA},
+                              ipiv,
+                              strideP,
+                              {B, nullptr, ldb, strideB},
+                              {X, nullptr, ldx, strideX},
+                              iter,
+                              info,
+                              batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex*       A,
+                                            const int                   lda,
+                                            const hipblasStride         strideA,
+                                            int*                        ipiv,
+                                            const hipblasStride         strideP,
+                                            const hipblasDoubleComplex* B,
+                                            const int                   ldb,
+                                            const hipblasStride         strideB,
+                                            hipblasDoubleComplex*       X,
+                                            const int                   ldx,
+                                            const hipblasStride         strideX,
+                                            int*                        iter,
+                                            int*                        info,
+                                            const int                   batchCount)
+try
+{
+    return gesv_mixed<hipblasDoubleComplex>(handle,
+                                            n,
+                                            nrhs,
+                                            {A, nullptr, lda, strideA},
+                                            ipiv,
+                                            strideP,
+                                            {B, nullptr, ldb, strideB},
+                                            {X, nullptr, ldx, strideX},
+                                            iter,
+                                            info,
+                                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "graph.hpp"
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // A copy the graph makes to host memory each time it runs
+    struct hipblas_host_copy
+    {
+        void*       dst;
+        const void* src;
+        size_t      size;
+    };
+
+    void run_host_copy(void* data)
+    {
+        auto copy = static_cast<const hipblas_host_copy*>(data);
+        memcpy(copy->dst, copy->src, copy->size);
+    }
+
+    // Staging is handed out from chunks of pinned memory this large, or as
+    // large as a single request
+    constexpr size_t staging_chunk_size = 4096;
+    constexpr size_t staging_alignment  = 16;
+}
+
+struct hipblas_graph_resources
+{
+    hipblas_graph_resources()                               = default;
+    hipblas_graph_resources(const hipblas_graph_resources&) = delete;
+    hipblas_graph_resources& operator=(const hipblas_graph_resources&) = delete;
+
+    ~hipblas_graph_resources()
+    {
+        for(void* chunk : chunks)
+            (void)hipHostFree(chunk);
+    }
+
+    hipStream_t stream               = nullptr;
+    uint64_t    workspace_generation = 0;
+
+    std::vector<void*> chunks;
+    size_t             chunk_used = 0;
+    size_t             chunk_size = 0;
+
+    // Arguments of the host nodes, which keep their address as copies are added
+    std::deque<hipblas_host_copy> copies;
+};
+
+struct _hipblasGraph
+{
+    _hipblasGraph()                     = default;
+    _hipblasGraph(const _hipblasGraph&) = delete;
+    _hipblasGraph& operator=(const _hipblasGraph&) = delete;
+
+    ~_hipblasGraph()
+    {
+        if(exec)
+            (void)hipGraphExecDestroy(exec);
+    }
+
+    hipblasHandle_t                          handle               = nullptr;
+    hipGraphExec_t                           exec                 = nullptr;
+    uint64_t                                 workspace_generation = 0;
+    std::unique_ptr<hipblas_graph_resources> resources;
+};
+
+hipblas_graph_capture::~hipblas_graph_capture()
+{
+    // The handle is destroyed in the middle of a capture
+    if(resources)
+    {
+        hipGraph_t graph = nullptr;
+        if(hipStreamEndCapture(resources->stream, &graph) == hipSuccess && graph)
+            (void)hipGraphDestroy(graph);
+        delete resources;
+    }
+}
+
+void* hipblas_capture_staging(hipblasHandle_t handle, size_t size)
+{
+    hipblas_graph_resources* resources = hipblas_get_handle_state(handle)->capture.resources;
+    if(!resources)
+        return nullptr;
+
+    size = (size + staging_alignment - 1) / staging_alignment * staging_alignment;
+    if(resources->chunks.empty() || resources->chunk_used + size > resources->chunk_size)
+    {
+        size_t chunk_size = std::max(size, staging_chunk_size);
+        void*  chunk      = nullptr;
+
+        // Allocating is not a stream operation, but the capture would refuse it
+        hipStreamCaptureMode mode = hipStreamCaptureModeRelaxed;
+        (void)hipThreadExchangeStreamCaptureMode(&mode);
+        hipError_t err = hipHostMalloc(&chunk, chunk_size, hipHostMallocMapped);
+        (void)hipThreadExchangeStreamCaptureMode(&mode);
+        if(err != hipSuccess)
+            return nullptr;
+
+        resources->chunks.push_back(chunk);
+        resources->chunk_used = 0;
+        resources->chunk_size = chunk_size;
+    }
+
+    void* staging = static_cast<char*>(resources->chunks.back()) + resources->chunk_used;
+    resources->chunk_used += size;
+    return staging;
+}
+
+hipblasStatus_t hipblas_capture_copy_to_host(
+    hipblasHandle_t handle, hipStream_t stream, void* dst, const void* staging, size_t size)
+{
+    hipblas_graph_resources* resources = hipblas_get_handle_state(handle)->capture.resources;
+    if(!resources)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    resources->copies.push_back({dst, staging, size});
+    if(hipLaunchHostFunc(stream, run_host_copy, &resources->copies.back()) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGraphBegin(hipblasHandle_t handle)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_graph_capture& capture = hipblas_get_handle_state(handle)->capture;
+    if(capture.resources)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The null stream cannot be captured
+    if(!stream)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Deferred gemm calls are made before the capture, not captured
+    hipblas_coalescing_dependency(handle);
+
+    status = hipblas_reserve_capture_workspace(handle, capture.workspace_reserve);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto resources                  = std::make_unique<hipblas_graph_resources>();
+    resources->stream               = stream;
+    resources->workspace_generation = capture.workspace_generation;
+
+    if(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    capture.workspace_exhausted = false;
+    capture.resources           = resources.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphEnd(hipblasHandle_t handle, hipblasGraph_t* graph)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *graph                         = nullptr;
+    hipblas_graph_capture& capture = hipblas_get_handle_state(handle)->capture;
+    if(!capture.resources)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipblas_graph_resources> resources(capture.resources);
+    capture.resources = nullptr;
+
+    hipGraph_t captured = nullptr;
+    if(hipStreamEndCapture(resources->stream, &captured) != hipSuccess || !captured)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // A call could not get the workspace it needed; the next capture reserves it
+    if(capture.workspace_exhausted)
+    {
+        (void)hipGraphDestroy(captured);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    auto result                  = std::make_unique<_hipblasGraph>();
+    result->handle               = handle;
+    result->workspace_generation = resources->workspace_generation;
+    result->resources            = std::move(resources);
+
+    hipError_t err = hipGraphInstantiate(&result->exec, captured, nullptr, nullptr, 0);
+    (void)hipGraphDestroy(captured);
+    if(err != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    *graph = result.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphLaunch(hipblasHandle_t handle, hipblasGraph_t graph)
+try
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!graph || graph->handle != handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The graph refers to a workspace which has since been freed
+    hipblas_graph_capture& capture = hipblas_get_handle_state(handle)->capture;
+    if(capture.workspace_generation != graph->workspace_generation)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(hipGraphLaunch(graph->exec, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph)
+try
+{
+    delete graph;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
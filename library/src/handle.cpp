@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "handle.hpp"
+#include <algorithm>
+#include <memory>
+#include <shared_mutex>
+
+bool hipblas_workspace_cache::find(const hipblas_workspace_key& key, size_t& size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_sizes.find(key);
+    if(it == m_sizes.end())
+    {
+        m_misses++;
+        return false;
+    }
+
+    m_hits++;
+    size = it->second;
+    return true;
+}
+
+void hipblas_workspace_cache::insert(const hipblas_workspace_key& key, size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_sizes[key] = size;
+}
+
+void hipblas_workspace_cache::get_stats(size_t* hits, size_t* misses) const
+{
+    if(hits)
+        *hits = m_hits;
+    if(misses)
+        *misses = m_misses;
+}
+
+void hipblas_backend_workspace::need(size_t size)
+{
+    size_t current = needed.load();
+    while(current < size && !needed.compare_exchange_weak(current, size))
+    {
+    }
+}
+
+hipblas_device_scratch::~hipblas_device_scratch()
+{
+    if(m_data)
+        (void)hipFree(m_data);
+}
+
+void* hipblas_device_scratch::get(size_t size, hipblas_graph_capture& capture)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(size <= m_size)
+        return m_data;
+
+    // Work captured so far uses the current buffer
+    if(capture.resources)
+    {
+        capture.workspace_exhausted = true;
+        capture.workspace_reserve   = std::max(capture.workspace_reserve, size);
+        return nullptr;
+    }
+
+    // hipFree waits for the device, so kernels still reading the old buffer
+    // finish before it is released
+    if(m_data)
+        (void)hipFree(m_data);
+    m_data = nullptr;
+    m_size = 0;
+    if(hipMalloc(&m_data, size) != hipSuccess)
+    {
+        m_data = nullptr;
+        return nullptr;
+    }
+    m_size = size;
+    capture.workspace_generation++;
+    return m_data;
+}
+
+namespace
+{
+    uint64_t pointer_array_hash(const void* const* array, int count)
+    {
+        uint64_t seed = std::hash<int>{}(count);
+        for(int i = 0; i < count; i++)
+            seed ^= std::hash<const void*>{}(array[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+}
+
+hipblas_pointer_array_cache::~hipblas_pointer_array_cache()
+{
+    for(entry& e : m_entries)
+        release(e);
+}
+
+void hipblas_pointer_array_cache::release(entry& e)
+{
+    // hipFree waits for the device, so the upload from the pinned copy and
+    // the kernels reading the device copy finish first
+    if(e.device)
+        (void)hipFree(e.device);
+    if(e.host)
+        (void)hipHostFree(e.host);
+}
+
+hipblasStatus_t
+    hipblas_pointer_array_cache::upload(entry& e, hipStream_t stream, hipblas_graph_capture& capture)
+{
+    size_t size = sizeof(void*) * e.count;
+    if(hipMemcpyAsync(e.device, e.host, size, hipMemcpyHostToDevice, stream) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    // A captured copy only runs with the graph
+    e.uploaded = !capture.resources;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_pointer_array_cache::get(const void* const*     host,
+                                                 int                    count,
+                                                 hipStream_t            stream,
+                                                 hipblas_graph_capture& capture,
+                                                 void***                device)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint64_t hash  = pointer_array_hash(host, count);
+    auto     range = m_index.equal_range(hash);
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        entry& e = *it->second;
+        if(e.count == count && std::equal(host, host + count, e.host))
+        {
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            m_hits++;
+            *device = e.device;
+            return e.uploaded ? HIPBLAS_STATUS_SUCCESS : upload(e, stream, capture);
+        }
+    }
+    m_misses++;
+
+    // Allocating and freeing are not stream operations, but a capture would
+    // refuse them
+    hipStreamCaptureMode mode = hipStreamCaptureModeRelaxed;
+    if(capture.resources)
+        (void)hipThreadExchangeStreamCaptureMode(&mode);
+
+    if(m_entries.size() >= max_entries)
+    {
+        // Graphs captured before may use the copy
+        entry& oldest = m_entries.back();
+        auto   it     = m_index.equal_range(oldest.hash).first;
+        while(it->second != std::prev(m_entries.end()))
+            ++it;
+        m_index.erase(it);
+        release(oldest);
+        m_entries.pop_back();
+        capture.workspace_generation++;
+    }
+
+    size_t size      = sizeof(void*) * count;
+    entry  e         = {hash, count, nullptr, nullptr, false};
+    bool   allocated = hipHostMalloc(&e.host, size) == hipSuccess
+                     && hipMalloc(&e.device, size) == hipSuccess;
+
+    if(capture.resources)
+        (void)hipThreadExchangeStreamCaptureMode(&mode);
+    if(!allocated)
+    {
+        release(e);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    std::copy(host, host + count, e.host);
+    hipblasStatus_t status = upload(e, stream, capture);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        release(e);
+        return status;
+    }
+
+    m_entries.push_front(e);
+    m_index.emplace(hash, m_entries.begin());
+    *device = e.device;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblas_pointer_array_cache::clear(hipblas_graph_capture& capture)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(m_entries.empty())
+        return;
+
+    for(entry& e : m_entries)
+        release(e);
+    m_entries.clear();
+    m_index.clear();
+    capture.workspace_generation++;
+}
+
+void hipblas_pointer_array_cache::get_stats(size_t* hits, size_t* misses) const
+{
+    if(hits)
+        *hits = m_hits;
+    if(misses)
+        *misses = m_misses;
+}
+
+hipblas_backend_solver::~hipblas_backend_solver()
+{
+    if(m_handle)
+        m_destroy(m_handle);
+}
+
+void* hipblas_backend_solver::get(void* (*create)(), void (*destroy)(void*))
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if(!m_handle)
+    {
+        m_handle  = create();
+        m_destroy = destroy;
+    }
+    return m_handle;
+}
+
+hipblas_worker_handles::~hipblas_worker_handles()
+{
+    for(const worker& w : m_workers)
+    {
+        hipblasDestroy(w.handle);
+        (void)hipStreamDestroy(w.stream);
+        (void)hipEventDestroy(w.done);
+    }
+    if(m_fork)
+        (void)hipEventDestroy(m_fork);
+}
+
+// std::min binds a reference to it, which needs a definition before C++17
+constexpr int hipblas_worker_handles::max_workers;
+
+const std::vector<hipblas_worker_handles::worker>& hipblas_worker_handles::get(int count)
+{
+    count = std::min(count, max_workers);
+    while(int(m_workers.size()) < count)
+    {
+        worker w{};
+        if(hipStreamCreateWithFlags(&w.stream, hipStreamNonBlocking) != hipSuccess)
+            break;
+        if(hipEventCreateWithFlags(&w.done, hipEventDisableTiming) != hipSuccess)
+        {
+            (void)hipStreamDestroy(w.stream);
+            break;
+        }
+        if(hipblasCreate(&w.handle) != HIPBLAS_STATUS_SUCCESS
+           || hipblasSetStream(w.handle, w.stream) != HIPBLAS_STATUS_SUCCESS)
+        {
+            if(w.handle)
+                hipblasDestroy(w.handle);
+            (void)hipStreamDestroy(w.stream);
+            (void)hipEventDestroy(w.done);
+            break;
+        }
+        m_workers.push_back(w);
+    }
+    return m_workers;
+}
+
+hipEvent_t hipblas_worker_handles::fork()
+{
+    if(!m_fork && hipEventCreateWithFlags(&m_fork, hipEventDisableTiming) != hipSuccess)
+        m_fork = nullptr;
+    return m_fork;
+}
+
+namespace
+{
+    // Handles are looked up on every call but only added or removed on
+    // create/destroy, so lookups share the lock
+    std::shared_timed_mutex                                                    handle_state_mutex;
+    std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblas_handle_state>> handle_state_map;
+}
+
+hipblas_handle_state* hipblas_get_handle_state(hipblasHandle_t handle)
+{
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(handle_state_mutex);
+
+        auto it = handle_state_map.find(handle);
+        if(it != handle_state_map.end())
+            return it->second.get();
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(handle_state_mutex);
+
+    auto& state = handle_state_map[handle];
+    if(!state)
+        state.reset(new hipblas_handle_state);
+    return state.get();
+}
+
+void hipblas_release_handle_state(hipblasHandle_t handle)
+{
+    std::unique_ptr<hipblas_handle_state> state;
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(handle_state_mutex);
+
+        auto it = handle_state_map.find(handle);
+        if(it == handle_state_map.end())
+            return;
+        state = std::move(it->second);
+        handle_state_map.erase(it);
+    }
+    // Destroyed unlocked, as destroying its worker handles releases their state
+}
+
+int* hipblas_gesv_pivots(hipblasHandle_t handle, int n, int batch_count, int* ipiv)
+{
+    if(ipiv || n <= 0)
+        return ipiv;
+
+    // Not null for an empty batch, which the backends may still check
+    hipblas_handle_state* state = hipblas_get_handle_state(handle);
+    return static_cast<int*>(
+        state->scratch.get(sizeof(int) * size_t(n) * std::max(batch_count, 1), state->capture));
+}
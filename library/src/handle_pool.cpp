@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// A pool of ready to use handles. Free handles live in a fixed array of
+// atomic slots which acquire and release claim with exchange/compare-exchange,
+// so recycling a handle never takes a lock. Each thread starts probing at its
+// own slot, which keeps threads from contending on the same cache line.
+struct _hipblasHandlePool
+{
+    explicit _hipblasHandlePool(int capacity)
+        : capacity(capacity)
+        , slots(new std::atomic<hipblasHandle_t>[capacity])
+        , serial(next_serial++)
+    {
+        for(int i = 0; i < capacity; i++)
+            slots[i] = nullptr;
+    }
+
+    const int                                       capacity;
+    std::unique_ptr<std::atomic<hipblasHandle_t>[]> slots;
+
+    // Distinguishes this pool from an earlier one at the same address
+    const uint64_t               serial;
+    static std::atomic<uint64_t> next_serial;
+
+    // Settings every handle is returned to on release, captured from a fresh handle
+    bool                 defaults_valid = false;
+    hipblasPointerMode_t pointer_mode   = HIPBLAS_POINTER_MODE_HOST;
+    hipblasAtomicsMode_t atomics_mode   = HIPBLAS_ATOMICS_ALLOWED;
+
+    // Guards the defaults above, the handles owned by threads which have not
+    // exited, which are only touched the first time a thread asks for its
+    // handle and when it exits, and the handles of threads which have exited.
+    // Those are reset when next acquired, rather than by the exiting thread.
+    std::mutex                          mutex;
+    std::unordered_set<hipblasHandle_t> thread_handles;
+    std::vector<hipblasHandle_t>        exited_handles;
+};
+
+std::atomic<uint64_t> _hipblasHandlePool::next_serial{1};
+
+namespace
+{
+    // Slot each thread starts probing from
+    int thread_slot(int capacity)
+    {
+        static std::atomic<unsigned> next_thread{0};
+        thread_local unsigned        thread_index = next_thread++;
+        return int(thread_index % unsigned(capacity));
+    }
+
+    hipblasStatus_t create_pooled_handle(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+    {
+        hipblasStatus_t status = hipblasCreate(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->defaults_valid)
+        {
+            status = hipblasGetPointerMode(*handle, &pool->pointer_mode);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGetAtomicsMode(*handle, &pool->atomics_mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+            {
+                hipblasDestroy(*handle);
+                return status;
+            }
+            pool->defaults_valid = true;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Return a handle to the settings of a freshly created one. Workspace the
+    // library allocated is kept, while the application's is let go of.
+    hipblasStatus_t reset_pooled_handle(hipblasHandlePool_t pool, hipblasHandle_t handle)
+    {
+        // The collected gemm calls run on the workspace and stream they were
+        // made with, and their errors go to the thread releasing the handle
+        hipblasStatus_t status = hipblasFlushCoalescedCalls(handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetCoalescingMode(handle, HIPBLAS_COALESCING_OFF);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetHandleCountersMode(handle, HIPBLAS_COUNTERS_OFF);
+
+        // Backends without hipblasSetWorkspace cannot hold the application's
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetWorkspace(handle, nullptr, 0);
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+            status = HIPBLAS_STATUS_SUCCESS;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(handle, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, pool->pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(handle, pool->atomics_mode);
+        return status;
+    }
+
+    // Pools not yet destroyed, by serial, so that an exiting thread only
+    // returns its handles to those
+    std::mutex                                        live_pools_mutex;
+    std::unordered_map<uint64_t, hipblasHandlePool_t> live_pools;
+
+    // The handles a thread got from hipblasHandlePoolGetThreadHandle, by the
+    // serial of their pool. They go back to their pools when the thread exits.
+    // No hipBLAS call is made then, as the other thread_local state of the
+    // library may already be gone.
+    class owned_handles
+    {
+    public:
+        ~owned_handles()
+        {
+            // Holding live_pools_mutex keeps the pools from being destroyed
+            std::lock_guard<std::mutex> lock(live_pools_mutex);
+            for(const entry& e : m_entries)
+            {
+                auto pool = live_pools.find(e.serial);
+                if(pool == live_pools.end())
+                    continue;
+
+                std::lock_guard<std::mutex> pool_lock(pool->second->mutex);
+                pool->second->thread_handles.erase(e.handle);
+                pool->second->exited_handles.push_back(e.handle);
+            }
+        }
+
+        hipblasHandle_t find(uint64_t serial) const
+        {
+            for(const entry& e : m_entries)
+                if(e.serial == serial)
+                    return e.handle;
+            return nullptr;
+        }
+
+        // Handles of destroyed pools were destroyed with them, and are dropped
+        void add(uint64_t serial, hipblasHandle_t handle)
+        {
+            std::lock_guard<std::mutex> lock(live_pools_mutex);
+            auto destroyed = [](const entry& e) { return !live_pools.count(e.serial); };
+            m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), destroyed),
+                            m_entries.end());
+            m_entries.push_back({serial, handle});
+        }
+
+    private:
+        struct entry
+        {
+            uint64_t        serial;
+            hipblasHandle_t handle;
+        };
+
+        std::vector<entry> m_entries;
+    };
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool, int capacity)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(capacity <= 0)
+        capacity = 2 * std::max(1u, std::thread::hardware_concurrency());
+
+    *pool = new _hipblasHandlePool(capacity);
+
+    std::lock_guard<std::mutex> lock(live_pools_mutex);
+    live_pools[(*pool)->serial] = *pool;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(!pool)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Threads exiting from now on leave their handles to be destroyed here
+    {
+        std::lock_guard<std::mutex> lock(live_pools_mutex);
+        live_pools.erase(pool->serial);
+    }
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < pool->capacity; i++)
+    {
+        hipblasHandle_t handle = pool->slots[i].exchange(nullptr);
+        if(handle)
+        {
+            hipblasStatus_t destroy_status = hipblasDestroy(handle);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = destroy_status;
+        }
+    }
+    for(hipblasHandle_t thread_handle : pool->thread_handles)
+    {
+        hipblasStatus_t destroy_status = hipblasDestroy(thread_handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = destroy_status;
+    }
+    for(hipblasHandle_t exited_handle : pool->exited_handles)
+    {
+        hipblasStatus_t destroy_status = hipblasDestroy(exited_handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = destroy_status;
+    }
+
+    delete pool;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+try
+{
+    if(!pool || !handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int start = thread_slot(pool->capacity);
+    for(int i = 0; i < pool->capacity; i++)
+    {
+        auto& slot = pool->slots[(start + i) % pool->capacity];
+        if(slot.load(std::memory_order_relaxed))
+        {
+            hipblasHandle_t pooled = slot.exchange(nullptr, std::memory_order_acquire);
+            if(pooled)
+            {
+                *handle = pooled;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+        }
+    }
+
+    // A handle of an exited thread
+    hipblasHandle_t exited = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if(!pool->exited_handles.empty())
+        {
+            exited = pool->exited_handles.back();
+            pool->exited_handles.pop_back();
+        }
+    }
+    if(exited)
+    {
+        if(reset_pooled_handle(pool, exited) == HIPBLAS_STATUS_SUCCESS)
+        {
+            *handle = exited;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        hipblasDestroy(exited);
+    }
+
+    // Nothing to recycle
+    return create_pooled_handle(pool, handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+try
+{
+    if(!pool || !handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = reset_pooled_handle(pool, handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(handle);
+        return status;
+    }
+
+    int start = thread_slot(pool->capacity);
+    for(int i = 0; i < pool->capacity; i++)
+    {
+        auto&           slot  = pool->slots[(start + i) % pool->capacity];
+        hipblasHandle_t empty = nullptr;
+        if(!slot.load(std::memory_order_relaxed)
+           && slot.compare_exchange_strong(empty, handle, std::memory_order_release))
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The pool is full
+    return hipblasDestroy(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolGetThreadHandle(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+try
+{
+    if(!pool || !handle)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    thread_local owned_handles owned;
+    if(hipblasHandle_t owned_handle = owned.find(pool->serial))
+    {
+        *handle = owned_handle;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t status = hipblasHandlePoolAcquire(pool, handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->thread_handles.insert(*handle);
+    }
+    owned.add(pool->serial, *handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
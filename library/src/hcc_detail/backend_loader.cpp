@@ -0,0 +1,179 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Lazy loading of rocBLAS and rocSOLVER, used when hipBLAS is built with
+// BUILD_WITH_DLOPEN_BACKEND. hipblas.cpp calls the backend as usual, but every
+// rocblas_ and rocsolver_ symbol it uses is defined here as a hidden stub that
+// jumps through a slot of the dispatch table. A slot starts out pointing at a
+// resolver which opens the owning library on first use, looks the symbol up
+// with dlsym and patches the slot, so later calls cost one indirect jump.
+// rocSOLVER is therefore only opened once a solver routine is first called.
+//
+// The library names can be overridden with HIPBLAS_ROCBLAS_LIBRARY and
+// HIPBLAS_ROCSOLVER_LIBRARY, e.g. to run against a stub backend.
+
+#if !defined(__x86_64__) || !defined(__linux__)
+#error "BUILD_WITH_DLOPEN_BACKEND is only supported on x86-64 Linux"
+#endif
+
+#include "rocblas.h"
+#include <cstdlib>
+#include <dlfcn.h>
+#include <mutex>
+
+#ifndef ROCBLAS_LIBRARY_NAME
+#define ROCBLAS_LIBRARY_NAME "librocblas.so"
+#endif
+#ifndef ROCSOLVER_LIBRARY_NAME
+#define ROCSOLVER_LIBRARY_NAME "librocsolver.so"
+#endif
+
+namespace
+{
+    enum hipblas_backend_library : long
+    {
+        hipblas_rocblas_library   = 0,
+        hipblas_rocsolver_library = 1,
+    };
+}
+
+// Layout is known to the assembly below: the stub jumps through fn, and the
+// resolver is handed the address of the slot
+struct hipblas_backend_slot
+{
+    void*       fn;
+    const char* name;
+    long        library;
+};
+
+extern "C" __attribute__((visibility("hidden"))) void*
+    hipblas_backend_resolve(hipblas_backend_slot* slot);
+
+// Common entry of every unresolved symbol, with its slot in r11. The argument
+// registers (including al, the vector register count for varargs) are saved
+// around the resolver, then the call continues into the backend as though it
+// had been made directly.
+asm(".text\n"
+    ".p2align 4\n"
+    ".hidden hipblas_backend_trampoline\n"
+    ".type hipblas_backend_trampoline, @function\n"
+    "hipblas_backend_trampoline:\n"
+    "    pushq %rbp\n"
+    "    movq %rsp, %rbp\n"
+    "    pushq %rdi\n"
+    "    pushq %rsi\n"
+    "    pushq %rdx\n"
+    "    pushq %rcx\n"
+    "    pushq %r8\n"
+    "    pushq %r9\n"
+    "    pushq %rax\n"
+    "    subq $136, %rsp\n"
+    "    movdqu %xmm0, 0(%rsp)\n"
+    "    movdqu %xmm1, 16(%rsp)\n"
+    "    movdqu %xmm2, 32(%rsp)\n"
+    "    movdqu %xmm3, 48(%rsp)\n"
+    "    movdqu %xmm4, 64(%rsp)\n"
+    "    movdqu %xmm5, 80(%rsp)\n"
+    "    movdqu %xmm6, 96(%rsp)\n"
+    "    movdqu %xmm7, 112(%rsp)\n"
+    "    movq %r11, %rdi\n"
+    "    call hipblas_backend_resolve\n"
+    "    movq %rax, %r10\n"
+    "    movdqu 0(%rsp), %xmm0\n"
+    "    movdqu 16(%rsp), %xmm1\n"
+    "    movdqu 32(%rsp), %xmm2\n"
+    "    movdqu 48(%rsp), %xmm3\n"
+    "    movdqu 64(%rsp), %xmm4\n"
+    "    movdqu 80(%rsp), %xmm5\n"
+    "    movdqu 96(%rsp), %xmm6\n"
+    "    movdqu 112(%rsp), %xmm7\n"
+    "    addq $136, %rsp\n"
+    "    popq %rax\n"
+    "    popq %r9\n"
+    "    popq %r8\n"
+    "    popq %rcx\n"
+    "    popq %rdx\n"
+    "    popq %rsi\n"
+    "    popq %rdi\n"
+    "    popq %rbp\n"
+    "    jmp *%r10\n"
+    ".size hipblas_backend_trampoline, .-hipblas_backend_trampoline\n");
+
+// Defines the slot of a backend symbol and the hidden stub which replaces it
+// inside libhipblas, so the symbol never interposes on the real backend
+#define HIPBLAS_BACKEND_SYMBOL(library__, name__)                                   \
+    extern "C" void hipblas_lazy_##name__();                                        \
+    extern "C" {                                                                    \
+    __attribute__((visibility("hidden"))) hipblas_backend_slot                      \
+        hipblas_slot_##name__ = {(void*)hipblas_lazy_##name__, #name__, library__}; \
+    }                                                                               \
+    asm(".text\n"                                                                   \
+        ".globl " #name__ "\n"                                                      \
+        ".hidden " #name__ "\n"                                                     \
+        ".type " #name__ ", @function\n"                                            \
+        #name__ ":\n"                                                               \
+        "    jmp *hipblas_slot_" #name__ "(%rip)\n"                                 \
+        ".size " #name__ ", .-" #name__ "\n"                                        \
+        ".globl hipblas_lazy_" #name__ "\n"                                         \
+        ".hidden hipblas_lazy_" #name__ "\n"                                        \
+        ".type hipblas_lazy_" #name__ ", @function\n"                               \
+        "hipblas_lazy_" #name__ ":\n"                                               \
+        "    leaq hipblas_slot_" #name__ "(%rip), %r11\n"                           \
+        "    jmp hipblas_backend_trampoline\n"                                      \
+        ".size hipblas_lazy_" #name__ ", .-hipblas_lazy_" #name__ "\n");
+
+#define HIPBLAS_ROCBLAS_SYMBOL(name__) HIPBLAS_BACKEND_SYMBOL(hipblas_rocblas_library, name__)
+#define HIPBLAS_ROCSOLVER_SYMBOL(name__) HIPBLAS_BACKEND_SYMBOL(hipblas_rocsolver_library, name__)
+
+// Generated at configure time from the backend calls in hipblas.cpp
+#include "backend_symbols.hpp"
+
+namespace
+{
+    // Stands in for symbols which could not be loaded. Every backend entry point
+    // hipBLAS uses returns a status, so this surfaces as HIPBLAS_STATUS_NOT_SUPPORTED.
+    rocblas_status hipblas_backend_unavailable()
+    {
+        return rocblas_status_not_implemented;
+    }
+
+    void* open_backend_library(const char* env, const char* name)
+    {
+        const char* path = getenv(env);
+        return dlopen(path && *path ? path : name, RTLD_NOW | RTLD_LOCAL);
+    }
+
+    void* backend_library(long library)
+    {
+        static std::once_flag rocblas_once, rocsolver_once;
+        static void*          rocblas_library   = nullptr;
+        static void*          rocsolver_library = nullptr;
+
+        if(library == hipblas_rocsolver_library)
+        {
+            std::call_once(rocsolver_once, [] {
+                rocsolver_library
+                    = open_backend_library("HIPBLAS_ROCSOLVER_LIBRARY", ROCSOLVER_LIBRARY_NAME);
+            });
+            return rocsolver_library;
+        }
+
+        std::call_once(rocblas_once, [] {
+            rocblas_library = open_backend_library("HIPBLAS_ROCBLAS_LIBRARY", ROCBLAS_LIBRARY_NAME);
+        });
+        return rocblas_library;
+    }
+}
+
+void* hipblas_backend_resolve(hipblas_backend_slot* slot)
+{
+    void* library = backend_library(slot->library);
+    void* fn      = library ? dlsym(library, slot->name) : nullptr;
+    if(!fn)
+        fn = (void*)hipblas_backend_unavailable;
+
+    // Racing threads resolve to the same address, so the store only has to be atomic
+    __atomic_store_n(&slot->fn, fn, __ATOMIC_RELEASE);
+    return fn;
+}
@@ -2,22 +2,54 @@
  * Copyright 2016-2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "hipblas.h"
+#include "coalesce.hpp"
 #include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "staging.hpp"
+#include "tuning.hpp"
 #include "limits.h"
+// rocblas_gemm_ex_get_solutions is a beta feature of rocBLAS
+#define ROCBLAS_BETA_FEATURES_API
 #include "rocblas.h"
 #ifdef __HIP_PLATFORM_SOLVER__
 #include "rocsolver.h"
 #endif
 #include <algorithm>
-#include <functional>
 #include <math.h>
 
 extern "C" hipblasStatus_t rocBLASStatusToHIPStatus(rocblas_status_ error);
 
+// Replace the handle's device memory with size bytes. Graphs captured before
+// refer to the old memory, and while capturing it cannot be replaced at all:
+// the capture fails, and the next one reserves the size up front. Workspace
+// set by the application is never replaced; the call needing more fails.
+static hipblasStatus_t hipblasResizeDeviceMemory(rocblas_handle handle, size_t size)
+{
+    hipblas_handle_state*  state   = hipblas_get_handle_state((hipblasHandle_t)handle);
+    hipblas_graph_capture& capture = state->capture;
+    state->backend_workspace.need(size);
+    if(state->backend_workspace.user)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    if(capture.resources)
+    {
+        capture.workspace_exhausted = true;
+        capture.workspace_reserve   = std::max(capture.workspace_reserve, size);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    rocblas_status blas_status = rocblas_set_device_memory_size(handle, size);
+    if(blas_status == rocblas_status_success)
+        capture.workspace_generation++;
+    return rocBLASStatusToHIPStatus(blas_status);
+}
+
 // Attempt a rocBLAS call; if it gets an allocation error, query the
 // size needed and attempt to allocate it, retrying the operation
-static hipblasStatus_t hipblasDemandAlloc(rocblas_handle                   handle,
-                                          std::function<hipblasStatus_t()> func)
+template <typename F>
+static hipblasStatus_t hipblasDemandAlloc(rocblas_handle handle, F&& func)
 {
     hipblasStatus_t status = func();
     if(status == HIPBLAS_STATUS_ALLOC_FAILED)
@@ -36,10 +68,8 @@ static hipblasStatus_t hipblasDemandAlloc(rocblas_handle                   handl
                     status = rocBLASStatusToHIPStatus(blas_status);
                 else
                 {
-                    blas_status = rocblas_set_device_memory_size(handle, size);
-                    if(blas_status != rocblas_status_success)
-                        status = rocBLASStatusToHIPStatus(blas_status);
-                    else
+                    status = hipblasResizeDeviceMemory(handle, size);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
                         status = func();
                 }
             }
@@ -48,9 +78,129 @@ static hipblasStatus_t hipblasDemandAlloc(rocblas_handle                   handl
     return status;
 }
 
+// Make sure the handle's device memory holds at least size bytes
+static hipblasStatus_t hipblasReserveDeviceMemory(rocblas_handle handle, size_t size)
+{
+    size_t         current_size;
+    rocblas_status blas_status = rocblas_get_device_memory_size(handle, &current_size);
+    if(blas_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(blas_status);
+    if(current_size < size)
+        return hipblasResizeDeviceMemory(handle, size);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Before a capture, switch the handle to a workspace of its own of at least
+// size bytes. rocBLAS otherwise grows the workspace it manages on demand,
+// which a graph could not follow.
+hipblasStatus_t hipblas_reserve_capture_workspace(hipblasHandle_t handle, size_t size)
+{
+    rocblas_handle         blas_handle = (rocblas_handle)handle;
+    hipblas_handle_state*  state       = hipblas_get_handle_state(handle);
+    hipblas_graph_capture& capture     = state->capture;
+
+    // The application's workspace stays in place, and calls needing more
+    // than it has fail during the capture as they would outside it
+    if(state->backend_workspace.user)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t         current_size;
+    rocblas_status blas_status = rocblas_get_device_memory_size(blas_handle, &current_size);
+    if(blas_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(blas_status);
+    if(capture.workspace_sized && current_size >= size)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status = hipblasResizeDeviceMemory(blas_handle, std::max(current_size, size));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        capture.workspace_sized = true;
+    return status;
+}
+
+// Like hipblasDemandAlloc, but the workspace size of every (routine, precision,
+// size) seen on the handle is remembered. The first call with a new shape runs
+// the size query up front and later calls with that shape pre-size the
+// workspace, so the backend routine itself is only dispatched once.
+template <typename F>
+static hipblasStatus_t
+    hipblasDemandAllocCached(hipblasHandle_t handle, const hipblas_workspace_key& key, F&& func)
+{
+    rocblas_handle           blas_handle = (rocblas_handle)handle;
+    hipblas_workspace_cache& cache       = hipblas_get_handle_state(handle)->workspace_cache;
+
+    size_t size;
+    if(!cache.find(key, size))
+    {
+        rocblas_status blas_status = rocblas_start_device_memory_size_query(blas_handle);
+        if(blas_status != rocblas_status_success)
+            return rocBLASStatusToHIPStatus(blas_status);
+
+        hipblasStatus_t status = func();
+        blas_status            = rocblas_stop_device_memory_size_query(blas_handle, &size);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(blas_status != rocblas_status_success)
+            return rocBLASStatusToHIPStatus(blas_status);
+
+        cache.insert(key, size);
+    }
+
+    if(size)
+    {
+        hipblasStatus_t status = hipblasReserveDeviceMemory(blas_handle, size);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    // The workspace may have been replaced since the size was cached,
+    // so keep the demand allocation as a fallback
+    return hipblasDemandAlloc(blas_handle, func);
+}
+
+// Return the flags to pass to the gemm_ex family. Only int8 inputs need the
+// layout flag, and it only depends on the device, so it is queried once per
+// handle and device instead of on every call.
+static hipblasStatus_t hipblasGemmExFlags(hipblasHandle_t   handle,
+                                          hipblasDatatype_t a_type,
+                                          hipblasDatatype_t b_type,
+                                          uint32_t*         flags)
+{
+    *flags = rocblas_gemm_flags_none;
+    if(a_type != HIPBLAS_R_8I && b_type != HIPBLAS_R_8I)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblas_int8_layout& layout = hipblas_get_handle_state(handle)->int8_layout;
+    if(!layout.valid || layout.device != device)
+    {
+        rocblas_gemm_flags query_flags = rocblas_gemm_flags_none;
+        rocblas_status     status
+            = rocblas_query_int8_layout_flag((rocblas_handle)handle, &query_flags);
+        if(status != rocblas_status_success)
+            return rocBLASStatusToHIPStatus(status);
+
+        layout.flags  = query_flags;
+        layout.device = device;
+        layout.valid  = true;
+    }
+
+    *flags = layout.flags;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
 #define HIPBLAS_DEMAND_ALLOC(status__) \
     hipblasDemandAlloc(rocblas_handle(handle), [&]() -> hipblasStatus_t { return status__; })
 
+#define HIPBLAS_SOLVER_ALLOC(routine__, precision__, m__, n__, nrhs__, batch_count__, status__) \
+    hipblasDemandAllocCached(                                                                   \
+        handle,                                                                                 \
+        hipblas_workspace_key{                                                                  \
+            hipblas_solver_routine::routine__, precision__, m__, n__, nrhs__, batch_count__},   \
+        [&]() -> hipblasStatus_t { return status__; })
+
 extern "C" {
 
 rocblas_operation_ hipOperationToHCCOperation(hipblasOperation_t op)
@@ -338,6 +488,8 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    hipblas_coalescing_dependency(handle);
+    hipblas_release_handle_state(handle);
     return rocBLASStatusToHIPStatus(rocblas_destroy_handle((rocblas_handle)handle));
 }
 catch(...)
@@ -352,6 +504,10 @@ try
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
     }
+    if(hipblas_is_capturing(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblas_coalescing_dependency(handle);
+    hipblas_get_handle_state(handle)->int8_layout.valid = false;
     return rocBLASStatusToHIPStatus(rocblas_set_stream((rocblas_handle)handle, streamId));
 }
 catch(...)
@@ -361,12 +517,65 @@ catch(...)
 
 hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId)
 try
+{
+    // The application may synchronize with the stream once it has it
+    hipblas_coalescing_dependency(handle);
+    return hipblas_get_stream(handle, streamId);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle, void* workspace, size_t sizeInBytes)
+try
 {
     if(handle == nullptr)
-    {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
-    }
-    return rocBLASStatusToHIPStatus(rocblas_get_stream((rocblas_handle)handle, streamId));
+    if(!workspace && sizeInBytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(hipblas_is_capturing(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Deferred gemm calls use the workspace they were made with
+    hipblas_coalescing_dependency(handle);
+
+    hipblas_handle_state* state = hipblas_get_handle_state(handle);
+    rocblas_status        blas_status
+        = rocblas_set_workspace((rocblas_handle)handle, workspace, sizeInBytes);
+    if(blas_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(blas_status);
+
+    // Without a workspace of the application's, rocBLAS allocates its own
+    // again, which the next capture sizes before it starts
+    state->backend_workspace.user      = workspace && sizeInBytes;
+    state->backend_workspace.user_size = state->backend_workspace.user ? sizeInBytes : 0;
+    state->capture.workspace_sized     = false;
+    state->capture.workspace_generation++;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle, size_t* sizeInBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!sizeInBytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t         current_size;
+    rocblas_status blas_status
+        = rocblas_get_device_memory_size((rocblas_handle)handle, &current_size);
+    if(blas_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(blas_status);
+
+    *sizeInBytes
+        = std::max(current_size, hipblas_get_handle_state(handle)->backend_workspace.needed.load());
+    return HIPBLAS_STATUS_SUCCESS;
 }
 catch(...)
 {
@@ -376,6 +585,7 @@ catch(...)
 hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t mode)
 try
 {
+    hipblas_coalescing_dependency(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_set_pointer_mode((rocblas_handle)handle, HIPPointerModeToRocblasPointerMode(mode)));
 }
@@ -400,6 +610,14 @@ catch(...)
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    // Deferred gemm calls may read or write the device vector
+    hipblas_coalescing_dependency(nullptr);
+
+    // A vector is staged as a matrix of one row
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(1, n, elemSize, x, incx, y, incy, nullptr, false);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(rocblas_set_vector(n, elemSize, x, incx, y, incy));
 }
 catch(...)
@@ -410,6 +628,10 @@ catch(...)
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status = hipblas_staged_get_matrix(1, n, elemSize, x, incx, y, incy, nullptr);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(rocblas_get_vector(n, elemSize, x, incx, y, incy));
 }
 catch(...)
@@ -421,6 +643,11 @@ hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(rows, cols, elemSize, A, lda, B, ldb, nullptr, false);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(rocblas_set_matrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -432,6 +659,11 @@ hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_get_matrix(rows, cols, elemSize, A, lda, B, ldb, nullptr);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(rocblas_get_matrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -443,6 +675,11 @@ hipblasStatus_t hipblasSetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(1, n, elemSize, x, incx, y, incy, stream, true);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(
         rocblas_set_vector_async(n, elemSize, x, incx, y, incy, stream));
 }
@@ -455,6 +692,10 @@ hipblasStatus_t hipblasGetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status = hipblas_staged_get_matrix(1, n, elemSize, x, incx, y, incy, stream);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(
         rocblas_get_vector_async(n, elemSize, x, incx, y, incy, stream));
 }
@@ -467,6 +708,11 @@ hipblasStatus_t hipblasSetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(rows, cols, elemSize, A, lda, B, ldb, stream, true);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(
         rocblas_set_matrix_async(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -479,6 +725,11 @@ hipblasStatus_t hipblasGetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_get_matrix(rows, cols, elemSize, A, lda, B, ldb, stream);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return rocBLASStatusToHIPStatus(
         rocblas_get_matrix_async(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -514,7 +765,10 @@ catch(...)
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -524,7 +778,10 @@ catch(...)
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -535,8 +792,10 @@ hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -547,8 +806,11 @@ hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -560,8 +822,11 @@ hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -572,8 +837,11 @@ hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -588,8 +856,11 @@ hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                      int*                        result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_icamax_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_icamax_batched(
+            (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -604,8 +875,15 @@ hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                      int*                              result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_izamax_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_izamax_batched((rocblas_handle)handle,
+                                                               n,
+                                                               (rocblas_double_complex* const*)x,
+                                                               incx,
+                                                               batchCount,
+                                                               result));
+    });
 }
 catch(...)
 {
@@ -622,8 +900,11 @@ hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_isamax_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_isamax_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -639,8 +920,11 @@ hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_idamax_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_idamax_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -656,8 +940,16 @@ hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                             int*                  result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_icamax_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_icamax_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_float_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -673,8 +965,16 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                             int*                        result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_izamax_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_izamax_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_double_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -685,7 +985,10 @@ catch(...)
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_isamin((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_isamin((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -695,7 +998,10 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_idamin((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_idamin((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -706,8 +1012,10 @@ hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_icamin((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_icamin((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -718,8 +1026,11 @@ hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_izamin((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_izamin((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -731,8 +1042,11 @@ hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_isamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_isamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -743,8 +1057,11 @@ hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_idamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_idamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -759,8 +1076,11 @@ hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                      int*                        result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_icamin_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_icamin_batched(
+            (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -775,8 +1095,15 @@ hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                      int*                              result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_izamin_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_izamin_batched((rocblas_handle)handle,
+                                                               n,
+                                                               (rocblas_double_complex* const*)x,
+                                                               incx,
+                                                               batchCount,
+                                                               result));
+    });
 }
 catch(...)
 {
@@ -793,8 +1120,11 @@ hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_isamin_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_isamin_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -810,8 +1140,11 @@ hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_idamin_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_idamin_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -827,8 +1160,16 @@ hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             int*                  result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_icamin_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_icamin_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_float_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -844,8 +1185,16 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                             int*                        result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_izamin_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_izamin_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_double_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -856,7 +1205,10 @@ catch(...)
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_sasum((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_sasum((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -867,7 +1219,9 @@ hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dasum((rocblas_handle)handle, n, x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dasum((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -878,8 +1232,10 @@ hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_scasum((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_scasum((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -890,8 +1246,11 @@ hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dzasum((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dzasum((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -903,8 +1262,11 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_sasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_sasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -919,8 +1281,11 @@ hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                     double*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -935,8 +1300,11 @@ hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                      float*                      result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_scasum_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_scasum_batched(
+            (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -951,8 +1319,15 @@ hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                      double*                           result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dzasum_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dzasum_batched((rocblas_handle)handle,
+                                                               n,
+                                                               (rocblas_double_complex* const*)x,
+                                                               incx,
+                                                               batchCount,
+                                                               result));
+    });
 }
 catch(...)
 {
@@ -969,8 +1344,11 @@ hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
                                            float*          result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_sasum_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_sasum_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -986,8 +1364,11 @@ hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                            double*         result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dasum_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dasum_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -1003,8 +1384,16 @@ hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                             float*                result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_scasum_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_scasum_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_float_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -1020,8 +1409,16 @@ hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                             double*                     result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dzasum_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dzasum_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_double_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -1038,6 +1435,7 @@ hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_haxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_half*)alpha,
@@ -1055,6 +1453,7 @@ hipblasStatus_t hipblasSaxpy(
     hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(
         rocblas_saxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
 }
@@ -1072,6 +1471,7 @@ hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                              int             incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(
         rocblas_daxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
 }
@@ -1089,6 +1489,7 @@ hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_caxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)alpha,
@@ -1111,6 +1512,7 @@ hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)alpha,
@@ -1135,6 +1537,7 @@ hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_haxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_half*)alpha,
@@ -1159,6 +1562,7 @@ hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_saxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
 }
@@ -1177,6 +1581,7 @@ hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_daxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
 }
@@ -1195,6 +1600,7 @@ hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_caxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex*)alpha,
@@ -1219,6 +1625,7 @@ hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex*)alpha,
@@ -1246,6 +1653,7 @@ hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_haxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_half*)alpha,
@@ -1274,6 +1682,7 @@ hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_saxpy_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1294,6 +1703,7 @@ hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_daxpy_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1314,6 +1724,7 @@ hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_caxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)alpha,
@@ -1342,6 +1753,7 @@ hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)alpha,
@@ -1385,6 +1797,7 @@ hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_ccopy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -1405,6 +1818,7 @@ hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zcopy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -1427,6 +1841,7 @@ hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_scopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -1444,6 +1859,7 @@ hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dcopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -1461,6 +1877,7 @@ hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ccopy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -1483,6 +1900,7 @@ hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zcopy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -1508,6 +1926,7 @@ hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_scopy_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1527,6 +1946,7 @@ hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dcopy_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1546,6 +1966,7 @@ hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ccopy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -1572,6 +1993,7 @@ hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zcopy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -1597,13 +2019,16 @@ hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                             hipblasHalf*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_hdot((rocblas_handle)handle,
-                                                 n,
-                                                 (rocblas_half*)x,
-                                                 incx,
-                                                 (rocblas_half*)y,
-                                                 incy,
-                                                 (rocblas_half*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_hdot((rocblas_handle)handle,
+                                                     n,
+                                                     (rocblas_half*)x,
+                                                     incx,
+                                                     (rocblas_half*)y,
+                                                     incy,
+                                                     (rocblas_half*)result));
+    });
 }
 catch(...)
 {
@@ -1619,13 +2044,16 @@ hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                              hipblasBfloat16*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_bfdot((rocblas_handle)handle,
-                                                  n,
-                                                  (rocblas_bfloat16*)x,
-                                                  incx,
-                                                  (rocblas_bfloat16*)y,
-                                                  incy,
-                                                  (rocblas_bfloat16*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_bfdot((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_bfloat16*)x,
+                                                      incx,
+                                                      (rocblas_bfloat16*)y,
+                                                      incy,
+                                                      (rocblas_bfloat16*)result));
+    });
 }
 catch(...)
 {
@@ -1641,8 +2069,11 @@ hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                             float*          result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_sdot((rocblas_handle)handle, n, x, incx, y, incy, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_sdot((rocblas_handle)handle, n, x, incx, y, incy, result));
+    });
 }
 catch(...)
 {
@@ -1658,8 +2089,11 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                             double*         result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_ddot((rocblas_handle)handle, n, x, incx, y, incy, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_ddot((rocblas_handle)handle, n, x, incx, y, incy, result));
+    });
 }
 catch(...)
 {
@@ -1675,13 +2109,16 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotc((rocblas_handle)handle,
-                                                  n,
-                                                  (rocblas_float_complex*)x,
-                                                  incx,
-                                                  (rocblas_float_complex*)y,
-                                                  incy,
-                                                  (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_cdotc((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)x,
+                                                      incx,
+                                                      (rocblas_float_complex*)y,
+                                                      incy,
+                                                      (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1697,13 +2134,16 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotu((rocblas_handle)handle,
-                                                  n,
-                                                  (rocblas_float_complex*)x,
-                                                  incx,
-                                                  (rocblas_float_complex*)y,
-                                                  incy,
-                                                  (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_cdotu((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_float_complex*)x,
+                                                      incx,
+                                                      (rocblas_float_complex*)y,
+                                                      incy,
+                                                      (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1719,13 +2159,16 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotc((rocblas_handle)handle,
-                                                  n,
-                                                  (rocblas_double_complex*)x,
-                                                  incx,
-                                                  (rocblas_double_complex*)y,
-                                                  incy,
-                                                  (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_zdotc((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)x,
+                                                      incx,
+                                                      (rocblas_double_complex*)y,
+                                                      incy,
+                                                      (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1741,13 +2184,16 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotu((rocblas_handle)handle,
-                                                  n,
-                                                  (rocblas_double_complex*)x,
-                                                  incx,
-                                                  (rocblas_double_complex*)y,
-                                                  incy,
-                                                  (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_zdotu((rocblas_handle)handle,
+                                                      n,
+                                                      (rocblas_double_complex*)x,
+                                                      incx,
+                                                      (rocblas_double_complex*)y,
+                                                      incy,
+                                                      (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1765,14 +2211,17 @@ hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                    hipblasHalf*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_hdot_batched((rocblas_handle)handle,
-                                                         n,
-                                                         (rocblas_half* const*)x,
-                                                         incx,
-                                                         (rocblas_half* const*)y,
-                                                         incy,
-                                                         batchCount,
-                                                         (rocblas_half*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_hdot_batched((rocblas_handle)handle,
+                                                             n,
+                                                             (rocblas_half* const*)x,
+                                                             incx,
+                                                             (rocblas_half* const*)y,
+                                                             incy,
+                                                             batchCount,
+                                                             (rocblas_half*)result));
+    });
 }
 catch(...)
 {
@@ -1789,14 +2238,17 @@ hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                     hipblasBfloat16*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_bfdot_batched((rocblas_handle)handle,
-                                                          n,
-                                                          (rocblas_bfloat16* const*)x,
-                                                          incx,
-                                                          (rocblas_bfloat16* const*)y,
-                                                          incy,
-                                                          batchCount,
-                                                          (rocblas_bfloat16*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_bfdot_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_bfloat16* const*)x,
+                                                              incx,
+                                                              (rocblas_bfloat16* const*)y,
+                                                              incy,
+                                                              batchCount,
+                                                              (rocblas_bfloat16*)result));
+    });
 }
 catch(...)
 {
@@ -1813,8 +2265,11 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_sdot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_sdot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -1831,8 +2286,11 @@ hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                    double*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_ddot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_ddot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -1849,14 +2307,17 @@ hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotc_batched((rocblas_handle)handle,
-                                                          n,
-                                                          (rocblas_float_complex**)x,
-                                                          incx,
-                                                          (rocblas_float_complex**)y,
-                                                          incy,
-                                                          batchCount,
-                                                          (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_cdotc_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex**)x,
+                                                              incx,
+                                                              (rocblas_float_complex**)y,
+                                                              incy,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1873,14 +2334,17 @@ hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotu_batched((rocblas_handle)handle,
-                                                          n,
-                                                          (rocblas_float_complex**)x,
-                                                          incx,
-                                                          (rocblas_float_complex**)y,
-                                                          incy,
-                                                          batchCount,
-                                                          (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_cdotu_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_float_complex**)x,
+                                                              incx,
+                                                              (rocblas_float_complex**)y,
+                                                              incy,
+                                                              batchCount,
+                                                              (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1897,14 +2361,17 @@ hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotc_batched((rocblas_handle)handle,
-                                                          n,
-                                                          (rocblas_double_complex**)x,
-                                                          incx,
-                                                          (rocblas_double_complex**)y,
-                                                          incy,
-                                                          batchCount,
-                                                          (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_zdotc_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex**)x,
+                                                              incx,
+                                                              (rocblas_double_complex**)y,
+                                                              incy,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1921,14 +2388,17 @@ hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotu_batched((rocblas_handle)handle,
-                                                          n,
-                                                          (rocblas_double_complex**)x,
-                                                          incx,
-                                                          (rocblas_double_complex**)y,
-                                                          incy,
-                                                          batchCount,
-                                                          (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_zdotu_batched((rocblas_handle)handle,
+                                                              n,
+                                                              (rocblas_double_complex**)x,
+                                                              incx,
+                                                              (rocblas_double_complex**)y,
+                                                              incy,
+                                                              batchCount,
+                                                              (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -1948,16 +2418,19 @@ hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
                                           hipblasHalf*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_hdot_strided_batched((rocblas_handle)handle,
-                                                                 n,
-                                                                 (rocblas_half*)x,
-                                                                 incx,
-                                                                 stridex,
-                                                                 (rocblas_half*)y,
-                                                                 incy,
-                                                                 stridey,
-                                                                 batchCount,
-                                                                 (rocblas_half*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_hdot_strided_batched((rocblas_handle)handle,
+                                                                     n,
+                                                                     (rocblas_half*)x,
+                                                                     incx,
+                                                                     stridex,
+                                                                     (rocblas_half*)y,
+                                                                     incy,
+                                                                     stridey,
+                                                                     batchCount,
+                                                                     (rocblas_half*)result));
+    });
 }
 catch(...)
 {
@@ -1976,16 +2449,19 @@ hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                            hipblasBfloat16*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_bfdot_strided_batched((rocblas_handle)handle,
-                                                                  n,
-                                                                  (rocblas_bfloat16*)x,
-                                                                  incx,
-                                                                  stridex,
-                                                                  (rocblas_bfloat16*)y,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batchCount,
-                                                                  (rocblas_bfloat16*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_bfdot_strided_batched((rocblas_handle)handle,
+                                                                      n,
+                                                                      (rocblas_bfloat16*)x,
+                                                                      incx,
+                                                                      stridex,
+                                                                      (rocblas_bfloat16*)y,
+                                                                      incy,
+                                                                      stridey,
+                                                                      batchCount,
+                                                                      (rocblas_bfloat16*)result));
+    });
 }
 catch(...)
 {
@@ -2004,8 +2480,11 @@ hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                           float*          result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_sdot_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_sdot_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2024,8 +2503,11 @@ hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                           double*         result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_ddot_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_ddot_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2044,16 +2526,20 @@ hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotc_strided_batched((rocblas_handle)handle,
-                                                                  n,
-                                                                  (rocblas_float_complex*)x,
-                                                                  incx,
-                                                                  stridex,
-                                                                  (rocblas_float_complex*)y,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batchCount,
-                                                                  (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_cdotc_strided_batched((rocblas_handle)handle,
+                                          n,
+                                          (rocblas_float_complex*)x,
+                                          incx,
+                                          stridex,
+                                          (rocblas_float_complex*)y,
+                                          incy,
+                                          stridey,
+                                          batchCount,
+                                          (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -2072,16 +2558,20 @@ hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cdotu_strided_batched((rocblas_handle)handle,
-                                                                  n,
-                                                                  (rocblas_float_complex*)x,
-                                                                  incx,
-                                                                  stridex,
-                                                                  (rocblas_float_complex*)y,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batchCount,
-                                                                  (rocblas_float_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_cdotu_strided_batched((rocblas_handle)handle,
+                                          n,
+                                          (rocblas_float_complex*)x,
+                                          incx,
+                                          stridex,
+                                          (rocblas_float_complex*)y,
+                                          incy,
+                                          stridey,
+                                          batchCount,
+                                          (rocblas_float_complex*)result));
+    });
 }
 catch(...)
 {
@@ -2100,16 +2590,20 @@ hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotc_strided_batched((rocblas_handle)handle,
-                                                                  n,
-                                                                  (rocblas_double_complex*)x,
-                                                                  incx,
-                                                                  stridex,
-                                                                  (rocblas_double_complex*)y,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batchCount,
-                                                                  (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_zdotc_strided_batched((rocblas_handle)handle,
+                                          n,
+                                          (rocblas_double_complex*)x,
+                                          incx,
+                                          stridex,
+                                          (rocblas_double_complex*)y,
+                                          incy,
+                                          stridey,
+                                          batchCount,
+                                          (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -2128,16 +2622,20 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zdotu_strided_batched((rocblas_handle)handle,
-                                                                  n,
-                                                                  (rocblas_double_complex*)x,
-                                                                  incx,
-                                                                  stridex,
-                                                                  (rocblas_double_complex*)y,
-                                                                  incy,
-                                                                  stridey,
-                                                                  batchCount,
-                                                                  (rocblas_double_complex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_zdotu_strided_batched((rocblas_handle)handle,
+                                          n,
+                                          (rocblas_double_complex*)x,
+                                          incx,
+                                          stridex,
+                                          (rocblas_double_complex*)y,
+                                          incy,
+                                          stridey,
+                                          batchCount,
+                                          (rocblas_double_complex*)result));
+    });
 }
 catch(...)
 {
@@ -2148,7 +2646,10 @@ catch(...)
 hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_snrm2((rocblas_handle)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_snrm2((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -2159,7 +2660,9 @@ hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dnrm2((rocblas_handle)handle, n, x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dnrm2((rocblas_handle)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -2170,8 +2673,10 @@ hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_scnrm2((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_scnrm2((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -2182,8 +2687,11 @@ hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dznrm2((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dznrm2((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -2195,8 +2703,11 @@ hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_snrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_snrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2211,8 +2722,11 @@ hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                     double*             result)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dnrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dnrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2227,8 +2741,11 @@ hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                      float*                      result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_scnrm2_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_scnrm2_batched(
+            (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2243,8 +2760,15 @@ hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                      double*                           result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dznrm2_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dznrm2_batched((rocblas_handle)handle,
+                                                               n,
+                                                               (rocblas_double_complex* const*)x,
+                                                               incx,
+                                                               batchCount,
+                                                               result));
+    });
 }
 catch(...)
 {
@@ -2261,8 +2785,11 @@ hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
                                            float*          result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_snrm2_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_snrm2_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2278,8 +2805,11 @@ hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                            double*         result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dnrm2_strided_batched(
-        (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dnrm2_strided_batched(
+            (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
+    });
 }
 catch(...)
 {
@@ -2295,8 +2825,16 @@ hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             float*                result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_scnrm2_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_scnrm2_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_float_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -2312,8 +2850,16 @@ hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                             double*                     result)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dznrm2_strided_batched(
-        (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_capture_result(handle, result, batchCount, [&](auto result) {
+        return rocBLASStatusToHIPStatus(rocblas_dznrm2_strided_batched((rocblas_handle)handle,
+                                                                       n,
+                                                                       (rocblas_double_complex*)x,
+                                                                       incx,
+                                                                       stridex,
+                                                                       batchCount,
+                                                                       result));
+    });
 }
 catch(...)
 {
@@ -2331,6 +2877,7 @@ hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                             const float*    s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(
         rocblas_srot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
 }
@@ -2349,6 +2896,7 @@ hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                             const double*   s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(
         rocblas_drot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
 }
@@ -2367,6 +2915,7 @@ hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                             const hipblasComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(rocblas_crot((rocblas_handle)handle,
                                                  n,
                                                  (rocblas_float_complex*)x,
@@ -2391,6 +2940,7 @@ hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                              const float*    s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(rocblas_csrot((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -2415,6 +2965,7 @@ hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                             const hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(rocblas_zrot((rocblas_handle)handle,
                                                  n,
                                                  (rocblas_double_complex*)x,
@@ -2439,6 +2990,7 @@ hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                              const double*         s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return rocBLASStatusToHIPStatus(rocblas_zdrot((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -2465,6 +3017,7 @@ hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                    int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_srot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
 }
@@ -2484,6 +3037,7 @@ hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                    int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_drot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
 }
@@ -2503,6 +3057,7 @@ hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                    int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_crot_batched((rocblas_handle)handle,
                                                          n,
                                                          (rocblas_float_complex**)x,
@@ -2529,6 +3084,7 @@ hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csrot_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -2555,6 +3111,7 @@ hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zrot_batched((rocblas_handle)handle,
                                                          n,
                                                          (rocblas_double_complex**)x,
@@ -2581,6 +3138,7 @@ hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zdrot_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -2610,6 +3168,7 @@ hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_srot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
 }
@@ -2631,6 +3190,7 @@ hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_drot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
 }
@@ -2652,6 +3212,7 @@ hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_crot_strided_batched((rocblas_handle)handle,
                                                                  n,
                                                                  (rocblas_float_complex*)x,
@@ -2682,6 +3243,7 @@ hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csrot_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -2712,6 +3274,7 @@ hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zrot_strided_batched((rocblas_handle)handle,
                                                                  n,
                                                                  (rocblas_double_complex*)x,
@@ -2742,6 +3305,7 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zdrot_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -2763,6 +3327,7 @@ catch(...)
 hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return rocBLASStatusToHIPStatus(rocblas_srotg((rocblas_handle)handle, a, b, c, s));
 }
 catch(...)
@@ -2773,6 +3338,7 @@ catch(...)
 hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return rocBLASStatusToHIPStatus(rocblas_drotg((rocblas_handle)handle, a, b, c, s));
 }
 catch(...)
@@ -2784,6 +3350,7 @@ hipblasStatus_t hipblasCrotg(
     hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return rocBLASStatusToHIPStatus(rocblas_crotg((rocblas_handle)handle,
                                                   (rocblas_float_complex*)a,
                                                   (rocblas_float_complex*)b,
@@ -2802,6 +3369,7 @@ hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
                              hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return rocBLASStatusToHIPStatus(rocblas_zrotg((rocblas_handle)handle,
                                                   (rocblas_double_complex*)a,
                                                   (rocblas_double_complex*)b,
@@ -2822,6 +3390,7 @@ hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_srotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
 }
@@ -2838,6 +3407,7 @@ hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_drotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
 }
@@ -2854,6 +3424,7 @@ hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_crotg_batched((rocblas_handle)handle,
                                                           (rocblas_float_complex**)a,
                                                           (rocblas_float_complex**)b,
@@ -2874,6 +3445,7 @@ hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zrotg_batched((rocblas_handle)handle,
                                                           (rocblas_double_complex**)a,
                                                           (rocblas_double_complex**)b,
@@ -2899,6 +3471,7 @@ hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_srotg_strided_batched(
         (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
 }
@@ -2919,6 +3492,7 @@ hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_drotg_strided_batched(
         (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
 }
@@ -2939,6 +3513,7 @@ hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_crotg_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_float_complex*)a,
                                                                   stride_a,
@@ -2967,6 +3542,7 @@ hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zrotg_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_double_complex*)a,
                                                                   stride_a,
@@ -2988,6 +3564,7 @@ hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param);
     return rocBLASStatusToHIPStatus(
         rocblas_srotm((rocblas_handle)handle, n, x, incx, y, incy, param));
 }
@@ -3000,6 +3577,7 @@ hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param);
     return rocBLASStatusToHIPStatus(
         rocblas_drotm((rocblas_handle)handle, n, x, incx, y, incy, param));
 }
@@ -3019,6 +3597,7 @@ hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_srotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
 }
@@ -3037,6 +3616,7 @@ hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_drotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
 }
@@ -3059,6 +3639,7 @@ hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, param, strideParam, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_srotm_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   x,
@@ -3089,6 +3670,7 @@ hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, param, strideParam, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_drotm_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   x,
@@ -3111,6 +3693,7 @@ hipblasStatus_t hipblasSrotmg(
     hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param);
     return rocBLASStatusToHIPStatus(rocblas_srotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -3122,6 +3705,7 @@ hipblasStatus_t hipblasDrotmg(
     hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param);
     return rocBLASStatusToHIPStatus(rocblas_drotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -3139,6 +3723,7 @@ hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_srotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
 }
@@ -3156,6 +3741,7 @@ hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_drotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
 }
@@ -3179,6 +3765,18 @@ hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     d1,
+                     stride_d1,
+                     d2,
+                     stride_d2,
+                     x1,
+                     stride_x1,
+                     y1,
+                     stride_y1,
+                     param,
+                     strideParam,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_srotmg_strided_batched((rocblas_handle)handle,
                                                                    d1,
                                                                    stride_d1,
@@ -3211,6 +3809,18 @@ hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     d1,
+                     stride_d1,
+                     d2,
+                     stride_d2,
+                     x1,
+                     stride_x1,
+                     y1,
+                     stride_y1,
+                     param,
+                     strideParam,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_drotmg_strided_batched((rocblas_handle)handle,
                                                                    d1,
                                                                    stride_d1,
@@ -3233,6 +3843,7 @@ catch(...)
 hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_sscal((rocblas_handle)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -3255,6 +3866,7 @@ hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_cscal(
         (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
 }
@@ -3282,6 +3894,7 @@ hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_zscal((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)alpha,
@@ -3297,6 +3910,7 @@ hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(
         rocblas_zdscal((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
 }
@@ -3310,6 +3924,7 @@ hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_sscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
 }
@@ -3322,6 +3937,7 @@ hipblasStatus_t hipblasDscalBatched(
     hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
 }
@@ -3338,6 +3954,7 @@ hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cscal_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex*)alpha,
@@ -3358,6 +3975,7 @@ hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zscal_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex*)alpha,
@@ -3378,6 +3996,7 @@ hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                      int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csscal_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
 }
@@ -3394,6 +4013,7 @@ hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zdscal_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
 }
@@ -3412,6 +4032,7 @@ hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sscal_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
 }
@@ -3429,6 +4050,7 @@ hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dscal_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
 }
@@ -3446,6 +4068,7 @@ hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cscal_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)alpha,
@@ -3468,6 +4091,7 @@ hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zscal_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)alpha,
@@ -3490,6 +4114,7 @@ hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csscal_strided_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
 }
@@ -3507,6 +4132,7 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zdscal_strided_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
 }
@@ -3519,6 +4145,7 @@ catch(...)
 hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_sswap((rocblas_handle)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -3541,6 +4168,7 @@ hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_cswap((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -3561,6 +4189,7 @@ hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zswap((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -3578,6 +4207,7 @@ hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_sswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -3590,6 +4220,7 @@ hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -3607,6 +4238,7 @@ hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cswap_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -3629,6 +4261,7 @@ hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zswap_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -3654,6 +4287,7 @@ hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sswap_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -3673,6 +4307,7 @@ hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dswap_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -3692,6 +4327,7 @@ hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cswap_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -3718,6 +4354,7 @@ hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zswap_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -3750,6 +4387,7 @@ hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3786,6 +4424,7 @@ hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3822,6 +4461,7 @@ hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3858,6 +4498,7 @@ hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3896,6 +4537,8 @@ hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -3934,6 +4577,8 @@ hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -3972,6 +4617,8 @@ hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4010,6 +4657,8 @@ hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4052,6 +4701,24 @@ hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4096,6 +4763,24 @@ hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4140,6 +4825,24 @@ hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4184,6 +4887,24 @@ hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4223,6 +4944,7 @@ hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_sgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4255,6 +4977,7 @@ hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4287,6 +5010,7 @@ hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_cgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4319,6 +5043,7 @@ hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4353,6 +5078,7 @@ hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4387,6 +5113,7 @@ hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4421,6 +5148,7 @@ hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4455,6 +5183,7 @@ hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4493,6 +5222,22 @@ hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4533,6 +5278,22 @@ hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4573,6 +5334,22 @@ hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4613,6 +5390,22 @@ hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4648,6 +5441,7 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(
         rocblas_sger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -4668,6 +5462,7 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(
         rocblas_dger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -4688,6 +5483,7 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_cgeru((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4716,6 +5512,7 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_cgerc((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4744,6 +5541,7 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zgeru((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4772,6 +5570,7 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zgerc((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4802,6 +5601,7 @@ hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sger_batched(
         (rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount));
 }
@@ -4823,6 +5623,7 @@ hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dger_batched(
         (rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount));
 }
@@ -4844,6 +5645,7 @@ hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgeru_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4874,6 +5676,7 @@ hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgerc_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4904,6 +5707,7 @@ hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgeru_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4934,6 +5738,7 @@ hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgerc_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4968,6 +5773,8 @@ hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sger_strided_batched((rocblas_handle)handle,
                                                                  m,
                                                                  n,
@@ -5004,6 +5811,8 @@ hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dger_strided_batched((rocblas_handle)handle,
                                                                  m,
                                                                  n,
@@ -5040,6 +5849,8 @@ hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgeru_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5076,6 +5887,8 @@ hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgerc_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5112,6 +5925,8 @@ hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgeru_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5148,6 +5963,8 @@ hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgerc_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5183,6 +6000,7 @@ hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_chbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5215,6 +6033,7 @@ hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5249,6 +6068,7 @@ hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5283,6 +6103,7 @@ hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5321,6 +6142,22 @@ hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5361,6 +6198,22 @@ hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5397,6 +6250,7 @@ hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_chemv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5427,6 +6281,7 @@ hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zhemv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5459,6 +6314,7 @@ hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_chemv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5491,6 +6347,7 @@ hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zhemv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5527,6 +6384,21 @@ hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_chemv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5565,6 +6437,21 @@ hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zhemv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5597,6 +6484,7 @@ hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_cher((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -5621,6 +6509,7 @@ hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zher((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -5647,6 +6536,7 @@ hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cher_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -5673,6 +6563,7 @@ hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zher_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -5702,6 +6593,7 @@ hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cher_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -5732,6 +6624,7 @@ hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zher_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -5762,6 +6655,7 @@ hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_cher2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5790,6 +6684,7 @@ hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zher2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5820,6 +6715,7 @@ hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cher2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5850,6 +6746,7 @@ hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zher2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5884,6 +6781,8 @@ hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cher2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5920,6 +6819,8 @@ hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zher2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5953,6 +6854,7 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_chpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5981,6 +6883,7 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6011,6 +6914,7 @@ hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6041,6 +6945,7 @@ hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6075,6 +6980,8 @@ hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6111,6 +7018,8 @@ hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6141,6 +7050,7 @@ hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(rocblas_chpr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6163,6 +7073,7 @@ hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(rocblas_zhpr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6187,6 +7098,7 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -6211,6 +7123,7 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -6238,6 +7151,7 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -6266,6 +7180,7 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -6294,6 +7209,7 @@ hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                              hipblasComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return rocBLASStatusToHIPStatus(rocblas_chpr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6320,6 +7236,7 @@ hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6348,6 +7265,7 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6376,6 +7294,7 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6408,6 +7327,8 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chpr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6442,6 +7363,8 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6476,6 +7399,7 @@ hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -6498,6 +7422,7 @@ hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -6522,6 +7447,7 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6556,6 +7482,7 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6594,6 +7521,22 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6634,6 +7577,22 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6669,6 +7628,7 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_sspmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -6689,6 +7649,7 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dspmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -6711,6 +7672,7 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6741,6 +7703,7 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6775,6 +7738,8 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6811,6 +7776,8 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6841,6 +7808,7 @@ hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                             float*            AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(
         rocblas_sspr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP));
 }
@@ -6858,6 +7826,7 @@ hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                             double*           AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(
         rocblas_dspr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP));
 }
@@ -6875,6 +7844,7 @@ hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(rocblas_cspr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6897,6 +7867,7 @@ hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return rocBLASStatusToHIPStatus(rocblas_zspr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6921,6 +7892,7 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP, batchCount));
 }
@@ -6939,6 +7911,7 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP, batchCount));
 }
@@ -6957,6 +7930,7 @@ hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cspr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -6981,6 +7955,7 @@ hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zspr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7008,6 +7983,7 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7036,6 +8012,7 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7064,6 +8041,7 @@ hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7092,6 +8070,7 @@ hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7120,6 +8099,7 @@ hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                              float*            AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return rocBLASStatusToHIPStatus(
         rocblas_sspr2((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP));
 }
@@ -7139,6 +8119,7 @@ hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                              double*           AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return rocBLASStatusToHIPStatus(
         rocblas_dspr2((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP));
 }
@@ -7160,6 +8141,7 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspr2_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP, batchCount));
 }
@@ -7180,6 +8162,7 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspr2_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP, batchCount));
 }
@@ -7204,6 +8187,8 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sspr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7238,6 +8223,8 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dspr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7271,6 +8258,7 @@ hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_ssymv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -7292,6 +8280,7 @@ hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dsymv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -7313,6 +8302,7 @@ hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_csymv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -7343,6 +8333,7 @@ hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zsymv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -7375,6 +8366,7 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7407,6 +8399,7 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7439,6 +8432,7 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7471,6 +8465,7 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7507,6 +8502,21 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7545,6 +8555,21 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7583,6 +8608,21 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7621,6 +8661,21 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7653,6 +8708,7 @@ hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda));
 }
@@ -7671,6 +8727,7 @@ hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda));
 }
@@ -7689,6 +8746,7 @@ hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_csyr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -7713,6 +8771,7 @@ hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zsyr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -7739,6 +8798,7 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda, batchCount));
 }
@@ -7758,6 +8818,7 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda, batchCount));
 }
@@ -7777,6 +8838,7 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7803,6 +8865,7 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7832,6 +8895,7 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7862,6 +8926,7 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7892,6 +8957,7 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7922,6 +8988,7 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7952,6 +9019,7 @@ hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -7972,6 +9040,7 @@ hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -7992,6 +9061,7 @@ hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_csyr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -8020,6 +9090,7 @@ hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -8050,6 +9121,7 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8080,6 +9152,7 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8110,6 +9183,7 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8140,6 +9214,7 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8174,6 +9249,8 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8210,6 +9287,8 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8246,6 +9325,8 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8282,6 +9363,8 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8315,6 +9398,7 @@ hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_stbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8343,6 +9427,7 @@ hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dtbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8371,6 +9456,7 @@ hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ctbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8399,6 +9485,7 @@ hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ztbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8429,6 +9516,7 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_stbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8459,6 +9547,7 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_dtbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8489,6 +9578,7 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_ctbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8519,6 +9609,7 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_ztbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8552,6 +9643,8 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
     return rocBLASStatusToHIPStatus(
         rocblas_stbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8587,6 +9680,8 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
     return rocBLASStatusToHIPStatus(
         rocblas_dtbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8622,6 +9717,8 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
     return rocBLASStatusToHIPStatus(
         rocblas_ctbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8657,6 +9754,8 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
     return rocBLASStatusToHIPStatus(
         rocblas_ztbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8690,6 +9789,7 @@ hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_stbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8718,6 +9818,7 @@ hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dtbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8746,6 +9847,7 @@ hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ctbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8774,6 +9876,7 @@ hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ztbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8804,6 +9907,7 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_stbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8834,6 +9938,7 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dtbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8864,6 +9969,7 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ctbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8894,6 +10000,7 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ztbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8927,6 +10034,8 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_stbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8962,6 +10071,8 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dtbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8997,6 +10108,8 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ctbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9032,6 +10145,8 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ztbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9063,6 +10178,7 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_stpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9087,6 +10203,7 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dtpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9111,6 +10228,7 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ctpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9135,6 +10253,7 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ztpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9161,6 +10280,7 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_stpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9187,6 +10307,7 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dtpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9213,6 +10334,7 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ctpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9239,6 +10361,7 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ztpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9268,6 +10391,7 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_stpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9299,6 +10423,7 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dtpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9330,6 +10455,7 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ctpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9361,6 +10487,7 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ztpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9390,6 +10517,7 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_stpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9414,6 +10542,7 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dtpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9438,6 +10567,7 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ctpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9462,6 +10592,7 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ztpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9488,6 +10619,7 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_stpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9514,6 +10646,7 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dtpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9540,6 +10673,7 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ctpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9566,6 +10700,7 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ztpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9595,6 +10730,7 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_stpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9626,6 +10762,7 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dtpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9657,6 +10794,7 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ctpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9688,6 +10826,7 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ztpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9718,6 +10857,7 @@ hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_strmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9744,6 +10884,7 @@ hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dtrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9770,6 +10911,7 @@ hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ctrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9796,6 +10938,7 @@ hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_ztrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9824,6 +10967,7 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_strmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9852,6 +10996,7 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dtrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9880,6 +11025,7 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ctrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9908,6 +11054,7 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ztrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9939,6 +11086,7 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_strmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9972,6 +11120,7 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dtrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10005,6 +11154,7 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ctrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10038,6 +11188,7 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stridex, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ztrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10069,6 +11220,7 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10096,6 +11248,7 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10123,6 +11276,7 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10150,6 +11304,7 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10179,6 +11334,7 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10208,6 +11364,7 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10237,6 +11394,7 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10266,6 +11424,7 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10298,6 +11457,7 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10331,6 +11491,7 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10364,6 +11525,7 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10397,6 +11559,7 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10432,6 +11595,7 @@ hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_cherk((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -10462,6 +11626,7 @@ hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zherk((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -10494,6 +11659,7 @@ hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cherk_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10526,6 +11692,7 @@ hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zherk_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10561,6 +11728,8 @@ hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_cherk_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10598,6 +11767,8 @@ hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zherk_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10635,6 +11806,7 @@ hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_cherkx((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10669,6 +11841,7 @@ hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zherkx((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10705,6 +11878,7 @@ hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cherkx_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -10741,6 +11915,7 @@ hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zherkx_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -10781,6 +11956,23 @@ hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_cherkx_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -10824,6 +12016,23 @@ hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zherkx_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -10864,6 +12073,7 @@ hipblasStatus_t hipblasCher2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_cher2k((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10898,6 +12108,7 @@ hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zher2k((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10934,6 +12145,7 @@ hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cher2k_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -10970,6 +12182,7 @@ hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zher2k_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -11010,6 +12223,23 @@ hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_cher2k_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -11053,6 +12283,23 @@ hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zher2k_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -11093,6 +12340,7 @@ hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_ssymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11127,6 +12375,7 @@ hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_dsymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11161,6 +12410,7 @@ hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_csymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11195,6 +12445,7 @@ hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zsymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11231,6 +12482,7 @@ hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11267,6 +12519,7 @@ hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11303,6 +12556,7 @@ hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11339,6 +12593,7 @@ hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11379,6 +12634,23 @@ hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11421,6 +12693,23 @@ hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11463,6 +12752,23 @@ hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11505,6 +12811,23 @@ hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11542,6 +12865,7 @@ hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_ssyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11572,6 +12896,7 @@ hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_dsyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11602,6 +12927,7 @@ hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_csyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11632,6 +12958,7 @@ hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zsyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11664,6 +12991,7 @@ hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11696,6 +13024,7 @@ hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11728,6 +13057,7 @@ hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11760,6 +13090,7 @@ hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11795,6 +13126,8 @@ hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11832,6 +13165,8 @@ hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11869,6 +13204,8 @@ hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_csyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11906,6 +13243,8 @@ hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11943,6 +13282,7 @@ hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -11977,6 +13317,7 @@ hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12011,6 +13352,7 @@ hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_csyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12045,6 +13387,7 @@ hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12081,6 +13424,7 @@ hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12117,6 +13461,7 @@ hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12153,6 +13498,7 @@ hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12189,6 +13535,7 @@ hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12229,6 +13576,23 @@ hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12272,6 +13636,23 @@ hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12315,6 +13696,23 @@ hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_csyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12358,6 +13756,23 @@ hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12398,6 +13813,7 @@ hipblasStatus_t hipblasSsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_ssyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12432,6 +13848,7 @@ hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_dsyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12466,6 +13883,7 @@ hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_csyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12500,6 +13918,7 @@ hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zsyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12536,6 +13955,7 @@ hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ssyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12572,6 +13992,7 @@ hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dsyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12608,6 +14029,7 @@ hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_csyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12644,6 +14066,7 @@ hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zsyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12684,6 +14107,23 @@ hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12727,6 +14167,23 @@ hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12770,6 +14227,23 @@ hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_csyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12813,6 +14287,23 @@ hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12853,6 +14344,7 @@ hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_sgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -12887,6 +14379,7 @@ hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_dgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -12921,6 +14414,7 @@ hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_cgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -12955,6 +14449,7 @@ hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -12991,6 +14486,7 @@ hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13027,6 +14523,7 @@ hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13063,6 +14560,7 @@ hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13099,6 +14597,7 @@ hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13139,6 +14638,23 @@ hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_sgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13182,6 +14698,23 @@ hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13225,6 +14758,23 @@ hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_cgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13268,6 +14818,23 @@ hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_zgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13308,6 +14875,7 @@ hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_chemm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13342,6 +14910,7 @@ hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zhemm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13378,6 +14947,7 @@ hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chemm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13414,6 +14984,7 @@ hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhemm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13454,6 +15025,23 @@ hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_chemm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -13496,6 +15084,23 @@ hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zhemm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -13534,6 +15139,7 @@ hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return rocBLASStatusToHIPStatus(rocblas_strmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13566,6 +15172,7 @@ hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return rocBLASStatusToHIPStatus(rocblas_dtrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13598,6 +15205,7 @@ hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return rocBLASStatusToHIPStatus(rocblas_ctrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13630,6 +15238,7 @@ hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return rocBLASStatusToHIPStatus(rocblas_ztrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13664,6 +15273,7 @@ hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_strmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13698,6 +15308,7 @@ hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dtrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13732,6 +15343,7 @@ hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ctrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13766,6 +15378,7 @@ hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_ztrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13803,6 +15416,21 @@ hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_strmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13842,6 +15470,21 @@ hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_dtrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13881,6 +15524,21 @@ hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ctrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13920,6 +15578,21 @@ hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
     return rocBLASStatusToHIPStatus(
         rocblas_ztrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13957,6 +15630,7 @@ hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -13990,6 +15664,7 @@ hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14023,6 +15698,7 @@ hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14056,6 +15732,7 @@ hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14091,6 +15768,7 @@ hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14126,6 +15804,7 @@ hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14161,6 +15840,7 @@ hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                     int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14196,6 +15876,7 @@ hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14234,6 +15915,21 @@ hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14273,6 +15969,21 @@ hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14312,6 +16023,21 @@ hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14351,6 +16077,21 @@ hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14384,6 +16125,7 @@ hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                               int               ldinvA)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14409,6 +16151,7 @@ hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                               int               ldinvA)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14434,6 +16177,7 @@ hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                               int                   ldinvA)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14459,6 +16203,7 @@ hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                               int                         ldinvA)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14486,6 +16231,7 @@ hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
                                      int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14513,6 +16259,7 @@ hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                      int                 batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14540,6 +16287,7 @@ hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
                                      int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14567,6 +16315,7 @@ hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
                                      int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14597,6 +16346,8 @@ hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
                                             int               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14628,6 +16379,8 @@ hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
                                             int               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14659,6 +16412,8 @@ hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
                                             int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14690,6 +16445,8 @@ hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
                                             int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14721,6 +16478,7 @@ hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm(
         (rocblas_handle)handle, hipSideToHCCSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -14741,6 +16499,7 @@ hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm(
         (rocblas_handle)handle, hipSideToHCCSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -14761,6 +16520,7 @@ hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   m,
@@ -14789,6 +16549,7 @@ hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   m,
@@ -14819,6 +16580,7 @@ hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14849,6 +16611,7 @@ hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14879,6 +16642,7 @@ hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14909,6 +16673,7 @@ hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14943,6 +16708,8 @@ hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -14979,6 +16746,8 @@ hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15015,6 +16784,8 @@ hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15051,6 +16822,8 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15123,12 +16896,26 @@ hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_sgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf(
+                                        (rocblas_handle)handle, n, n, A, lda, ipiv, info)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_sgetrf_npvt((rocblas_handle)handle, n, n, A, lda, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt(
+                                        (rocblas_handle)handle, n, n, A, lda, info)));
 }
 catch(...)
 {
@@ -15139,12 +16926,26 @@ hipblasStatus_t hipblasDgetrf(
     hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_dgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf(
+                                        (rocblas_handle)handle, n, n, A, lda, ipiv, info)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_dgetrf_npvt((rocblas_handle)handle, n, n, A, lda, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt(
+                                        (rocblas_handle)handle, n, n, A, lda, info)));
 }
 catch(...)
 {
@@ -15155,12 +16956,37 @@ hipblasStatus_t hipblasCgetrf(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf(
-            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, ipiv, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex*)A,
+                                        lda,
+                                        ipiv,
+                                        info)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt(
-            (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex*)A,
+                                        lda,
+                                        info)));
 }
 catch(...)
 {
@@ -15175,12 +17001,37 @@ hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
                               int*                  info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_zgetrf(
-            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, ipiv, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex*)A,
+                                        lda,
+                                        ipiv,
+                                        info)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt(
-            (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, info)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    1,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex*)A,
+                                        lda,
+                                        info)));
 }
 catch(...)
 {
@@ -15197,12 +17048,34 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_batched(
-            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_batched,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_batched,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_batched(
+                                        (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
 }
 catch(...)
 {
@@ -15218,12 +17091,34 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_batched(
-            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_batched,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_batched,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_batched(
+                                        (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
 }
 catch(...)
 {
@@ -15239,20 +17134,40 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
-                                                              n,
-                                                              n,
-                                                              (rocblas_float_complex**)A,
-                                                              lda,
-                                                              ipiv,
-                                                              n,
-                                                              info,
-                                                              batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_batched,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex**)A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, (rocblas_float_complex**)A, lda, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_batched,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex**)A,
+                                        lda,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15268,20 +17183,40 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
-                                                              n,
-                                                              n,
-                                                              (rocblas_double_complex**)A,
-                                                              lda,
-                                                              ipiv,
-                                                              n,
-                                                              info,
-                                                              batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_batched,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex**)A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, (rocblas_double_complex**)A, lda, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_batched,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex**)A,
+                                        lda,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15300,12 +17235,42 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_strided_batched,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        ipiv,
+                                        strideP,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_strided_batched,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15323,12 +17288,42 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_strided_batched,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        ipiv,
+                                        strideP,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_strided_batched,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15346,28 +17341,42 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
-                                                                      n,
-                                                                      n,
-                                                                      (rocblas_float_complex*)A,
-                                                                      lda,
-                                                                      strideA,
-                                                                      ipiv,
-                                                                      strideP,
-                                                                      info,
-                                                                      batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_strided_batched,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex*)A,
+                                        lda,
+                                        strideA,
+                                        ipiv,
+                                        strideP,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_cgetrf_npvt_strided_batched((rocblas_handle)handle,
-                                                  n,
-                                                  n,
-                                                  (rocblas_float_complex*)A,
-                                                  lda,
-                                                  strideA,
-                                                  info,
-                                                  batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_strided_batched,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_float_complex*)A,
+                                        lda,
+                                        strideA,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15385,28 +17394,42 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
-                                                                      n,
-                                                                      n,
-                                                                      (rocblas_double_complex*)A,
-                                                                      lda,
-                                                                      strideA,
-                                                                      ipiv,
-                                                                      strideP,
-                                                                      info,
-                                                                      batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_strided_batched,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex*)A,
+                                        lda,
+                                        strideA,
+                                        ipiv,
+                                        strideP,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetrf_npvt_strided_batched((rocblas_handle)handle,
-                                                  n,
-                                                  n,
-                                                  (rocblas_double_complex*)A,
-                                                  lda,
-                                                  strideA,
-                                                  info,
-                                                  batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getrf_npvt_strided_batched,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt_strided_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        n,
+                                        (rocblas_double_complex*)A,
+                                        lda,
+                                        strideA,
+                                        info,
+                                        batch_count)));
 }
 catch(...)
 {
@@ -15426,6 +17449,8 @@ hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15445,8 +17470,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrs(
-        (rocblas_handle)handle, hipOperationToHCCOperation(trans), n, nrhs, A, lda, ipiv, B, ldb)));
+    return HIPBLAS_SOLVER_ALLOC(getrs,
+                                's',
+                                n,
+                                n,
+                                nrhs,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_sgetrs(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    B,
+                                    ldb)));
 }
 catch(...)
 {
@@ -15465,6 +17504,8 @@ hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15484,8 +17525,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrs(
-        (rocblas_handle)handle, hipOperationToHCCOperation(trans), n, nrhs, A, lda, ipiv, B, ldb)));
+    return HIPBLAS_SOLVER_ALLOC(getrs,
+                                'd',
+                                n,
+                                n,
+                                nrhs,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_dgetrs(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    B,
+                                    ldb)));
 }
 catch(...)
 {
@@ -15504,6 +17559,8 @@ hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15523,16 +17580,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgetrs((rocblas_handle)handle,
-                                                  hipOperationToHCCOperation(trans),
-                                                  n,
-                                                  nrhs,
-                                                  (rocblas_float_complex*)A,
-                                                  lda,
-                                                  ipiv,
-                                                  (rocblas_float_complex*)B,
-                                                  ldb)));
+    return HIPBLAS_SOLVER_ALLOC(getrs,
+                                'c',
+                                n,
+                                n,
+                                nrhs,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_cgetrs(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    ipiv,
+                                    (rocblas_float_complex*)B,
+                                    ldb)));
 }
 catch(...)
 {
@@ -15551,6 +17614,8 @@ hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15570,16 +17635,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgetrs((rocblas_handle)handle,
-                                                  hipOperationToHCCOperation(trans),
-                                                  n,
-                                                  nrhs,
-                                                  (rocblas_double_complex*)A,
-                                                  lda,
-                                                  ipiv,
-                                                  (rocblas_double_complex*)B,
-                                                  ldb)));
+    return HIPBLAS_SOLVER_ALLOC(getrs,
+                                'z',
+                                n,
+                                n,
+                                nrhs,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_zgetrs(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    ipiv,
+                                    (rocblas_double_complex*)B,
+                                    ldb)));
 }
 catch(...)
 {
@@ -15600,6 +17671,8 @@ hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15621,18 +17694,24 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_sgetrs_batched((rocblas_handle)handle,
-                                                          hipOperationToHCCOperation(trans),
-                                                          n,
-                                                          nrhs,
-                                                          A,
-                                                          lda,
-                                                          ipiv,
-                                                          n,
-                                                          B,
-                                                          ldb,
-                                                          batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_batched,
+                                's',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_sgetrs_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    n,
+                                    B,
+                                    ldb,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15652,6 +17731,8 @@ hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15673,18 +17754,24 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_dgetrs_batched((rocblas_handle)handle,
-                                                          hipOperationToHCCOperation(trans),
-                                                          n,
-                                                          nrhs,
-                                                          A,
-                                                          lda,
-                                                          ipiv,
-                                                          n,
-                                                          B,
-                                                          ldb,
-                                                          batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_batched,
+                                'd',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_dgetrs_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    ipiv,
+                                    n,
+                                    B,
+                                    ldb,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15704,6 +17791,8 @@ hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15725,18 +17814,24 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgetrs_batched((rocblas_handle)handle,
-                                                          hipOperationToHCCOperation(trans),
-                                                          n,
-                                                          nrhs,
-                                                          (rocblas_float_complex**)A,
-                                                          lda,
-                                                          ipiv,
-                                                          n,
-                                                          (rocblas_float_complex**)B,
-                                                          ldb,
-                                                          batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_batched,
+                                'c',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgetrs_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_float_complex**)A,
+                                    lda,
+                                    ipiv,
+                                    n,
+                                    (rocblas_float_complex**)B,
+                                    ldb,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15756,6 +17851,8 @@ hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15777,18 +17874,24 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgetrs_batched((rocblas_handle)handle,
-                                                          hipOperationToHCCOperation(trans),
-                                                          n,
-                                                          nrhs,
-                                                          (rocblas_double_complex**)A,
-                                                          lda,
-                                                          ipiv,
-                                                          n,
-                                                          (rocblas_double_complex**)B,
-                                                          ldb,
-                                                          batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_batched,
+                                'z',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgetrs_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_double_complex**)A,
+                                    lda,
+                                    ipiv,
+                                    n,
+                                    (rocblas_double_complex**)B,
+                                    ldb,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15812,6 +17915,9 @@ hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15833,20 +17939,26 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_sgetrs_strided_batched((rocblas_handle)handle,
-                                                                  hipOperationToHCCOperation(trans),
-                                                                  n,
-                                                                  nrhs,
-                                                                  A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  ipiv,
-                                                                  strideP,
-                                                                  B,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_strided_batched,
+                                's',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_sgetrs_strided_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    ipiv,
+                                    strideP,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15869,6 +17981,9 @@ hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15890,20 +18005,26 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_dgetrs_strided_batched((rocblas_handle)handle,
-                                                                  hipOperationToHCCOperation(trans),
-                                                                  n,
-                                                                  nrhs,
-                                                                  A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  ipiv,
-                                                                  strideP,
-                                                                  B,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_strided_batched,
+                                'd',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_dgetrs_strided_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    ipiv,
+                                    strideP,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15926,6 +18047,9 @@ hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -15947,20 +18071,26 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgetrs_strided_batched((rocblas_handle)handle,
-                                                                  hipOperationToHCCOperation(trans),
-                                                                  n,
-                                                                  nrhs,
-                                                                  (rocblas_float_complex*)A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  ipiv,
-                                                                  strideP,
-                                                                  (rocblas_float_complex*)B,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_strided_batched,
+                                'c',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgetrs_strided_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    strideA,
+                                    ipiv,
+                                    strideP,
+                                    (rocblas_float_complex*)B,
+                                    ldb,
+                                    strideB,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -15983,6 +18113,9 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(n < 0)
@@ -16004,20 +18137,398 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgetrs_strided_batched((rocblas_handle)handle,
-                                                                  hipOperationToHCCOperation(trans),
-                                                                  n,
-                                                                  nrhs,
-                                                                  (rocblas_double_complex*)A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  ipiv,
-                                                                  strideP,
-                                                                  (rocblas_double_complex*)B,
-                                                                  ldb,
-                                                                  strideB,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(getrs_strided_batched,
+                                'z',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgetrs_strided_batched(
+                                    (rocblas_handle)handle,
+                                    hipOperationToHCCOperation(trans),
+                                    n,
+                                    nrhs,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    strideA,
+                                    ipiv,
+                                    strideP,
+                                    (rocblas_double_complex*)B,
+                                    ldb,
+                                    strideB,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    float* const    A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    float* const    B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(
+        gesv_batched,
+        's',
+        n,
+        n,
+        nrhs,
+        batch_count,
+        rocBLASStatusToHIPStatus(rocsolver_sgesv_batched(
+            (rocblas_handle)handle, n, nrhs, A, lda, pivots, n, B, ldb, info, batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    double* const   A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    double* const   B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(
+        gesv_batched,
+        'd',
+        n,
+        n,
+        nrhs,
+        batch_count,
+        rocBLASStatusToHIPStatus(rocsolver_dgesv_batched(
+            (rocblas_handle)handle, n, nrhs, A, lda, pivots, n, B, ldb, info, batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    int*                  ipiv,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    const int             batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_batched,
+                                'c',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgesv_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    (rocblas_float_complex* const*)A,
+                                    lda,
+                                    pivots,
+                                    n,
+                                    (rocblas_float_complex* const*)B,
+                                    ldb,
+                                    info,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    int*                        ipiv,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    const int                   batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_batched,
+                                'z',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgesv_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    (rocblas_double_complex* const*)A,
+                                    lda,
+                                    pivots,
+                                    n,
+                                    (rocblas_double_complex* const*)B,
+                                    ldb,
+                                    info,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // The pivots of the scratch memory are packed
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_strided_batched,
+                                's',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_sgesv_strided_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    pivots,
+                                    ipiv ? strideP : n,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    info,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // The pivots of the scratch memory are packed
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_strided_batched,
+                                'd',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_dgesv_strided_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    pivots,
+                                    ipiv ? strideP : n,
+                                    B,
+                                    ldb,
+                                    strideB,
+                                    info,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // The pivots of the scratch memory are packed
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_strided_batched,
+                                'c',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgesv_strided_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    strideA,
+                                    pivots,
+                                    ipiv ? strideP : n,
+                                    (rocblas_float_complex*)B,
+                                    ldb,
+                                    strideB,
+                                    info,
+                                    batch_count)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           int*                  ipiv,
+                                           const hipblasStride   strideP,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           const int             batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // The pivots of the scratch memory are packed
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    return HIPBLAS_SOLVER_ALLOC(gesv_strided_batched,
+                                'z',
+                                n,
+                                n,
+                                nrhs,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgesv_strided_batched(
+                                    (rocblas_handle)handle,
+                                    n,
+                                    nrhs,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    strideA,
+                                    pivots,
+                                    ipiv ? strideP : n,
+                                    (rocblas_double_complex*)B,
+                                    ldb,
+                                    strideB,
+                                    info,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16036,11 +18547,34 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetri_outofplace_batched(
-            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getri_outofplace_batched,
+                                    's',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_sgetri_outofplace_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        C,
+                                        ldc,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(
+        return HIPBLAS_SOLVER_ALLOC(
+            getri_npvt_outofplace_batched,
+            's',
+            n,
+            n,
+            0,
+            batch_count,
             rocBLASStatusToHIPStatus(rocsolver_sgetri_npvt_outofplace_batched(
                 (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
 }
@@ -16060,11 +18594,34 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetri_outofplace_batched(
-            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getri_outofplace_batched,
+                                    'd',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_dgetri_outofplace_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        C,
+                                        ldc,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(
+        return HIPBLAS_SOLVER_ALLOC(
+            getri_npvt_outofplace_batched,
+            'd',
+            n,
+            n,
+            0,
+            batch_count,
             rocBLASStatusToHIPStatus(rocsolver_dgetri_npvt_outofplace_batched(
                 (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
 }
@@ -16084,28 +18641,43 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
-                                                                         n,
-                                                                         (rocblas_float_complex**)A,
-                                                                         lda,
-                                                                         ipiv,
-                                                                         n,
-                                                                         (rocblas_float_complex**)C,
-                                                                         ldc,
-                                                                         info,
-                                                                         batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getri_outofplace_batched,
+                                    'c',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_cgetri_outofplace_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        (rocblas_float_complex**)A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        (rocblas_float_complex**)C,
+                                        ldc,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_cgetri_npvt_outofplace_batched((rocblas_handle)handle,
-                                                     n,
-                                                     (rocblas_float_complex**)A,
-                                                     lda,
-                                                     (rocblas_float_complex**)C,
-                                                     ldc,
-                                                     info,
-                                                     batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(
+            getri_npvt_outofplace_batched,
+            'c',
+            n,
+            n,
+            0,
+            batch_count,
+            rocBLASStatusToHIPStatus(rocsolver_cgetri_npvt_outofplace_batched(
+                (rocblas_handle)handle,
+                n,
+                (rocblas_float_complex**)A,
+                lda,
+                (rocblas_float_complex**)C,
+                ldc,
+                info,
+                batch_count)));
 }
 catch(...)
 {
@@ -16123,28 +18695,43 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
+
     if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
-                                                n,
-                                                (rocblas_double_complex**)A,
-                                                lda,
-                                                ipiv,
-                                                n,
-                                                (rocblas_double_complex**)C,
-                                                ldc,
-                                                info,
-                                                batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(getri_outofplace_batched,
+                                    'z',
+                                    n,
+                                    n,
+                                    0,
+                                    batch_count,
+                                    rocBLASStatusToHIPStatus(rocsolver_zgetri_outofplace_batched(
+                                        (rocblas_handle)handle,
+                                        n,
+                                        (rocblas_double_complex**)A,
+                                        lda,
+                                        ipiv,
+                                        n,
+                                        (rocblas_double_complex**)C,
+                                        ldc,
+                                        info,
+                                        batch_count)));
     else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetri_npvt_outofplace_batched((rocblas_handle)handle,
-                                                     n,
-                                                     (rocblas_double_complex**)A,
-                                                     lda,
-                                                     (rocblas_double_complex**)C,
-                                                     ldc,
-                                                     info,
-                                                     batch_count)));
+        return HIPBLAS_SOLVER_ALLOC(
+            getri_npvt_outofplace_batched,
+            'z',
+            n,
+            n,
+            0,
+            batch_count,
+            rocBLASStatusToHIPStatus(rocsolver_zgetri_npvt_outofplace_batched(
+                (rocblas_handle)handle,
+                n,
+                (rocblas_double_complex**)A,
+                lda,
+                (rocblas_double_complex**)C,
+                ldc,
+                info,
+                batch_count)));
 }
 catch(...)
 {
@@ -16161,6 +18748,8 @@ hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16176,8 +18765,14 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf,
+                                's',
+                                m,
+                                n,
+                                0,
+                                1,
+                                rocBLASStatusToHIPStatus(
+                                    rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
 }
 catch(...)
 {
@@ -16193,6 +18788,8 @@ hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16208,8 +18805,14 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf,
+                                'd',
+                                m,
+                                n,
+                                0,
+                                1,
+                                rocBLASStatusToHIPStatus(
+                                    rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
 }
 catch(...)
 {
@@ -16225,6 +18828,8 @@ hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16240,13 +18845,19 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgeqrf((rocblas_handle)handle,
-                                                  m,
-                                                  n,
-                                                  (rocblas_float_complex*)A,
-                                                  lda,
-                                                  (rocblas_float_complex*)tau)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf,
+                                'c',
+                                m,
+                                n,
+                                0,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_cgeqrf(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    (rocblas_float_complex*)tau)));
 }
 catch(...)
 {
@@ -16262,6 +18873,8 @@ hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
                               int*                  info)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16277,13 +18890,19 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgeqrf((rocblas_handle)handle,
-                                                  m,
-                                                  n,
-                                                  (rocblas_double_complex*)A,
-                                                  lda,
-                                                  (rocblas_double_complex*)tau)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf,
+                                'z',
+                                m,
+                                n,
+                                0,
+                                1,
+                                rocBLASStatusToHIPStatus(rocsolver_zgeqrf(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    (rocblas_double_complex*)tau)));
 }
 catch(...)
 {
@@ -16301,6 +18920,8 @@ hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16318,8 +18939,14 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-        rocsolver_sgeqrf_ptr_batched((rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_ptr_batched,
+                                's',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_sgeqrf_ptr_batched(
+                                    (rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
 }
 catch(...)
 {
@@ -16336,6 +18963,8 @@ hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16353,8 +18982,14 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-        rocsolver_dgeqrf_ptr_batched((rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_ptr_batched,
+                                'd',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_dgeqrf_ptr_batched(
+                                    (rocblas_handle)handle, m, n, A, lda, tau, batch_count)));
 }
 catch(...)
 {
@@ -16371,6 +19006,8 @@ hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16388,14 +19025,20 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgeqrf_ptr_batched((rocblas_handle)handle,
-                                                              m,
-                                                              n,
-                                                              (rocblas_float_complex**)A,
-                                                              lda,
-                                                              (rocblas_float_complex**)tau,
-                                                              batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_ptr_batched,
+                                'c',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgeqrf_ptr_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_float_complex**)A,
+                                    lda,
+                                    (rocblas_float_complex**)tau,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16412,6 +19055,8 @@ hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16429,14 +19074,20 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgeqrf_ptr_batched((rocblas_handle)handle,
-                                                              m,
-                                                              n,
-                                                              (rocblas_double_complex**)A,
-                                                              lda,
-                                                              (rocblas_double_complex**)tau,
-                                                              batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_ptr_batched,
+                                'z',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgeqrf_ptr_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_double_complex**)A,
+                                    lda,
+                                    (rocblas_double_complex**)tau,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16456,6 +19107,8 @@ hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, tau, strideT, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16473,8 +19126,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgeqrf_strided_batched(
-        (rocblas_handle)handle, m, n, A, lda, strideA, tau, strideT, batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_strided_batched,
+                                's',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_sgeqrf_strided_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    tau,
+                                    strideT,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16493,6 +19160,8 @@ hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, tau, strideT, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16510,8 +19179,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgeqrf_strided_batched(
-        (rocblas_handle)handle, m, n, A, lda, strideA, tau, strideT, batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_strided_batched,
+                                'd',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_dgeqrf_strided_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    A,
+                                    lda,
+                                    strideA,
+                                    tau,
+                                    strideT,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16530,6 +19213,8 @@ hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, tau, strideT, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16547,16 +19232,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_cgeqrf_strided_batched((rocblas_handle)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (rocblas_float_complex*)A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  (rocblas_float_complex*)tau,
-                                                                  strideT,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_strided_batched,
+                                'c',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_cgeqrf_strided_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_float_complex*)A,
+                                    lda,
+                                    strideA,
+                                    (rocblas_float_complex*)tau,
+                                    strideT,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16575,6 +19266,8 @@ hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
                                             const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, tau, strideT, info, batch_count);
+
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16592,16 +19285,22 @@ try
     else
         *info = 0;
 
-    return HIPBLAS_DEMAND_ALLOC(
-        rocBLASStatusToHIPStatus(rocsolver_zgeqrf_strided_batched((rocblas_handle)handle,
-                                                                  m,
-                                                                  n,
-                                                                  (rocblas_double_complex*)A,
-                                                                  lda,
-                                                                  strideA,
-                                                                  (rocblas_double_complex*)tau,
-                                                                  strideT,
-                                                                  batch_count)));
+    return HIPBLAS_SOLVER_ALLOC(geqrf_strided_batched,
+                                'z',
+                                m,
+                                n,
+                                0,
+                                batch_count,
+                                rocBLASStatusToHIPStatus(rocsolver_zgeqrf_strided_batched(
+                                    (rocblas_handle)handle,
+                                    m,
+                                    n,
+                                    (rocblas_double_complex*)A,
+                                    lda,
+                                    strideA,
+                                    (rocblas_double_complex*)tau,
+                                    strideT,
+                                    batch_count)));
 }
 catch(...)
 {
@@ -16627,6 +19326,7 @@ hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return rocBLASStatusToHIPStatus(rocblas_hgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -16663,6 +19363,8 @@ hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_R_32F);
     return rocBLASStatusToHIPStatus(rocblas_sgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -16699,6 +19401,8 @@ hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_R_64F);
     return rocBLASStatusToHIPStatus(rocblas_dgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -16735,6 +19439,8 @@ hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_C_32F);
     return rocBLASStatusToHIPStatus(rocblas_cgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -16771,6 +19477,8 @@ hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_C_64F);
     return rocBLASStatusToHIPStatus(rocblas_zgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -16809,6 +19517,8 @@ hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_hgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -16847,6 +19557,8 @@ hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_sgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -16885,6 +19597,8 @@ hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_dgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -16923,6 +19637,8 @@ hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_cgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -16961,6 +19677,8 @@ hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return rocBLASStatusToHIPStatus(rocblas_zgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17003,6 +19721,25 @@ hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
     {
@@ -17060,6 +19797,25 @@ hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17127,6 +19883,25 @@ hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17194,6 +19969,25 @@ hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17261,6 +20055,25 @@ hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17333,12 +20146,80 @@ hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasGemmAlgo_t  algo)
 try
 {
-    uint32_t           solution_index = 0;
-    rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     compute_type,
+                     algo);
+
+    hipblasStatus_t coalesce_status;
+    if(hipblas_coalesce_gemm(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             a_type,
+                             lda,
+                             B,
+                             b_type,
+                             ldb,
+                             beta,
+                             C,
+                             c_type,
+                             ldc,
+                             compute_type,
+                             algo,
+                             coalesce_status))
+        return coalesce_status;
+
+    // A solution chosen by hipblasGemmExTune for this problem takes precedence
+    hipblas_tuning_key tuning_key = hipblas_make_tuning_key(
+        transa, transb, m, n, k, lda, ldb, ldc, a_type, b_type, c_type, compute_type);
+    int tuned_solution;
+    if(algo == HIPBLAS_GEMM_DEFAULT && hipblas_find_tuned_gemm(tuning_key, tuned_solution))
+        return hipblas_gemm_ex_solution(handle,
+                                        transa,
+                                        transb,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_type,
+                                        lda,
+                                        B,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        c_type,
+                                        ldc,
+                                        compute_type,
+                                        tuned_solution);
 
-    rocblas_status status = rocblas_query_int8_layout_flag((rocblas_handle)handle, &flags);
-    if(status != rocblas_status_success)
-        return rocBLASStatusToHIPStatus(status);
+    uint32_t solution_index = 0;
+    uint32_t flags;
+
+    hipblasStatus_t status = hipblasGemmExFlags(handle, a_type, b_type, &flags);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
 
     return rocBLASStatusToHIPStatus(rocblas_gemm_ex((rocblas_handle)handle,
                                                     hipOperationToHCCOperation(transa),
@@ -17370,6 +20251,179 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+} // extern "C"
+
+// Declared in coalesce.hpp, so not extern "C"
+hipblasStatus_t hipblas_get_stream(hipblasHandle_t handle, hipStream_t* stream)
+{
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    return rocBLASStatusToHIPStatus(rocblas_get_stream((rocblas_handle)handle, stream));
+}
+
+// Declared in tuning.hpp, so not extern "C"
+hipblasStatus_t hipblas_gemm_ex_solution(hipblasHandle_t    handle,
+                                         hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         hipblasDatatype_t  a_type,
+                                         int                lda,
+                                         const void*        B,
+                                         hipblasDatatype_t  b_type,
+                                         int                ldb,
+                                         const void*        beta,
+                                         void*              C,
+                                         hipblasDatatype_t  c_type,
+                                         int                ldc,
+                                         hipblasDatatype_t  compute_type,
+                                         int                solution)
+try
+{
+    uint32_t        flags;
+    hipblasStatus_t status = hipblasGemmExFlags(handle, a_type, b_type, &flags);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return rocBLASStatusToHIPStatus(rocblas_gemm_ex((rocblas_handle)handle,
+                                                    hipOperationToHCCOperation(transa),
+                                                    hipOperationToHCCOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    A,
+                                                    HIPDatatypeToRocblasDatatype(a_type),
+                                                    lda,
+                                                    B,
+                                                    HIPDatatypeToRocblasDatatype(b_type),
+                                                    ldb,
+                                                    beta,
+                                                    C,
+                                                    HIPDatatypeToRocblasDatatype(c_type),
+                                                    ldc,
+                                                    C,
+                                                    HIPDatatypeToRocblasDatatype(c_type),
+                                                    ldc,
+                                                    HIPDatatypeToRocblasDatatype(compute_type),
+                                                    rocblas_gemm_algo_solution_index,
+                                                    solution,
+                                                    flags));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmExGetSolutions(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  a_type,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int                ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo,
+                                          int*               solutions,
+                                          int*               size)
+try
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     compute_type,
+                     algo,
+                     solutions,
+                     size);
+
+    if(!size || (solutions && *size < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    HIPGemmAlgoToRocblasGemmAlgo(algo); // throws for an invalid algo
+
+    uint32_t        flags;
+    hipblasStatus_t status = hipblasGemmExFlags(handle, a_type, b_type, &flags);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // rocBLAS reports the number of solutions only when asked without a list
+    auto get_solutions = [&](rocblas_int* list, rocblas_int* list_size) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_gemm_ex_get_solutions((rocblas_handle)handle,
+                                          hipOperationToHCCOperation(transa),
+                                          hipOperationToHCCOperation(transb),
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          HIPDatatypeToRocblasDatatype(a_type),
+                                          lda,
+                                          B,
+                                          HIPDatatypeToRocblasDatatype(b_type),
+                                          ldb,
+                                          beta,
+                                          C,
+                                          HIPDatatypeToRocblasDatatype(c_type),
+                                          ldc,
+                                          C,
+                                          HIPDatatypeToRocblasDatatype(c_type),
+                                          ldc,
+                                          HIPDatatypeToRocblasDatatype(compute_type),
+                                          rocblas_gemm_algo_solution_index,
+                                          flags,
+                                          list,
+                                          list_size));
+    };
+
+    rocblas_int count = 0;
+    status            = get_solutions(nullptr, &count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !solutions)
+    {
+        *size = count;
+        return status;
+    }
+
+    rocblas_int list_size = std::min(*size, count);
+    status                = get_solutions(solutions, &list_size);
+    *size                 = status == HIPBLAS_STATUS_SUCCESS ? list_size : 0;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasOperation_t transa,
                                      hipblasOperation_t transb,
@@ -17392,8 +20446,33 @@ hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     batch_count,
+                     compute_type,
+                     algo);
+
     uint32_t solution_index = 0;
-    uint32_t flags          = 0;
+    uint32_t flags;
+
+    hipblasStatus_t status = hipblasGemmExFlags(handle, a_type, b_type, &flags);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
 
     return rocBLASStatusToHIPStatus(
         rocblas_gemm_batched_ex((rocblas_handle)handle,
@@ -17452,8 +20531,36 @@ hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     stride_A,
+                     B,
+                     b_type,
+                     ldb,
+                     stride_B,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     stride_C,
+                     batch_count,
+                     compute_type,
+                     algo);
+
     uint32_t solution_index = 0;
-    uint32_t flags          = 0;
+    uint32_t flags;
+
+    hipblasStatus_t status = hipblasGemmExFlags(handle, a_type, b_type, &flags);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
 
     return rocBLASStatusToHIPStatus(
         rocblas_gemm_strided_batched_ex((rocblas_handle)handle,
@@ -17509,6 +20616,21 @@ hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     invA,
+                     invA_size,
+                     compute_type);
     return rocBLASStatusToHIPStatus(rocblas_trsm_ex((rocblas_handle)handle,
                                                     hipSideToHCCSide(side),
                                                     hipFillToHCCFill(uplo),
@@ -17548,6 +20670,22 @@ hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
                                      hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     batch_count,
+                     invA,
+                     invA_size,
+                     compute_type);
     return rocBLASStatusToHIPStatus(
         rocblas_trsm_batched_ex((rocblas_handle)handle,
                                 hipSideToHCCSide(side),
@@ -17592,6 +20730,25 @@ hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     batch_count,
+                     invA,
+                     invA_size,
+                     stride_invA,
+                     compute_type);
     return rocBLASStatusToHIPStatus(
         rocblas_trsm_strided_batched_ex((rocblas_handle)handle,
                                         hipSideToHCCSide(side),
@@ -17678,6 +20835,7 @@ hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, executionType);
     return rocBLASStatusToHIPStatus(rocblas_axpy_ex((rocblas_handle)handle,
                                                     n,
                                                     alpha,
@@ -17709,6 +20867,8 @@ hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, batch_count, executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_axpy_batched_ex((rocblas_handle)handle,
                                 n,
@@ -17744,6 +20904,20 @@ hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     alphaType,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_axpy_strided_batched_ex((rocblas_handle)handle,
                                         n,
@@ -17779,17 +20953,22 @@ hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dot_ex((rocblas_handle)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToRocblasDatatype(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToRocblasDatatype(yType),
-                                                   incy,
-                                                   result,
-                                                   HIPDatatypeToRocblasDatatype(resultType),
-                                                   HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dot_ex((rocblas_handle)handle,
+                           n,
+                           x,
+                           HIPDatatypeToRocblasDatatype(xType),
+                           incx,
+                           y,
+                           HIPDatatypeToRocblasDatatype(yType),
+                           incy,
+                           result,
+                           HIPDatatypeToRocblasDatatype(resultType),
+                           HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17809,17 +20988,22 @@ hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_dotc_ex((rocblas_handle)handle,
-                                                    n,
-                                                    x,
-                                                    HIPDatatypeToRocblasDatatype(xType),
-                                                    incx,
-                                                    y,
-                                                    HIPDatatypeToRocblasDatatype(yType),
-                                                    incy,
-                                                    result,
-                                                    HIPDatatypeToRocblasDatatype(resultType),
-                                                    HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dotc_ex((rocblas_handle)handle,
+                            n,
+                            x,
+                            HIPDatatypeToRocblasDatatype(xType),
+                            incx,
+                            y,
+                            HIPDatatypeToRocblasDatatype(yType),
+                            incy,
+                            result,
+                            HIPDatatypeToRocblasDatatype(resultType),
+                            HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17840,19 +21024,24 @@ hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dot_batched_ex((rocblas_handle)handle,
-                               n,
-                               x,
-                               HIPDatatypeToRocblasDatatype(xType),
-                               incx,
-                               y,
-                               HIPDatatypeToRocblasDatatype(yType),
-                               incy,
-                               batch_count,
-                               result,
-                               HIPDatatypeToRocblasDatatype(resultType),
-                               HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, batch_count, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dot_batched_ex((rocblas_handle)handle,
+                                   n,
+                                   x,
+                                   HIPDatatypeToRocblasDatatype(xType),
+                                   incx,
+                                   y,
+                                   HIPDatatypeToRocblasDatatype(yType),
+                                   incy,
+                                   batch_count,
+                                   result,
+                                   HIPDatatypeToRocblasDatatype(resultType),
+                                   HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17873,19 +21062,24 @@ hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dotc_batched_ex((rocblas_handle)handle,
-                                n,
-                                x,
-                                HIPDatatypeToRocblasDatatype(xType),
-                                incx,
-                                y,
-                                HIPDatatypeToRocblasDatatype(yType),
-                                incy,
-                                batch_count,
-                                result,
-                                HIPDatatypeToRocblasDatatype(resultType),
-                                HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, batch_count, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dotc_batched_ex((rocblas_handle)handle,
+                                    n,
+                                    x,
+                                    HIPDatatypeToRocblasDatatype(xType),
+                                    incx,
+                                    y,
+                                    HIPDatatypeToRocblasDatatype(yType),
+                                    incy,
+                                    batch_count,
+                                    result,
+                                    HIPDatatypeToRocblasDatatype(resultType),
+                                    HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17908,21 +21102,38 @@ hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dot_strided_batched_ex((rocblas_handle)handle,
-                                       n,
-                                       x,
-                                       HIPDatatypeToRocblasDatatype(xType),
-                                       incx,
-                                       stridex,
-                                       y,
-                                       HIPDatatypeToRocblasDatatype(yType),
-                                       incy,
-                                       stridey,
-                                       batch_count,
-                                       result,
-                                       HIPDatatypeToRocblasDatatype(resultType),
-                                       HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     result,
+                     resultType,
+                     executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dot_strided_batched_ex((rocblas_handle)handle,
+                                           n,
+                                           x,
+                                           HIPDatatypeToRocblasDatatype(xType),
+                                           incx,
+                                           stridex,
+                                           y,
+                                           HIPDatatypeToRocblasDatatype(yType),
+                                           incy,
+                                           stridey,
+                                           batch_count,
+                                           result,
+                                           HIPDatatypeToRocblasDatatype(resultType),
+                                           HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17945,21 +21156,38 @@ hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dotc_strided_batched_ex((rocblas_handle)handle,
-                                        n,
-                                        x,
-                                        HIPDatatypeToRocblasDatatype(xType),
-                                        incx,
-                                        stridex,
-                                        y,
-                                        HIPDatatypeToRocblasDatatype(yType),
-                                        incy,
-                                        stridey,
-                                        batch_count,
-                                        result,
-                                        HIPDatatypeToRocblasDatatype(resultType),
-                                        HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     result,
+                     resultType,
+                     executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_dotc_strided_batched_ex((rocblas_handle)handle,
+                                            n,
+                                            x,
+                                            HIPDatatypeToRocblasDatatype(xType),
+                                            incx,
+                                            stridex,
+                                            y,
+                                            HIPDatatypeToRocblasDatatype(yType),
+                                            incy,
+                                            stridey,
+                                            batch_count,
+                                            result,
+                                            HIPDatatypeToRocblasDatatype(resultType),
+                                            HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -17977,14 +21205,19 @@ hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_nrm2_ex((rocblas_handle)handle,
-                                                    n,
-                                                    x,
-                                                    HIPDatatypeToRocblasDatatype(xType),
-                                                    incx,
-                                                    result,
-                                                    HIPDatatypeToRocblasDatatype(resultType),
-                                                    HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_nrm2_ex((rocblas_handle)handle,
+                            n,
+                            x,
+                            HIPDatatypeToRocblasDatatype(xType),
+                            incx,
+                            result,
+                            HIPDatatypeToRocblasDatatype(resultType),
+                            HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -18002,16 +21235,20 @@ hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_nrm2_batched_ex((rocblas_handle)handle,
-                                n,
-                                x,
-                                HIPDatatypeToRocblasDatatype(xType),
-                                incx,
-                                batch_count,
-                                result,
-                                HIPDatatypeToRocblasDatatype(resultType),
-                                HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, batch_count, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_nrm2_batched_ex((rocblas_handle)handle,
+                                    n,
+                                    x,
+                                    HIPDatatypeToRocblasDatatype(xType),
+                                    incx,
+                                    batch_count,
+                                    result,
+                                    HIPDatatypeToRocblasDatatype(resultType),
+                                    HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -18030,17 +21267,22 @@ hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_nrm2_strided_batched_ex((rocblas_handle)handle,
-                                        n,
-                                        x,
-                                        HIPDatatypeToRocblasDatatype(xType),
-                                        incx,
-                                        stridex,
-                                        batch_count,
-                                        result,
-                                        HIPDatatypeToRocblasDatatype(resultType),
-                                        HIPDatatypeToRocblasDatatype(executionType)));
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, stridex, batch_count, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType) * batch_count;
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return rocBLASStatusToHIPStatus(
+            rocblas_nrm2_strided_batched_ex((rocblas_handle)handle,
+                                            n,
+                                            x,
+                                            HIPDatatypeToRocblasDatatype(xType),
+                                            incx,
+                                            stridex,
+                                            batch_count,
+                                            result,
+                                            HIPDatatypeToRocblasDatatype(resultType),
+                                            HIPDatatypeToRocblasDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -18062,6 +21304,7 @@ hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, c, s, csType, executionType);
     return rocBLASStatusToHIPStatus(rocblas_rot_ex((rocblas_handle)handle,
                                                    n,
                                                    x,
@@ -18095,6 +21338,8 @@ hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, c, s, csType, batch_count, executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_rot_batched_ex((rocblas_handle)handle,
                                n,
@@ -18132,6 +21377,21 @@ hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     c,
+                     s,
+                     csType,
+                     batch_count,
+                     executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_rot_strided_batched_ex((rocblas_handle)handle,
                                        n,
@@ -18165,6 +21425,7 @@ hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, executionType);
     return rocBLASStatusToHIPStatus(rocblas_scal_ex((rocblas_handle)handle,
                                                     n,
                                                     alpha,
@@ -18190,6 +21451,7 @@ hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, batch_count, executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_scal_batched_ex((rocblas_handle)handle,
                                 n,
@@ -18218,6 +21480,8 @@ hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, alphaType, x, xType, incx, stridex, batch_count, executionType);
     return rocBLASStatusToHIPStatus(
         rocblas_scal_strided_batched_ex((rocblas_handle)handle,
                                         n,
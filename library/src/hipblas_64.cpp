@@ -0,0 +1,2934 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// The _64 entry points, which take 64-bit sizes, increments and leading
+// dimensions. Neither backend has a 64-bit interface in the versions hipBLAS
+// supports, so a call whose sizes fit an int is passed on to the 32-bit entry
+// point as it is, and a larger one is split into pieces which fit. A split
+// reduction, or a split gemv, gemm, syrk or herk adding pieces of the product
+// into its output, runs in host pointer mode and waits for the device.
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+
+namespace
+{
+    // Split calls take at most this many elements, columns or batches at a
+    // time
+    constexpr int64_t piece_size = int64_t(1) << 30;
+
+    bool fits_int(std::initializer_list<int64_t> values)
+    {
+        for(int64_t value : values)
+            if(value < INT_MIN || value > INT_MAX)
+                return false;
+        return true;
+    }
+
+    // Offset of the first of the count elements from start on of a vector of
+    // n elements with increment inc, as BLAS addresses a vector of count
+    // elements: from its last element when inc is negative
+    int64_t vector_offset(int64_t n, int64_t inc, int64_t start, int64_t count)
+    {
+        return inc >= 0 ? start * inc : (n - start - count) * -inc;
+    }
+
+    // Call call(start, count) for consecutive pieces of n
+    template <typename F>
+    hipblasStatus_t for_each_piece(int64_t n, F&& call)
+    {
+        for(int64_t start = 0; start < n; start += piece_size)
+        {
+            hipblasStatus_t status = call(start, int(std::min(piece_size, n - start)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Call call(start, count) for the batches of a batched call, in pieces if
+    // batch_count does not fit an int
+    template <typename F>
+    hipblasStatus_t for_each_batch(int64_t batch_count, F&& call)
+    {
+        if(fits_int({batch_count}))
+            return call(0, int(batch_count));
+        return for_each_piece(batch_count, call);
+    }
+
+    template <typename T>
+    struct real_of
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_of<hipblasComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_of<hipblasDoubleComplex>
+    {
+        using type = double;
+    };
+
+    // Store one of type at value. Returns false for types gemm cannot compute
+    // in.
+    bool set_one(hipblasDatatype_t type, void* value)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+        {
+            uint16_t one = 0x3c00;
+            memcpy(value, &one, sizeof(one));
+            return true;
+        }
+        case HIPBLAS_R_32F:
+        case HIPBLAS_C_32F:
+        {
+            float one[2] = {1, 0};
+            memcpy(value, one, hipblas_datatype_size(type));
+            return true;
+        }
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_64F:
+        {
+            double one[2] = {1, 0};
+            memcpy(value, one, hipblas_datatype_size(type));
+            return true;
+        }
+        case HIPBLAS_R_32I:
+        {
+            int32_t one = 1;
+            memcpy(value, &one, sizeof(one));
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Copy size bytes between host and device memory after the work queued on
+    // the stream of handle, and wait for the copy
+    hipblasStatus_t copy_sync(
+        hipblasHandle_t handle, void* dst, const void* src, size_t size, hipMemcpyKind kind)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(hipMemcpyAsync(dst, src, size, kind, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Puts handle in host pointer mode for the scope, so that the results of
+    // the pieces of a split call can be combined on the host
+    class host_pointer_mode
+    {
+    public:
+        explicit host_pointer_mode(hipblasHandle_t handle)
+            : m_handle(handle)
+        {
+            m_status = hipblasGetPointerMode(handle, &m_mode);
+            if(m_status == HIPBLAS_STATUS_SUCCESS && m_mode == HIPBLAS_POINTER_MODE_DEVICE)
+                m_status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        }
+
+        ~host_pointer_mode()
+        {
+            if(m_status == HIPBLAS_STATUS_SUCCESS && m_mode == HIPBLAS_POINTER_MODE_DEVICE)
+                (void)hipblasSetPointerMode(m_handle, m_mode);
+        }
+
+        hipblasStatus_t status() const
+        {
+            return m_status;
+        }
+
+        // Copy a scalar argument of the call to value
+        hipblasStatus_t read(const void* scalar, void* value, size_t size) const
+        {
+            if(m_mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                memcpy(value, scalar, size);
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            return copy_sync(m_handle, value, scalar, size, hipMemcpyDeviceToHost);
+        }
+
+        // Store the result of the call
+        hipblasStatus_t write(void* result, const void* value, size_t size) const
+        {
+            if(m_mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                memcpy(result, value, size);
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            return copy_sync(m_handle, result, value, size, hipMemcpyHostToDevice);
+        }
+
+    private:
+        hipblasHandle_t      m_handle;
+        hipblasPointerMode_t m_mode = HIPBLAS_POINTER_MODE_HOST;
+        hipblasStatus_t      m_status;
+    };
+
+    // The pieces of a split reduction cannot be combined while capturing
+    hipblasStatus_t split_reduction_status(hipblasHandle_t handle)
+    {
+        return hipblas_is_capturing(handle) ? HIPBLAS_STATUS_NOT_SUPPORTED
+                                            : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Level 1 routines on one vector, or two of the same length. call(count,
+    // x_offset, y_offset) runs the 32-bit routine on a piece.
+    template <typename F>
+    hipblasStatus_t vectors_64(int64_t n, int64_t incx, int64_t incy, F&& call)
+    {
+        if(fits_int({n, incx, incy}))
+            return call(int(n), 0, 0);
+        if(!fits_int({incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        return for_each_piece(n, [&](int64_t start, int count) {
+            return call(
+                count, vector_offset(n, incx, start, count), vector_offset(n, incy, start, count));
+        });
+    }
+
+    // Sums, or the sums of squares for nrm2, over a vector or a pair of
+    // vectors. call(count, x_offset, y_offset, result) runs the 32-bit routine
+    // on a piece.
+    template <typename R, typename T, typename F>
+    hipblasStatus_t sum_64(hipblasHandle_t handle,
+                           int64_t         n,
+                           int64_t         incx,
+                           int64_t         incy,
+                           T*              result,
+                           bool            norm,
+                           F&&             call)
+    {
+        if(fits_int({n, incx, incy}))
+            return call(int(n), 0, 0, result);
+        if(!fits_int({incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasStatus_t status = split_reduction_status(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode mode(handle);
+        if(mode.status() != HIPBLAS_STATUS_SUCCESS)
+            return mode.status();
+
+        // Complex results are summed as pairs of reals
+        constexpr int parts = sizeof(T) / sizeof(R);
+        R             sum[parts] = {};
+        R             scale      = 0;
+
+        status = for_each_piece(n, [&](int64_t start, int count) {
+            T               piece;
+            hipblasStatus_t piece_status = call(count,
+                                                vector_offset(n, incx, start, count),
+                                                vector_offset(n, incy, start, count),
+                                                &piece);
+            if(piece_status != HIPBLAS_STATUS_SUCCESS)
+                return piece_status;
+
+            R value[parts];
+            memcpy(value, &piece, sizeof(piece));
+            if(!norm)
+            {
+                for(int i = 0; i < parts; i++)
+                    sum[i] += value[i];
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+
+            // Add the squares of the norms, scaled by the largest so far
+            R piece_norm = value[0];
+            if(piece_norm > scale)
+            {
+                sum[0] = 1 + sum[0] * (scale / piece_norm) * (scale / piece_norm);
+                scale  = piece_norm;
+            }
+            else if(piece_norm > 0)
+                sum[0] += (piece_norm / scale) * (piece_norm / scale);
+            return HIPBLAS_STATUS_SUCCESS;
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(norm)
+            sum[0] = scale * std::sqrt(sum[0]);
+        return mode.write(result, sum, sizeof(T));
+    }
+
+    template <typename T>
+    typename real_of<T>::type magnitude(const T& value)
+    {
+        using R = typename real_of<T>::type;
+
+        // |re| + |im| for complex values
+        R parts[sizeof(T) / sizeof(R)];
+        memcpy(parts, &value, sizeof(value));
+
+        R sum = 0;
+        for(R part : parts)
+            sum += std::abs(part);
+        return sum;
+    }
+
+    // iamax and iamin, the first element of largest or smallest magnitude
+    template <typename T>
+    hipblasStatus_t iamax_64(hipblasStatus_t (*iamax)(hipblasHandle_t, int, const T*, int, int*),
+                             bool            largest,
+                             hipblasHandle_t handle,
+                             int64_t         n,
+                             const T*        x,
+                             int64_t         incx,
+                             int64_t*        result)
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(fits_int({n, incx}))
+        {
+            if(mode == HIPBLAS_POINTER_MODE_HOST)
+            {
+                int index;
+                status  = iamax(handle, int(n), x, int(incx), &index);
+                *result = index;
+                return status;
+            }
+
+            // The index is never negative, so the 32-bit result written to the
+            // low half of the device result is widened by zeroing the high half
+            hipStream_t stream;
+            status = hipblasGetStream(handle, &stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            int* low = reinterpret_cast<int*>(result);
+            if(hipMemsetAsync(low + 1, 0, sizeof(int), stream) != hipSuccess)
+                return HIPBLAS_STATUS_EXECUTION_FAILED;
+            return iamax(handle, int(n), x, int(incx), low);
+        }
+        if(!fits_int({incx}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        status = split_reduction_status(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode host_mode(handle);
+        if(host_mode.status() != HIPBLAS_STATUS_SUCCESS)
+            return host_mode.status();
+
+        int64_t                   best           = 0;
+        typename real_of<T>::type best_magnitude = 0;
+
+        status = for_each_piece(n, [&](int64_t start, int count) {
+            int             index;
+            hipblasStatus_t piece_status = iamax(
+                handle, count, x + vector_offset(n, incx, start, count), int(incx), &index);
+            if(piece_status != HIPBLAS_STATUS_SUCCESS || index <= 0)
+                return piece_status;
+
+            // incx is positive if an index is returned
+            T value;
+            piece_status = copy_sync(handle,
+                                     &value,
+                                     x + (start + index - 1) * incx,
+                                     sizeof(T),
+                                     hipMemcpyDeviceToHost);
+            if(piece_status != HIPBLAS_STATUS_SUCCESS)
+                return piece_status;
+
+            auto value_magnitude = magnitude(value);
+            if(!best
+               || (largest ? value_magnitude > best_magnitude : value_magnitude < best_magnitude))
+            {
+                best           = start + index;
+                best_magnitude = value_magnitude;
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return host_mode.write(result, &best, sizeof(best));
+    }
+
+    // Read alpha and beta of a split call adding pieces into its output, and
+    // set one to the scalar the pieces after the first are added with
+    hipblasStatus_t read_scalars(const host_pointer_mode& mode,
+                                 const void*              alpha,
+                                 const void*              beta,
+                                 hipblasDatatype_t        type,
+                                 unsigned char*           host_alpha,
+                                 unsigned char*           host_beta,
+                                 unsigned char*           one)
+    {
+        if(mode.status() != HIPBLAS_STATUS_SUCCESS)
+            return mode.status();
+        if(!set_one(type, one))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size_t          size   = hipblas_datatype_size(type);
+        hipblasStatus_t status = mode.read(alpha, host_alpha, size);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = mode.read(beta, host_beta, size);
+        return status;
+    }
+
+    // gemv and the gemv of a batch. call(n, alpha, a_offset, x_offset, beta,
+    // y_offset) runs the 32-bit routine on a piece of the columns of A, the
+    // offsets being in elements.
+    template <typename F>
+    hipblasStatus_t gemv_64(hipblasHandle_t    handle,
+                            hipblasOperation_t trans,
+                            int64_t            m,
+                            int64_t            n,
+                            int64_t            lda,
+                            int64_t            incx,
+                            int64_t            incy,
+                            const void*        alpha,
+                            const void*        beta,
+                            hipblasDatatype_t  type,
+                            F&&                call)
+    {
+        if(fits_int({m, n, lda, incx, incy}))
+            return call(int(n), alpha, 0, 0, beta, 0);
+
+        // The rows of A never need splitting, as lda is at least m
+        if(!fits_int({m, lda, incx, incy}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(n < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // Pieces of the columns of A^T give pieces of y
+        if(trans != HIPBLAS_OP_N)
+            return for_each_piece(n, [&](int64_t start, int count) {
+                return call(
+                    count, alpha, start * lda, 0, beta, vector_offset(n, incy, start, count));
+            });
+
+        // Pieces of the columns of A are added into y
+        hipblasStatus_t status = split_reduction_status(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode mode(handle);
+        unsigned char     host_alpha[16], host_beta[16], one[16];
+        status = read_scalars(mode, alpha, beta, type, host_alpha, host_beta, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return for_each_piece(n, [&](int64_t start, int count) {
+            return call(count,
+                        host_alpha,
+                        start * lda,
+                        vector_offset(n, incx, start, count),
+                        start ? one : host_beta,
+                        0);
+        });
+    }
+
+    // gemm. call(m, n, k, alpha, a_offset, b_offset, beta, c_offset) runs the
+    // 32-bit routine on a piece of C, or of the sum making up C, the offsets
+    // being in elements.
+    template <typename F>
+    hipblasStatus_t gemm_64(hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int64_t            m,
+                            int64_t            n,
+                            int64_t            k,
+                            int64_t            lda,
+                            int64_t            ldb,
+                            int64_t            ldc,
+                            const void*        alpha,
+                            const void*        beta,
+                            hipblasDatatype_t  compute_type,
+                            F&&                call)
+    {
+        if(fits_int({m, n, k, lda, ldb, ldc}))
+            return call(int(m), int(n), int(k), alpha, 0, 0, beta, 0);
+
+        if(!fits_int({lda, ldb, ldc}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || k < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto run = [&](const void* run_alpha, const void* run_beta, const void* one) {
+            return for_each_piece(m, [&](int64_t row, int rows) {
+                return for_each_piece(n, [&](int64_t col, int cols) {
+                    return for_each_piece(std::max<int64_t>(k, 1), [&](int64_t i, int count) {
+                        int64_t a_offset = transa == HIPBLAS_OP_N ? row + i * lda : i + row * lda;
+                        int64_t b_offset = transb == HIPBLAS_OP_N ? i + col * ldb : col + i * ldb;
+                        return call(rows,
+                                    cols,
+                                    k ? count : 0,
+                                    run_alpha,
+                                    a_offset,
+                                    b_offset,
+                                    i ? one : run_beta,
+                                    row + col * ldc);
+                    });
+                });
+            });
+        };
+        if(k <= piece_size)
+            return run(alpha, beta, beta);
+
+        // Pieces of k are added into C
+        hipblasStatus_t status = split_reduction_status(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode mode(handle);
+        unsigned char     host_alpha[16], host_beta[16], one[16];
+        status = read_scalars(mode, alpha, beta, compute_type, host_alpha, host_beta, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return run(host_alpha, host_beta, one);
+    }
+
+    // gemmBatched. The matrices are given by device arrays of pointers, which
+    // cannot point into pieces of the matrices, so only the batch is split.
+    // call(start, count) runs the 32-bit routine on a piece of the batch.
+    template <typename F>
+    hipblasStatus_t gemm_batched_64(int64_t m,
+                                    int64_t n,
+                                    int64_t k,
+                                    int64_t lda,
+                                    int64_t ldb,
+                                    int64_t ldc,
+                                    int64_t batch_count,
+                                    F&&     call)
+    {
+        if(!fits_int({m, n, k, lda, ldb, ldc}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return for_each_batch(batch_count, call);
+    }
+
+    // Routines on an n by n matrix A are not split, as lda is at least n: a
+    // call whose sizes do not fit an int is invalid, or not supported
+    hipblasStatus_t square_status(int64_t n, int64_t lda, std::initializer_list<int64_t> values)
+    {
+        if(fits_int(values))
+            return HIPBLAS_STATUS_SUCCESS;
+        return n > lda ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // ger. call(n, y_offset, a_offset) runs the 32-bit routine on a piece of
+    // the columns of A, the offsets being in elements.
+    template <typename F>
+    hipblasStatus_t ger_64(int64_t m, int64_t n, int64_t incx, int64_t incy, int64_t lda, F&& call)
+    {
+        if(fits_int({m, n, incx, incy, lda}))
+            return call(int(n), 0, 0);
+
+        // The rows of A never need splitting, as lda is at least m
+        if(!fits_int({m, incx, incy, lda}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        return for_each_piece(n, [&](int64_t start, int count) {
+            return call(count, vector_offset(n, incy, start, count), start * lda);
+        });
+    }
+
+    // trsm. call(n, b_offset) runs the 32-bit routine on a piece of the
+    // columns of B, which are solved independently with A on the left, the
+    // offset being in elements.
+    template <typename F>
+    hipblasStatus_t trsm_64(
+        hipblasSideMode_t side, int64_t m, int64_t n, int64_t lda, int64_t ldb, F&& call)
+    {
+        if(fits_int({m, n, lda, ldb}))
+            return call(int(n), 0);
+
+        // A is m by m on the left and n by n on the right, and ldb is at least
+        // m, so only the columns of B on the left can be split
+        if(side != HIPBLAS_SIDE_LEFT)
+            return square_status(n, lda, {n, lda, m, ldb});
+        if(!fits_int({m, lda, ldb}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        return for_each_piece(n, [&](int64_t start, int count) {
+            return call(count, start * ldb);
+        });
+    }
+
+    // syrk and herk. call(k, alpha, a_offset, beta) runs the 32-bit routine on
+    // a piece of k, the offset being in elements. The pieces are added into C,
+    // with alpha and beta of type.
+    template <typename F>
+    hipblasStatus_t rank_k_64(hipblasHandle_t    handle,
+                              hipblasOperation_t trans,
+                              int64_t            n,
+                              int64_t            k,
+                              int64_t            lda,
+                              int64_t            ldc,
+                              const void*        alpha,
+                              const void*        beta,
+                              hipblasDatatype_t  type,
+                              F&&                call)
+    {
+        if(fits_int({n, k, lda, ldc}))
+            return call(int(k), alpha, 0, beta);
+
+        // C is n by n, so only k can be split
+        hipblasStatus_t status = square_status(n, ldc, {n, lda, ldc});
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(k < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // A is k by n when transposed, and lda is then smaller than k
+        if(trans != HIPBLAS_OP_N)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        status = split_reduction_status(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        host_pointer_mode mode(handle);
+        unsigned char     host_alpha[16], host_beta[16], one[16];
+        status = read_scalars(mode, alpha, beta, type, host_alpha, host_beta, one);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return for_each_piece(k, [&](int64_t start, int count) {
+            return call(count, host_alpha, start * lda, start ? one : host_beta);
+        });
+    }
+}
+
+hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const float*    alpha,
+                                const float*    x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasSaxpy(handle, count, alpha, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const double*   alpha,
+                                const double*   x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasDaxpy(handle, count, alpha, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasCaxpy(handle, count, alpha, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasZaxpy(handle, count, alpha, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasScopy(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasDcopy(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasCcopy(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasZcopy(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasSswap(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasDswap(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasCswap(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset) {
+        return hipblasZswap(handle, count, x + x_offset, int(incx), y + y_offset, int(incy));
+    };
+    return vectors_64(n, incx, incy, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasSscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasDscal_64(hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasDscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscal_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasCscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasCsscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasZscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t) {
+        return hipblasZdscal(handle, count, alpha, x + x_offset, int(incx));
+    };
+    return vectors_64(n, incx, incx, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset, float* piece_result) {
+        return hipblasSdot(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset, double* piece_result) {
+        return hipblasDdot(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset, hipblasComplex* piece_result) {
+        return hipblasCdotu(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t y_offset, hipblasComplex* piece_result) {
+        return hipblasCdotc(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    auto piece = [&](int                   count,
+                     int64_t               x_offset,
+                     int64_t               y_offset,
+                     hipblasDoubleComplex* piece_result) {
+        return hipblasZdotu(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+try
+{
+    auto piece = [&](int                   count,
+                     int64_t               x_offset,
+                     int64_t               y_offset,
+                     hipblasDoubleComplex* piece_result) {
+        return hipblasZdotc(
+            handle, count, x + x_offset, int(incx), y + y_offset, int(incy), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incy, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, float* piece_result) {
+        return hipblasSasum(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incx, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, double* piece_result) {
+        return hipblasDasum(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incx, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, float* piece_result) {
+        return hipblasScasum(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incx, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, double* piece_result) {
+        return hipblasDzasum(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incx, result, false, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, float* piece_result) {
+        return hipblasSnrm2(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incx, result, true, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, double* piece_result) {
+        return hipblasDnrm2(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incx, result, true, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, float* piece_result) {
+        return hipblasScnrm2(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<float>(handle, n, incx, incx, result, true, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+try
+{
+    auto piece = [&](int count, int64_t x_offset, int64_t, double* piece_result) {
+        return hipblasDznrm2(handle, count, x + x_offset, int(incx), piece_result);
+    };
+    return sum_64<double>(handle, n, incx, incx, result, true, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIsamax, true, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIdamax, true, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIcamax, true, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIzamax, true, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIsamin, false, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIdamin, false, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIcamin, false, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return iamax_64(hipblasIzamin, false, handle, n, x, incx, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                const float*       A,
+                                int64_t            lda,
+                                const float*       x,
+                                int64_t            incx,
+                                const float*       beta,
+                                float*             y,
+                                int64_t            incy)
+try
+{
+    auto piece = [&](int         cols,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     x_offset,
+                     const void* piece_beta,
+                     int64_t     y_offset) {
+        return hipblasSgemv(handle,
+                            trans,
+                            int(m),
+                            cols,
+                            (const float*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            x + x_offset,
+                            int(incx),
+                            (const float*)piece_beta,
+                            y + y_offset,
+                            int(incy));
+    };
+    return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_R_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                const double*      A,
+                                int64_t            lda,
+                                const double*      x,
+                                int64_t            incx,
+                                const double*      beta,
+                                double*            y,
+                                int64_t            incy)
+try
+{
+    auto piece = [&](int         cols,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     x_offset,
+                     const void* piece_beta,
+                     int64_t     y_offset) {
+        return hipblasDgemv(handle,
+                            trans,
+                            int(m),
+                            cols,
+                            (const double*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            x + x_offset,
+                            int(incx),
+                            (const double*)piece_beta,
+                            y + y_offset,
+                            int(incy));
+    };
+    return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_R_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    auto piece = [&](int         cols,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     x_offset,
+                     const void* piece_beta,
+                     int64_t     y_offset) {
+        return hipblasCgemv(handle,
+                            trans,
+                            int(m),
+                            cols,
+                            (const hipblasComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            x + x_offset,
+                            int(incx),
+                            (const hipblasComplex*)piece_beta,
+                            y + y_offset,
+                            int(incy));
+    };
+    return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_C_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    auto piece = [&](int         cols,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     x_offset,
+                     const void* piece_beta,
+                     int64_t     y_offset) {
+        return hipblasZgemv(handle,
+                            trans,
+                            int(m),
+                            cols,
+                            (const hipblasDoubleComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            x + x_offset,
+                            int(incx),
+                            (const hipblasDoubleComplex*)piece_beta,
+                            y + y_offset,
+                            int(incy));
+    };
+    return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_C_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         cols,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     x_offset,
+                         const void* piece_beta,
+                         int64_t     y_offset) {
+            return hipblasSgemvStridedBatched(handle,
+                                              trans,
+                                              int(m),
+                                              cols,
+                                              (const float*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              x + start * stridex + x_offset,
+                                              int(incx),
+                                              stridex,
+                                              (const float*)piece_beta,
+                                              y + start * stridey + y_offset,
+                                              int(incy),
+                                              stridey,
+                                              count);
+        };
+        return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_R_32F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t trans,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int64_t            incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int64_t            incy,
+                                              hipblasStride      stridey,
+                                              int64_t            batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         cols,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     x_offset,
+                         const void* piece_beta,
+                         int64_t     y_offset) {
+            return hipblasDgemvStridedBatched(handle,
+                                              trans,
+                                              int(m),
+                                              cols,
+                                              (const double*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              x + start * stridex + x_offset,
+                                              int(incx),
+                                              stridex,
+                                              (const double*)piece_beta,
+                                              y + start * stridey + y_offset,
+                                              int(incy),
+                                              stridey,
+                                              count);
+        };
+        return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_R_64F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    trans,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              hipblasStride         stridey,
+                                              int64_t               batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         cols,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     x_offset,
+                         const void* piece_beta,
+                         int64_t     y_offset) {
+            return hipblasCgemvStridedBatched(handle,
+                                              trans,
+                                              int(m),
+                                              cols,
+                                              (const hipblasComplex*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              x + start * stridex + x_offset,
+                                              int(incx),
+                                              stridex,
+                                              (const hipblasComplex*)piece_beta,
+                                              y + start * stridey + y_offset,
+                                              int(incy),
+                                              stridey,
+                                              count);
+        };
+        return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_C_32F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          trans,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int64_t                     incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              hipblasStride               stridey,
+                                              int64_t                     batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         cols,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     x_offset,
+                         const void* piece_beta,
+                         int64_t     y_offset) {
+            return hipblasZgemvStridedBatched(handle,
+                                              trans,
+                                              int(m),
+                                              cols,
+                                              (const hipblasDoubleComplex*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              x + start * stridex + x_offset,
+                                              int(incx),
+                                              stridex,
+                                              (const hipblasDoubleComplex*)piece_beta,
+                                              y + start * stridey + y_offset,
+                                              int(incy),
+                                              stridey,
+                                              count);
+        };
+        return gemv_64(handle, trans, m, n, lda, incx, incy, alpha, beta, HIPBLAS_C_64F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSger_64(hipblasHandle_t handle,
+                               int64_t         m,
+                               int64_t         n,
+                               const float*    alpha,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          A,
+                               int64_t         lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasSger(handle,
+                           int(m),
+                           cols,
+                           alpha,
+                           x,
+                           int(incx),
+                           y + y_offset,
+                           int(incy),
+                           A + a_offset,
+                           int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDger_64(hipblasHandle_t handle,
+                               int64_t         m,
+                               int64_t         n,
+                               const double*   alpha,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         A,
+                               int64_t         lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasDger(handle,
+                           int(m),
+                           cols,
+                           alpha,
+                           x,
+                           int(incx),
+                           y + y_offset,
+                           int(incy),
+                           A + a_offset,
+                           int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeru_64(hipblasHandle_t       handle,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       A,
+                                int64_t               lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasCgeru(handle,
+                            int(m),
+                            cols,
+                            alpha,
+                            x,
+                            int(incx),
+                            y + y_offset,
+                            int(incy),
+                            A + a_offset,
+                            int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgerc_64(hipblasHandle_t       handle,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       A,
+                                int64_t               lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasCgerc(handle,
+                            int(m),
+                            cols,
+                            alpha,
+                            x,
+                            int(incx),
+                            y + y_offset,
+                            int(incy),
+                            A + a_offset,
+                            int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeru_64(hipblasHandle_t             handle,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       A,
+                                int64_t                     lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasZgeru(handle,
+                            int(m),
+                            cols,
+                            alpha,
+                            x,
+                            int(incx),
+                            y + y_offset,
+                            int(incy),
+                            A + a_offset,
+                            int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgerc_64(hipblasHandle_t             handle,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       A,
+                                int64_t                     lda)
+try
+{
+    auto piece = [&](int cols, int64_t y_offset, int64_t a_offset) {
+        return hipblasZgerc(handle,
+                            int(m),
+                            cols,
+                            alpha,
+                            x,
+                            int(incx),
+                            y + y_offset,
+                            int(incy),
+                            A + a_offset,
+                            int(lda));
+    };
+    return ger_64(m, n, incx, incy, lda, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const float*      alpha,
+                                const float*      A,
+                                int64_t           lda,
+                                const float*      x,
+                                int64_t           incx,
+                                const float*      beta,
+                                float*            y,
+                                int64_t           incy)
+try
+{
+    hipblasStatus_t status = square_status(n, lda, {n, lda, incx, incy});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasSsymv(handle, uplo, int(n), alpha, A, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymv_64(hipblasHandle_t   handle,
+                                hipblasFillMode_t uplo,
+                                int64_t           n,
+                                const double*     alpha,
+                                const double*     A,
+                                int64_t           lda,
+                                const double*     x,
+                                int64_t           incx,
+                                const double*     beta,
+                                double*           y,
+                                int64_t           incy)
+try
+{
+    hipblasStatus_t status = square_status(n, lda, {n, lda, incx, incy});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDsymv(handle, uplo, int(n), alpha, A, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+try
+{
+    hipblasStatus_t status = square_status(n, lda, {n, lda, incx, incy});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasCsymv(handle, uplo, int(n), alpha, A, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+try
+{
+    hipblasStatus_t status = square_status(n, lda, {n, lda, incx, incy});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasZsymv(handle, uplo, int(n), alpha, A, int(lda), x, int(incx), beta, y, int(incy));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const float*       A,
+                                int64_t            lda,
+                                float*             x,
+                                int64_t            incx)
+try
+{
+    hipblasStatus_t status = square_status(m, lda, {m, lda, incx});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasStrsv(handle, uplo, transA, diag, int(m), A, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsv_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                const double*      A,
+                                int64_t            lda,
+                                double*            x,
+                                int64_t            incx)
+try
+{
+    hipblasStatus_t status = square_status(m, lda, {m, lda, incx});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDtrsv(handle, uplo, transA, diag, int(m), A, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsv_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                hipblasComplex*       x,
+                                int64_t               incx)
+try
+{
+    hipblasStatus_t status = square_status(m, lda, {m, lda, incx});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasCtrsv(handle, uplo, transA, diag, int(m), A, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsv_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+try
+{
+    hipblasStatus_t status = square_status(m, lda, {m, lda, incx});
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasZtrsv(handle, uplo, transA, diag, int(m), A, int(lda), x, int(incx));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       alpha,
+                                const float*       A,
+                                int64_t            lda,
+                                const float*       B,
+                                int64_t            ldb,
+                                const float*       beta,
+                                float*             C,
+                                int64_t            ldc)
+try
+{
+    auto piece = [&](int         rows,
+                     int         cols,
+                     int         depth,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     b_offset,
+                     const void* piece_beta,
+                     int64_t     c_offset) {
+        return hipblasSgemm(handle,
+                            transa,
+                            transb,
+                            rows,
+                            cols,
+                            depth,
+                            (const float*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb),
+                            (const float*)piece_beta,
+                            C + c_offset,
+                            int(ldc));
+    };
+    return gemm_64(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_R_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int64_t            m,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      alpha,
+                                const double*      A,
+                                int64_t            lda,
+                                const double*      B,
+                                int64_t            ldb,
+                                const double*      beta,
+                                double*            C,
+                                int64_t            ldc)
+try
+{
+    auto piece = [&](int         rows,
+                     int         cols,
+                     int         depth,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     b_offset,
+                     const void* piece_beta,
+                     int64_t     c_offset) {
+        return hipblasDgemm(handle,
+                            transa,
+                            transb,
+                            rows,
+                            cols,
+                            depth,
+                            (const double*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb),
+                            (const double*)piece_beta,
+                            C + c_offset,
+                            int(ldc));
+    };
+    return gemm_64(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_R_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                hipblasOperation_t    transa,
+                                hipblasOperation_t    transb,
+                                int64_t               m,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const hipblasComplex* B,
+                                int64_t               ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int64_t               ldc)
+try
+{
+    auto piece = [&](int         rows,
+                     int         cols,
+                     int         depth,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     b_offset,
+                     const void* piece_beta,
+                     int64_t     c_offset) {
+        return hipblasCgemm(handle,
+                            transa,
+                            transb,
+                            rows,
+                            cols,
+                            depth,
+                            (const hipblasComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb),
+                            (const hipblasComplex*)piece_beta,
+                            C + c_offset,
+                            int(ldc));
+    };
+    return gemm_64(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_C_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                hipblasOperation_t          transa,
+                                hipblasOperation_t          transb,
+                                int64_t                     m,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* B,
+                                int64_t                     ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int64_t                     ldc)
+try
+{
+    auto piece = [&](int         rows,
+                     int         cols,
+                     int         depth,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     b_offset,
+                     const void* piece_beta,
+                     int64_t     c_offset) {
+        return hipblasZgemm(handle,
+                            transa,
+                            transb,
+                            rows,
+                            cols,
+                            depth,
+                            (const hipblasDoubleComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb),
+                            (const hipblasDoubleComplex*)piece_beta,
+                            C + c_offset,
+                            int(ldc));
+    };
+    return gemm_64(
+        handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_C_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int64_t            m,
+                                       int64_t            n,
+                                       int64_t            k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int64_t            lda,
+                                       const float* const B[],
+                                       int64_t            ldb,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int64_t            ldc,
+                                       int64_t            batchCount)
+try
+{
+    auto piece = [&](int64_t start, int count) {
+        return hipblasSgemmBatched(handle,
+                                   transa,
+                                   transb,
+                                   int(m),
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   A + start,
+                                   int(lda),
+                                   B + start,
+                                   int(ldb),
+                                   beta,
+                                   C + start,
+                                   int(ldc),
+                                   count);
+    };
+    return gemm_batched_64(m, n, k, lda, ldb, ldc, batchCount, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transa,
+                                       hipblasOperation_t  transb,
+                                       int64_t             m,
+                                       int64_t             n,
+                                       int64_t             k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int64_t             lda,
+                                       const double* const B[],
+                                       int64_t             ldb,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int64_t             ldc,
+                                       int64_t             batchCount)
+try
+{
+    auto piece = [&](int64_t start, int count) {
+        return hipblasDgemmBatched(handle,
+                                   transa,
+                                   transb,
+                                   int(m),
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   A + start,
+                                   int(lda),
+                                   B + start,
+                                   int(ldb),
+                                   beta,
+                                   C + start,
+                                   int(ldc),
+                                   count);
+    };
+    return gemm_batched_64(m, n, k, lda, ldb, ldc, batchCount, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transa,
+                                       hipblasOperation_t          transb,
+                                       int64_t                     m,
+                                       int64_t                     n,
+                                       int64_t                     k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int64_t                     lda,
+                                       const hipblasComplex* const B[],
+                                       int64_t                     ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int64_t                     ldc,
+                                       int64_t                     batchCount)
+try
+{
+    auto piece = [&](int64_t start, int count) {
+        return hipblasCgemmBatched(handle,
+                                   transa,
+                                   transb,
+                                   int(m),
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   A + start,
+                                   int(lda),
+                                   B + start,
+                                   int(ldb),
+                                   beta,
+                                   C + start,
+                                   int(ldc),
+                                   count);
+    };
+    return gemm_batched_64(m, n, k, lda, ldb, ldc, batchCount, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transa,
+                                       hipblasOperation_t                transb,
+                                       int64_t                           m,
+                                       int64_t                           n,
+                                       int64_t                           k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int64_t                           lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int64_t                           ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int64_t                           ldc,
+                                       int64_t                           batchCount)
+try
+{
+    auto piece = [&](int64_t start, int count) {
+        return hipblasZgemmBatched(handle,
+                                   transa,
+                                   transb,
+                                   int(m),
+                                   int(n),
+                                   int(k),
+                                   alpha,
+                                   A + start,
+                                   int(lda),
+                                   B + start,
+                                   int(ldb),
+                                   beta,
+                                   C + start,
+                                   int(ldc),
+                                   count);
+    };
+    return gemm_batched_64(m, n, k, lda, ldb, ldc, batchCount, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const float*       B,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              const float*       beta,
+                                              float*             C,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         rows,
+                         int         cols,
+                         int         depth,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     b_offset,
+                         const void* piece_beta,
+                         int64_t     c_offset) {
+            return hipblasSgemmStridedBatched(handle,
+                                              transa,
+                                              transb,
+                                              rows,
+                                              cols,
+                                              depth,
+                                              (const float*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              B + start * strideB + b_offset,
+                                              int(ldb),
+                                              strideB,
+                                              (const float*)piece_beta,
+                                              C + start * strideC + c_offset,
+                                              int(ldc),
+                                              strideC,
+                                              count);
+        };
+        return gemm_64(
+            handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_R_32F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              hipblasStride      strideA,
+                                              const double*      B,
+                                              int64_t            ldb,
+                                              hipblasStride      strideB,
+                                              const double*      beta,
+                                              double*            C,
+                                              int64_t            ldc,
+                                              hipblasStride      strideC,
+                                              int64_t            batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         rows,
+                         int         cols,
+                         int         depth,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     b_offset,
+                         const void* piece_beta,
+                         int64_t     c_offset) {
+            return hipblasDgemmStridedBatched(handle,
+                                              transa,
+                                              transb,
+                                              rows,
+                                              cols,
+                                              depth,
+                                              (const double*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              B + start * strideB + b_offset,
+                                              int(ldb),
+                                              strideB,
+                                              (const double*)piece_beta,
+                                              C + start * strideC + c_offset,
+                                              int(ldc),
+                                              strideC,
+                                              count);
+        };
+        return gemm_64(
+            handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_R_64F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* B,
+                                              int64_t               ldb,
+                                              hipblasStride         strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc,
+                                              hipblasStride         strideC,
+                                              int64_t               batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         rows,
+                         int         cols,
+                         int         depth,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     b_offset,
+                         const void* piece_beta,
+                         int64_t     c_offset) {
+            return hipblasCgemmStridedBatched(handle,
+                                              transa,
+                                              transb,
+                                              rows,
+                                              cols,
+                                              depth,
+                                              (const hipblasComplex*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              B + start * strideB + b_offset,
+                                              int(ldb),
+                                              strideB,
+                                              (const hipblasComplex*)piece_beta,
+                                              C + start * strideC + c_offset,
+                                              int(ldc),
+                                              strideC,
+                                              count);
+        };
+        return gemm_64(
+            handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_C_32F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* B,
+                                              int64_t                     ldb,
+                                              hipblasStride               strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int64_t                     ldc,
+                                              hipblasStride               strideC,
+                                              int64_t                     batchCount)
+try
+{
+    return for_each_batch(batchCount, [&](int64_t start, int count) {
+        auto piece = [&](int         rows,
+                         int         cols,
+                         int         depth,
+                         const void* piece_alpha,
+                         int64_t     a_offset,
+                         int64_t     b_offset,
+                         const void* piece_beta,
+                         int64_t     c_offset) {
+            return hipblasZgemmStridedBatched(handle,
+                                              transa,
+                                              transb,
+                                              rows,
+                                              cols,
+                                              depth,
+                                              (const hipblasDoubleComplex*)piece_alpha,
+                                              A + start * strideA + a_offset,
+                                              int(lda),
+                                              strideA,
+                                              B + start * strideB + b_offset,
+                                              int(ldb),
+                                              strideB,
+                                              (const hipblasDoubleComplex*)piece_beta,
+                                              C + start * strideC + c_offset,
+                                              int(ldc),
+                                              strideC,
+                                              count);
+        };
+        return gemm_64(
+            handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, HIPBLAS_C_64F, piece);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrk_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int64_t            n,
+                                int64_t            k,
+                                const float*       alpha,
+                                const float*       A,
+                                int64_t            lda,
+                                const float*       beta,
+                                float*             C,
+                                int64_t            ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasSsyrk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const float*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const float*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_R_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrk_64(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int64_t            n,
+                                int64_t            k,
+                                const double*      alpha,
+                                const double*      A,
+                                int64_t            lda,
+                                const double*      beta,
+                                double*            C,
+                                int64_t            ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasDsyrk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const double*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const double*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_R_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrk_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int64_t               n,
+                                int64_t               k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int64_t               ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasCsyrk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const hipblasComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const hipblasComplex*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_C_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrk_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int64_t                     ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasZsyrk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const hipblasDoubleComplex*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const hipblasDoubleComplex*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_C_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherk_64(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int64_t               n,
+                                int64_t               k,
+                                const float*          alpha,
+                                const hipblasComplex* A,
+                                int64_t               lda,
+                                const float*          beta,
+                                hipblasComplex*       C,
+                                int64_t               ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasCherk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const float*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const float*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_R_32F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherk_64(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int64_t                     n,
+                                int64_t                     k,
+                                const double*               alpha,
+                                const hipblasDoubleComplex* A,
+                                int64_t                     lda,
+                                const double*               beta,
+                                hipblasDoubleComplex*       C,
+                                int64_t                     ldc)
+try
+{
+    auto piece = [&](int depth, const void* piece_alpha, int64_t a_offset, const void* piece_beta) {
+        return hipblasZherk(handle,
+                            uplo,
+                            transA,
+                            int(n),
+                            depth,
+                            (const double*)piece_alpha,
+                            A + a_offset,
+                            int(lda),
+                            (const double*)piece_beta,
+                            C,
+                            int(ldc));
+    };
+    return rank_k_64(handle, transA, n, k, lda, ldc, alpha, beta, HIPBLAS_R_64F, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const float*       alpha,
+                                float*             A,
+                                int64_t            lda,
+                                float*             B,
+                                int64_t            ldb)
+try
+{
+    auto piece = [&](int cols, int64_t b_offset) {
+        return hipblasStrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            int(m),
+                            cols,
+                            alpha,
+                            A,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb));
+    };
+    return trsm_64(side, m, n, lda, ldb, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsm_64(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int64_t            m,
+                                int64_t            n,
+                                const double*      alpha,
+                                double*            A,
+                                int64_t            lda,
+                                double*            B,
+                                int64_t            ldb)
+try
+{
+    auto piece = [&](int cols, int64_t b_offset) {
+        return hipblasDtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            int(m),
+                            cols,
+                            alpha,
+                            A,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb));
+    };
+    return trsm_64(side, m, n, lda, ldb, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsm_64(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int64_t               m,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                hipblasComplex*       A,
+                                int64_t               lda,
+                                hipblasComplex*       B,
+                                int64_t               ldb)
+try
+{
+    auto piece = [&](int cols, int64_t b_offset) {
+        return hipblasCtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            int(m),
+                            cols,
+                            alpha,
+                            A,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb));
+    };
+    return trsm_64(side, m, n, lda, ldb, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsm_64(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int64_t                     m,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       A,
+                                int64_t                     lda,
+                                hipblasDoubleComplex*       B,
+                                int64_t                     ldb)
+try
+{
+    auto piece = [&](int cols, int64_t b_offset) {
+        return hipblasZtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            int(m),
+                            cols,
+                            alpha,
+                            A,
+                            int(lda),
+                            B + b_offset,
+                            int(ldb));
+    };
+    return trsm_64(side, m, n, lda, ldb, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans_a,
+                                 hipblasOperation_t trans_b,
+                                 int64_t            m,
+                                 int64_t            n,
+                                 int64_t            k,
+                                 const void*        alpha,
+                                 const void*        a,
+                                 hipblasDatatype_t  a_type,
+                                 int64_t            lda,
+                                 const void*        b,
+                                 hipblasDatatype_t  b_type,
+                                 int64_t            ldb,
+                                 const void*        beta,
+                                 void*              c,
+                                 hipblasDatatype_t  c_type,
+                                 int64_t            ldc,
+                                 hipblasDatatype_t  compute_type,
+                                 hipblasGemmAlgo_t  algo)
+try
+{
+    auto piece = [&](int         rows,
+                     int         cols,
+                     int         depth,
+                     const void* piece_alpha,
+                     int64_t     a_offset,
+                     int64_t     b_offset,
+                     const void* piece_beta,
+                     int64_t     c_offset) {
+        return hipblasGemmEx(handle,
+                             trans_a,
+                             trans_b,
+                             rows,
+                             cols,
+                             depth,
+                             piece_alpha,
+                             (const char*)a + a_offset * hipblas_datatype_size(a_type),
+                             a_type,
+                             int(lda),
+                             (const char*)b + b_offset * hipblas_datatype_size(b_type),
+                             b_type,
+                             int(ldb),
+                             piece_beta,
+                             (char*)c + c_offset * hipblas_datatype_size(c_type),
+                             c_type,
+                             int(ldc),
+                             compute_type,
+                             algo);
+    };
+    return gemm_64(
+        handle, trans_a, trans_b, m, n, k, lda, ldb, ldc, alpha, beta, compute_type, piece);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
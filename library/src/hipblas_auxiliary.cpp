@@ -1,7 +1,9 @@
 /* ************************************************************************
  * Copyright 2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
-#include <hipblas.h>
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle.hpp"
 
 // Convert hipblas_status to string
 extern "C" const char* hipblasStatusToString(hipblasStatus_t status)
@@ -29,3 +31,72 @@ extern "C" const char* hipblasStatusToString(hipblasStatus_t status)
     // from our switch. If the value is not a valid hipblas_status, we return this string.
     return "<undefined hipblasStatus_t value>";
 }
+
+extern "C" hipblasStatus_t
+    hipblasGetWorkspaceCacheStats(hipblasHandle_t handle, size_t* hits, size_t* misses)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_get_handle_state(handle)->workspace_cache.get_stats(hits, misses);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasGetDevicePointerArray(hipblasHandle_t    handle,
+                                                        const void* const* host_array,
+                                                        int                count,
+                                                        void***            device_array)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!host_array || count <= 0 || !device_array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_handle_state* state = hipblas_get_handle_state(handle);
+    return state->pointer_arrays.get(host_array, count, stream, state->capture, device_array);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t
+    hipblasGetPointerArrayCacheStats(hipblasHandle_t handle, size_t* hits, size_t* misses)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_get_handle_state(handle)->pointer_arrays.get_stats(hits, misses);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" hipblasStatus_t hipblasClearPointerArrayCache(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_handle_state* state = hipblas_get_handle_state(handle);
+    state->pointer_arrays.clear(state->capture);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
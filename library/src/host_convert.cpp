@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Element conversions on the host (hipblas_host_convert in convert.hpp), for
+// the type converting transfers of the GPU backends and the conversions of the
+// host backend. The loops are written without branches so that the compiler
+// vectorizes them; on x86 the half conversions use F16C when the processor
+// has it, whether or not the compiler targets it.
+
+#include "convert.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HIPBLAS_HOST_F16C 1
+#endif
+
+namespace
+{
+    uint32_t float_bits(float f)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+    float bits_float(uint32_t bits)
+    {
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    // Round to nearest even; overflow goes to infinity and NaN stays a NaN
+    hipblasHalf float_to_half(float f)
+    {
+        constexpr uint32_t f16_overflow = (127 + 16) << 23;
+        constexpr uint32_t f16_normal   = (127 - 14) << 23;
+        constexpr uint32_t denorm_magic = ((127 - 15) + (23 - 10) + 1) << 23;
+
+        uint32_t bits = float_bits(f);
+        uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint32_t half;
+        if(bits >= f16_overflow)
+            half = bits > 0x7f800000u ? 0x7e00 : 0x7c00;
+        else if(bits < f16_normal)
+            // The addition rounds the subnormal into the low mantissa bits
+            half = float_bits(bits_float(bits) + bits_float(denorm_magic)) - denorm_magic;
+        else
+            half = (bits + (uint32_t(15 - 127) << 23) + 0xfff + ((bits >> 13) & 1)) >> 13;
+        return hipblasHalf(half | (sign >> 16));
+    }
+
+    float half_to_float(hipblasHalf h)
+    {
+        constexpr uint32_t shifted_exponent = 0x7c00u << 13;
+
+        uint32_t bits     = uint32_t(h & 0x7fff) << 13;
+        uint32_t exponent = bits & shifted_exponent;
+        bits += uint32_t(127 - 15) << 23;
+
+        float f;
+        if(exponent == shifted_exponent)
+            f = bits_float(bits + (uint32_t(128 - 16) << 23));
+        else if(exponent == 0)
+            // Renormalize a subnormal by subtracting the implicit bit
+            f = bits_float(bits + (1u << 23)) - bits_float(113u << 23);
+        else
+            f = bits_float(bits);
+        return bits_float(float_bits(f) | (uint32_t(h & 0x8000) << 16));
+    }
+
+    // Elements of type T as loaded to float, or double for double, and stored
+    // from either
+    template <typename T>
+    struct host_value;
+
+    template <>
+    struct host_value<float>
+    {
+        static constexpr double max = FLT_MAX;
+
+        static float load(float x)
+        {
+            return x;
+        }
+
+        template <typename W>
+        static float store(W x)
+        {
+            return float(x);
+        }
+    };
+
+    template <>
+    struct host_value<double>
+    {
+        static constexpr double max = DBL_MAX;
+
+        static double load(double x)
+        {
+            return x;
+        }
+
+        template <typename W>
+        static double store(W x)
+        {
+            return double(x);
+        }
+    };
+
+    template <>
+    struct host_value<hipblasHalf>
+    {
+        static constexpr double max = 65504.0;
+
+        static float load(hipblasHalf x)
+        {
+            return half_to_float(x);
+        }
+
+        template <typename W>
+        static hipblasHalf store(W x)
+        {
+            return float_to_half(float(x));
+        }
+    };
+
+    template <>
+    struct host_value<hipblasBfloat16>
+    {
+        static constexpr double max = 3.38953138925153547590470800371487866880e+38;
+
+        static float load(hipblasBfloat16 x)
+        {
+            return bits_float(uint32_t(x.data) << 16);
+        }
+
+        // Round to nearest even; NaN stays a quiet NaN
+        template <typename W>
+        static hipblasBfloat16 store(W x)
+        {
+            uint32_t        bits = float_bits(float(x));
+            hipblasBfloat16 b;
+            b.data = (bits & 0x7fffffff) > 0x7f800000
+                         ? uint16_t((bits >> 16) | 0x40)
+                         : uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+            return b;
+        }
+    };
+
+    template <>
+    struct host_value<int8_t>
+    {
+        static constexpr double max = 127.0;
+
+        static float load(int8_t x)
+        {
+            return x;
+        }
+
+        // Round to nearest and saturate; NaN is 0
+        template <typename W>
+        static int8_t store(W x)
+        {
+            W rounded = std::nearbyint(x);
+            return x != x ? 0 : int8_t(std::min(std::max(rounded, W(-128)), W(127)));
+        }
+    };
+
+    // Whether the finite x is beyond the range of D once rounded to it
+    template <typename D, typename W>
+    bool overflows(W x)
+    {
+        W magnitude = std::fabs(x);
+        if(std::is_same<D, int8_t>{})
+            return magnitude <= std::numeric_limits<W>::max() && (x >= W(127.5) || x < W(-128.5));
+        return magnitude > host_value<D>::max && magnitude <= std::numeric_limits<W>::max();
+    }
+
+    template <typename S, typename D>
+    bool convert_n(const S* src, D* dst, int64_t n)
+    {
+        bool over = false;
+        for(int64_t i = 0; i < n; i++)
+        {
+            auto x = host_value<S>::load(src[i]);
+            over |= overflows<D>(x);
+            dst[i] = host_value<D>::store(x);
+        }
+        return over;
+    }
+
+#if HIPBLAS_HOST_F16C
+    bool has_f16c()
+    {
+        static const bool has = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+        return has;
+    }
+
+    __attribute__((target("avx,f16c"))) void
+        float_to_half_f16c(const float* src, hipblasHalf* dst, int64_t n)
+    {
+        int64_t i = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst + i),
+                _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+        for(; i < n; i++)
+            dst[i] = float_to_half(src[i]);
+    }
+
+    __attribute__((target("avx,f16c"))) void
+        half_to_float_f16c(const hipblasHalf* src, float* dst, int64_t n)
+    {
+        int64_t i = 0;
+        for(; i + 8 <= n; i += 8)
+            _mm256_storeu_ps(
+                dst + i,
+                _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        for(; i < n; i++)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    template <>
+    bool convert_n<float, hipblasHalf>(const float* src, hipblasHalf* dst, int64_t n)
+    {
+        if(has_f16c())
+            float_to_half_f16c(src, dst, n);
+        else
+            for(int64_t i = 0; i < n; i++)
+                dst[i] = float_to_half(src[i]);
+
+        bool over = false;
+        for(int64_t i = 0; i < n; i++)
+            over |= overflows<hipblasHalf>(src[i]);
+        return over;
+    }
+
+    template <>
+    bool convert_n<hipblasHalf, float>(const hipblasHalf* src, float* dst, int64_t n)
+    {
+        if(has_f16c())
+            half_to_float_f16c(src, dst, n);
+        else
+            for(int64_t i = 0; i < n; i++)
+                dst[i] = half_to_float(src[i]);
+        return false;
+    }
+#endif
+
+    template <typename S>
+    bool convert_from(const S* src, hipblasDatatype_t dst_type, void* dst, int64_t n)
+    {
+        switch(dst_type)
+        {
+        case HIPBLAS_R_16F:
+            return convert_n(src, static_cast<hipblasHalf*>(dst), n);
+        case HIPBLAS_R_16B:
+            return convert_n(src, static_cast<hipblasBfloat16*>(dst), n);
+        case HIPBLAS_R_8I:
+            return convert_n(src, static_cast<int8_t*>(dst), n);
+        case HIPBLAS_R_32F:
+        case HIPBLAS_C_32F:
+            return convert_n(src, static_cast<float*>(dst), n);
+        default:
+            return convert_n(src, static_cast<double*>(dst), n);
+        }
+    }
+}
+
+bool hipblas_host_convert(hipblasDatatype_t src_type,
+                          const void*       src,
+                          hipblasDatatype_t dst_type,
+                          void*             dst,
+                          int64_t           n)
+{
+    // A complex element is converted as two reals
+    if(src_type == HIPBLAS_C_32F || src_type == HIPBLAS_C_64F)
+        n *= 2;
+
+    switch(src_type)
+    {
+    case HIPBLAS_R_16F:
+        return convert_from(static_cast<const hipblasHalf*>(src), dst_type, dst, n);
+    case HIPBLAS_R_16B:
+        return convert_from(static_cast<const hipblasBfloat16*>(src), dst_type, dst, n);
+    case HIPBLAS_R_8I:
+        return convert_from(static_cast<const int8_t*>(src), dst_type, dst, n);
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return convert_from(static_cast<const float*>(src), dst_type, dst, n);
+    default:
+        return convert_from(static_cast<const double*>(src), dst_type, dst, n);
+    }
+}
@@ -0,0 +1,361 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Handles and data movement of the host backend. All memory is host memory
+// and every call completes before it returns, so streams are only recorded.
+
+#include "host_kernels.hpp"
+#include "staging.hpp"
+#include <new>
+
+namespace
+{
+    // Copy rows x cols elements of elem_size bytes between column-major matrices
+    rocblas_status copy_matrix(rocblas_int rows,
+                               rocblas_int cols,
+                               rocblas_int elem_size,
+                               const void* a,
+                               rocblas_int lda,
+                               void*       b,
+                               rocblas_int ldb)
+    {
+        if(rows < 0 || cols < 0 || elem_size <= 0 || lda <= 0 || ldb <= 0 || lda < rows
+           || ldb < rows)
+            return rocblas_status_invalid_size;
+        if(!rows || !cols)
+            return rocblas_status_success;
+        if(!a || !b)
+            return rocblas_status_invalid_pointer;
+
+        const char* src = static_cast<const char*>(a);
+        char*       dst = static_cast<char*>(b);
+        if(lda == rows && ldb == rows)
+            std::memcpy(dst, src, size_t(rows) * cols * elem_size);
+        else
+            for(rocblas_int j = 0; j < cols; j++)
+                std::memcpy(dst + size_t(j) * ldb * elem_size,
+                            src + size_t(j) * lda * elem_size,
+                            size_t(rows) * elem_size);
+        return rocblas_status_success;
+    }
+
+    rocblas_status copy_vector(rocblas_int n,
+                               rocblas_int elem_size,
+                               const void* x,
+                               rocblas_int incx,
+                               void*       y,
+                               rocblas_int incy)
+    {
+        if(n < 0 || elem_size <= 0 || incx <= 0 || incy <= 0)
+            return rocblas_status_invalid_size;
+        if(!n)
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        const char* src = static_cast<const char*>(x);
+        char*       dst = static_cast<char*>(y);
+        if(incx == 1 && incy == 1)
+            std::memcpy(dst, src, size_t(n) * elem_size);
+        else
+            for(rocblas_int i = 0; i < n; i++)
+                std::memcpy(dst + size_t(i) * incy * elem_size,
+                            src + size_t(i) * incx * elem_size,
+                            elem_size);
+        return rocblas_status_success;
+    }
+}
+
+extern "C" {
+
+rocblas_status rocblas_create_handle(rocblas_handle* handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    *handle = new(std::nothrow) _rocblas_handle;
+    return *handle ? rocblas_status_success : rocblas_status_memory_error;
+}
+
+rocblas_status rocblas_destroy_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    delete handle;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->stream = stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream)
+        return rocblas_status_invalid_pointer;
+    *stream = handle->stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocblas_pointer_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->pointer_mode = mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_pointer_mode(rocblas_handle handle, rocblas_pointer_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->pointer_mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_atomics_mode(rocblas_handle handle, rocblas_atomics_mode mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->atomics_mode = mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_atomics_mode(rocblas_handle handle, rocblas_atomics_mode* mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->atomics_mode;
+    return rocblas_status_success;
+}
+
+// The host routines need no device memory; the size is kept so that the
+// queries of hipBLAS see what they set
+rocblas_status rocblas_start_device_memory_size_query(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->size_query)
+        return rocblas_status_size_query_mismatch;
+    handle->size_query = true;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_stop_device_memory_size_query(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!handle->size_query)
+        return rocblas_status_size_query_mismatch;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    handle->size_query = false;
+    *size              = 0;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->device_memory_size;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_device_memory_size(rocblas_handle handle, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->device_memory_size = size;
+    return rocblas_status_success;
+}
+
+// The memory of the application is not used, only its size reported
+rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->device_memory_size = addr ? size : 0;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_query_int8_layout_flag(rocblas_handle handle, rocblas_gemm_flags* flag)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!flag)
+        return rocblas_status_invalid_pointer;
+    *flag = rocblas_gemm_flags_none;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_vector(rocblas_int n,
+                                  rocblas_int elem_size,
+                                  const void* x,
+                                  rocblas_int incx,
+                                  void*       y,
+                                  rocblas_int incy)
+{
+    return copy_vector(n, elem_size, x, incx, y, incy);
+}
+
+rocblas_status rocblas_get_vector(rocblas_int n,
+                                  rocblas_int elem_size,
+                                  const void* x,
+                                  rocblas_int incx,
+                                  void*       y,
+                                  rocblas_int incy)
+{
+    return copy_vector(n, elem_size, x, incx, y, incy);
+}
+
+rocblas_status rocblas_set_vector_async(rocblas_int n,
+                                        rocblas_int elem_size,
+                                        const void* x,
+                                        rocblas_int incx,
+                                        void*       y,
+                                        rocblas_int incy,
+                                        hipStream_t)
+{
+    return copy_vector(n, elem_size, x, incx, y, incy);
+}
+
+rocblas_status rocblas_get_vector_async(rocblas_int n,
+                                        rocblas_int elem_size,
+                                        const void* x,
+                                        rocblas_int incx,
+                                        void*       y,
+                                        rocblas_int incy,
+                                        hipStream_t)
+{
+    return copy_vector(n, elem_size, x, incx, y, incy);
+}
+
+rocblas_status rocblas_set_matrix(rocblas_int rows,
+                                  rocblas_int cols,
+                                  rocblas_int elem_size,
+                                  const void* a,
+                                  rocblas_int lda,
+                                  void*       b,
+                                  rocblas_int ldb)
+{
+    return copy_matrix(rows, cols, elem_size, a, lda, b, ldb);
+}
+
+rocblas_status rocblas_get_matrix(rocblas_int rows,
+                                  rocblas_int cols,
+                                  rocblas_int elem_size,
+                                  const void* a,
+                                  rocblas_int lda,
+                                  void*       b,
+                                  rocblas_int ldb)
+{
+    return copy_matrix(rows, cols, elem_size, a, lda, b, ldb);
+}
+
+rocblas_status rocblas_set_matrix_async(rocblas_int rows,
+                                        rocblas_int cols,
+                                        rocblas_int elem_size,
+                                        const void* a,
+                                        rocblas_int lda,
+                                        void*       b,
+                                        rocblas_int ldb,
+                                        hipStream_t)
+{
+    return copy_matrix(rows, cols, elem_size, a, lda, b, ldb);
+}
+
+rocblas_status rocblas_get_matrix_async(rocblas_int rows,
+                                        rocblas_int cols,
+                                        rocblas_int elem_size,
+                                        const void* a,
+                                        rocblas_int lda,
+                                        void*       b,
+                                        rocblas_int ldb,
+                                        hipStream_t)
+{
+    return copy_matrix(rows, cols, elem_size, a, lda, b, ldb);
+}
+
+} // extern "C"
+
+// Both sides are host memory, so there is nothing to stage
+hipblasStatus_t hipblas_staged_set_matrix(
+    int, int, int, const void*, int, void*, int, hipStream_t, bool)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t
+    hipblas_staged_get_matrix(int, int, int, const void*, int, void*, int, hipStream_t)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// A batch is copied straight from one side to the other
+hipblasStatus_t hipblas_staged_set_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count)
+{
+    return hipblas_copy_matrices(handle, rows, cols, elem_size, a, b, batch_count);
+}
+
+hipblasStatus_t hipblas_staged_get_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count)
+{
+    return hipblas_copy_matrices(handle, rows, cols, elem_size, a, b, batch_count);
+}
+
+// Both sides are host memory, so the elements are converted in place of a copy
+hipblasStatus_t hipblas_staged_set_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb)
+{
+    return hipblas_convert_matrices(handle,
+                                    rows,
+                                    cols,
+                                    {a_type, const_cast<void*>(a), nullptr, lda, 0},
+                                    {b_type, b, nullptr, ldb, 0},
+                                    1,
+                                    nullptr);
+}
+
+hipblasStatus_t hipblas_staged_get_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb)
+{
+    return hipblas_staged_set_matrix_ex(handle, rows, cols, a_type, a, lda, b_type, b, ldb);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Type conversions, copies and norms of batches of matrices for the host
+// backend, on host memory. The elements are converted by hipblas_host_convert,
+// which converts a complex element as two reals, as on the GPU.
+
+#include "convert.hpp"
+#include "graph.hpp"
+#include "host_kernels.hpp"
+#include <cmath>
+
+namespace
+{
+    template <typename T>
+    T* batch_matrix(const hipblas_matrix_batch& x, int b, int scale)
+    {
+        return x.array ? static_cast<T*>(x.array[b])
+                       : static_cast<T*>(x.data) + b * x.stride * scale;
+    }
+
+    // Each column is converted as one run of elements
+    hipblasStatus_t run_convert(int                         m,
+                                int                         n,
+                                const hipblas_matrix_batch& src,
+                                const hipblas_matrix_batch& dst,
+                                int                         batch_count,
+                                int*                        overflow)
+    {
+        size_t src_size = hipblas_datatype_size(src.type);
+        size_t dst_size = hipblas_datatype_size(dst.type);
+        hipblas_host_for_batch(batch_count, int64_t(m) * n, [&](rocblas_int b) {
+            const char* s    = batch_matrix<const char>(src, b, src_size);
+            char*       d    = batch_matrix<char>(dst, b, dst_size);
+            bool        over = false;
+            for(int j = 0; j < n; j++)
+                over |= hipblas_host_convert(src.type,
+                                             s + size_t(j) * src.ld * src_size,
+                                             dst.type,
+                                             d + size_t(j) * dst.ld * dst_size,
+                                             m);
+            if(over && overflow)
+                overflow[b] = 1;
+        });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The larger of a and b, NaN if either is, as on the GPU
+    double nan_max(double a, double b)
+    {
+        return b > a || b != b ? b : a;
+    }
+
+    template <typename T>
+    hipblasStatus_t run_norms(hipblas_matrix_norm         norm,
+                              int                         m,
+                              int                         n,
+                              const hipblas_matrix_batch& x,
+                              int                         batch_count,
+                              double*                     norms)
+    {
+        hipblas_host_for_batch(batch_count, int64_t(m) * n, [&](rocblas_int b) {
+            const T* xb = batch_matrix<const T>(x, b, 1);
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                {
+                    double a = host_abs1(xb[i + int64_t(j) * x.ld]);
+                    if(norm == hipblas_matrix_norm::row_sums)
+                        norms[int64_t(b) * m + i] = (j ? norms[int64_t(b) * m + i] : 0) + a;
+                    else
+                        norms[int64_t(b) * n + j] = nan_max(i ? norms[int64_t(b) * n + j] : 0, a);
+                }
+        });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblas_convert_matrices(hipblasHandle_t,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblas_matrix_batch& src,
+                                         const hipblas_matrix_batch& dst,
+                                         int                         batch_count,
+                                         int*                        overflow)
+{
+    if(!hipblas_convert_supported(src.type, dst.type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    return run_convert(m, n, src, dst, batch_count, overflow);
+}
+
+hipblasStatus_t hipblas_copy_matrices(hipblasHandle_t,
+                                      int                         m,
+                                      int                         n,
+                                      int                         elem_size,
+                                      const hipblas_matrix_batch& src,
+                                      const hipblas_matrix_batch& dst,
+                                      int                         batch_count)
+{
+    if(m <= 0 || n <= 0 || elem_size <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // Elements are copied as bytes, elem_size to one
+    hipblas_host_for_batch(batch_count, int64_t(m) * n, [&](rocblas_int b) {
+        const char* s = batch_matrix<const char>(src, b, elem_size);
+        char*       d = batch_matrix<char>(dst, b, elem_size);
+        for(int j = 0; j < n; j++)
+            std::memcpy(d + size_t(j) * dst.ld * elem_size,
+                        s + size_t(j) * src.ld * elem_size,
+                        size_t(m) * elem_size);
+    });
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_matrix_norms(hipblasHandle_t,
+                                     hipblas_matrix_norm         norm,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblas_matrix_batch& x,
+                                     int                         batch_count,
+                                     double*                     norms)
+{
+    if(x.type != HIPBLAS_R_64F && x.type != HIPBLAS_C_64F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    return x.type == HIPBLAS_C_64F
+               ? run_norms<host_complex<double>>(norm, m, n, x, batch_count, norms)
+               : run_norms<double>(norm, m, n, x, batch_count, norms);
+}
@@ -0,0 +1,431 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Shared pieces of the host backend, used when hipBLAS is built with
+// HIPBLAS_BACKEND=host. hcc_detail/hipblas.cpp is compiled as usual and the
+// rocblas_ symbols it calls are defined in host_detail on host memory.
+
+#include "parallel.hpp"
+#include "rocblas.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+// Handle of the host backend; rocblas.h leaves the struct opaque
+struct _rocblas_handle
+{
+    hipStream_t          stream             = nullptr;
+    rocblas_pointer_mode pointer_mode       = rocblas_pointer_mode_host;
+    rocblas_atomics_mode atomics_mode       = rocblas_atomics_allowed;
+    bool                 size_query         = false;
+    size_t               device_memory_size = 0;
+};
+
+// Every routine starts with the handle checks of rocBLAS. Routines need no
+// workspace, so a size query returns before doing any work.
+#define HOST_CHECK_HANDLE(handle__)                \
+    do                                             \
+    {                                              \
+        if(!(handle__))                            \
+            return rocblas_status_invalid_handle;  \
+        if((handle__)->size_query)                 \
+            return rocblas_status_size_unchanged;  \
+    } while(0)
+
+// Complex element with plain arithmetic; same layout as the rocBLAS types
+template <typename T>
+struct host_complex
+{
+    T re, im;
+
+    host_complex() = default;
+    constexpr host_complex(T re, T im = 0)
+        : re(re)
+        , im(im)
+    {
+    }
+
+    host_complex& operator+=(const host_complex& rhs)
+    {
+        re += rhs.re;
+        im += rhs.im;
+        return *this;
+    }
+
+    friend host_complex operator+(const host_complex& a, const host_complex& b)
+    {
+        return {a.re + b.re, a.im + b.im};
+    }
+
+    friend host_complex operator-(const host_complex& a, const host_complex& b)
+    {
+        return {a.re - b.re, a.im - b.im};
+    }
+
+    friend host_complex operator*(const host_complex& a, const host_complex& b)
+    {
+        return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+    }
+
+    friend host_complex operator*(const host_complex& a, T b)
+    {
+        return {a.re * b, a.im * b};
+    }
+
+    friend host_complex operator*(T a, const host_complex& b)
+    {
+        return {a * b.re, a * b.im};
+    }
+
+    friend bool operator==(const host_complex& a, const host_complex& b)
+    {
+        return a.re == b.re && a.im == b.im;
+    }
+
+    friend bool operator!=(const host_complex& a, const host_complex& b)
+    {
+        return !(a == b);
+    }
+};
+
+// Element type the kernels compute with for a rocBLAS type
+template <typename T>
+struct host_type
+{
+    using type = T;
+};
+
+template <>
+struct host_type<rocblas_float_complex>
+{
+    using type = host_complex<float>;
+};
+
+template <>
+struct host_type<rocblas_double_complex>
+{
+    using type = host_complex<double>;
+};
+
+template <typename T>
+struct host_type<const T>
+{
+    using type = const typename host_type<T>::type;
+};
+
+template <typename T>
+using host_t = typename host_type<T>::type;
+
+template <typename T>
+inline host_t<T>* host_cast(T* p)
+{
+    static_assert(sizeof(host_t<T>) == sizeof(T), "host type must match the rocBLAS layout");
+    return reinterpret_cast<host_t<T>*>(p);
+}
+
+template <typename T>
+inline host_t<T>* const* host_cast(T* const* p)
+{
+    return reinterpret_cast<host_t<T>* const*>(p);
+}
+
+template <typename T>
+inline T host_conj(const T& x)
+{
+    return x;
+}
+
+template <typename T>
+inline host_complex<T> host_conj(const host_complex<T>& x)
+{
+    return {x.re, -x.im};
+}
+
+// |re| + |im|, the magnitude asum and iamax use
+template <typename T>
+inline T host_abs1(T x)
+{
+    return std::abs(x);
+}
+
+template <typename T>
+inline T host_abs1(const host_complex<T>& x)
+{
+    return std::abs(x.re) + std::abs(x.im);
+}
+
+template <typename T>
+inline T host_norm(T x)
+{
+    return x * x;
+}
+
+template <typename T>
+inline T host_norm(const host_complex<T>& x)
+{
+    return x.re * x.re + x.im * x.im;
+}
+
+// Half and bfloat16 conversions, on the bits of the values since rocblas_half
+// is a struct or _Float16 depending on the compiler. F16C is used when the
+// compiler targets it.
+inline float host_half_to_float(rocblas_half h)
+{
+    uint16_t data;
+    std::memcpy(&data, &h, sizeof(data));
+#if defined(__F16C__)
+    return _cvtsh_ss(data);
+#else
+    uint32_t sign     = uint32_t(data & 0x8000) << 16;
+    uint32_t exponent = (data >> 10) & 0x1f;
+    uint32_t mantissa = data & 0x3ff;
+    uint32_t bits;
+    if(exponent == 0x1f)
+        bits = sign | 0x7f800000 | (mantissa << 13);
+    else if(exponent)
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    else if(mantissa)
+    {
+        // Subnormal: normalize the mantissa
+        exponent = 113;
+        while(!(mantissa & 0x400))
+        {
+            mantissa <<= 1;
+            exponent--;
+        }
+        bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+    }
+    else
+        bits = sign;
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+#endif
+}
+
+inline rocblas_half host_float_to_half(float f)
+{
+    uint16_t data;
+#if defined(__F16C__)
+    data = _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#else
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    uint32_t sign     = (bits >> 16) & 0x8000;
+    int32_t  exponent = int32_t((bits >> 23) & 0xff) - 112;
+    uint32_t mantissa = bits & 0x7fffff;
+    if(((bits >> 23) & 0xff) == 0xff)
+        data = uint16_t(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+    else if(exponent >= 0x1f)
+        data = uint16_t(sign | 0x7c00);
+    else if(exponent <= 0)
+    {
+        // Subnormal or zero, rounded to nearest even
+        if(exponent < -10)
+            data = uint16_t(sign);
+        else
+        {
+            mantissa |= 0x800000;
+            uint32_t shift   = uint32_t(14 - exponent);
+            uint32_t value   = mantissa >> shift;
+            uint32_t rest    = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if(rest > halfway || (rest == halfway && (value & 1)))
+                value++;
+            data = uint16_t(sign | value);
+        }
+    }
+    else
+    {
+        uint32_t value = (uint32_t(exponent) << 10) | (mantissa >> 13);
+        uint32_t rest  = mantissa & 0x1fff;
+        if(rest > 0x1000 || (rest == 0x1000 && (value & 1)))
+            value++;
+        data = uint16_t(sign | value);
+    }
+#endif
+    rocblas_half h;
+    std::memcpy(&h, &data, sizeof(h));
+    return h;
+}
+
+inline float host_bfloat16_to_float(rocblas_bfloat16 b)
+{
+    uint16_t data;
+    std::memcpy(&data, &b, sizeof(data));
+    uint32_t bits = uint32_t(data) << 16;
+    float    f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+inline rocblas_bfloat16 host_float_to_bfloat16(float f)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    uint16_t data;
+    if(std::isnan(f))
+        data = uint16_t((bits >> 16) | 0x40);
+    else
+        data = uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+    rocblas_bfloat16 b;
+    std::memcpy(&b, &data, sizeof(b));
+    return b;
+}
+
+// Conversion between storage and compute types
+template <typename To, typename From>
+struct host_converter
+{
+    static To convert(const From& x)
+    {
+        return To(x);
+    }
+};
+
+template <>
+struct host_converter<float, rocblas_half>
+{
+    static float convert(rocblas_half x)
+    {
+        return host_half_to_float(x);
+    }
+};
+
+template <>
+struct host_converter<rocblas_half, float>
+{
+    static rocblas_half convert(float x)
+    {
+        return host_float_to_half(x);
+    }
+};
+
+template <>
+struct host_converter<float, rocblas_bfloat16>
+{
+    static float convert(rocblas_bfloat16 x)
+    {
+        return host_bfloat16_to_float(x);
+    }
+};
+
+template <>
+struct host_converter<rocblas_bfloat16, float>
+{
+    static rocblas_bfloat16 convert(float x)
+    {
+        return host_float_to_bfloat16(x);
+    }
+};
+
+template <typename To, typename From>
+inline To host_convert(const From& x)
+{
+    return host_converter<To, From>::convert(x);
+}
+
+// Convert n contiguous elements
+template <typename To, typename From>
+inline void host_convert_n(const From* src, To* dst, int64_t n)
+{
+    for(int64_t i = 0; i < n; i++)
+        dst[i] = host_convert<To>(src[i]);
+}
+
+#if defined(__F16C__) && defined(__AVX__)
+template <>
+inline void host_convert_n<float, rocblas_half>(const rocblas_half* src, float* dst, int64_t n)
+{
+    int64_t i = 0;
+    for(; i + 8 <= n; i += 8)
+        _mm256_storeu_ps(dst + i,
+                         _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    for(; i < n; i++)
+        dst[i] = host_half_to_float(src[i]);
+}
+#endif
+
+// Operand b of a batch: one pointer advanced by a stride, which with a zero
+// stride also serves the non-batched routines
+template <typename T>
+struct host_strided
+{
+    T*             p;
+    rocblas_stride stride;
+
+    T* operator[](rocblas_int b) const
+    {
+        return p + b * stride;
+    }
+
+    explicit operator bool() const
+    {
+        return p != nullptr;
+    }
+};
+
+// Operand b of a batch held in an array of pointers
+template <typename T>
+struct host_batched
+{
+    T* const* p;
+
+    T* operator[](rocblas_int b) const
+    {
+        return p[b];
+    }
+
+    explicit operator bool() const
+    {
+        return p != nullptr;
+    }
+};
+
+// Accessors in host types for the operands of the rocBLAS entry points
+template <typename T>
+inline host_strided<host_t<T>> host_single(T* p)
+{
+    return {host_cast(p), 0};
+}
+
+template <typename T>
+inline host_strided<host_t<T>> host_stride(T* p, rocblas_stride stride)
+{
+    return {host_cast(p), stride};
+}
+
+template <typename T>
+inline host_batched<host_t<T>> host_array(T* const* p)
+{
+    return {host_cast(p)};
+}
+
+// First element of a vector with a possibly negative increment
+template <typename T>
+inline T* host_vector_start(T* x, rocblas_int n, rocblas_int inc)
+{
+    return inc < 0 ? x - int64_t(n - 1) * inc : x;
+}
+
+// Run body(b) for every batch member b, in parallel once the batch holds
+// enough work. work is the number of multiply-adds of one member.
+template <typename F>
+inline void hipblas_host_for_batch(rocblas_int batch_count, int64_t work, F&& body)
+{
+    constexpr int64_t min_chunk_work = 1 << 15;
+    int64_t           grain          = work >= min_chunk_work ? 1 : min_chunk_work / (work + 1) + 1;
+    hipblas_host_parallel_for(batch_count, grain, [&](int64_t begin, int64_t end) {
+        for(int64_t b = begin; b < end; b++)
+            body(rocblas_int(b));
+    });
+}
@@ -0,0 +1,591 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Level 1 routines of the host backend. Unit stride loops are kept simple so
+// the compiler vectorizes them. A single long vector is split across the
+// thread pool; reductions combine fixed chunks, so results do not depend on
+// the number of threads.
+
+#include "host_kernels.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    constexpr int64_t element_grain = 1 << 16;
+
+    // Run body(b, begin, end) over the elements of every batch member
+    template <typename F>
+    void for_elements(rocblas_int n, rocblas_int batch_count, F&& body)
+    {
+        if(batch_count == 1)
+            hipblas_host_parallel_for(
+                n, element_grain, [&](int64_t begin, int64_t end) { body(0, begin, end); });
+        else
+            hipblas_host_for_batch(batch_count, n, [&](rocblas_int b) { body(b, 0, n); });
+    }
+
+    // Reduce [0, n) by combining partial(begin, end) of fixed chunks in order
+    template <typename R, typename F, typename C>
+    R reduce_elements(rocblas_int n, bool parallel, F&& partial, C&& combine)
+    {
+        int64_t chunks = (n + element_grain - 1) / element_grain;
+        if(!parallel || chunks <= 1)
+            return partial(0, n);
+
+        std::vector<R> parts(chunks);
+        hipblas_host_parallel_for(chunks, 1, [&](int64_t begin, int64_t end) {
+            for(int64_t c = begin; c < end; c++)
+                parts[c] = partial(c * element_grain, std::min<int64_t>(n, (c + 1) * element_grain));
+        });
+        R result = parts[0];
+        for(int64_t c = 1; c < chunks; c++)
+            result = combine(result, parts[c]);
+        return result;
+    }
+
+    template <typename T, typename X, typename Y>
+    rocblas_status axpy(rocblas_handle handle,
+                        rocblas_int    n,
+                        const T*       alpha,
+                        X              x,
+                        rocblas_int    incx,
+                        Y              y,
+                        rocblas_int    incy,
+                        rocblas_int    batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(n <= 0 || !batch_count)
+            return rocblas_status_success;
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        const T a = *alpha;
+        if(a == T(0))
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        for_elements(n, batch_count, [&](rocblas_int b, int64_t begin, int64_t end) {
+            const T* xb = host_vector_start(x[b], n, incx);
+            T*       yb = host_vector_start(y[b], n, incy);
+            if(incx == 1 && incy == 1)
+                for(int64_t i = begin; i < end; i++)
+                    yb[i] = yb[i] + a * xb[i];
+            else
+                for(int64_t i = begin; i < end; i++)
+                    yb[i * incy] = yb[i * incy] + a * xb[i * incx];
+        });
+        return rocblas_status_success;
+    }
+
+    template <typename Ta, typename X>
+    rocblas_status scal(rocblas_handle handle,
+                        rocblas_int    n,
+                        const Ta*      alpha,
+                        X              x,
+                        rocblas_int    incx,
+                        rocblas_int    batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(n <= 0 || incx <= 0 || !batch_count)
+            return rocblas_status_success;
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        const Ta a = *alpha;
+        if(a == Ta(1))
+            return rocblas_status_success;
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        for_elements(n, batch_count, [&](rocblas_int b, int64_t begin, int64_t end) {
+            auto* xb = x[b];
+            if(incx == 1)
+                for(int64_t i = begin; i < end; i++)
+                    xb[i] = a * xb[i];
+            else
+                for(int64_t i = begin; i < end; i++)
+                    xb[i * incx] = a * xb[i * incx];
+        });
+        return rocblas_status_success;
+    }
+
+    template <typename X, typename Y>
+    rocblas_status copy(rocblas_handle handle,
+                        rocblas_int    n,
+                        X              x,
+                        rocblas_int    incx,
+                        Y              y,
+                        rocblas_int    incy,
+                        rocblas_int    batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(n <= 0 || !batch_count)
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        for_elements(n, batch_count, [&](rocblas_int b, int64_t begin, int64_t end) {
+            const auto* xb = host_vector_start(x[b], n, incx);
+            auto*       yb = host_vector_start(y[b], n, incy);
+            if(incx == 1 && incy == 1)
+                std::copy(xb + begin, xb + end, yb + begin);
+            else
+                for(int64_t i = begin; i < end; i++)
+                    yb[i * incy] = xb[i * incx];
+        });
+        return rocblas_status_success;
+    }
+
+    template <typename X, typename Y>
+    rocblas_status swap(rocblas_handle handle,
+                        rocblas_int    n,
+                        X              x,
+                        rocblas_int    incx,
+                        Y              y,
+                        rocblas_int    incy,
+                        rocblas_int    batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(n <= 0 || !batch_count)
+            return rocblas_status_success;
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        for_elements(n, batch_count, [&](rocblas_int b, int64_t begin, int64_t end) {
+            auto* xb = host_vector_start(x[b], n, incx);
+            auto* yb = host_vector_start(y[b], n, incy);
+            for(int64_t i = begin; i < end; i++)
+                std::swap(xb[i * incx], yb[i * incy]);
+        });
+        return rocblas_status_success;
+    }
+
+    template <bool CONJ, typename T, typename X, typename Y>
+    rocblas_status dot(rocblas_handle handle,
+                       rocblas_int    n,
+                       X              x,
+                       rocblas_int    incx,
+                       Y              y,
+                       rocblas_int    incy,
+                       rocblas_int    batch_count,
+                       T*             result)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!batch_count)
+            return rocblas_status_success;
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0)
+        {
+            std::fill(result, result + batch_count, T(0));
+            return rocblas_status_success;
+        }
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        hipblas_host_for_batch(batch_count, n, [&](rocblas_int b) {
+            const T* xb = host_vector_start(x[b], n, incx);
+            const T* yb = host_vector_start(y[b], n, incy);
+            result[b]   = reduce_elements<T>(
+                n,
+                batch_count == 1,
+                [&](int64_t begin, int64_t end) {
+                    T sum(0);
+                    for(int64_t i = begin; i < end; i++)
+                        sum += (CONJ ? host_conj(xb[i * incx]) : xb[i * incx]) * yb[i * incy];
+                    return sum;
+                },
+                [](T a, T b) { return a + b; });
+        });
+        return rocblas_status_success;
+    }
+
+    // Accumulates float vectors in double
+    template <typename R>
+    using accumulator_t = std::conditional_t<std::is_same<R, float>{}, double, R>;
+
+    template <typename R, typename X>
+    rocblas_status nrm2(rocblas_handle handle,
+                        rocblas_int    n,
+                        X              x,
+                        rocblas_int    incx,
+                        rocblas_int    batch_count,
+                        R*             result)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!batch_count)
+            return rocblas_status_success;
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0 || incx <= 0)
+        {
+            std::fill(result, result + batch_count, R(0));
+            return rocblas_status_success;
+        }
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        using A = accumulator_t<R>;
+        hipblas_host_for_batch(batch_count, n, [&](rocblas_int b) {
+            const auto* xb  = x[b];
+            A           sum = reduce_elements<A>(
+                n,
+                batch_count == 1,
+                [&](int64_t begin, int64_t end) {
+                    A part(0);
+                    for(int64_t i = begin; i < end; i++)
+                        part += host_norm(xb[i * incx]);
+                    return part;
+                },
+                [](A a, A b) { return a + b; });
+            result[b] = R(std::sqrt(sum));
+        });
+        return rocblas_status_success;
+    }
+
+    template <typename R, typename X>
+    rocblas_status asum(rocblas_handle handle,
+                        rocblas_int    n,
+                        X              x,
+                        rocblas_int    incx,
+                        rocblas_int    batch_count,
+                        R*             result)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!batch_count)
+            return rocblas_status_success;
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0 || incx <= 0)
+        {
+            std::fill(result, result + batch_count, R(0));
+            return rocblas_status_success;
+        }
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        using A = accumulator_t<R>;
+        hipblas_host_for_batch(batch_count, n, [&](rocblas_int b) {
+            const auto* xb = x[b];
+            result[b]      = R(reduce_elements<A>(
+                n,
+                batch_count == 1,
+                [&](int64_t begin, int64_t end) {
+                    A part(0);
+                    for(int64_t i = begin; i < end; i++)
+                        part += host_abs1(xb[i * incx]);
+                    return part;
+                },
+                [](A a, A b) { return a + b; }));
+        });
+        return rocblas_status_success;
+    }
+
+    // Index and magnitude of the first extreme element of a chunk
+    template <typename R>
+    struct extreme
+    {
+        int64_t index;
+        R       value;
+    };
+
+    // 1-based index of the first element of largest (MAX) or smallest |re| + |im|
+    template <bool MAX, typename X>
+    rocblas_status iamax(rocblas_handle handle,
+                         rocblas_int    n,
+                         X              x,
+                         rocblas_int    incx,
+                         rocblas_int    batch_count,
+                         rocblas_int*   result)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!batch_count)
+            return rocblas_status_success;
+        if(!result)
+            return rocblas_status_invalid_pointer;
+        if(n <= 0 || incx <= 0)
+        {
+            std::fill(result, result + batch_count, 0);
+            return rocblas_status_success;
+        }
+        if(!x)
+            return rocblas_status_invalid_pointer;
+
+        using R = decltype(host_abs1(*x[0]));
+        hipblas_host_for_batch(batch_count, n, [&](rocblas_int b) {
+            const auto* xb   = x[b];
+            auto        best = reduce_elements<extreme<R>>(
+                n,
+                batch_count == 1,
+                [&](int64_t begin, int64_t end) {
+                    extreme<R> e{begin, host_abs1(xb[begin * incx])};
+                    for(int64_t i = begin + 1; i < end; i++)
+                    {
+                        R v = host_abs1(xb[i * incx]);
+                        if(MAX ? v > e.value : v < e.value)
+                            e = {i, v};
+                    }
+                    return e;
+                },
+                [](extreme<R> a, extreme<R> b) {
+                    return (MAX ? b.value > a.value : b.value < a.value) ? b : a;
+                });
+            result[b] = rocblas_int(best.index + 1);
+        });
+        return rocblas_status_success;
+    }
+}
+
+// The three variants of each routine, for one precision
+#define HOST_AXPY(prefix__, T__)                                                                \
+    rocblas_status rocblas_##prefix__##axpy(rocblas_handle handle,                              \
+                                            rocblas_int    n,                                   \
+                                            const T__*     alpha,                               \
+                                            const T__*     x,                                   \
+                                            rocblas_int    incx,                                \
+                                            T__*           y,                                   \
+                                            rocblas_int    incy)                                \
+    {                                                                                           \
+        return axpy(                                                                            \
+            handle, n, host_cast(alpha), host_single(x), incx, host_single(y), incy, 1);        \
+    }                                                                                           \
+    rocblas_status rocblas_##prefix__##axpy_batched(rocblas_handle   handle,                    \
+                                                    rocblas_int      n,                         \
+                                                    const T__*       alpha,                     \
+                                                    const T__* const x[],                       \
+                                                    rocblas_int      incx,                      \
+                                                    T__* const       y[],                       \
+                                                    rocblas_int      incy,                      \
+                                                    rocblas_int      batch_count)               \
+    {                                                                                           \
+        return axpy(                                                                            \
+            handle, n, host_cast(alpha), host_array(x), incx, host_array(y), incy, batch_count); \
+    }                                                                                           \
+    rocblas_status rocblas_##prefix__##axpy_strided_batched(rocblas_handle handle,              \
+                                                            rocblas_int    n,                   \
+                                                            const T__*     alpha,               \
+                                                            const T__*     x,                   \
+                                                            rocblas_int    incx,                \
+                                                            rocblas_stride stridex,             \
+                                                            T__*           y,                   \
+                                                            rocblas_int    incy,                \
+                                                            rocblas_stride stridey,             \
+                                                            rocblas_int    batch_count)         \
+    {                                                                                           \
+        return axpy(handle,                                                                     \
+                    n,                                                                          \
+                    host_cast(alpha),                                                           \
+                    host_stride(x, stridex),                                                    \
+                    incx,                                                                       \
+                    host_stride(y, stridey),                                                    \
+                    incy,                                                                       \
+                    batch_count);                                                               \
+    }
+
+#define HOST_SCAL(name__, Ta__, T__)                                                              \
+    rocblas_status rocblas_##name__(                                                              \
+        rocblas_handle handle, rocblas_int n, const Ta__* alpha, T__* x, rocblas_int incx)        \
+    {                                                                                             \
+        return scal(handle, n, host_cast(alpha), host_single(x), incx, 1);                        \
+    }                                                                                             \
+    rocblas_status rocblas_##name__##_batched(rocblas_handle handle,                              \
+                                              rocblas_int    n,                                   \
+                                              const Ta__*    alpha,                               \
+                                              T__* const     x[],                                 \
+                                              rocblas_int    incx,                                \
+                                              rocblas_int    batch_count)                         \
+    {                                                                                             \
+        return scal(handle, n, host_cast(alpha), host_array(x), incx, batch_count);               \
+    }                                                                                             \
+    rocblas_status rocblas_##name__##_strided_batched(rocblas_handle handle,                      \
+                                                      rocblas_int    n,                           \
+                                                      const Ta__*    alpha,                       \
+                                                      T__*           x,                           \
+                                                      rocblas_int    incx,                        \
+                                                      rocblas_stride stridex,                     \
+                                                      rocblas_int    batch_count)                 \
+    {                                                                                             \
+        return scal(handle, n, host_cast(alpha), host_stride(x, stridex), incx, batch_count);     \
+    }
+
+#define HOST_COPY_SWAP(routine__, prefix__, Tx__, T__)                                            \
+    rocblas_status rocblas_##prefix__##routine__(                                                 \
+        rocblas_handle handle, rocblas_int n, Tx__* x, rocblas_int incx, T__* y, rocblas_int incy) \
+    {                                                                                             \
+        return routine__(handle, n, host_single(x), incx, host_single(y), incy, 1);               \
+    }                                                                                             \
+    rocblas_status rocblas_##prefix__##routine__##_batched(rocblas_handle handle,                 \
+                                                           rocblas_int    n,                      \
+                                                           Tx__* const    x[],                    \
+                                                           rocblas_int    incx,                   \
+                                                           T__* const     y[],                    \
+                                                           rocblas_int    incy,                   \
+                                                           rocblas_int    batch_count)            \
+    {                                                                                             \
+        return routine__(handle, n, host_array(x), incx, host_array(y), incy, batch_count);       \
+    }                                                                                             \
+    rocblas_status rocblas_##prefix__##routine__##_strided_batched(rocblas_handle handle,         \
+                                                                   rocblas_int    n,              \
+                                                                   Tx__*          x,              \
+                                                                   rocblas_int    incx,           \
+                                                                   rocblas_stride stridex,        \
+                                                                   T__*           y,              \
+                                                                   rocblas_int    incy,           \
+                                                                   rocblas_stride stridey,        \
+                                                                   rocblas_int    batch_count)    \
+    {                                                                                             \
+        return routine__(handle,                                                                  \
+                         n,                                                                       \
+                         host_stride(x, stridex),                                                 \
+                         incx,                                                                    \
+                         host_stride(y, stridey),                                                 \
+                         incy,                                                                    \
+                         batch_count);                                                            \
+    }
+
+#define HOST_DOT(name__, conj__, T__)                                                          \
+    rocblas_status rocblas_##name__(rocblas_handle handle,                                     \
+                                    rocblas_int    n,                                          \
+                                    const T__*     x,                                          \
+                                    rocblas_int    incx,                                       \
+                                    const T__*     y,                                          \
+                                    rocblas_int    incy,                                       \
+                                    T__*           result)                                     \
+    {                                                                                          \
+        return dot<conj__>(                                                                    \
+            handle, n, host_single(x), incx, host_single(y), incy, 1, host_cast(result));      \
+    }                                                                                          \
+    rocblas_status rocblas_##name__##_batched(rocblas_handle   handle,                         \
+                                              rocblas_int      n,                              \
+                                              const T__* const x[],                            \
+                                              rocblas_int      incx,                           \
+                                              const T__* const y[],                            \
+                                              rocblas_int      incy,                           \
+                                              rocblas_int      batch_count,                    \
+                                              T__*             result)                         \
+    {                                                                                          \
+        return dot<conj__>(handle,                                                             \
+                           n,                                                                  \
+                           host_array(x),                                                      \
+                           incx,                                                               \
+                           host_array(y),                                                      \
+                           incy,                                                               \
+                           batch_count,                                                        \
+                           host_cast(result));                                                 \
+    }                                                                                          \
+    rocblas_status rocblas_##name__##_strided_batched(rocblas_handle handle,                   \
+                                                      rocblas_int    n,                        \
+                                                      const T__*     x,                        \
+                                                      rocblas_int    incx,                     \
+                                                      rocblas_stride stridex,                  \
+                                                      const T__*     y,                        \
+                                                      rocblas_int    incy,                     \
+                                                      rocblas_stride stridey,                  \
+                                                      rocblas_int    batch_count,              \
+                                                      T__*           result)                   \
+    {                                                                                          \
+        return dot<conj__>(handle,                                                             \
+                           n,                                                                  \
+                           host_stride(x, stridex),                                            \
+                           incx,                                                               \
+                           host_stride(y, stridey),                                            \
+                           incy,                                                               \
+                           batch_count,                                                        \
+                           host_cast(result));                                                 \
+    }
+
+// nrm2, asum, iamax and iamin, which reduce one vector into R
+#define HOST_REDUCTION(name__, kernel__, T__, R__)                                                \
+    rocblas_status rocblas_##name__(                                                              \
+        rocblas_handle handle, rocblas_int n, const T__* x, rocblas_int incx, R__* result)        \
+    {                                                                                             \
+        return kernel__(handle, n, host_single(x), incx, 1, result);                              \
+    }                                                                                             \
+    rocblas_status rocblas_##name__##_batched(rocblas_handle   handle,                            \
+                                              rocblas_int      n,                                 \
+                                              const T__* const x[],                               \
+                                              rocblas_int      incx,                              \
+                                              rocblas_int      batch_count,                       \
+                                              R__*             result)                            \
+    {                                                                                             \
+        return kernel__(handle, n, host_array(x), incx, batch_count, result);                     \
+    }                                                                                             \
+    rocblas_status rocblas_##name__##_strided_batched(rocblas_handle handle,                      \
+                                                      rocblas_int    n,                           \
+                                                      const T__*     x,                           \
+                                                      rocblas_int    incx,                        \
+                                                      rocblas_stride stridex,                     \
+                                                      rocblas_int    batch_count,                 \
+                                                      R__*           result)                      \
+    {                                                                                             \
+        return kernel__(handle, n, host_stride(x, stridex), incx, batch_count, result);           \
+    }
+
+extern "C" {
+
+HOST_AXPY(s, float)
+HOST_AXPY(d, double)
+HOST_AXPY(c, rocblas_float_complex)
+HOST_AXPY(z, rocblas_double_complex)
+
+HOST_SCAL(sscal, float, float)
+HOST_SCAL(dscal, double, double)
+HOST_SCAL(cscal, rocblas_float_complex, rocblas_float_complex)
+HOST_SCAL(zscal, rocblas_double_complex, rocblas_double_complex)
+HOST_SCAL(csscal, float, rocblas_float_complex)
+HOST_SCAL(zdscal, double, rocblas_double_complex)
+
+HOST_COPY_SWAP(copy, s, const float, float)
+HOST_COPY_SWAP(copy, d, const double, double)
+HOST_COPY_SWAP(copy, c, const rocblas_float_complex, rocblas_float_complex)
+HOST_COPY_SWAP(copy, z, const rocblas_double_complex, rocblas_double_complex)
+
+HOST_COPY_SWAP(swap, s, float, float)
+HOST_COPY_SWAP(swap, d, double, double)
+HOST_COPY_SWAP(swap, c, rocblas_float_complex, rocblas_float_complex)
+HOST_COPY_SWAP(swap, z, rocblas_double_complex, rocblas_double_complex)
+
+HOST_DOT(sdot, false, float)
+HOST_DOT(ddot, false, double)
+HOST_DOT(cdotu, false, rocblas_float_complex)
+HOST_DOT(zdotu, false, rocblas_double_complex)
+HOST_DOT(cdotc, true, rocblas_float_complex)
+HOST_DOT(zdotc, true, rocblas_double_complex)
+
+HOST_REDUCTION(snrm2, nrm2, float, float)
+HOST_REDUCTION(dnrm2, nrm2, double, double)
+HOST_REDUCTION(scnrm2, nrm2, rocblas_float_complex, float)
+HOST_REDUCTION(dznrm2, nrm2, rocblas_double_complex, double)
+
+HOST_REDUCTION(sasum, asum, float, float)
+HOST_REDUCTION(dasum, asum, double, double)
+HOST_REDUCTION(scasum, asum, rocblas_float_complex, float)
+HOST_REDUCTION(dzasum, asum, rocblas_double_complex, double)
+
+HOST_REDUCTION(isamax, iamax<true>, float, rocblas_int)
+HOST_REDUCTION(idamax, iamax<true>, double, rocblas_int)
+HOST_REDUCTION(icamax, iamax<true>, rocblas_float_complex, rocblas_int)
+HOST_REDUCTION(izamax, iamax<true>, rocblas_double_complex, rocblas_int)
+HOST_REDUCTION(isamin, iamax<false>, float, rocblas_int)
+HOST_REDUCTION(idamin, iamax<false>, double, rocblas_int)
+HOST_REDUCTION(icamin, iamax<false>, rocblas_float_complex, rocblas_int)
+HOST_REDUCTION(izamin, iamax<false>, rocblas_double_complex, rocblas_int)
+
+} // extern "C"
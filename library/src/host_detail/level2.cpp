@@ -0,0 +1,336 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Level 2 routines of the host backend. Both walk the matrix a column at a
+// time so the inner loops run down contiguous memory. A single large matrix
+// is split across the thread pool by rows (gemv) or columns (gemv with a
+// transpose, ger).
+
+#include "host_kernels.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // Rows or columns per chunk of a single matrix
+    constexpr int64_t vector_grain = 256;
+
+    // y = alpha * op(A) * x + beta * y
+    template <typename T, typename MA, typename X, typename Y>
+    rocblas_status gemv(rocblas_handle    handle,
+                        rocblas_operation trans,
+                        rocblas_int       m,
+                        rocblas_int       n,
+                        const T*          alpha,
+                        MA                A,
+                        rocblas_int       lda,
+                        X                 x,
+                        rocblas_int       incx,
+                        const T*          beta,
+                        Y                 y,
+                        rocblas_int       incy,
+                        rocblas_int       batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+           && trans != rocblas_operation_conjugate_transpose)
+            return rocblas_status_invalid_value;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        const T     a     = *alpha;
+        const T     bt    = *beta;
+        rocblas_int x_len = trans == rocblas_operation_none ? n : m;
+        rocblas_int y_len = trans == rocblas_operation_none ? m : n;
+        if(a == T(0) && bt == T(1))
+            return rocblas_status_success;
+        if(!y || (a != T(0) && (!A || !x)))
+            return rocblas_status_invalid_pointer;
+
+        hipblas_host_for_batch(batch_count, int64_t(m) * n, [&](rocblas_int b) {
+            const T* Ab = a != T(0) ? A[b] : nullptr;
+            const T* xb = a != T(0) ? host_vector_start(x[b], x_len, incx) : nullptr;
+            T*       yb = host_vector_start(y[b], y_len, incy);
+
+            if(trans == rocblas_operation_none)
+            {
+                hipblas_host_parallel_for(
+                    m, batch_count == 1 ? vector_grain : m, [&](int64_t begin, int64_t end) {
+                        // Accumulate a block of y contiguously, then scale into place
+                        std::vector<T> acc(end - begin, T(0));
+                        if(a != T(0))
+                            for(rocblas_int j = 0; j < n; j++)
+                            {
+                                const T  xj  = a * xb[int64_t(j) * incx];
+                                const T* col = Ab + int64_t(j) * lda;
+                                for(int64_t i = begin; i < end; i++)
+                                    acc[i - begin] = acc[i - begin] + col[i] * xj;
+                            }
+                        for(int64_t i = begin; i < end; i++)
+                        {
+                            T& yi = yb[i * incy];
+                            yi    = bt == T(0) ? acc[i - begin] : acc[i - begin] + bt * yi;
+                        }
+                    });
+            }
+            else
+            {
+                const bool conj = trans == rocblas_operation_conjugate_transpose;
+                hipblas_host_parallel_for(
+                    n, batch_count == 1 ? vector_grain : n, [&](int64_t begin, int64_t end) {
+                        for(int64_t j = begin; j < end; j++)
+                        {
+                            T sum(0);
+                            if(a != T(0))
+                            {
+                                const T* col = Ab + j * lda;
+                                if(conj)
+                                    for(rocblas_int i = 0; i < m; i++)
+                                        sum += host_conj(col[i]) * xb[int64_t(i) * incx];
+                                else
+                                    for(rocblas_int i = 0; i < m; i++)
+                                        sum += col[i] * xb[int64_t(i) * incx];
+                            }
+                            T& yj = yb[j * incy];
+                            yj    = bt == T(0) ? a * sum : a * sum + bt * yj;
+                        }
+                    });
+            }
+        });
+        return rocblas_status_success;
+    }
+
+    // A = alpha * x * y**T + A, or with y conjugated (CONJ)
+    template <bool CONJ, typename T, typename X, typename Y, typename MA>
+    rocblas_status ger(rocblas_handle handle,
+                       rocblas_int    m,
+                       rocblas_int    n,
+                       const T*       alpha,
+                       X              x,
+                       rocblas_int    incx,
+                       Y              y,
+                       rocblas_int    incy,
+                       MA             A,
+                       rocblas_int    lda,
+                       rocblas_int    batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(m < 0 || n < 0 || lda < std::max(1, m) || !incx || !incy || batch_count < 0)
+            return rocblas_status_invalid_size;
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+        if(!alpha)
+            return rocblas_status_invalid_pointer;
+        const T a = *alpha;
+        if(a == T(0))
+            return rocblas_status_success;
+        if(!x || !y || !A)
+            return rocblas_status_invalid_pointer;
+
+        hipblas_host_for_batch(batch_count, int64_t(m) * n, [&](rocblas_int b) {
+            const T* xb = host_vector_start(x[b], m, incx);
+            const T* yb = host_vector_start(y[b], n, incy);
+            T*       Ab = A[b];
+            hipblas_host_parallel_for(
+                n, batch_count == 1 ? vector_grain : n, [&](int64_t begin, int64_t end) {
+                    for(int64_t j = begin; j < end; j++)
+                    {
+                        const T yj  = a * (CONJ ? host_conj(yb[j * incy]) : yb[j * incy]);
+                        T*      col = Ab + j * lda;
+                        if(incx == 1)
+                            for(rocblas_int i = 0; i < m; i++)
+                                col[i] = col[i] + xb[i] * yj;
+                        else
+                            for(rocblas_int i = 0; i < m; i++)
+                                col[i] = col[i] + xb[int64_t(i) * incx] * yj;
+                    }
+                });
+        });
+        return rocblas_status_success;
+    }
+}
+
+#define HOST_GEMV(prefix__, T__)                                                                 \
+    rocblas_status rocblas_##prefix__##gemv(rocblas_handle    handle,                            \
+                                            rocblas_operation trans,                             \
+                                            rocblas_int       m,                                 \
+                                            rocblas_int       n,                                 \
+                                            const T__*        alpha,                             \
+                                            const T__*        A,                                 \
+                                            rocblas_int       lda,                               \
+                                            const T__*        x,                                 \
+                                            rocblas_int       incx,                              \
+                                            const T__*        beta,                              \
+                                            T__*              y,                                 \
+                                            rocblas_int       incy)                              \
+    {                                                                                            \
+        return gemv(handle,                                                                      \
+                    trans,                                                                       \
+                    m,                                                                           \
+                    n,                                                                           \
+                    host_cast(alpha),                                                            \
+                    host_single(A),                                                              \
+                    lda,                                                                         \
+                    host_single(x),                                                              \
+                    incx,                                                                        \
+                    host_cast(beta),                                                             \
+                    host_single(y),                                                              \
+                    incy,                                                                        \
+                    1);                                                                          \
+    }                                                                                            \
+    rocblas_status rocblas_##prefix__##gemv_batched(rocblas_handle    handle,                    \
+                                                    rocblas_operation trans,                     \
+                                                    rocblas_int       m,                         \
+                                                    rocblas_int       n,                         \
+                                                    const T__*        alpha,                     \
+                                                    const T__* const  A[],                       \
+                                                    rocblas_int       lda,                       \
+                                                    const T__* const  x[],                       \
+                                                    rocblas_int       incx,                      \
+                                                    const T__*        beta,                      \
+                                                    T__* const        y[],                       \
+                                                    rocblas_int       incy,                      \
+                                                    rocblas_int       batch_count)               \
+    {                                                                                            \
+        return gemv(handle,                                                                      \
+                    trans,                                                                       \
+                    m,                                                                           \
+                    n,                                                                           \
+                    host_cast(alpha),                                                            \
+                    host_array(A),                                                               \
+                    lda,                                                                         \
+                    host_array(x),                                                               \
+                    incx,                                                                        \
+                    host_cast(beta),                                                             \
+                    host_array(y),                                                               \
+                    incy,                                                                        \
+                    batch_count);                                                                \
+    }                                                                                            \
+    rocblas_status rocblas_##prefix__##gemv_strided_batched(rocblas_handle    handle,            \
+                                                            rocblas_operation trans,             \
+                                                            rocblas_int       m,                 \
+                                                            rocblas_int       n,                 \
+                                                            const T__*        alpha,             \
+                                                            const T__*        A,                 \
+                                                            rocblas_int       lda,               \
+                                                            rocblas_stride    strideA,           \
+                                                            const T__*        x,                 \
+                                                            rocblas_int       incx,              \
+                                                            rocblas_stride    stridex,           \
+                                                            const T__*        beta,              \
+                                                            T__*              y,                 \
+                                                            rocblas_int       incy,              \
+                                                            rocblas_stride    stridey,           \
+                                                            rocblas_int       batch_count)       \
+    {                                                                                            \
+        return gemv(handle,                                                                      \
+                    trans,                                                                       \
+                    m,                                                                           \
+                    n,                                                                           \
+                    host_cast(alpha),                                                            \
+                    host_stride(A, strideA),                                                     \
+                    lda,                                                                         \
+                    host_stride(x, stridex),                                                     \
+                    incx,                                                                        \
+                    host_cast(beta),                                                             \
+                    host_stride(y, stridey),                                                     \
+                    incy,                                                                        \
+                    batch_count);                                                                \
+    }
+
+#define HOST_GER(name__, conj__, T__)                                                          \
+    rocblas_status rocblas_##name__(rocblas_handle handle,                                     \
+                                    rocblas_int    m,                                          \
+                                    rocblas_int    n,                                          \
+                                    const T__*     alpha,                                      \
+                                    const T__*     x,                                          \
+                                    rocblas_int    incx,                                       \
+                                    const T__*     y,                                          \
+                                    rocblas_int    incy,                                       \
+                                    T__*           A,                                          \
+                                    rocblas_int    lda)                                        \
+    {                                                                                          \
+        return ger<conj__>(handle,                                                             \
+                           m,                                                                  \
+                           n,                                                                  \
+                           host_cast(alpha),                                                   \
+                           host_single(x),                                                     \
+                           incx,                                                               \
+                           host_single(y),                                                     \
+                           incy,                                                               \
+                           host_single(A),                                                     \
+                           lda,                                                                \
+                           1);                                                                 \
+    }                                                                                          \
+    rocblas_status rocblas_##name__##_batched(rocblas_handle   handle,                         \
+                                              rocblas_int      m,                              \
+                                              rocblas_int      n,                              \
+                                              const T__*       alpha,                          \
+                                              const T__* const x[],                            \
+                                              rocblas_int      incx,                           \
+                                              const T__* const y[],                            \
+                                              rocblas_int      incy,                           \
+                                              T__* const       A[],                            \
+                                              rocblas_int      lda,                            \
+                                              rocblas_int      batch_count)                    \
+    {                                                                                          \
+        return ger<conj__>(handle,                                                             \
+                           m,                                                                  \
+                           n,                                                                  \
+                           host_cast(alpha),                                                   \
+                           host_array(x),                                                      \
+                           incx,                                                               \
+                           host_array(y),                                                      \
+                           incy,                                                               \
+                           host_array(A),                                                      \
+                           lda,                                                                \
+                           batch_count);                                                       \
+    }                                                                                          \
+    rocblas_status rocblas_##name__##_strided_batched(rocblas_handle handle,                   \
+                                                      rocblas_int    m,                        \
+                                                      rocblas_int    n,                        \
+                                                      const T__*     alpha,                    \
+                                                      const T__*     x,                        \
+                                                      rocblas_int    incx,                     \
+                                                      rocblas_stride stridex,                  \
+                                                      const T__*     y,                        \
+                                                      rocblas_int    incy,                     \
+                                                      rocblas_stride stridey,                  \
+                                                      T__*           A,                        \
+                                                      rocblas_int    lda,                      \
+                                                      rocblas_stride strideA,                  \
+                                                      rocblas_int    batch_count)              \
+    {                                                                                          \
+        return ger<conj__>(handle,                                                             \
+                           m,                                                                  \
+                           n,                                                                  \
+                           host_cast(alpha),                                                   \
+                           host_stride(x, stridex),                                            \
+                           incx,                                                               \
+                           host_stride(y, stridey),                                            \
+                           incy,                                                               \
+                           host_stride(A, strideA),                                            \
+                           lda,                                                                \
+                           batch_count);                                                       \
+    }
+
+extern "C" {
+
+HOST_GEMV(s, float)
+HOST_GEMV(d, double)
+HOST_GEMV(c, rocblas_float_complex)
+HOST_GEMV(z, rocblas_double_complex)
+
+HOST_GER(sger, false, float)
+HOST_GER(dger, false, double)
+HOST_GER(cgeru, false, rocblas_float_complex)
+HOST_GER(zgeru, false, rocblas_double_complex)
+HOST_GER(cgerc, true, rocblas_float_complex)
+HOST_GER(zgerc, true, rocblas_double_complex)
+
+} // extern "C"
@@ -0,0 +1,735 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// gemm of the host backend, and through it hgemm and the gemm_ex family.
+// Storage types (half, bfloat16) are converted to the compute type as the
+// operands are packed, so the inner loops only ever see the compute type.
+//
+// op(A) is packed a block of k at a time into a column-major panel scaled by
+// alpha. Columns of C are then updated four at a time, each panel column
+// loaded once for the four, in blocks of rows that keep the panel in cache.
+// A single large gemm is split by columns across the thread pool; a batch of
+// small ones is split by batch member.
+
+#include "host_kernels.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    // Rows and depth of a packed panel
+    constexpr rocblas_int row_block   = 128;
+    constexpr rocblas_int depth_block = 256;
+    // Below this many multiply-adds the direct loop beats packing
+    constexpr int64_t small_gemm = 1 << 12;
+
+    bool valid_operation(rocblas_operation op)
+    {
+        return op == rocblas_operation_none || op == rocblas_operation_transpose
+               || op == rocblas_operation_conjugate_transpose;
+    }
+
+    // Element (i, j) of op(M), converted to the compute type
+    template <typename Tc, typename T>
+    inline Tc op_element(rocblas_operation op, const T* M, rocblas_int ld, int64_t i, int64_t j)
+    {
+        if(op == rocblas_operation_none)
+            return host_convert<Tc>(M[i + j * ld]);
+        Tc x = host_convert<Tc>(M[j + i * ld]);
+        return op == rocblas_operation_conjugate_transpose ? host_conj(x) : x;
+    }
+
+    // D = alpha * op(A) * op(B) + beta * C for one matrix
+    template <typename Tc, typename TA, typename TB, typename TC, typename TD>
+    void gemm_kernel(rocblas_operation transA,
+                     rocblas_operation transB,
+                     rocblas_int       m,
+                     rocblas_int       n,
+                     rocblas_int       k,
+                     Tc                alpha,
+                     const TA*         A,
+                     rocblas_int       lda,
+                     const TB*         B,
+                     rocblas_int       ldb,
+                     Tc                beta,
+                     const TC*         C,
+                     rocblas_int       ldc,
+                     TD*               D,
+                     rocblas_int       ldd)
+    {
+        const bool multiply = k && alpha != Tc(0);
+
+        if(int64_t(m) * n * k < small_gemm)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    Tc sum(0);
+                    if(multiply)
+                        for(rocblas_int p = 0; p < k; p++)
+                            sum += op_element<Tc>(transA, A, lda, i, p)
+                                   * op_element<Tc>(transB, B, ldb, p, j);
+                    Tc d = multiply ? alpha * sum : Tc(0);
+                    if(beta != Tc(0))
+                        d = d + beta * host_convert<Tc>(C[i + int64_t(j) * ldc]);
+                    D[i + int64_t(j) * ldd] = host_convert<TD>(d);
+                }
+            return;
+        }
+
+        // Accumulate in D itself when it holds the compute type, else in a
+        // compute type copy
+        constexpr bool in_place = std::is_same<TD, Tc>{};
+        std::vector<Tc> work(in_place ? 0 : size_t(m) * n);
+        Tc*             W   = in_place ? reinterpret_cast<Tc*>(D) : work.data();
+        int64_t         ldw = in_place ? ldd : m;
+
+        const bool same_c = static_cast<const void*>(C) == static_cast<const void*>(D) && ldc == ldd;
+        if(!(in_place && same_c && beta == Tc(1)))
+            hipblas_host_parallel_for(n, 16, [&](int64_t begin, int64_t end) {
+                for(int64_t j = begin; j < end; j++)
+                    for(rocblas_int i = 0; i < m; i++)
+                        W[i + j * ldw] = beta == Tc(0)
+                                             ? Tc(0)
+                                             : beta * host_convert<Tc>(C[i + j * ldc]);
+            });
+
+        if(multiply)
+        {
+            std::vector<Tc> panel(size_t(m) * std::min(k, depth_block));
+            for(rocblas_int pc = 0; pc < k; pc += depth_block)
+            {
+                rocblas_int kc = std::min(depth_block, k - pc);
+
+                hipblas_host_parallel_for(kc, 16, [&](int64_t begin, int64_t end) {
+                    for(int64_t p = begin; p < end; p++)
+                    {
+                        Tc* dst = panel.data() + p * m;
+                        if(transA == rocblas_operation_none)
+                            host_convert_n(A + (pc + p) * lda, dst, m);
+                        else
+                            for(rocblas_int i = 0; i < m; i++)
+                                dst[i] = op_element<Tc>(transA, A, lda, i, pc + p);
+                        for(rocblas_int i = 0; i < m; i++)
+                            dst[i] = alpha * dst[i];
+                    }
+                });
+
+                // Groups of four columns
+                hipblas_host_parallel_for((n + 3) / 4, 4, [&](int64_t begin, int64_t end) {
+                    for(rocblas_int ic = 0; ic < m; ic += row_block)
+                    {
+                        rocblas_int mc = std::min(row_block, m - ic);
+                        for(int64_t g = begin; g < end; g++)
+                        {
+                            int64_t j  = 4 * g;
+                            int     nc = int(std::min<int64_t>(4, n - j));
+                            Tc*     w0 = W + ic + j * ldw;
+                            if(nc == 4)
+                            {
+                                Tc* w1 = w0 + ldw;
+                                Tc* w2 = w1 + ldw;
+                                Tc* w3 = w2 + ldw;
+                                for(rocblas_int p = 0; p < kc; p++)
+                                {
+                                    const Tc* a  = panel.data() + ic + int64_t(p) * m;
+                                    const Tc  b0 = op_element<Tc>(transB, B, ldb, pc + p, j);
+                                    const Tc  b1 = op_element<Tc>(transB, B, ldb, pc + p, j + 1);
+                                    const Tc  b2 = op_element<Tc>(transB, B, ldb, pc + p, j + 2);
+                                    const Tc  b3 = op_element<Tc>(transB, B, ldb, pc + p, j + 3);
+                                    for(rocblas_int i = 0; i < mc; i++)
+                                    {
+                                        const Tc ai = a[i];
+                                        w0[i]       = w0[i] + ai * b0;
+                                        w1[i]       = w1[i] + ai * b1;
+                                        w2[i]       = w2[i] + ai * b2;
+                                        w3[i]       = w3[i] + ai * b3;
+                                    }
+                                }
+                            }
+                            else
+                                for(int c = 0; c < nc; c++)
+                                {
+                                    Tc* w = w0 + c * ldw;
+                                    for(rocblas_int p = 0; p < kc; p++)
+                                    {
+                                        const Tc* a = panel.data() + ic + int64_t(p) * m;
+                                        const Tc  b = op_element<Tc>(transB, B, ldb, pc + p, j + c);
+                                        for(rocblas_int i = 0; i < mc; i++)
+                                            w[i] = w[i] + a[i] * b;
+                                    }
+                                }
+                        }
+                    }
+                });
+            }
+        }
+
+        if(!in_place)
+            hipblas_host_parallel_for(n, 16, [&](int64_t begin, int64_t end) {
+                for(int64_t j = begin; j < end; j++)
+                    for(rocblas_int i = 0; i < m; i++)
+                        D[i + j * ldd] = host_convert<TD>(W[i + j * ldw]);
+            });
+    }
+
+    // Checks of rocBLAS, then the kernel on every batch member. Ts is the type
+    // alpha and beta are stored in, Tc the type the kernel computes in.
+    template <typename Tc, typename Ts, typename MA, typename MB, typename MC, typename MD>
+    rocblas_status gemm(rocblas_handle    handle,
+                        rocblas_operation transA,
+                        rocblas_operation transB,
+                        rocblas_int       m,
+                        rocblas_int       n,
+                        rocblas_int       k,
+                        const Ts*         alpha,
+                        MA                A,
+                        rocblas_int       lda,
+                        MB                B,
+                        rocblas_int       ldb,
+                        const Ts*         beta,
+                        MC                C,
+                        rocblas_int       ldc,
+                        MD                D,
+                        rocblas_int       ldd,
+                        rocblas_int       batch_count)
+    {
+        HOST_CHECK_HANDLE(handle);
+        if(!valid_operation(transA) || !valid_operation(transB))
+            return rocblas_status_invalid_value;
+        rocblas_int rows_a = transA == rocblas_operation_none ? m : k;
+        rocblas_int rows_b = transB == rocblas_operation_none ? k : n;
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, rows_a)
+           || ldb < std::max(1, rows_b) || ldc < std::max(1, m) || ldd < std::max(1, m))
+            return rocblas_status_invalid_size;
+        if(!m || !n || !batch_count)
+            return rocblas_status_success;
+        if(!alpha || !beta)
+            return rocblas_status_invalid_pointer;
+
+        const Tc a = host_convert<Tc>(*host_cast(alpha));
+        const Tc b = host_convert<Tc>(*host_cast(beta));
+        if(!C || !D || (k && a != Tc(0) && (!A || !B)))
+            return rocblas_status_invalid_pointer;
+
+        const bool multiply = k && a != Tc(0);
+        hipblas_host_for_batch(batch_count, int64_t(m) * n * std::max(k, 1), [&](rocblas_int i) {
+            gemm_kernel(transA,
+                        transB,
+                        m,
+                        n,
+                        k,
+                        a,
+                        multiply ? A[i] : nullptr,
+                        lda,
+                        multiply ? B[i] : nullptr,
+                        ldb,
+                        b,
+                        C[i],
+                        ldc,
+                        D[i],
+                        ldd);
+        });
+        return rocblas_status_success;
+    }
+
+    // Element types of the gemm_ex family, and the scalar type of each compute type
+    template <rocblas_datatype type>
+    struct storage;
+
+    template <>
+    struct storage<rocblas_datatype_f16_r>
+    {
+        using type = rocblas_half;
+    };
+
+    template <>
+    struct storage<rocblas_datatype_bf16_r>
+    {
+        using type = rocblas_bfloat16;
+    };
+
+    template <>
+    struct storage<rocblas_datatype_f32_r>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct storage<rocblas_datatype_f64_r>
+    {
+        using type = double;
+    };
+
+    template <>
+    struct storage<rocblas_datatype_f32_c>
+    {
+        using type = rocblas_float_complex;
+    };
+
+    template <>
+    struct storage<rocblas_datatype_f64_c>
+    {
+        using type = rocblas_double_complex;
+    };
+
+    // Batch accessors of the untyped gemm_ex operands
+    enum class ex_layout
+    {
+        strided,
+        batched,
+    };
+
+    template <typename T>
+    host_strided<host_t<T>> ex_operand(const void* p, rocblas_stride stride, ex_layout)
+    {
+        return host_stride(static_cast<T*>(const_cast<void*>(p)), stride);
+    }
+
+    template <typename T>
+    struct ex_batched_operand
+    {
+        static host_batched<host_t<T>> get(const void* p)
+        {
+            return host_array(static_cast<T* const*>(p));
+        }
+    };
+
+    // Run the gemm_ex family for one combination of types. Tc is the type the
+    // kernel computes in, which is float for the 16 bit compute types.
+    template <rocblas_datatype AB, rocblas_datatype CD, rocblas_datatype COMPUTE>
+    rocblas_status gemm_ex_typed(rocblas_handle    handle,
+                                 rocblas_operation transA,
+                                 rocblas_operation transB,
+                                 rocblas_int       m,
+                                 rocblas_int       n,
+                                 rocblas_int       k,
+                                 const void*       alpha,
+                                 const void*       a,
+                                 rocblas_int       lda,
+                                 rocblas_stride    stride_a,
+                                 const void*       b,
+                                 rocblas_int       ldb,
+                                 rocblas_stride    stride_b,
+                                 const void*       beta,
+                                 const void*       c,
+                                 rocblas_int       ldc,
+                                 rocblas_stride    stride_c,
+                                 void*             d,
+                                 rocblas_int       ldd,
+                                 rocblas_stride    stride_d,
+                                 rocblas_int       batch_count,
+                                 ex_layout         layout)
+    {
+        using TA = const typename storage<AB>::type;
+        using TC = const typename storage<CD>::type;
+        using TD = typename storage<CD>::type;
+        using Ts = typename storage<COMPUTE>::type;
+        using Tc = std::conditional_t<std::is_same<Ts, rocblas_half>{}
+                                          || std::is_same<Ts, rocblas_bfloat16>{},
+                                      float,
+                                      host_t<Ts>>;
+
+        const Ts* alpha_t = static_cast<const Ts*>(alpha);
+        const Ts* beta_t  = static_cast<const Ts*>(beta);
+        if(layout == ex_layout::batched)
+            return gemm<Tc>(handle,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha_t,
+                            ex_batched_operand<TA>::get(a),
+                            lda,
+                            ex_batched_operand<TA>::get(b),
+                            ldb,
+                            beta_t,
+                            ex_batched_operand<TC>::get(c),
+                            ldc,
+                            ex_batched_operand<TD>::get(d),
+                            ldd,
+                            batch_count);
+        return gemm<Tc>(handle,
+                        transA,
+                        transB,
+                        m,
+                        n,
+                        k,
+                        alpha_t,
+                        ex_operand<TA>(a, stride_a, layout),
+                        lda,
+                        ex_operand<TA>(b, stride_b, layout),
+                        ldb,
+                        beta_t,
+                        ex_operand<TC>(c, stride_c, layout),
+                        ldc,
+                        ex_operand<TD>(d, stride_d, layout),
+                        ldd,
+                        batch_count);
+    }
+
+    // The type combinations of gemm_ex the host backend supports: the
+    // floating point ones of rocBLAS. int8 returns rocblas_status_not_implemented.
+    rocblas_status gemm_ex_dispatch(rocblas_handle    handle,
+                                    rocblas_operation transA,
+                                    rocblas_operation transB,
+                                    rocblas_int       m,
+                                    rocblas_int       n,
+                                    rocblas_int       k,
+                                    const void*       alpha,
+                                    const void*       a,
+                                    rocblas_datatype  a_type,
+                                    rocblas_int       lda,
+                                    rocblas_stride    stride_a,
+                                    const void*       b,
+                                    rocblas_datatype  b_type,
+                                    rocblas_int       ldb,
+                                    rocblas_stride    stride_b,
+                                    const void*       beta,
+                                    const void*       c,
+                                    rocblas_datatype  c_type,
+                                    rocblas_int       ldc,
+                                    rocblas_stride    stride_c,
+                                    void*             d,
+                                    rocblas_datatype  d_type,
+                                    rocblas_int       ldd,
+                                    rocblas_stride    stride_d,
+                                    rocblas_int       batch_count,
+                                    rocblas_datatype  compute_type,
+                                    ex_layout         layout)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+        if(a_type != b_type || c_type != d_type)
+            return rocblas_status_not_implemented;
+
+#define HOST_GEMM_EX_CASE(ab__, cd__, compute__)                                         \
+    if(a_type == rocblas_datatype_##ab__ && c_type == rocblas_datatype_##cd__            \
+       && compute_type == rocblas_datatype_##compute__)                                  \
+        return gemm_ex_typed<rocblas_datatype_##ab__,                                    \
+                             rocblas_datatype_##cd__,                                    \
+                             rocblas_datatype_##compute__>(handle,                       \
+                                                           transA,                       \
+                                                           transB,                       \
+                                                           m,                            \
+                                                           n,                            \
+                                                           k,                            \
+                                                           alpha,                        \
+                                                           a,                            \
+                                                           lda,                          \
+                                                           stride_a,                     \
+                                                           b,                            \
+                                                           ldb,                          \
+                                                           stride_b,                     \
+                                                           beta,                         \
+                                                           c,                            \
+                                                           ldc,                          \
+                                                           stride_c,                     \
+                                                           d,                            \
+                                                           ldd,                          \
+                                                           stride_d,                     \
+                                                           batch_count,                  \
+                                                           layout);
+
+        HOST_GEMM_EX_CASE(f16_r, f16_r, f16_r)
+        HOST_GEMM_EX_CASE(f16_r, f16_r, f32_r)
+        HOST_GEMM_EX_CASE(f16_r, f32_r, f32_r)
+        HOST_GEMM_EX_CASE(bf16_r, bf16_r, f32_r)
+        HOST_GEMM_EX_CASE(bf16_r, f32_r, f32_r)
+        HOST_GEMM_EX_CASE(f32_r, f32_r, f32_r)
+        HOST_GEMM_EX_CASE(f64_r, f64_r, f64_r)
+        HOST_GEMM_EX_CASE(f32_c, f32_c, f32_c)
+        HOST_GEMM_EX_CASE(f64_c, f64_c, f64_c)
+
+#undef HOST_GEMM_EX_CASE
+
+        return rocblas_status_not_implemented;
+    }
+}
+
+// Typed gemm, computing half precision in float
+#define HOST_GEMM(prefix__, T__, Tc__)                                                         \
+    rocblas_status rocblas_##prefix__##gemm(rocblas_handle    handle,                          \
+                                            rocblas_operation transA,                          \
+                                            rocblas_operation transB,                          \
+                                            rocblas_int       m,                               \
+                                            rocblas_int       n,                               \
+                                            rocblas_int       k,                               \
+                                            const T__*        alpha,                           \
+                                            const T__*        A,                               \
+                                            rocblas_int       lda,                             \
+                                            const T__*        B,                               \
+                                            rocblas_int       ldb,                             \
+                                            const T__*        beta,                            \
+                                            T__*              C,                               \
+                                            rocblas_int       ldc)                             \
+    {                                                                                          \
+        return gemm<Tc__>(handle,                                                              \
+                          transA,                                                              \
+                          transB,                                                              \
+                          m,                                                                   \
+                          n,                                                                   \
+                          k,                                                                   \
+                          alpha,                                                               \
+                          host_single(A),                                                      \
+                          lda,                                                                 \
+                          host_single(B),                                                      \
+                          ldb,                                                                 \
+                          beta,                                                                \
+                          host_single(C),                                                      \
+                          ldc,                                                                 \
+                          host_single(C),                                                      \
+                          ldc,                                                                 \
+                          1);                                                                  \
+    }                                                                                          \
+    rocblas_status rocblas_##prefix__##gemm_batched(rocblas_handle    handle,                  \
+                                                    rocblas_operation transA,                  \
+                                                    rocblas_operation transB,                  \
+                                                    rocblas_int       m,                       \
+                                                    rocblas_int       n,                       \
+                                                    rocblas_int       k,                       \
+                                                    const T__*        alpha,                   \
+                                                    const T__* const  A[],                     \
+                                                    rocblas_int       lda,                     \
+                                                    const T__* const  B[],                     \
+                                                    rocblas_int       ldb,                     \
+                                                    const T__*        beta,                    \
+                                                    T__* const        C[],                     \
+                                                    rocblas_int       ldc,                     \
+                                                    rocblas_int       batch_count)             \
+    {                                                                                          \
+        return gemm<Tc__>(handle,                                                              \
+                          transA,                                                              \
+                          transB,                                                              \
+                          m,                                                                   \
+                          n,                                                                   \
+                          k,                                                                   \
+                          alpha,                                                               \
+                          host_array(A),                                                       \
+                          lda,                                                                 \
+                          host_array(B),                                                       \
+                          ldb,                                                                 \
+                          beta,                                                                \
+                          host_array(C),                                                       \
+                          ldc,                                                                 \
+                          host_array(C),                                                       \
+                          ldc,                                                                 \
+                          batch_count);                                                        \
+    }                                                                                          \
+    rocblas_status rocblas_##prefix__##gemm_strided_batched(rocblas_handle    handle,          \
+                                                            rocblas_operation transA,          \
+                                                            rocblas_operation transB,          \
+                                                            rocblas_int       m,               \
+                                                            rocblas_int       n,               \
+                                                            rocblas_int       k,               \
+                                                            const T__*        alpha,           \
+                                                            const T__*        A,               \
+                                                            rocblas_int       lda,             \
+                                                            rocblas_stride    stride_a,        \
+                                                            const T__*        B,               \
+                                                            rocblas_int       ldb,             \
+                                                            rocblas_stride    stride_b,        \
+                                                            const T__*        beta,            \
+                                                            T__*              C,               \
+                                                            rocblas_int       ldc,             \
+                                                            rocblas_stride    stride_c,        \
+                                                            rocblas_int       batch_count)     \
+    {                                                                                          \
+        return gemm<Tc__>(handle,                                                              \
+                          transA,                                                              \
+                          transB,                                                              \
+                          m,                                                                   \
+                          n,                                                                   \
+                          k,                                                                   \
+                          alpha,                                                               \
+                          host_stride(A, stride_a),                                            \
+                          lda,                                                                 \
+                          host_stride(B, stride_b),                                            \
+                          ldb,                                                                 \
+                          beta,                                                                \
+                          host_stride(C, stride_c),                                            \
+                          ldc,                                                                 \
+                          host_stride(C, stride_c),                                            \
+                          ldc,                                                                 \
+                          batch_count);                                                        \
+    }
+
+extern "C" {
+
+HOST_GEMM(h, rocblas_half, float)
+HOST_GEMM(s, float, float)
+HOST_GEMM(d, double, double)
+HOST_GEMM(c, rocblas_float_complex, host_complex<float>)
+HOST_GEMM(z, rocblas_double_complex, host_complex<double>)
+
+rocblas_status rocblas_gemm_ex(rocblas_handle    handle,
+                               rocblas_operation transA,
+                               rocblas_operation transB,
+                               rocblas_int       m,
+                               rocblas_int       n,
+                               rocblas_int       k,
+                               const void*       alpha,
+                               const void*       a,
+                               rocblas_datatype  a_type,
+                               rocblas_int       lda,
+                               const void*       b,
+                               rocblas_datatype  b_type,
+                               rocblas_int       ldb,
+                               const void*       beta,
+                               const void*       c,
+                               rocblas_datatype  c_type,
+                               rocblas_int       ldc,
+                               void*             d,
+                               rocblas_datatype  d_type,
+                               rocblas_int       ldd,
+                               rocblas_datatype  compute_type,
+                               rocblas_gemm_algo,
+                               int32_t,
+                               uint32_t)
+{
+    return gemm_ex_dispatch(handle,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            a,
+                            a_type,
+                            lda,
+                            0,
+                            b,
+                            b_type,
+                            ldb,
+                            0,
+                            beta,
+                            c,
+                            c_type,
+                            ldc,
+                            0,
+                            d,
+                            d_type,
+                            ldd,
+                            0,
+                            1,
+                            compute_type,
+                            ex_layout::strided);
+}
+
+rocblas_status rocblas_gemm_batched_ex(rocblas_handle    handle,
+                                       rocblas_operation transA,
+                                       rocblas_operation transB,
+                                       rocblas_int       m,
+                                       rocblas_int       n,
+                                       rocblas_int       k,
+                                       const void*       alpha,
+                                       const void*       a,
+                                       rocblas_datatype  a_type,
+                                       rocblas_int       lda,
+                                       const void*       b,
+                                       rocblas_datatype  b_type,
+                                       rocblas_int       ldb,
+                                       const void*       beta,
+                                       const void*       c,
+                                       rocblas_datatype  c_type,
+                                       rocblas_int       ldc,
+                                       void*             d,
+                                       rocblas_datatype  d_type,
+                                       rocblas_int       ldd,
+                                       rocblas_int       batch_count,
+                                       rocblas_datatype  compute_type,
+                                       rocblas_gemm_algo,
+                                       int32_t,
+                                       uint32_t)
+{
+    return gemm_ex_dispatch(handle,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            a,
+                            a_type,
+                            lda,
+                            0,
+                            b,
+                            b_type,
+                            ldb,
+                            0,
+                            beta,
+                            c,
+                            c_type,
+                            ldc,
+                            0,
+                            d,
+                            d_type,
+                            ldd,
+                            0,
+                            batch_count,
+                            compute_type,
+                            ex_layout::batched);
+}
+
+rocblas_status rocblas_gemm_strided_batched_ex(rocblas_handle    handle,
+                                               rocblas_operation transA,
+                                               rocblas_operation transB,
+                                               rocblas_int       m,
+                                               rocblas_int       n,
+                                               rocblas_int       k,
+                                               const void*       alpha,
+                                               const void*       a,
+                                               rocblas_datatype  a_type,
+                                               rocblas_int       lda,
+                                               rocblas_stride    stride_a,
+                                               const void*       b,
+                                               rocblas_datatype  b_type,
+                                               rocblas_int       ldb,
+                                               rocblas_stride    stride_b,
+                                               const void*       beta,
+                                               const void*       c,
+                                               rocblas_datatype  c_type,
+                                               rocblas_int       ldc,
+                                               rocblas_stride    stride_c,
+                                               void*             d,
+                                               rocblas_datatype  d_type,
+                                               rocblas_int       ldd,
+                                               rocblas_stride    stride_d,
+                                               rocblas_int       batch_count,
+                                               rocblas_datatype  compute_type,
+                                               rocblas_gemm_algo,
+                                               int32_t,
+                                               uint32_t)
+{
+    return gemm_ex_dispatch(handle,
+                            transA,
+                            transB,
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            a,
+                            a_type,
+                            lda,
+                            stride_a,
+                            b,
+                            b_type,
+                            ldb,
+                            stride_b,
+                            beta,
+                            c,
+                            c_type,
+                            ldc,
+                            stride_c,
+                            d,
+                            d_type,
+                            ldd,
+                            stride_d,
+                            batch_count,
+                            compute_type,
+                            ex_layout::strided);
+}
+
+} // extern "C"
@@ -0,0 +1,80 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// The gemm post-op of the host backend, run over the columns of C once the
+// gemm has returned. Half and bfloat16 are computed in float like the GPU
+// kernel does.
+
+#include "host_kernels.hpp"
+#include "post_op.hpp"
+
+namespace
+{
+    // Work type of a storage type
+    template <typename T>
+    struct host_work
+    {
+        using type = T;
+    };
+
+    template <>
+    struct host_work<rocblas_half>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct host_work<rocblas_bfloat16>
+    {
+        using type = float;
+    };
+
+    template <typename T, typename S>
+    hipblasStatus_t run_post_op(const hipblas_post_op_args& args)
+    {
+        using W = typename host_work<T>::type;
+
+        const hipblasPostOp_t& e     = args.post_op;
+        T*                     c     = static_cast<T*>(args.c);
+        const T*               bias  = static_cast<const T*>(e.bias);
+        const S*               scale = static_cast<const S*>(e.scale);
+        T*                     aux   = static_cast<T*>(e.aux);
+
+        hipblas_host_for_batch(args.batch_count, int64_t(args.m) * args.n, [&](rocblas_int b) {
+            for(int j = 0; j < args.n; j++)
+            {
+                T* cj = c + b * args.stride_c + int64_t(j) * args.ldc;
+                W  s  = scale ? host_convert<W>(scale[b * e.stride_scale + j]) : W(1);
+                for(int i = 0; i < args.m; i++)
+                {
+                    W z = host_convert<W>(cj[i]);
+                    if(bias)
+                        z += host_convert<W>(bias[b * e.stride_bias + i]);
+                    if(aux)
+                        aux[b * e.stride_aux + i + int64_t(j) * e.ld_aux] = host_convert<T>(z);
+                    cj[i] = host_convert<T>(hipblas_activation(e.activation, z) * s);
+                }
+            }
+        });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblas_run_post_op(hipblasHandle_t, const hipblas_post_op_args& args)
+{
+    switch(args.c_type)
+    {
+    case HIPBLAS_R_16F:
+        return args.compute_type == HIPBLAS_R_16F ? run_post_op<rocblas_half, rocblas_half>(args)
+                                                  : run_post_op<rocblas_half, float>(args);
+    case HIPBLAS_R_16B:
+        return run_post_op<rocblas_bfloat16, float>(args);
+    case HIPBLAS_R_32F:
+        return run_post_op<float, float>(args);
+    case HIPBLAS_R_64F:
+        return run_post_op<double, double>(args);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
@@ -0,0 +1,28 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Fallbacks of the host backend for the rocblas_ and rocsolver_ symbols it
+// has no kernel for. Each is a weak hidden definition returning
+// rocblas_status_not_implemented, which hipBLAS reports as
+// HIPBLAS_STATUS_NOT_SUPPORTED; the definitions in the other host_detail
+// sources replace them at link time.
+//
+// rocblas.h is deliberately not included, as the fallbacks do not match the
+// declared signatures.
+
+#define HIPBLAS_HOST_FALLBACK extern "C" __attribute__((weak, visibility("hidden")))
+
+namespace
+{
+    constexpr int hipblas_host_not_implemented = 2; // rocblas_status_not_implemented
+}
+
+#define HIPBLAS_ROCBLAS_SYMBOL(name__)       \
+    HIPBLAS_HOST_FALLBACK int name__()       \
+    {                                        \
+        return hipblas_host_not_implemented; \
+    }
+#define HIPBLAS_ROCSOLVER_SYMBOL(name__) HIPBLAS_ROCBLAS_SYMBOL(name__)
+
+#include "backend_symbols.hpp"
@@ -0,0 +1,195 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "logging.hpp"
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// What makes gemm calls mergeable into one batched call: everything but the
+// matrix pointers. alpha and beta are held by value in host pointer mode, as
+// the caller's copies may be gone when the calls run. In device pointer mode
+// they are held by the address of a copy made on the stream when the call is
+// deferred, as the caller may change them before the calls run, so such calls
+// are not merged.
+struct hipblas_gemm_shape
+{
+    hipblasOperation_t   trans_a;
+    hipblasOperation_t   trans_b;
+    int                  m;
+    int                  n;
+    int                  k;
+    int                  lda;
+    int                  ldb;
+    int                  ldc;
+    hipblasDatatype_t    a_type;
+    hipblasDatatype_t    b_type;
+    hipblasDatatype_t    c_type;
+    hipblasDatatype_t    compute_type;
+    hipblasGemmAlgo_t    algo;
+    hipblasPointerMode_t pointer_mode;
+    unsigned char        alpha[16];
+    unsigned char        beta[16];
+
+    bool operator==(const hipblas_gemm_shape& other) const;
+};
+
+// Gemm calls of one shape waiting to run
+struct hipblas_gemm_group
+{
+    hipblas_gemm_shape       shape;
+    std::vector<const void*> a;
+    std::vector<const void*> b;
+    std::vector<void*>       c;
+};
+
+// Bytes spanned by a matrix, used to find calls depending on one another
+struct hipblas_memory_range
+{
+    const char* begin;
+    const char* end;
+
+    bool overlaps(const hipblas_memory_range& other) const
+    {
+        return begin < other.end && other.begin < end;
+    }
+};
+
+// The gemm calls a handle in HIPBLAS_COALESCING_ON mode has deferred. Held in
+// hipblas_handle_state.
+class hipblas_gemm_coalescer
+{
+public:
+    ~hipblas_gemm_coalescer();
+
+    // Turning coalescing off runs the deferred calls, returning as flush does
+    hipblasStatus_t         set_mode(hipblasHandle_t handle, hipblasCoalescingMode_t mode);
+    hipblasCoalescingMode_t mode();
+
+    // Defer a call, or leave it to the caller to run now after running the
+    // deferred calls. Returns true with the status of the call if deferred.
+    bool defer(hipblasHandle_t           handle,
+               const hipblas_gemm_shape& shape,
+               const void*               A,
+               const void*               B,
+               void*                     C,
+               hipblasStatus_t&          status);
+
+    // Run the deferred calls before a call which may depend on them. Errors
+    // are kept for flush to return.
+    void run_deferred(hipblasHandle_t handle);
+
+    // Run the deferred calls. Returns the first error since the last flush.
+    hipblasStatus_t flush(hipblasHandle_t handle);
+
+private:
+    void run(hipblasHandle_t handle);
+
+    // Copy the device alpha and beta of shape to m_scalars, pointing shape at
+    // the copies. Returns false if they cannot be copied.
+    bool copy_scalars(hipblasHandle_t handle, hipblas_gemm_shape& shape);
+
+    std::mutex                        m_mutex;
+    bool                              m_enabled = false;
+    hipblasHandle_t                   m_handle  = nullptr;
+    std::vector<hipblas_gemm_group>   m_groups;
+    std::vector<hipblas_memory_range> m_reads;
+    std::vector<hipblas_memory_range> m_writes;
+    hipblasStatus_t                   m_status = HIPBLAS_STATUS_SUCCESS;
+
+    // Device copies of the scalars of the deferred device pointer mode calls,
+    // written on m_scalars_stream
+    unsigned char* m_scalars        = nullptr;
+    hipStream_t    m_scalars_stream = nullptr;
+    size_t         m_scalars_used   = 0;
+};
+
+// The stream of handle, as hipblasGetStream returns it but without running
+// the deferred calls. Defined by each backend.
+hipblasStatus_t hipblas_get_stream(hipblasHandle_t handle, hipStream_t* stream);
+
+// Set on a thread while it runs deferred calls through the public gemm entry
+// points, which must then neither defer them again nor log them twice
+extern thread_local bool hipblas_coalescer_running;
+
+// Whether func is an entry point whose calls are deferred rather than being
+// a dependency of the deferred calls
+bool hipblas_coalesced_entry_point(const char* func);
+
+bool hipblas_defer_gemm(hipblasHandle_t    handle,
+                        hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int                m,
+                        int                n,
+                        int                k,
+                        const void*        alpha,
+                        const void*        A,
+                        hipblasDatatype_t  aType,
+                        int                lda,
+                        const void*        B,
+                        hipblasDatatype_t  bType,
+                        int                ldb,
+                        const void*        beta,
+                        void*              C,
+                        hipblasDatatype_t  cType,
+                        int                ldc,
+                        hipblasDatatype_t  computeType,
+                        hipblasGemmAlgo_t  algo,
+                        hipblasStatus_t&   status);
+
+// Called by the gemm entry points with the arguments of hipblasGemmEx. Returns
+// true, with the status to return, if the call has been deferred, false if it
+// is to run now. Costs a single branch unless some handle is coalescing.
+template <typename... Ts>
+inline bool hipblas_coalesce_gemm(Ts&&... args)
+{
+    return (hipblas_log_layer.load(std::memory_order_relaxed) & hipblas_layer_mode_coalescing)
+           && !hipblas_coalescer_running && hipblas_defer_gemm(std::forward<Ts>(args)...);
+}
+
+// Run the calls deferred on every coalescing handle before a call on handle
+// which may depend on them. The deferred calls are not yet on any stream, so
+// a call on another handle may read what they are still to write. The gemm
+// entry points leave out their own handle, whose calls the coalescer orders.
+void hipblas_flush_coalesced(hipblasHandle_t handle, bool own_calls = true);
+
+inline void hipblas_coalescing_dependency(hipblasHandle_t handle)
+{
+    if((hipblas_log_layer.load(std::memory_order_relaxed) & hipblas_layer_mode_coalescing)
+       && !hipblas_coalescer_running)
+        hipblas_flush_coalesced(handle);
+}
+
+// Defer the enclosing gemm entry point if its handle is coalescing. Its
+// arguments must be named as those of hipblasSgemm; type__ is the
+// hipblasDatatype_t of its matrices and scalars.
+#define HIPBLAS_COALESCE_GEMM(type__)                                                 \
+    do                                                                                \
+    {                                                                                 \
+        hipblasStatus_t coalesce_status__;                                            \
+        if(hipblas_coalesce_gemm(handle,                                              \
+                                 transa,                                              \
+                                 transb,                                              \
+                                 m,                                                   \
+                                 n,                                                   \
+                                 k,                                                   \
+                                 (const void*)alpha,                                  \
+                                 (const void*)A,                                      \
+                                 type__,                                              \
+                                 lda,                                                 \
+                                 (const void*)B,                                      \
+                                 type__,                                              \
+                                 ldb,                                                 \
+                                 (const void*)beta,                                   \
+                                 (void*)C,                                            \
+                                 type__,                                              \
+                                 ldc,                                                 \
+                                 type__,                                              \
+                                 HIPBLAS_GEMM_DEFAULT,                                \
+                                 coalesce_status__))                                  \
+            return coalesce_status__;                                                 \
+    } while(0)
@@ -0,0 +1,93 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// batch_count m-by-n matrices of type in the memory of the backend, matrix b
+// being at array[b] if array is set, and at data + b * stride elements
+// otherwise
+struct hipblas_matrix_batch
+{
+    hipblasDatatype_t type;
+    void*             data;
+    void* const*      array;
+    int               ld;
+    hipblasStride     stride;
+};
+
+// The conversions hipblas_convert_matrices runs: between float or double and
+// any of half, bfloat16, int8, float and double, and between single and double
+// complex, including copies within a type
+inline bool hipblas_convert_supported(hipblasDatatype_t src_type, hipblasDatatype_t dst_type)
+{
+    auto real = [](hipblasDatatype_t type) {
+        return type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_8I
+               || type == HIPBLAS_R_32F || type == HIPBLAS_R_64F;
+    };
+    auto wide = [](hipblasDatatype_t type) {
+        return type == HIPBLAS_R_32F || type == HIPBLAS_R_64F;
+    };
+
+    switch(src_type)
+    {
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_64F:
+        return dst_type == HIPBLAS_C_32F || dst_type == HIPBLAS_C_64F;
+    default:
+        return real(src_type) && real(dst_type) && (wide(src_type) || wide(dst_type));
+    }
+}
+
+// dst_b = src_b, converted to the type of dst, on the stream of handle. If
+// overflow is set, overflow[b] is set to 1 when a finite element of src_b is
+// beyond the range of the type of dst, and left as is otherwise. Defined by
+// each backend.
+hipblasStatus_t hipblas_convert_matrices(hipblasHandle_t             handle,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblas_matrix_batch& src,
+                                         const hipblas_matrix_batch& dst,
+                                         int                         batch_count,
+                                         int*                        overflow);
+
+// dst[i] = src[i] for n elements of host memory converted from src_type to
+// dst_type, a pair hipblas_convert_supported allows, with vector instructions
+// where the host has them. Half is rounded through float. Elements beyond
+// the range of an integer type saturate. Returns whether a finite element
+// was beyond the range of dst_type.
+bool hipblas_host_convert(hipblasDatatype_t src_type,
+                          const void*       src,
+                          hipblasDatatype_t dst_type,
+                          void*             dst,
+                          int64_t           n);
+
+// dst_b = src_b for matrices of elem_size byte elements of any type, which the
+// type of the batches does not describe, on the stream of handle. Defined by
+// each backend.
+hipblasStatus_t hipblas_copy_matrices(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      int                         elem_size,
+                                      const hipblas_matrix_batch& src,
+                                      const hipblas_matrix_batch& dst,
+                                      int                         batch_count);
+
+enum class hipblas_matrix_norm
+{
+    row_sums, // norms[b * m + i] = sum over j of |x_ij|
+    column_max, // norms[b * n + j] = max over i of |x_ij|
+};
+
+// Norms of the double or double complex matrices x_b in device memory, on the
+// stream of handle. |x| of a complex x is |re(x)| + |im(x)|. Defined by each
+// backend.
+hipblasStatus_t hipblas_matrix_norms(hipblasHandle_t             handle,
+                                     hipblas_matrix_norm         norm,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblas_matrix_batch& x,
+                                     int                         batch_count,
+                                     double*                     norms);
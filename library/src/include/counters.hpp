@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "logging.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// How the counters read the arguments of an entry point, worked out from its
+// name and argument names the first time a thread calls it. Argument indices
+// are -1 when the entry point has no such argument.
+struct hipblas_counter_model
+{
+    // Routine family, or -1 if calls of the entry point are not counted
+    int family = -1;
+    // Precision, or -1 to take the type of argument datatype_arg
+    int  type                = -1;
+    int  datatype_arg        = -1;
+    bool datatype_is_operand = false;
+
+    int m           = -1;
+    int n           = -1;
+    int k           = -1;
+    int kl          = -1;
+    int ku          = -1;
+    int nrhs        = -1;
+    int trans       = -1;
+    int side        = -1;
+    int batch_count = -1;
+};
+
+hipblas_counter_model hipblas_make_counter_model(const char*                     func,
+                                                 const std::vector<std::string>& names);
+
+// Add a call to the calling thread's shard of the handle's counters. Returns
+// a timer whose start event has been recorded when the handle measures
+// device time, or nullptr.
+hipblas_call_timer* hipblas_count_call(hipblasHandle_t              handle,
+                                       const hipblas_counter_model& model,
+                                       const hipblas_log_value*     values);
+
+// Totals of one family, as stored in a shard
+struct hipblas_counter_totals
+{
+    uint64_t calls          = 0;
+    double   gflop          = 0;
+    double   gbyte          = 0;
+    double   device_time_ms = 0;
+};
+
+class hipblas_counter_shard;
+
+// Counters of one handle. Every thread calling on the handle adds to a shard
+// of its own, which only that thread writes, so counting never locks; the
+// shards are summed when the counters are read. Held in hipblas_handle_state.
+class hipblas_handle_counters
+{
+public:
+    ~hipblas_handle_counters();
+
+    void set_mode(hipblasCountersMode_t mode);
+
+    // Create the calling thread's shard
+    std::shared_ptr<hipblas_counter_shard> add_shard();
+
+    // Totals since the last reset, by family
+    std::vector<hipblas_counter_totals> read();
+
+    void reset();
+
+private:
+    std::vector<hipblas_counter_totals> sum();
+
+    std::mutex                                          m_mutex;
+    hipblasCountersMode_t                               m_mode = HIPBLAS_COUNTERS_OFF;
+    std::vector<std::shared_ptr<hipblas_counter_shard>> m_shards;
+    // Totals of the shards of exited threads, and the totals at the last reset
+    std::vector<hipblas_counter_totals> m_retired;
+    std::vector<hipblas_counter_totals> m_baseline;
+};
+
+// Name of a routine family, as reported by hipblasGetHandleCounters
+const char* hipblas_counter_family_name(int family);
+
+int hipblas_counter_family_count();
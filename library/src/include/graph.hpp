@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Support for calls made between hipblasGraphBegin and hipblasGraphEnd.
+//
+// A captured call does not run until the graph is launched, possibly many
+// times, so results it returns in host memory cannot be copied there by a
+// synchronous copy at the end of the call. Instead the routine writes them to
+// pinned staging memory owned by the graph, and a host node copies them to
+// the caller's pointer each time the graph runs.
+
+#include "hipblas.h"
+#include "handle.hpp"
+#include <cstddef>
+
+inline bool hipblas_is_capturing(hipblasHandle_t handle)
+{
+    return handle && hipblas_get_handle_state(handle)->capture.resources;
+}
+
+// Return size bytes of pinned, device accessible host memory which lives as
+// long as the graph being captured on handle, or nullptr if it cannot be
+// allocated
+void* hipblas_capture_staging(hipblasHandle_t handle, size_t size);
+
+// Capture a copy of size bytes from staging to the host memory at dst, made
+// after the work captured on stream so far
+hipblasStatus_t hipblas_capture_copy_to_host(
+    hipblasHandle_t handle, hipStream_t stream, void* dst, const void* staging, size_t size);
+
+// Make sure the backend workspace is at least size bytes before a capture
+// starts; defined by each backend
+hipblasStatus_t hipblas_reserve_capture_workspace(hipblasHandle_t handle, size_t size);
+
+// Bytes taken by one value of type, for routines returning results of a
+// runtime type
+inline size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    }
+    return 0;
+}
+
+// Run call(result) for a routine returning size bytes at result. While
+// capturing in host pointer mode the routine runs in device pointer mode on
+// staging memory, which is copied to result when the graph runs.
+template <typename F>
+hipblasStatus_t
+    hipblas_capture_result_bytes(hipblasHandle_t handle, void* result, size_t size, F&& call)
+{
+    hipblasPointerMode_t mode;
+    if(!hipblas_is_capturing(handle) || !size || !result
+       || hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || mode != HIPBLAS_POINTER_MODE_HOST)
+        return call(result);
+
+    void* staging = hipblas_capture_staging(handle, size);
+    if(!staging)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    hipblasStatus_t status = call(staging);
+    hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblas_capture_copy_to_host(handle, stream, result, staging, size);
+}
+
+// The same for a routine returning count values of T
+template <typename T, typename F>
+hipblasStatus_t hipblas_capture_result(hipblasHandle_t handle, T* result, int count, F&& call)
+{
+    size_t size = count > 0 ? sizeof(T) * count : 0;
+    return hipblas_capture_result_bytes(
+        handle, result, size, [&](void* target) { return call(static_cast<T*>(target)); });
+}
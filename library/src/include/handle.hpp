@@ -0,0 +1,301 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "coalesce.hpp"
+#include "counters.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Solver routines whose device workspace requirement is memoized per handle.
+// Batched and strided batched forms need different amounts of workspace, so
+// each variant is its own routine.
+enum class hipblas_solver_routine : int
+{
+    getrf,
+    getrf_npvt,
+    getrf_batched,
+    getrf_npvt_batched,
+    getrf_strided_batched,
+    getrf_npvt_strided_batched,
+    getrs,
+    getrs_batched,
+    getrs_strided_batched,
+    getri_outofplace_batched,
+    getri_npvt_outofplace_batched,
+    geqrf,
+    geqrf_ptr_batched,
+    geqrf_strided_batched,
+    gesv_batched,
+    gesv_strided_batched,
+};
+
+// The workspace needed by a solver call only depends on these values
+struct hipblas_workspace_key
+{
+    hipblas_solver_routine routine;
+    char                   precision;
+    int                    m;
+    int                    n;
+    int                    nrhs;
+    int                    batch_count;
+
+    bool operator==(const hipblas_workspace_key& rhs) const
+    {
+        return routine == rhs.routine && precision == rhs.precision && m == rhs.m && n == rhs.n
+               && nrhs == rhs.nrhs && batch_count == rhs.batch_count;
+    }
+};
+
+struct hipblas_workspace_key_hash
+{
+    size_t operator()(const hipblas_workspace_key& key) const
+    {
+        size_t seed = std::hash<int>{}(int(key.routine));
+        auto   mix  = [&seed](size_t value) {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+        mix(size_t(key.precision));
+        mix(std::hash<int>{}(key.m));
+        mix(std::hash<int>{}(key.n));
+        mix(std::hash<int>{}(key.nrhs));
+        mix(std::hash<int>{}(key.batch_count));
+        return seed;
+    }
+};
+
+// Memo of the device workspace sizes reported by the backend's size query,
+// so that a known shape can pre-size the workspace and run exactly once
+class hipblas_workspace_cache
+{
+public:
+    // Return true and set size if key has been seen before on this handle
+    bool find(const hipblas_workspace_key& key, size_t& size);
+
+    void insert(const hipblas_workspace_key& key, size_t size);
+
+    void get_stats(size_t* hits, size_t* misses) const;
+
+private:
+    std::mutex                                                                    m_mutex;
+    std::unordered_map<hipblas_workspace_key, size_t, hipblas_workspace_key_hash> m_sizes;
+    std::atomic<size_t>                                                           m_hits{0};
+    std::atomic<size_t>                                                           m_misses{0};
+};
+
+// Backend gemm_ex flags for int8 inputs, resolved once for the device and
+// stream of the handle. Cleared whenever the handle's stream changes.
+struct hipblas_int8_layout
+{
+    bool     valid  = false;
+    int      device = -1;
+    uint32_t flags  = 0;
+};
+
+// What a graph being captured owns, see graph.cpp
+struct hipblas_graph_resources;
+
+// Graph capture state of a handle. The backend workspace cannot be replaced
+// while capturing, and replacing it afterwards invalidates the graphs
+// captured before, which still refer to the old one.
+struct hipblas_graph_capture
+{
+    hipblas_graph_capture() = default;
+    hipblas_graph_capture(const hipblas_graph_capture&) = delete;
+    hipblas_graph_capture& operator=(const hipblas_graph_capture&) = delete;
+    ~hipblas_graph_capture();
+
+    // Set between hipblasGraphBegin and hipblasGraphEnd
+    hipblas_graph_resources* resources = nullptr;
+
+    // Set when a call during the capture needed more workspace than reserved
+    bool workspace_exhausted = false;
+
+    // Set once hipBLAS has sized the backend workspace itself
+    bool workspace_sized = false;
+
+    // Workspace the next capture reserves: the most a capture ran out of
+    size_t workspace_reserve = 0;
+
+    // Incremented whenever the workspace is replaced
+    std::atomic<uint64_t> workspace_generation{0};
+};
+
+// Workspace of the backend routines of a handle. The backend allocates it,
+// and hipBLAS grows it as calls need more, until hipblasSetWorkspace gives
+// the handle memory of the application's, which hipBLAS never replaces.
+struct hipblas_backend_workspace
+{
+    // Set while the workspace is the application's
+    std::atomic<bool> user{false};
+
+    // Bytes of the application's workspace
+    std::atomic<size_t> user_size{0};
+
+    // The most workspace any call on the handle has needed
+    std::atomic<size_t> needed{0};
+
+    // Raise needed to size
+    void need(size_t size);
+};
+
+// Device memory a handle keeps for the temporaries of routines hipBLAS runs
+// kernels for itself. It only grows, and is freed with the handle.
+class hipblas_device_scratch
+{
+public:
+    hipblas_device_scratch() = default;
+    hipblas_device_scratch(const hipblas_device_scratch&) = delete;
+    hipblas_device_scratch& operator=(const hipblas_device_scratch&) = delete;
+    ~hipblas_device_scratch();
+
+    // Return at least size bytes of device memory, or nullptr if they cannot
+    // be allocated. The memory stays valid until the next call with a larger
+    // size; work on the handle's stream that uses it is ordered before that.
+    // While capturing, a larger size fails the capture instead.
+    void* get(size_t size, hipblas_graph_capture& capture);
+
+private:
+    std::mutex m_mutex;
+    void*      m_data = nullptr;
+    size_t     m_size = 0;
+};
+
+// Device copies of the pointer arrays batched routines take, keyed by their
+// content so that an application passing the same host array every step
+// uploads it once. The least recently used copies are freed beyond
+// max_entries.
+class hipblas_pointer_array_cache
+{
+public:
+    static constexpr size_t max_entries = 1024;
+
+    hipblas_pointer_array_cache() = default;
+    hipblas_pointer_array_cache(const hipblas_pointer_array_cache&) = delete;
+    hipblas_pointer_array_cache& operator=(const hipblas_pointer_array_cache&) = delete;
+    ~hipblas_pointer_array_cache();
+
+    // Set device to a device copy of the count pointers at host, uploading
+    // them on stream if no copy of the same pointers is cached
+    hipblasStatus_t get(const void* const*     host,
+                        int                    count,
+                        hipStream_t            stream,
+                        hipblas_graph_capture& capture,
+                        void***                device);
+
+    // Free every copy; graphs captured before refer to them and can no
+    // longer be launched
+    void clear(hipblas_graph_capture& capture);
+
+    void get_stats(size_t* hits, size_t* misses) const;
+
+private:
+    struct entry
+    {
+        uint64_t     hash;
+        int          count;
+        const void** host; // pinned, so that the upload can be asynchronous
+        void**       device;
+        bool         uploaded; // false if the only upload is in a graph
+    };
+
+    hipblasStatus_t upload(entry& e, hipStream_t stream, hipblas_graph_capture& capture);
+    void            release(entry& e);
+
+    std::mutex                                                    m_mutex;
+    std::list<entry>                                              m_entries; // most recent first
+    std::unordered_multimap<uint64_t, std::list<entry>::iterator> m_index;
+    std::atomic<size_t>                                           m_hits{0};
+    std::atomic<size_t>                                           m_misses{0};
+};
+
+// Handle of the backend's solver library, for backends where it is separate
+// from the BLAS handle. Created by the first solver call and destroyed with
+// the handle.
+class hipblas_backend_solver
+{
+public:
+    hipblas_backend_solver() = default;
+    hipblas_backend_solver(const hipblas_backend_solver&) = delete;
+    hipblas_backend_solver& operator=(const hipblas_backend_solver&) = delete;
+    ~hipblas_backend_solver();
+
+    // Return the solver handle, calling create on first use, or nullptr if
+    // create fails. destroy releases it with the handle.
+    void* get(void* (*create)(), void (*destroy)(void*));
+
+private:
+    std::mutex m_mutex;
+    void*      m_handle = nullptr;
+    void (*m_destroy)(void*) = nullptr;
+};
+
+// Handles of their own, each on a stream of its own, over which the groups of
+// a grouped gemm are spread so that they run concurrently. Created by the
+// first grouped call needing them and destroyed with the handle.
+class hipblas_worker_handles
+{
+public:
+    static constexpr int max_workers = 4;
+
+    struct worker
+    {
+        hipblasHandle_t handle;
+        hipStream_t     stream;
+        hipEvent_t      done;
+    };
+
+    hipblas_worker_handles() = default;
+    hipblas_worker_handles(const hipblas_worker_handles&) = delete;
+    hipblas_worker_handles& operator=(const hipblas_worker_handles&) = delete;
+    ~hipblas_worker_handles();
+
+    // Return up to count workers, creating them on first use; fewer if no
+    // more can be created. Only valid while mutex is held.
+    const std::vector<worker>& get(int count);
+
+    // Recorded on the stream of the handle before the workers start
+    hipEvent_t fork();
+
+    std::mutex mutex;
+
+private:
+    std::vector<worker> m_workers;
+    hipEvent_t          m_fork = nullptr;
+};
+
+// State hipBLAS keeps alongside each backend handle. The backend handle is
+// returned to the user as the hipblasHandle_t, so this lives in a side table.
+struct hipblas_handle_state
+{
+    hipblas_workspace_cache     workspace_cache;
+    hipblas_backend_workspace   backend_workspace;
+    hipblas_int8_layout         int8_layout;
+    hipblas_handle_counters     counters;
+    hipblas_device_scratch      scratch;
+    hipblas_backend_solver      solver;
+    hipblas_graph_capture       capture;
+    hipblas_gemm_coalescer      coalescer;
+    hipblas_pointer_array_cache pointer_arrays;
+    hipblas_worker_handles      workers;
+};
+
+// Return the state of handle, creating it on first use
+hipblas_handle_state* hipblas_get_handle_state(hipblasHandle_t handle);
+
+// Drop the state of a handle which is being destroyed
+void hipblas_release_handle_state(hipblasHandle_t handle);
+
+// The pivots of a gesv call: ipiv, or n * batch_count ints of the scratch
+// memory of handle if the caller does not want them. nullptr if n > 0 and
+// those cannot be allocated.
+int* hipblas_gesv_pivots(hipblasHandle_t handle, int n, int batch_count, int* ipiv);
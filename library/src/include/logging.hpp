@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+// Bits of the HIPBLAS_LAYER environment variable
+enum hipblas_layer_mode
+{
+    hipblas_layer_mode_none        = 0,
+    hipblas_layer_mode_log_trace   = 1,
+    hipblas_layer_mode_log_bench   = 2,
+    hipblas_layer_mode_log_profile = 4,
+    // Set while any handle has its call counters on; see counters.hpp
+    hipblas_layer_mode_counters = 8,
+    // Binary call trace for hipblas-bench --replay; see replay.hpp
+    hipblas_layer_mode_log_replay = 16,
+    // Set while any handle defers gemm calls; see coalesce.hpp
+    hipblas_layer_mode_coalescing = 32,
+};
+
+// Read from HIPBLAS_LAYER when the library is loaded; zero when logging is off
+extern std::atomic<int> hipblas_log_layer;
+
+// An argument of a logged call, captured by value
+struct hipblas_log_value
+{
+    enum kind_t : uint8_t
+    {
+        integer,
+        real,
+        pointer,
+        operation,
+        fill,
+        diagonal,
+        side,
+        datatype,
+    };
+
+    kind_t kind;
+    // Element type of a pointer argument, or -1 if it is not a scalar type
+    int element;
+    union
+    {
+        int64_t     i;
+        double      d;
+        const void* p;
+    };
+};
+
+template <typename T>
+struct hipblas_log_element : std::integral_constant<int, -1>
+{
+};
+
+template <>
+struct hipblas_log_element<hipblasHalf> : std::integral_constant<int, HIPBLAS_R_16F>
+{
+};
+
+template <>
+struct hipblas_log_element<hipblasBfloat16> : std::integral_constant<int, HIPBLAS_R_16B>
+{
+};
+
+template <>
+struct hipblas_log_element<float> : std::integral_constant<int, HIPBLAS_R_32F>
+{
+};
+
+template <>
+struct hipblas_log_element<double> : std::integral_constant<int, HIPBLAS_R_64F>
+{
+};
+
+template <>
+struct hipblas_log_element<hipblasComplex> : std::integral_constant<int, HIPBLAS_C_32F>
+{
+};
+
+template <>
+struct hipblas_log_element<hipblasDoubleComplex> : std::integral_constant<int, HIPBLAS_C_64F>
+{
+};
+
+inline hipblas_log_value hipblas_log_arg(hipblasOperation_t value)
+{
+    hipblas_log_value arg{hipblas_log_value::operation, -1, {0}};
+    arg.i = value;
+    return arg;
+}
+
+inline hipblas_log_value hipblas_log_arg(hipblasFillMode_t value)
+{
+    hipblas_log_value arg{hipblas_log_value::fill, -1, {0}};
+    arg.i = value;
+    return arg;
+}
+
+inline hipblas_log_value hipblas_log_arg(hipblasDiagType_t value)
+{
+    hipblas_log_value arg{hipblas_log_value::diagonal, -1, {0}};
+    arg.i = value;
+    return arg;
+}
+
+inline hipblas_log_value hipblas_log_arg(hipblasSideMode_t value)
+{
+    hipblas_log_value arg{hipblas_log_value::side, -1, {0}};
+    arg.i = value;
+    return arg;
+}
+
+inline hipblas_log_value hipblas_log_arg(hipblasDatatype_t value)
+{
+    hipblas_log_value arg{hipblas_log_value::datatype, -1, {0}};
+    arg.i = value;
+    return arg;
+}
+
+template <typename T,
+          std::enable_if_t<std::is_integral<T>{} || std::is_enum<T>{}, int> = 0>
+inline hipblas_log_value hipblas_log_arg(T value)
+{
+    hipblas_log_value arg{hipblas_log_value::integer, -1, {0}};
+    arg.i = int64_t(value);
+    return arg;
+}
+
+template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+inline hipblas_log_value hipblas_log_arg(T value)
+{
+    hipblas_log_value arg{hipblas_log_value::real, -1, {0}};
+    arg.d = value;
+    return arg;
+}
+
+template <typename T>
+inline hipblas_log_value hipblas_log_arg(T* value)
+{
+    hipblas_log_value arg{
+        hipblas_log_value::pointer, hipblas_log_element<std::remove_cv_t<T>>::value, {0}};
+    arg.p = value;
+    return arg;
+}
+
+// Split an entry point such as hipblasZgemmStridedBatched into the
+// hipblas-bench function (gemm_strided_batched) and precision (f64_c).
+// Returns a null precision for the _ex functions, whose types are arguments.
+const char* hipblas_bench_function(const char* func, std::string& function);
+
+// Device timing of a call in flight, see hipblas_count_call
+struct hipblas_call_timer;
+
+// Format a call and queue it to every enabled log, and add it to the
+// handle's counters. names holds the comma separated names of the
+// arguments following the handle. Returns a timer to finish once the
+// call has been enqueued, or nullptr.
+hipblas_call_timer* hipblas_log_emit(hipblasHandle_t          handle,
+                                     const char*              func,
+                                     const char*              names,
+                                     const hipblas_log_value* values,
+                                     int                      count);
+
+void hipblas_finish_call_timer(hipblas_call_timer* timer);
+
+template <typename... Ts>
+hipblas_call_timer*
+    hipblas_log_call(hipblasHandle_t handle, const char* func, const char* names, Ts... args)
+{
+    const hipblas_log_value values[] = {hipblas_log_arg(args)...};
+    return hipblas_log_emit(handle, func, names, values, int(sizeof...(Ts)));
+}
+
+// Finishes the timer of a logged call when the entry point returns
+class hipblas_log_scope
+{
+public:
+    explicit hipblas_log_scope(hipblas_call_timer* timer)
+        : m_timer(timer)
+    {
+    }
+
+    ~hipblas_log_scope()
+    {
+        if(m_timer)
+            hipblas_finish_call_timer(m_timer);
+    }
+
+    hipblas_log_scope(const hipblas_log_scope&) = delete;
+    hipblas_log_scope& operator=(const hipblas_log_scope&) = delete;
+
+private:
+    hipblas_call_timer* m_timer;
+};
+
+// Log a call of the enclosing entry point, passing the handle and then every
+// other argument by name. When logging and counters are off this costs a
+// single branch.
+#define HIPBLAS_LOG_CALL(handle, ...)                                               \
+    hipblas_log_scope hipblas_log_scope_(                                           \
+        hipblas_log_layer.load(std::memory_order_relaxed)                           \
+            ? hipblas_log_call(handle, __func__, #__VA_ARGS__, __VA_ARGS__)         \
+            : nullptr)
@@ -0,0 +1,17 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// Run body(begin, end) over chunks of [0, n) on the host thread pool. Chunks
+// hold at least grain iterations; calls from inside a pool thread, and ranges
+// of a single chunk, run on the calling thread. The pool serves the kernels of
+// the host backend and the packing of staged transfers, and is sized by
+// HIPBLAS_HOST_THREADS, counting the calling thread.
+void hipblas_host_parallel_for(int64_t                                     n,
+                               int64_t                                     grain,
+                               const std::function<void(int64_t, int64_t)>& body);
@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cmath>
+
+#if defined(__HIPCC__) || defined(__CUDACC__)
+#define HIPBLAS_POST_OP_FN __host__ __device__ inline
+#else
+#define HIPBLAS_POST_OP_FN inline
+#endif
+
+// The post-op of a gemm as the backends run it, on the matrices
+// C_b = c + b * stride_c after the gemm has written them
+struct hipblas_post_op_args
+{
+    hipblasPostOp_t post_op;
+    int               m;
+    int               n;
+    void*             c;
+    hipblasDatatype_t c_type;
+    int               ldc;
+    hipblasStride     stride_c;
+    hipblasDatatype_t compute_type;
+    int               batch_count;
+};
+
+// The c_type and compute_type combinations the post-op runs for: half and
+// bfloat16 are computed in float, scale being of the type of alpha
+inline bool hipblas_post_op_supported(hipblasDatatype_t c_type, hipblasDatatype_t compute_type)
+{
+    switch(c_type)
+    {
+    case HIPBLAS_R_16F:
+        return compute_type == HIPBLAS_R_16F || compute_type == HIPBLAS_R_32F;
+    case HIPBLAS_R_16B:
+    case HIPBLAS_R_32F:
+        return compute_type == HIPBLAS_R_32F;
+    case HIPBLAS_R_64F:
+        return compute_type == HIPBLAS_R_64F;
+    default:
+        return false;
+    }
+}
+
+inline bool hipblas_valid_activation(hipblasActivation_t activation)
+{
+    return activation == HIPBLAS_ACTIVATION_NONE || activation == HIPBLAS_ACTIVATION_RELU
+           || activation == HIPBLAS_ACTIVATION_GELU || activation == HIPBLAS_ACTIVATION_TANH;
+}
+
+template <typename T>
+HIPBLAS_POST_OP_FN T hipblas_activation(hipblasActivation_t activation, T x)
+{
+    switch(activation)
+    {
+    case HIPBLAS_ACTIVATION_RELU:
+        return x > T(0) ? x : T(0);
+    case HIPBLAS_ACTIVATION_GELU:
+        // tanh approximation, sqrt(2/pi) = 0.7978845608...
+        return T(0.5) * x
+               * (T(1) + tanh(T(0.7978845608028654) * (x + T(0.044715) * x * x * x)));
+    case HIPBLAS_ACTIVATION_TANH:
+        return tanh(x);
+    default:
+        return x;
+    }
+}
+
+// Apply the post-op in place after the gemm on the stream of handle, on the
+// device memory of the backend; defined by each backend
+hipblasStatus_t hipblas_run_post_op(hipblasHandle_t handle, const hipblas_post_op_args& args);
@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Transfers of strided matrices and vectors between pageable host memory and
+// the device through pinned staging memory.
+//
+// Handed a pageable host matrix with lda > rows, or a vector with incx > 1,
+// the runtime copies one column or one element at a time. Instead the staged
+// copy packs the host side into pinned slots of a per-device pool on the
+// threads of the host pool, a chunk of whole columns at a time, and moves each
+// chunk with one 2D copy on the stream, so that packing a chunk overlaps the
+// copy of the one before. A vector is a matrix of one row and n columns with
+// lda = incx.
+//
+// A batch of small matrices is packed into the slots the same way, so that it
+// moves with one copy per slot rather than a copy per matrix. Elements copied
+// to another type are converted while being packed or unpacked when that
+// moves fewer bytes.
+
+#include "hipblas.h"
+#include "convert.hpp"
+
+// Copy the rows x cols matrix of elem_size byte elements at host a to device
+// b on stream. Unless async is set the copy is complete when this returns; the
+// host matrix can be reused on return either way. Returns
+// HIPBLAS_STATUS_NOT_SUPPORTED, having copied nothing, for arguments the
+// backend copies as well or better (invalid, small, contiguous or pinned host
+// data, or a stream being captured), and for backends without device memory;
+// the caller then runs the backend's copy. Defined by each backend.
+hipblasStatus_t hipblas_staged_set_matrix(int         rows,
+                                          int         cols,
+                                          int         elem_size,
+                                          const void* a,
+                                          int         lda,
+                                          void*       b,
+                                          int         ldb,
+                                          hipStream_t stream,
+                                          bool        async);
+
+// Copy the rows x cols matrix at device a to host b on stream, as above. The
+// host has to unpack the copy, so this always returns once b holds it.
+hipblasStatus_t hipblas_staged_get_matrix(int         rows,
+                                          int         cols,
+                                          int         elem_size,
+                                          const void* a,
+                                          int         lda,
+                                          void*       b,
+                                          int         ldb,
+                                          hipStream_t stream);
+
+// Copy the batch_count rows x cols matrices of elem_size byte elements of the
+// host batch a to the device batch b on the stream of handle: packed into the
+// slots, each moved with one copy and then spread over b on the device unless
+// b is packed already. Matrices larger than a slot are copied one at a time
+// instead. The type of the batches is not used. The host matrices can be
+// reused on return. Returns HIPBLAS_STATUS_NOT_SUPPORTED while the stream is
+// being captured. Defined by each backend.
+hipblasStatus_t hipblas_staged_set_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count);
+
+// Copy the device batch a to the host batch b as above, returning once b holds
+// the copy
+hipblasStatus_t hipblas_staged_get_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count);
+
+// Copy the rows x cols matrix of a_type elements at host a to the matrix of
+// b_type elements at device b on the stream of handle, converting them as
+// hipblas_convert_matrices does, so that only the narrower type crosses the
+// bus: the host converts while packing into the slots when b_type is no wider
+// than a_type, and the device converts a copy of a otherwise. The copy is
+// complete when this returns. Returns HIPBLAS_STATUS_NOT_SUPPORTED while the
+// stream is being captured. Defined by each backend.
+hipblasStatus_t hipblas_staged_set_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb);
+
+// Copy the device matrix a to the host matrix b as above: the host converts
+// while unpacking when a_type is no wider than b_type
+hipblasStatus_t hipblas_staged_get_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb);
@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// What the choice of a gemm solution depends on. Held as is in the tuning
+// files, so every field is 32 bits wide and the layout must not change
+// without bumping the file version.
+struct hipblas_tuning_key
+{
+    int32_t trans_a;
+    int32_t trans_b;
+    int32_t m;
+    int32_t n;
+    int32_t k;
+    int32_t lda;
+    int32_t ldb;
+    int32_t ldc;
+    int32_t a_type;
+    int32_t b_type;
+    int32_t c_type;
+    int32_t compute_type;
+};
+
+inline hipblas_tuning_key hipblas_make_tuning_key(hipblasOperation_t trans_a,
+                                                  hipblasOperation_t trans_b,
+                                                  int                m,
+                                                  int                n,
+                                                  int                k,
+                                                  int                lda,
+                                                  int                ldb,
+                                                  int                ldc,
+                                                  hipblasDatatype_t  a_type,
+                                                  hipblasDatatype_t  b_type,
+                                                  hipblasDatatype_t  c_type,
+                                                  hipblasDatatype_t  compute_type)
+{
+    return {int32_t(trans_a),
+            int32_t(trans_b),
+            m,
+            n,
+            k,
+            lda,
+            ldb,
+            ldc,
+            int32_t(a_type),
+            int32_t(b_type),
+            int32_t(c_type),
+            int32_t(compute_type)};
+}
+
+// Set solution to the one hipblasGemmExTune chose for key on the current
+// device, if any. Costs a relaxed load when nothing has been tuned.
+bool hipblas_find_tuned_gemm(const hipblas_tuning_key& key, int& solution);
+
+// Run the hipblasGemmEx call described by the arguments with the given
+// solution, one of those hipblasGemmExGetSolutions lists; defined by each
+// backend
+hipblasStatus_t hipblas_gemm_ex_solution(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans_a,
+                                         hipblasOperation_t trans_b,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        a,
+                                         hipblasDatatype_t  a_type,
+                                         int                lda,
+                                         const void*        b,
+                                         hipblasDatatype_t  b_type,
+                                         int                ldb,
+                                         const void*        beta,
+                                         void*              c,
+                                         hipblasDatatype_t  c_type,
+                                         int                ldc,
+                                         hipblasDatatype_t  compute_type,
+                                         int                solution);
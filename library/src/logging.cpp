@@ -0,0 +1,953 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "coalesce.hpp"
+#include "counters.hpp"
+#include "replay.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    int read_log_layer()
+    {
+        const char* layer = getenv("HIPBLAS_LAYER");
+        return layer ? int(strtol(layer, nullptr, 0)) : 0;
+    }
+
+    constexpr int log_modes = hipblas_layer_mode_log_trace | hipblas_layer_mode_log_bench
+                              | hipblas_layer_mode_log_profile | hipblas_layer_mode_log_replay;
+
+    enum hipblas_log_stream : uint8_t
+    {
+        trace_stream,
+        bench_stream,
+        profile_stream,
+        replay_stream,
+    };
+
+    // Single producer, single consumer byte ring. The owning thread appends
+    // records of [stream][length][text] and the flusher thread drains them;
+    // neither side takes a lock.
+    class log_ring
+    {
+    public:
+        static constexpr size_t capacity = size_t(1) << 16;
+        static constexpr size_t header   = sizeof(uint8_t) + sizeof(uint32_t);
+
+        // Return false if there is currently no room for the record
+        bool try_push(uint8_t stream, const char* text, uint32_t size)
+        {
+            size_t head = m_head.load(std::memory_order_relaxed);
+            size_t tail = m_tail.load(std::memory_order_acquire);
+            if(capacity - (head - tail) < header + size)
+                return false;
+
+            copy_in(head, &stream, sizeof(stream));
+            copy_in(head + sizeof(stream), &size, sizeof(size));
+            copy_in(head + header, text, size);
+            m_head.store(head + header + size, std::memory_order_release);
+            return true;
+        }
+
+        template <typename F>
+        void drain(F&& consume)
+        {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            size_t head = m_head.load(std::memory_order_acquire);
+            while(tail != head)
+            {
+                uint8_t  stream;
+                uint32_t size;
+                copy_out(tail, &stream, sizeof(stream));
+                copy_out(tail + sizeof(stream), &size, sizeof(size));
+                m_record.resize(size);
+                copy_out(tail + header, &m_record[0], size);
+                consume(stream, m_record);
+                tail += header + size;
+            }
+            m_tail.store(tail, std::memory_order_release);
+        }
+
+        bool empty() const
+        {
+            return m_head.load(std::memory_order_acquire)
+                   == m_tail.load(std::memory_order_relaxed);
+        }
+
+        // Set when the owning thread exits, so the flusher can drop the ring
+        std::atomic<bool> retired{false};
+
+    private:
+        void copy_in(size_t pos, const void* src, size_t size)
+        {
+            size_t offset = pos % capacity;
+            size_t first  = std::min(size, capacity - offset);
+            memcpy(m_buffer + offset, src, first);
+            memcpy(m_buffer, static_cast<const char*>(src) + first, size - first);
+        }
+
+        void copy_out(size_t pos, void* dst, size_t size) const
+        {
+            size_t offset = pos % capacity;
+            size_t first  = std::min(size, capacity - offset);
+            memcpy(dst, m_buffer + offset, first);
+            memcpy(static_cast<char*>(dst) + first, m_buffer, size - first);
+        }
+
+        char                m_buffer[capacity];
+        std::atomic<size_t> m_head{0};
+        std::atomic<size_t> m_tail{0};
+        std::string         m_record;
+    };
+
+    // Owns the log files and the thread which flushes every ring into them
+    class log_flusher
+    {
+    public:
+        log_flusher()
+            : m_trace(open("HIPBLAS_LOG_TRACE_PATH", m_trace_file))
+            , m_bench(open("HIPBLAS_LOG_BENCH_PATH", m_bench_file))
+            , m_profile(open("HIPBLAS_LOG_PROFILE_PATH", m_profile_file))
+            , m_replay(open_replay(m_replay_file))
+            , m_thread([this] { run(); })
+        {
+        }
+
+        ~log_flusher()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_one();
+            m_thread.join();
+            write_profile();
+        }
+
+        std::shared_ptr<log_ring> add_ring()
+        {
+            auto                        ring = std::make_shared<log_ring>();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_rings.push_back(ring);
+            return ring;
+        }
+
+        void wake()
+        {
+            m_wake.notify_one();
+        }
+
+        // Write a record too large for any ring from the calling thread, after
+        // the records already queued, so the order of each thread's calls holds
+        void write_now(uint8_t stream, const std::string& record)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            flush();
+            write(stream, record);
+            flush_files();
+        }
+
+    private:
+        static std::ostream* open(const char* env, std::ofstream& file)
+        {
+            const char* path = getenv(env);
+            if(path && *path)
+            {
+                file.open(path);
+                if(file)
+                    return &file;
+            }
+            return &std::cerr;
+        }
+
+        // The replay log is binary, so it goes to a file even if no path is set
+        static std::ostream* open_replay(std::ofstream& file)
+        {
+            if(!(hipblas_log_layer.load(std::memory_order_relaxed) & hipblas_layer_mode_log_replay))
+                return nullptr;
+
+            const char* path = getenv("HIPBLAS_LOG_REPLAY_PATH");
+            file.open(path && *path ? path : "hipblas_replay.bin", std::ios::binary);
+            if(!file)
+                return nullptr;
+            file.write(hipblas_replay_magic, sizeof(hipblas_replay_magic));
+            return &file;
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for(;;)
+            {
+                bool stop = m_stop;
+                flush();
+                if(stop)
+                    break;
+                m_wake.wait_for(lock, std::chrono::milliseconds(10));
+            }
+        }
+
+        // Called with m_mutex held, which guards the list of rings and the files
+        void flush()
+        {
+            for(auto it = m_rings.begin(); it != m_rings.end();)
+            {
+                log_ring& ring    = **it;
+                bool      retired = ring.retired.load(std::memory_order_acquire);
+                ring.drain(
+                    [this](uint8_t stream, const std::string& record) { write(stream, record); });
+                it = retired && ring.empty() ? m_rings.erase(it) : it + 1;
+            }
+            flush_files();
+        }
+
+        // Called with m_mutex held
+        void write(uint8_t stream, const std::string& record)
+        {
+            if(stream == trace_stream)
+                *m_trace << record << '\n';
+            else if(stream == bench_stream)
+                *m_bench << record << '\n';
+            else if(stream == profile_stream)
+                m_profile_counts[record]++;
+            else if(m_replay)
+            {
+                uint32_t size = uint32_t(record.size());
+                m_replay->write(reinterpret_cast<const char*>(&size), sizeof(size));
+                m_replay->write(record.data(), size);
+            }
+        }
+
+        void flush_files()
+        {
+            m_trace->flush();
+            m_bench->flush();
+            if(m_replay)
+                m_replay->flush();
+        }
+
+        // Unique calls, most frequent first, each followed by its count
+        void write_profile()
+        {
+            std::vector<std::pair<std::string, size_t>> calls(m_profile_counts.begin(),
+                                                              m_profile_counts.end());
+            std::stable_sort(calls.begin(), calls.end(), [](const auto& a, const auto& b) {
+                return a.second > b.second;
+            });
+            for(const auto& call : calls)
+                *m_profile << call.first << " # call_count: " << call.second << '\n';
+            m_profile->flush();
+        }
+
+        std::ofstream m_trace_file, m_bench_file, m_profile_file, m_replay_file;
+        std::ostream* m_trace;
+        std::ostream* m_bench;
+        std::ostream* m_profile;
+        std::ostream* m_replay;
+
+        std::map<std::string, size_t> m_profile_counts;
+
+        std::mutex                             m_mutex;
+        std::condition_variable                m_wake;
+        bool                                   m_stop = false;
+        std::vector<std::shared_ptr<log_ring>> m_rings;
+        std::thread                            m_thread;
+    };
+
+    log_flusher& flusher()
+    {
+        static log_flusher instance;
+        return instance;
+    }
+
+    // The ring of the calling thread, registered with the flusher on first use
+    struct thread_ring
+    {
+        std::shared_ptr<log_ring> ring = flusher().add_ring();
+
+        ~thread_ring()
+        {
+            ring->retired.store(true, std::memory_order_release);
+        }
+    };
+
+    void push(uint8_t stream, const std::string& record)
+    {
+        thread_local thread_ring local;
+
+        if(record.size() > log_ring::capacity - log_ring::header)
+        {
+            flusher().write_now(stream, record);
+            return;
+        }
+
+        uint32_t size = uint32_t(record.size());
+        while(!local.ring->try_push(stream, record.data(), size))
+        {
+            // Full; wait for the flusher to catch up rather than drop the record
+            flusher().wake();
+            std::this_thread::yield();
+        }
+    }
+
+    // Names of the arguments, split from the stringized argument list
+    std::vector<std::string> split_names(const char* names)
+    {
+        std::vector<std::string> split;
+        std::string              name;
+        for(const char* c = names;; c++)
+        {
+            if(*c == ',' || *c == '\0')
+            {
+                split.push_back(name);
+                name.clear();
+                if(*c == '\0')
+                    break;
+            }
+            else if(*c != ' ')
+                name += *c;
+        }
+        return split;
+    }
+
+    char operation_letter(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_OP_N:
+            return 'N';
+        case HIPBLAS_OP_T:
+            return 'T';
+        case HIPBLAS_OP_C:
+            return 'C';
+        }
+        return '?';
+    }
+
+    char fill_letter(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_FILL_MODE_UPPER:
+            return 'U';
+        case HIPBLAS_FILL_MODE_LOWER:
+            return 'L';
+        case HIPBLAS_FILL_MODE_FULL:
+            return 'F';
+        }
+        return '?';
+    }
+
+    char diagonal_letter(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_DIAG_NON_UNIT:
+            return 'N';
+        case HIPBLAS_DIAG_UNIT:
+            return 'U';
+        }
+        return '?';
+    }
+
+    char side_letter(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_SIDE_LEFT:
+            return 'L';
+        case HIPBLAS_SIDE_RIGHT:
+            return 'R';
+        case HIPBLAS_SIDE_BOTH:
+            return 'B';
+        }
+        return '?';
+    }
+
+    // Same spelling as hipblas-bench uses for --precision and the --*_type options
+    const char* datatype_string(int64_t value)
+    {
+        switch(value)
+        {
+        case HIPBLAS_R_16F:
+            return "f16_r";
+        case HIPBLAS_R_32F:
+            return "f32_r";
+        case HIPBLAS_R_64F:
+            return "f64_r";
+        case HIPBLAS_C_16F:
+            return "f16_c";
+        case HIPBLAS_C_32F:
+            return "f32_c";
+        case HIPBLAS_C_64F:
+            return "f64_c";
+        case HIPBLAS_R_8I:
+            return "i8_r";
+        case HIPBLAS_R_8U:
+            return "u8_r";
+        case HIPBLAS_R_32I:
+            return "i32_r";
+        case HIPBLAS_R_32U:
+            return "u32_r";
+        case HIPBLAS_C_8I:
+            return "i8_c";
+        case HIPBLAS_C_8U:
+            return "u8_c";
+        case HIPBLAS_C_32I:
+            return "i32_c";
+        case HIPBLAS_C_32U:
+            return "u32_c";
+        case HIPBLAS_R_16B:
+            return "bf16_r";
+        case HIPBLAS_C_16B:
+            return "bf16_c";
+        }
+        return "invalid";
+    }
+
+    // Inverse of datatype_string for the precisions of hipblas_bench_function
+    int64_t precision_datatype(const char* precision)
+    {
+        static const int64_t types[] = {HIPBLAS_R_16F,
+                                        HIPBLAS_R_16B,
+                                        HIPBLAS_R_32F,
+                                        HIPBLAS_R_64F,
+                                        HIPBLAS_C_32F,
+                                        HIPBLAS_C_64F};
+        for(int64_t type : types)
+            if(strcmp(precision, datatype_string(type)) == 0)
+                return type;
+        return HIPBLAS_R_32F;
+    }
+
+    float half_to_float(uint16_t half)
+    {
+        uint32_t sign     = uint32_t(half & 0x8000) << 16;
+        uint32_t exponent = (half >> 10) & 0x1f;
+        uint32_t mantissa = half & 0x3ff;
+        uint32_t bits;
+        if(exponent == 0x1f)
+            bits = sign | 0x7f800000 | (mantissa << 13);
+        else if(exponent)
+            bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+        else if(mantissa)
+        {
+            // Subnormal; normalize it
+            exponent = 113;
+            while(!(mantissa & 0x400))
+            {
+                mantissa <<= 1;
+                exponent--;
+            }
+            bits = sign | (exponent << 23) | ((mantissa & 0x3ff) << 13);
+        }
+        else
+            bits = sign;
+
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    // Read a host scalar of the given type as a real and imaginary part
+    bool read_scalar(const void* p, int type, double& re, double& im)
+    {
+        im = 0;
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            re = half_to_float(*static_cast<const uint16_t*>(p));
+            return true;
+        case HIPBLAS_R_16B:
+        {
+            uint32_t bits = uint32_t(*static_cast<const uint16_t*>(p)) << 16;
+            float    value;
+            memcpy(&value, &bits, sizeof(value));
+            re = value;
+            return true;
+        }
+        case HIPBLAS_R_32F:
+            re = *static_cast<const float*>(p);
+            return true;
+        case HIPBLAS_R_64F:
+            re = *static_cast<const double*>(p);
+            return true;
+        case HIPBLAS_C_32F:
+            re = static_cast<const float*>(p)[0];
+            im = static_cast<const float*>(p)[1];
+            return true;
+        case HIPBLAS_C_64F:
+            re = static_cast<const double*>(p)[0];
+            im = static_cast<const double*>(p)[1];
+            return true;
+        case HIPBLAS_R_32I:
+            re = *static_cast<const int32_t*>(p);
+            return true;
+        }
+        return false;
+    }
+
+    // Lower case, underscores removed, so that e.g. strideA, stride_a and
+    // stride_A all compare equal
+    std::string normalize(const std::string& name)
+    {
+        std::string key;
+        for(char c : name)
+            if(c != '_')
+                key += char(tolower(c));
+        return key;
+    }
+
+    // Tag of the hipblas-bench option set by an integer argument, or -1 if none
+    int bench_option(const std::string& key)
+    {
+        static const std::map<std::string, hipblas_replay_tag> options = {
+            {"m", hipblas_replay_m},
+            {"n", hipblas_replay_n},
+            {"k", hipblas_replay_k},
+            {"kl", hipblas_replay_kl},
+            {"ku", hipblas_replay_ku},
+            {"lda", hipblas_replay_lda},
+            {"ldb", hipblas_replay_ldb},
+            {"ldc", hipblas_replay_ldc},
+            {"ldd", hipblas_replay_ldd},
+            {"incx", hipblas_replay_incx},
+            {"incy", hipblas_replay_incy},
+            {"stridea", hipblas_replay_stride_a},
+            {"strideap", hipblas_replay_stride_a},
+            {"bsa", hipblas_replay_stride_a},
+            {"strideb", hipblas_replay_stride_b},
+            {"bsb", hipblas_replay_stride_b},
+            {"stridec", hipblas_replay_stride_c},
+            {"bsc", hipblas_replay_stride_c},
+            {"strided", hipblas_replay_stride_d},
+            {"stridex", hipblas_replay_stride_x},
+            {"stridey", hipblas_replay_stride_y},
+            {"batchcount", hipblas_replay_batch_count},
+        };
+        auto it = options.find(key);
+        return it == options.end() ? -1 : it->second;
+    }
+
+    struct call_info
+    {
+        std::vector<std::string> names;
+        hipblas_counter_model    model;
+        bool                     coalesced;
+    };
+
+    struct log_call
+    {
+        hipblasHandle_t                 handle;
+        const char*                     func;
+        const std::vector<std::string>& names;
+        const hipblas_log_value*        values;
+        int                             count;
+        hipblasPointerMode_t            pointer_mode;
+
+        // Type of the scalar pointed to by argument i, if it can be read on the host
+        int scalar_type(int i) const
+        {
+            if(pointer_mode != HIPBLAS_POINTER_MODE_HOST
+               || values[i].kind != hipblas_log_value::pointer || !values[i].p)
+                return -1;
+            if(values[i].element >= 0)
+                return values[i].element;
+
+            // void* scalars of the _ex functions take the type of alphaType
+            // when there is one, and of the compute type otherwise
+            int type = -1;
+            for(int j = 0; j < count; j++)
+                if(values[j].kind == hipblas_log_value::datatype && names[j] != "csType")
+                {
+                    type = int(values[j].i);
+                    if(names[j] == "alphaType")
+                        break;
+                }
+            return type;
+        }
+
+        bool is_scalar(int i) const
+        {
+            return names[i] == "alpha" || names[i] == "beta";
+        }
+    };
+
+    std::string trace_line(const log_call& call)
+    {
+        std::ostringstream line;
+        line << call.func;
+        for(int i = 0; i < call.count; i++)
+        {
+            const hipblas_log_value& value = call.values[i];
+            line << ',';
+            switch(value.kind)
+            {
+            case hipblas_log_value::integer:
+                line << value.i;
+                break;
+            case hipblas_log_value::real:
+                line << value.d;
+                break;
+            case hipblas_log_value::operation:
+                line << operation_letter(value.i);
+                break;
+            case hipblas_log_value::fill:
+                line << fill_letter(value.i);
+                break;
+            case hipblas_log_value::diagonal:
+                line << diagonal_letter(value.i);
+                break;
+            case hipblas_log_value::side:
+                line << side_letter(value.i);
+                break;
+            case hipblas_log_value::datatype:
+                line << datatype_string(value.i);
+                break;
+            case hipblas_log_value::pointer:
+            {
+                double re, im;
+                if(call.is_scalar(i) && read_scalar(value.p, call.scalar_type(i), re, im))
+                {
+                    line << re;
+                    if(im != 0)
+                        line << (im < 0 ? "" : "+") << im << 'i';
+                }
+                else
+                    line << value.p;
+                break;
+            }
+            }
+        }
+        return line.str();
+    }
+
+    // An option of the hipblas-bench command which repeats a call
+    struct bench_arg
+    {
+        hipblas_replay_tag tag;
+        // The value of integer, letter and datatype options
+        int64_t i;
+        // The value of real options
+        double d;
+    };
+
+    // The hipblas-bench function and options which repeat a call
+    std::vector<bench_arg> bench_args(const log_call& call, std::string& function)
+    {
+        const char* precision = hipblas_bench_function(call.func, function);
+
+        // getrf and getri skip pivoting when ipiv is null
+        for(int i = 0; i < call.count; i++)
+            if(call.names[i] == "ipiv" && !call.values[i].p
+               && (function.compare(0, 5, "getrf") == 0 || function.compare(0, 5, "getri") == 0))
+                function.insert(5, "_npvt");
+
+        std::vector<bench_arg> args;
+        auto add = [&](hipblas_replay_tag tag, int64_t i, double d = 0) {
+            args.push_back(bench_arg{tag, i, d});
+        };
+
+        // Datatype arguments are, in order, the types of A, B and C, and
+        // the last one is the compute type
+        static const hipblas_replay_tag type_tags[]
+            = {hipblas_replay_a_type, hipblas_replay_b_type, hipblas_replay_c_type};
+        std::vector<int64_t> types;
+        for(int i = 0; i < call.count; i++)
+            if(call.values[i].kind == hipblas_log_value::datatype && call.names[i] != "csType")
+                types.push_back(call.values[i].i);
+        if(precision)
+            add(hipblas_replay_precision, precision_datatype(precision));
+        else if(!types.empty())
+            add(hipblas_replay_precision, types.front());
+        for(size_t i = 0; i + 1 < types.size() && i < 3; i++)
+            add(type_tags[i], types[i]);
+        if(types.size() == 4 && function.compare(0, 4, "gemm") == 0)
+            add(hipblas_replay_d_type, types[2]);
+        if(types.size() > 1)
+            add(hipblas_replay_compute_type, types.back());
+
+        int operations = 0;
+        for(int i = 0; i < call.count; i++)
+        {
+            const hipblas_log_value& value = call.values[i];
+            switch(value.kind)
+            {
+            case hipblas_log_value::integer:
+            {
+                int tag = bench_option(normalize(call.names[i]));
+                if(tag >= 0)
+                    add(hipblas_replay_tag(tag), value.i);
+                break;
+            }
+            case hipblas_log_value::operation:
+                add(operations++ ? hipblas_replay_transB : hipblas_replay_transA,
+                    operation_letter(value.i));
+                break;
+            case hipblas_log_value::fill:
+                add(hipblas_replay_uplo, fill_letter(value.i));
+                break;
+            case hipblas_log_value::diagonal:
+                add(hipblas_replay_diag, diagonal_letter(value.i));
+                break;
+            case hipblas_log_value::side:
+                add(hipblas_replay_side, side_letter(value.i));
+                break;
+            case hipblas_log_value::pointer:
+            {
+                double re, im;
+                if(call.is_scalar(i) && read_scalar(value.p, call.scalar_type(i), re, im))
+                {
+                    bool alpha = call.names[i] == "alpha";
+                    add(alpha ? hipblas_replay_alpha : hipblas_replay_beta, 0, re);
+                    if(im != 0)
+                        add(alpha ? hipblas_replay_alphai : hipblas_replay_betai, 0, im);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        hipblasAtomicsMode_t atomics_mode;
+        if(hipblasGetAtomicsMode(call.handle, &atomics_mode) == HIPBLAS_STATUS_SUCCESS
+           && atomics_mode == HIPBLAS_ATOMICS_NOT_ALLOWED)
+            add(hipblas_replay_atomics_not_allowed, 0);
+
+        return args;
+    }
+
+    std::string bench_line(const std::string& function, const std::vector<bench_arg>& args)
+    {
+        std::ostringstream line;
+        line << "hipblas-bench -f " << function;
+        for(const bench_arg& arg : args)
+        {
+            const hipblas_replay_field& field = hipblas_replay_fields[arg.tag];
+            line << ' ' << field.option;
+            switch(field.kind)
+            {
+            case hipblas_replay_kind::integer:
+                line << ' ' << arg.i;
+                break;
+            case hipblas_replay_kind::real:
+                line << ' ' << arg.d;
+                break;
+            case hipblas_replay_kind::letter:
+                line << ' ' << char(arg.i);
+                break;
+            case hipblas_replay_kind::datatype:
+                line << ' ' << datatype_string(arg.i);
+                break;
+            case hipblas_replay_kind::flag:
+                break;
+            }
+        }
+        return line.str();
+    }
+
+    // Streams are numbered in order of first use, so that a replay can
+    // recreate as many and keep calls on the same stream together
+    uint32_t stream_index(hipblasHandle_t handle)
+    {
+        hipStream_t stream = nullptr;
+        if(hipblas_get_stream(handle, &stream) != HIPBLAS_STATUS_SUCCESS || !stream)
+            return 0;
+
+        static std::mutex                                mutex;
+        static std::unordered_map<hipStream_t, uint32_t> indices;
+        std::lock_guard<std::mutex>                      lock(mutex);
+        return indices.emplace(stream, uint32_t(indices.size() + 1)).first->second;
+    }
+
+    template <typename T>
+    void append(std::string& record, T value)
+    {
+        record.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    // A record of the replay log, see replay.hpp
+    std::string replay_record(const log_call&               call,
+                              const std::string&            function,
+                              const std::vector<bench_arg>& args)
+    {
+        static std::atomic<uint64_t> sequence{0};
+
+        std::string record;
+        append(record, sequence.fetch_add(1, std::memory_order_relaxed));
+        append(record, stream_index(call.handle));
+        append(record, uint8_t(call.pointer_mode));
+        append(record, uint8_t(function.size()));
+        record += function;
+        for(const bench_arg& arg : args)
+        {
+            append(record, uint8_t(arg.tag));
+            switch(hipblas_replay_fields[arg.tag].kind)
+            {
+            case hipblas_replay_kind::integer:
+                append(record, arg.i);
+                break;
+            case hipblas_replay_kind::real:
+                append(record, arg.d);
+                break;
+            case hipblas_replay_kind::letter:
+            case hipblas_replay_kind::datatype:
+                append(record, uint8_t(arg.i));
+                break;
+            case hipblas_replay_kind::flag:
+                break;
+            }
+        }
+        return record;
+    }
+}
+
+std::atomic<int> hipblas_log_layer{read_log_layer()};
+
+const char* hipblas_bench_function(const char* func, std::string& function)
+{
+    std::string name = func + strlen("hipblas");
+
+    std::string suffix;
+    if(name.size() > 2 && name.compare(name.size() - 2, 2, "Ex") == 0)
+    {
+        suffix = "_ex";
+        name.erase(name.size() - 2);
+    }
+    if(name.size() > 14 && name.compare(name.size() - 14, 14, "StridedBatched") == 0)
+    {
+        suffix = "_strided_batched" + suffix;
+        name.erase(name.size() - 14);
+    }
+    else if(name.size() > 7 && name.compare(name.size() - 7, 7, "Batched") == 0)
+    {
+        suffix = "_batched" + suffix;
+        name.erase(name.size() - 7);
+    }
+
+    static const std::map<char, const char*> precisions = {
+        {'H', "f16_r"}, {'S', "f32_r"}, {'D', "f64_r"}, {'C', "f32_c"}, {'Z', "f64_c"}};
+    static const std::map<std::string, std::pair<const char*, const char*>> mixed = {
+        {"Scasum", {"asum", "f32_c"}},
+        {"Dzasum", {"asum", "f64_c"}},
+        {"Scnrm2", {"nrm2", "f32_c"}},
+        {"Dznrm2", {"nrm2", "f64_c"}},
+        {"Csscal", {"scal", "f32_c"}},
+        {"Zdscal", {"scal", "f64_c"}},
+        {"Csrot", {"rot", "f32_c"}},
+        {"Zdrot", {"rot", "f64_c"}},
+        {"Bfdot", {"dot", "bf16_r"}},
+    };
+
+    bool is_ex = suffix.size() >= 3 && suffix.compare(suffix.size() - 3, 3, "_ex") == 0;
+
+    const char* precision = nullptr;
+    auto        it        = mixed.find(name);
+    if(is_ex)
+    {
+        // The types are arguments
+    }
+    else if(it != mixed.end())
+    {
+        name      = it->second.first;
+        precision = it->second.second;
+    }
+    else if(name.size() > 2 && name[0] == 'I' && precisions.count(char(toupper(name[1]))))
+    {
+        // Isamax and friends
+        precision = precisions.at(char(toupper(name[1])));
+        name.erase(1, 1);
+    }
+    else if(!name.empty() && precisions.count(name[0]))
+    {
+        precision = precisions.at(name[0]);
+        name.erase(0, 1);
+    }
+
+    function.clear();
+    for(char c : name)
+        function += char(tolower(c));
+    if(function == "dotu")
+        function = "dot";
+    function += suffix;
+    return precision;
+}
+
+hipblas_call_timer* hipblas_log_emit(hipblasHandle_t          handle,
+                                     const char*              func,
+                                     const char*              names,
+                                     const hipblas_log_value* values,
+                                     int                      count)
+{
+    // Deferred calls were logged and counted when they were made
+    if(hipblas_coalescer_running)
+        return nullptr;
+
+    // Each entry point passes its own __func__ and stringized argument list,
+    // so the parsed names can be cached by address
+    thread_local std::unordered_map<const char*, call_info> infos;
+
+    auto it = infos.find(func);
+    if(it == infos.end())
+    {
+        call_info info;
+        info.names     = split_names(names);
+        info.model     = hipblas_make_counter_model(func, info.names);
+        info.coalesced = hipblas_coalesced_entry_point(func);
+        it             = infos.emplace(func, std::move(info)).first;
+    }
+    const call_info& info = it->second;
+
+    int                 layer = hipblas_log_layer.load(std::memory_order_relaxed);
+    hipblas_call_timer* timer = nullptr;
+    if(layer & hipblas_layer_mode_coalescing)
+        hipblas_flush_coalesced(handle, !info.coalesced);
+    if(layer & hipblas_layer_mode_counters)
+        timer = hipblas_count_call(handle, info.model, values);
+
+    if(!(layer & log_modes))
+        return timer;
+
+    log_call call{handle, func, info.names, values, count, HIPBLAS_POINTER_MODE_DEVICE};
+    if(hipblasGetPointerMode(handle, &call.pointer_mode) != HIPBLAS_STATUS_SUCCESS)
+        call.pointer_mode = HIPBLAS_POINTER_MODE_DEVICE;
+
+    if(layer & hipblas_layer_mode_log_trace)
+        push(trace_stream, trace_line(call));
+
+    if(layer & (log_modes & ~hipblas_layer_mode_log_trace))
+    {
+        std::string            function;
+        std::vector<bench_arg> args = bench_args(call, function);
+        if(layer & (hipblas_layer_mode_log_bench | hipblas_layer_mode_log_profile))
+        {
+            std::string line = bench_line(function, args);
+            if(layer & hipblas_layer_mode_log_bench)
+                push(bench_stream, line);
+            if(layer & hipblas_layer_mode_log_profile)
+                push(profile_stream, line);
+        }
+        if(layer & hipblas_layer_mode_log_replay)
+            push(replay_stream, replay_record(call, function, args));
+    }
+    return timer;
+}
@@ -0,0 +1,376 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Device side pieces shared by the batched kernels of the CUDA backend. Only
+// included by the sources defining kernels, which hipcc compiles for the GPU.
+
+#include "batched_kernels.hpp"
+#include "handle.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cublas_v2.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+#define HIPBLAS_CUDA_FN __host__ __device__ inline
+
+// Threads of every kernel block
+constexpr int hipblas_cuda_threads = 256;
+// Largest y and z grid dimension, over which batches are strided
+constexpr int hipblas_cuda_max_grid = 65535;
+
+// Complex element with plain arithmetic; same layout as the hipBLAS types
+template <typename T>
+struct cuda_complex
+{
+    T re, im;
+
+    cuda_complex() = default;
+    HIPBLAS_CUDA_FN constexpr cuda_complex(T re, T im = 0)
+        : re(re)
+        , im(im)
+    {
+    }
+
+    friend HIPBLAS_CUDA_FN cuda_complex operator+(const cuda_complex& a, const cuda_complex& b)
+    {
+        return {a.re + b.re, a.im + b.im};
+    }
+
+    friend HIPBLAS_CUDA_FN cuda_complex operator-(const cuda_complex& a, const cuda_complex& b)
+    {
+        return {a.re - b.re, a.im - b.im};
+    }
+
+    friend HIPBLAS_CUDA_FN cuda_complex operator-(const cuda_complex& a)
+    {
+        return {-a.re, -a.im};
+    }
+
+    friend HIPBLAS_CUDA_FN cuda_complex operator*(const cuda_complex& a, const cuda_complex& b)
+    {
+        return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+    }
+
+    friend HIPBLAS_CUDA_FN cuda_complex operator/(const cuda_complex& a, const cuda_complex& b)
+    {
+        // Smith's algorithm, which avoids overflow in the denominator
+        if(fabs(b.re) >= fabs(b.im))
+        {
+            T r = b.im / b.re;
+            T d = b.re + r * b.im;
+            return {(a.re + r * a.im) / d, (a.im - r * a.re) / d};
+        }
+        T r = b.re / b.im;
+        T d = b.im + r * b.re;
+        return {(r * a.re + a.im) / d, (r * a.im - a.re) / d};
+    }
+
+    friend HIPBLAS_CUDA_FN bool operator==(const cuda_complex& a, const cuda_complex& b)
+    {
+        return a.re == b.re && a.im == b.im;
+    }
+
+    friend HIPBLAS_CUDA_FN bool operator!=(const cuda_complex& a, const cuda_complex& b)
+    {
+        return !(a == b);
+    }
+};
+
+// Element type the kernels compute with for a hipBLAS type
+template <typename T>
+struct cuda_type
+{
+    using type = T;
+};
+
+template <>
+struct cuda_type<hipblasComplex>
+{
+    using type = cuda_complex<float>;
+};
+
+template <>
+struct cuda_type<hipblasDoubleComplex>
+{
+    using type = cuda_complex<double>;
+};
+
+template <typename T>
+struct cuda_type<const T>
+{
+    using type = const typename cuda_type<T>::type;
+};
+
+template <typename T>
+using cuda_t = typename cuda_type<T>::type;
+
+template <typename T>
+inline cuda_t<T>* cuda_cast(T* p)
+{
+    static_assert(sizeof(cuda_t<T>) == sizeof(T), "kernel type must match the hipBLAS layout");
+    return reinterpret_cast<cuda_t<T>*>(p);
+}
+
+// Real type of an element type
+template <typename T>
+struct cuda_real_type
+{
+    using type = T;
+};
+
+template <typename T>
+struct cuda_real_type<cuda_complex<T>>
+{
+    using type = T;
+};
+
+template <typename T>
+using cuda_real_t = typename cuda_real_type<T>::type;
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_conj(const T& x)
+{
+    return x;
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN cuda_complex<T> cuda_conj(const cuda_complex<T>& x)
+{
+    return {x.re, -x.im};
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_real(const T& x)
+{
+    return x;
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_real(const cuda_complex<T>& x)
+{
+    return x.re;
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_imag(const T&)
+{
+    return 0;
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_imag(const cuda_complex<T>& x)
+{
+    return x.im;
+}
+
+// |re| + |im|, the magnitude asum and iamax use
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_abs1(T x)
+{
+    return fabs(x);
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_abs1(const cuda_complex<T>& x)
+{
+    return fabs(x.re) + fabs(x.im);
+}
+
+// |x|^2
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_norm(T x)
+{
+    return x * x;
+}
+
+template <typename T>
+HIPBLAS_CUDA_FN T cuda_norm(const cuda_complex<T>& x)
+{
+    return x.re * x.re + x.im * x.im;
+}
+
+// Batched operand as the kernels see it
+template <typename T>
+struct cuda_operand
+{
+    T*            p;
+    T* const*     array;
+    hipblasStride stride;
+
+    HIPBLAS_CUDA_FN T* operator[](int64_t b) const
+    {
+        return array ? array[b] : p + b * stride;
+    }
+
+    explicit HIPBLAS_CUDA_FN operator bool() const
+    {
+        return p || array;
+    }
+};
+
+template <typename T>
+inline cuda_operand<cuda_t<T>> cuda_cast(hipblas_batch_operand<T> x)
+{
+    return {cuda_cast(x.p), reinterpret_cast<cuda_t<T>* const*>(x.array), x.stride};
+}
+
+template <typename T>
+inline bool cuda_null(hipblas_batch_operand<T> x)
+{
+    return !x.p && !x.array;
+}
+
+// Offset of the first element of a vector with a possibly negative increment
+inline int64_t cuda_vector_offset(int n, int inc)
+{
+    return inc < 0 ? -int64_t(n - 1) * inc : 0;
+}
+
+// Scalar argument, held by value in host pointer mode and read by the kernel
+// in device pointer mode
+template <typename T>
+struct cuda_scalar
+{
+    T        value;
+    const T* ptr;
+
+    __device__ T get() const
+    {
+        return ptr ? *ptr : value;
+    }
+};
+
+// What every batched routine needs to know about the handle
+struct cuda_context
+{
+    hipblasHandle_t handle;
+    hipStream_t     stream;
+    bool            host_mode;
+
+    template <typename T>
+    cuda_scalar<cuda_t<T>> scalar(const T* x) const
+    {
+        if(host_mode)
+            return {*cuda_cast(x), nullptr};
+        return {cuda_t<T>(0), cuda_cast(x)};
+    }
+
+    // Device memory for count elements of T, valid until the next request
+    template <typename T>
+    T* scratch(size_t count) const
+    {
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        return static_cast<T*>(
+            state->scratch.get(std::max<size_t>(count, 1) * sizeof(T), state->capture));
+    }
+};
+
+// Status of the stream and pointer mode queries, and so of the handle
+inline hipblasStatus_t cuda_get_context(hipblasHandle_t handle, cuda_context& context)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    cublasPointerMode_t mode;
+    if(cublasGetStream((cublasHandle_t)handle, &context.stream) != CUBLAS_STATUS_SUCCESS
+       || cublasGetPointerMode((cublasHandle_t)handle, &mode) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    context.handle    = handle;
+    context.host_mode = mode == CUBLAS_POINTER_MODE_HOST;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Puts the handle in host pointer mode for the constants internal cuBLAS calls
+// take, and back in device pointer mode at the end of the scope
+class host_pointer_mode
+{
+    cublasHandle_t m_handle;
+    bool           m_restore;
+
+public:
+    explicit host_pointer_mode(const cuda_context& context)
+        : m_handle((cublasHandle_t)context.handle)
+        , m_restore(!context.host_mode)
+    {
+        if(m_restore)
+            cublasSetPointerMode(m_handle, CUBLAS_POINTER_MODE_HOST);
+    }
+
+    ~host_pointer_mode()
+    {
+        if(m_restore)
+            cublasSetPointerMode(m_handle, CUBLAS_POINTER_MODE_DEVICE);
+    }
+
+    host_pointer_mode(const host_pointer_mode&) = delete;
+    host_pointer_mode& operator=(const host_pointer_mode&) = delete;
+};
+
+// Conversions of nvcc_detail/hipblas.cpp, for the routines calling cuBLAS
+extern "C" cublasOperation_t hipOperationToCudaOperation(hipblasOperation_t op);
+extern "C" hipblasStatus_t   hipCUBLASStatusToHIPStatus(cublasStatus_t cuStatus);
+
+// Enumerations the routines accept
+inline bool valid_side(hipblasSideMode_t side)
+{
+    return side == HIPBLAS_SIDE_LEFT || side == HIPBLAS_SIDE_RIGHT;
+}
+
+inline bool valid_uplo(hipblasFillMode_t uplo)
+{
+    return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER;
+}
+
+inline bool valid_trans(hipblasOperation_t trans)
+{
+    return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+}
+
+inline bool valid_diag(hipblasDiagType_t diag)
+{
+    return diag == HIPBLAS_DIAG_NON_UNIT || diag == HIPBLAS_DIAG_UNIT;
+}
+
+// Status of the kernels launched last on this thread
+inline hipblasStatus_t cuda_launch_status()
+{
+    return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                           : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+
+inline unsigned cuda_blocks(int64_t n, int threads = hipblas_cuda_threads)
+{
+    return unsigned((n - 1) / threads + 1);
+}
+
+inline unsigned cuda_batch_blocks(int batch_count)
+{
+    return unsigned(std::min(batch_count, hipblas_cuda_max_grid));
+}
+
+// Sum of value over the threads of a one dimensional block of
+// hipblas_cuda_threads, returned to every thread
+template <typename T>
+__device__ T cuda_block_sum(T value)
+{
+    __shared__ T partial[hipblas_cuda_threads];
+
+    partial[threadIdx.x] = value;
+    __syncthreads();
+    for(unsigned s = hipblas_cuda_threads / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            partial[threadIdx.x] = partial[threadIdx.x] + partial[threadIdx.x + s];
+        __syncthreads();
+    }
+    T sum = partial[0];
+    // The next call may overwrite partial
+    __syncthreads();
+    return sum;
+}
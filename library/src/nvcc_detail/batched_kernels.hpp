@@ -0,0 +1,420 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Batched and strided batched routines cuBLAS does not provide, run as
+// kernels of hipBLAS on the CUDA backend. Each routine is one launch over the
+// whole batch, or a fixed number of launches where the operation needs them.
+//
+// A batched operand is either an array of device pointers or a pointer and a
+// stride, so one entry point serves both variants of a routine. Entry points
+// take the arguments of the hipBLAS API in the same order, follow the pointer
+// mode of the handle for scalars and results, and are instantiated for
+// float, double, hipblasComplex and hipblasDoubleComplex.
+
+#include "hipblas.h"
+
+// Operand b of a batch is array[b] when array is set, else p + b * stride
+template <typename T>
+struct hipblas_batch_operand
+{
+    T*            p;
+    T* const*     array;
+    hipblasStride stride;
+};
+
+template <typename T>
+inline hipblas_batch_operand<T> hipblas_strided(T* p, hipblasStride stride)
+{
+    return {p, nullptr, stride};
+}
+
+template <typename T>
+inline hipblas_batch_operand<T> hipblas_batched(T* const* array)
+{
+    return {nullptr, array, 0};
+}
+
+// Level 1
+
+template <typename T>
+hipblasStatus_t hipblas_axpy_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+// Ta is T, or the real type of a complex T for csscal and zdscal
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_scal_batched_cuda(hipblasHandle_t          handle,
+                                          int                      n,
+                                          const Ta*                alpha,
+                                          hipblas_batch_operand<T> x,
+                                          int                      incx,
+                                          int                      batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_copy_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_swap_batched_cuda(hipblasHandle_t          handle,
+                                          int                      n,
+                                          hipblas_batch_operand<T> x,
+                                          int                      incx,
+                                          hipblas_batch_operand<T> y,
+                                          int                      incy,
+                                          int                      batch_count);
+
+// dotc when conj is set, else dot or dotu
+template <typename T>
+hipblasStatus_t hipblas_dot_batched_cuda(hipblasHandle_t                handle,
+                                         bool                           conj,
+                                         int                            n,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<const T> y,
+                                         int                            incy,
+                                         int                            batch_count,
+                                         T*                             result);
+
+// Tr is the real type of T
+template <typename T, typename Tr>
+hipblasStatus_t hipblas_nrm2_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          int                            batch_count,
+                                          Tr*                            result);
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblas_asum_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          int                            batch_count,
+                                          Tr*                            result);
+
+// iamax when max is set, else iamin
+template <typename T>
+hipblasStatus_t hipblas_iamax_iamin_batched_cuda(hipblasHandle_t                handle,
+                                                 bool                           max,
+                                                 int                            n,
+                                                 hipblas_batch_operand<const T> x,
+                                                 int                            incx,
+                                                 int                            batch_count,
+                                                 int*                           result);
+
+// Tc is the real type of T, Ts is T or Tc
+template <typename T, typename Tc, typename Ts>
+hipblasStatus_t hipblas_rot_batched_cuda(hipblasHandle_t          handle,
+                                         int                      n,
+                                         hipblas_batch_operand<T> x,
+                                         int                      incx,
+                                         hipblas_batch_operand<T> y,
+                                         int                      incy,
+                                         const Tc*                c,
+                                         const Ts*                s,
+                                         int                      batch_count);
+
+template <typename T, typename Tc>
+hipblasStatus_t hipblas_rotg_batched_cuda(hipblasHandle_t           handle,
+                                          hipblas_batch_operand<T>  a,
+                                          hipblas_batch_operand<T>  b,
+                                          hipblas_batch_operand<Tc> c,
+                                          hipblas_batch_operand<T>  s,
+                                          int                       batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_rotm_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          hipblas_batch_operand<const T> param,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_rotmg_batched_cuda(hipblasHandle_t                handle,
+                                           hipblas_batch_operand<T>       d1,
+                                           hipblas_batch_operand<T>       d2,
+                                           hipblas_batch_operand<T>       x1,
+                                           hipblas_batch_operand<const T> y1,
+                                           hipblas_batch_operand<T>       param,
+                                           int                            batch_count);
+
+// Level 2
+
+template <typename T>
+hipblasStatus_t hipblas_gemv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasOperation_t             trans,
+                                          int                            m,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_gbmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasOperation_t             trans,
+                                          int                            m,
+                                          int                            n,
+                                          int                            kl,
+                                          int                            ku,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+// symv when hermitian is unset, hemv when set
+template <typename T>
+hipblasStatus_t hipblas_symv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+// spmv or hpmv
+template <typename T>
+hipblasStatus_t hipblas_spmv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+// sbmv or hbmv
+template <typename T>
+hipblasStatus_t hipblas_sbmv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          int                            k,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count);
+
+// ger or geru, gerc when conj is set
+template <typename T>
+hipblasStatus_t hipblas_ger_batched_cuda(hipblasHandle_t                handle,
+                                         bool                           conj,
+                                         int                            m,
+                                         int                            n,
+                                         const T*                       alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<const T> y,
+                                         int                            incy,
+                                         hipblas_batch_operand<T>       A,
+                                         int                            lda,
+                                         int                            batch_count);
+
+// syr, or her with a real Ta
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_syr_batched_cuda(hipblasHandle_t                handle,
+                                         hipblasFillMode_t              uplo,
+                                         int                            n,
+                                         const Ta*                      alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<T>       A,
+                                         int                            lda,
+                                         int                            batch_count);
+
+// spr, or hpr with a real Ta
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_spr_batched_cuda(hipblasHandle_t                handle,
+                                         hipblasFillMode_t              uplo,
+                                         int                            n,
+                                         const Ta*                      alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<T>       AP,
+                                         int                            batch_count);
+
+// syr2, her2 when hermitian is set
+template <typename T>
+hipblasStatus_t hipblas_syr2_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<const T> y,
+                                          int                            incy,
+                                          hipblas_batch_operand<T>       A,
+                                          int                            lda,
+                                          int                            batch_count);
+
+// spr2, hpr2 when hermitian is set
+template <typename T>
+hipblasStatus_t hipblas_spr2_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<const T> y,
+                                          int                            incy,
+                                          hipblas_batch_operand<T>       AP,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_trmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_tpmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_tbmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          int                            k,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_trsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_tpsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+template <typename T>
+hipblasStatus_t hipblas_tbsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            n,
+                                          int                            k,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count);
+
+// Level 3
+
+template <typename T>
+hipblasStatus_t hipblas_trmm_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasSideMode_t              side,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       B,
+                                          int                            ldb,
+                                          int                            batch_count);
+
+// syrk, or herk with a real Ta
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_syrk_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          int                            n,
+                                          int                            k,
+                                          const Ta*                      alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          const Ta*                      beta,
+                                          hipblas_batch_operand<T>       C,
+                                          int                            ldc,
+                                          int                            batch_count);
+
+// Also serves the non-batched trtri as a batch of one
+template <typename T>
+hipblasStatus_t hipblas_trtri_batched_cuda(hipblasHandle_t                handle,
+                                           hipblasFillMode_t              uplo,
+                                           hipblasDiagType_t              diag,
+                                           int                            n,
+                                           hipblas_batch_operand<const T> A,
+                                           int                            lda,
+                                           hipblas_batch_operand<T>       invA,
+                                           int                            ldinvA,
+                                           int                            batch_count);
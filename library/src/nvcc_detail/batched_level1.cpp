@@ -0,0 +1,1150 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Batched and strided batched level 1 routines of the CUDA backend.
+//
+// Element-wise routines run a thread per element, with blockIdx.y striding
+// over the batch. Reductions run a block per batch member, which keeps the
+// order of the sums fixed for a given n and increment.
+
+#include "batched_device.hpp"
+#include "graph.hpp"
+#include <vector>
+
+namespace
+{
+    // Reductions write their results to device memory: the caller's in device
+    // pointer mode, else scratch of the handle which is copied back afterwards.
+    // While capturing, host results go through staging copied when the graph runs.
+    template <typename R>
+    R* result_target(const cuda_context& context, R* result, int batch_count)
+    {
+        if(!context.host_mode)
+            return result;
+        if(hipblas_is_capturing(context.handle))
+            return static_cast<R*>(
+                hipblas_capture_staging(context.handle, sizeof(R) * batch_count));
+        return context.scratch<R>(batch_count);
+    }
+
+    template <typename R>
+    hipblasStatus_t
+        result_finish(const cuda_context& context, const R* target, R* result, int batch_count)
+    {
+        hipblasStatus_t status = cuda_launch_status();
+        if(status != HIPBLAS_STATUS_SUCCESS || !context.host_mode)
+            return status;
+
+        if(hipblas_is_capturing(context.handle))
+            return hipblas_capture_copy_to_host(
+                context.handle, context.stream, result, target, sizeof(R) * batch_count);
+
+        if(hipMemcpyAsync(
+               result, target, sizeof(R) * batch_count, hipMemcpyDeviceToHost, context.stream)
+               != hipSuccess
+           || hipStreamSynchronize(context.stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Results of an empty reduction are zero
+    template <typename R>
+    hipblasStatus_t result_zero(const cuda_context& context, R* result, int batch_count)
+    {
+        if(batch_count <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(context.host_mode)
+        {
+            std::fill(result, result + batch_count, R{});
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        return hipMemsetAsync(result, 0, sizeof(R) * batch_count, context.stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    dim3 element_grid(int n, int batch_count)
+    {
+        return dim3(cuda_blocks(n), cuda_batch_blocks(batch_count));
+    }
+
+    template <typename T, typename Ta>
+    __global__ void axpy_kernel(int                   n,
+                                cuda_scalar<Ta>       alpha,
+                                cuda_operand<const T> x,
+                                int64_t               offset_x,
+                                int                   incx,
+                                cuda_operand<T>       y,
+                                int64_t               offset_y,
+                                int                   incy,
+                                int                   batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        T a = alpha.get();
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* xb = x[b] + offset_x;
+            T*       yb = y[b] + offset_y;
+            yb[i * incy] = yb[i * incy] + a * xb[i * incx];
+        }
+    }
+
+    template <typename T, typename Ta>
+    __global__ void scal_kernel(
+        int n, cuda_scalar<Ta> alpha, cuda_operand<T> x, int incx, int batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        Ta a = alpha.get();
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            T* xb        = x[b];
+            xb[i * incx] = a * xb[i * incx];
+        }
+    }
+
+    template <typename T>
+    __global__ void copy_kernel(int                   n,
+                                cuda_operand<const T> x,
+                                int64_t               offset_x,
+                                int                   incx,
+                                cuda_operand<T>       y,
+                                int64_t               offset_y,
+                                int                   incy,
+                                int                   batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+            (y[b] + offset_y)[i * incy] = (x[b] + offset_x)[i * incx];
+    }
+
+    template <typename T>
+    __global__ void swap_kernel(int             n,
+                                cuda_operand<T> x,
+                                int64_t         offset_x,
+                                int             incx,
+                                cuda_operand<T> y,
+                                int64_t         offset_y,
+                                int             incy,
+                                int             batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            T* xi = x[b] + offset_x + i * incx;
+            T* yi = y[b] + offset_y + i * incy;
+            T  t  = *xi;
+            *xi   = *yi;
+            *yi   = t;
+        }
+    }
+
+    template <bool CONJ, typename T>
+    __global__ void dot_kernel(int                   n,
+                               cuda_operand<const T> x,
+                               int64_t               offset_x,
+                               int                   incx,
+                               cuda_operand<const T> y,
+                               int64_t               offset_y,
+                               int                   incy,
+                               int                   batch_count,
+                               T*                    result)
+    {
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const T* xb = x[b] + offset_x;
+            const T* yb = y[b] + offset_y;
+
+            T sum(0);
+            for(int64_t i = threadIdx.x; i < n; i += blockDim.x)
+                sum = sum + (CONJ ? cuda_conj(xb[i * incx]) : xb[i * incx]) * yb[i * incy];
+            sum = cuda_block_sum(sum);
+            if(threadIdx.x == 0)
+                result[b] = sum;
+        }
+    }
+
+    // Sum of f(x_i) over each vector of the batch, passed through finish
+    template <typename T, typename Tr, typename F, typename G>
+    __global__ void sum_kernel(
+        int n, cuda_operand<const T> x, int incx, int batch_count, Tr* result, F f, G finish)
+    {
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const T* xb = x[b];
+
+            Tr sum(0);
+            for(int64_t i = threadIdx.x; i < n; i += blockDim.x)
+                sum += f(xb[i * incx]);
+            sum = cuda_block_sum(sum);
+            if(threadIdx.x == 0)
+                result[b] = finish(sum);
+        }
+    }
+
+    struct norm_op
+    {
+        template <typename T>
+        __device__ cuda_real_t<T> operator()(const T& x) const
+        {
+            return cuda_norm(x);
+        }
+    };
+
+    struct abs1_op
+    {
+        template <typename T>
+        __device__ cuda_real_t<T> operator()(const T& x) const
+        {
+            return cuda_abs1(x);
+        }
+    };
+
+    struct sqrt_op
+    {
+        template <typename T>
+        __device__ T operator()(T x) const
+        {
+            return sqrt(x);
+        }
+    };
+
+    struct identity_op
+    {
+        template <typename T>
+        __device__ T operator()(T x) const
+        {
+            return x;
+        }
+    };
+
+    // 1-based index of the first element of largest, or smallest, |re| + |im|
+    template <bool MAX, typename T>
+    __global__ void
+        iamax_kernel(int n, cuda_operand<const T> x, int incx, int batch_count, int* result)
+    {
+        using Tr = cuda_real_t<T>;
+
+        __shared__ Tr  best_value[hipblas_cuda_threads];
+        __shared__ int best_index[hipblas_cuda_threads];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const T* xb = x[b];
+
+            // Each thread visits its elements in order, so keeps the first extreme
+            Tr  value = 0;
+            int index = 0;
+            for(int64_t i = threadIdx.x; i < n; i += blockDim.x)
+            {
+                Tr a = cuda_abs1(xb[i * incx]);
+                if(!index || (MAX ? a > value : a < value))
+                {
+                    value = a;
+                    index = int(i + 1);
+                }
+            }
+            best_value[threadIdx.x] = value;
+            best_index[threadIdx.x] = index;
+            __syncthreads();
+
+            for(unsigned s = hipblas_cuda_threads / 2; s > 0; s /= 2)
+            {
+                if(threadIdx.x < s)
+                {
+                    Tr  other_value = best_value[threadIdx.x + s];
+                    int other_index = best_index[threadIdx.x + s];
+                    Tr  this_value  = best_value[threadIdx.x];
+                    int this_index  = best_index[threadIdx.x];
+                    if(other_index
+                       && (!this_index
+                           || (MAX ? other_value > this_value : other_value < this_value)
+                           || (other_value == this_value && other_index < this_index)))
+                    {
+                        best_value[threadIdx.x] = other_value;
+                        best_index[threadIdx.x] = other_index;
+                    }
+                }
+                __syncthreads();
+            }
+            if(threadIdx.x == 0)
+                result[b] = best_index[0];
+            __syncthreads();
+        }
+    }
+
+    template <typename T, typename Tc, typename Ts>
+    __global__ void rot_kernel(int             n,
+                               cuda_operand<T> x,
+                               int64_t         offset_x,
+                               int             incx,
+                               cuda_operand<T> y,
+                               int64_t         offset_y,
+                               int             incy,
+                               cuda_scalar<Tc> c,
+                               cuda_scalar<Ts> s,
+                               int             batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        Tc cv = c.get();
+        Ts sv = s.get();
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            T* xi = x[b] + offset_x + i * incx;
+            T* yi = y[b] + offset_y + i * incy;
+            T  xv = *xi;
+            T  yv = *yi;
+            *xi   = cv * xv + sv * yv;
+            *yi   = cv * yv - cuda_conj(sv) * xv;
+        }
+    }
+
+    template <typename T>
+    __global__ void rotm_kernel(int                   n,
+                                cuda_operand<T>       x,
+                                int64_t               offset_x,
+                                int                   incx,
+                                cuda_operand<T>       y,
+                                int64_t               offset_y,
+                                int                   incy,
+                                cuda_operand<const T> param,
+                                int                   batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* p    = param[b];
+            T        flag = p[0];
+            if(flag == T(-2))
+                continue;
+
+            T h11 = flag == T(0) ? T(1) : p[1];
+            T h21 = flag == T(1) ? T(-1) : p[2];
+            T h12 = flag == T(1) ? T(1) : p[3];
+            T h22 = flag == T(0) ? T(1) : p[4];
+
+            T* xi = x[b] + offset_x + i * incx;
+            T* yi = y[b] + offset_y + i * incy;
+            T  xv = *xi;
+            T  yv = *yi;
+            *xi   = h11 * xv + h12 * yv;
+            *yi   = h21 * xv + h22 * yv;
+        }
+    }
+
+    // Givens rotation of the reference BLAS
+    template <typename T>
+    HIPBLAS_CUDA_FN void rotg(T& a, T& b, T& c, T& s)
+    {
+        T scale = fabs(a) + fabs(b);
+        if(scale == T(0))
+        {
+            c = 1;
+            s = 0;
+            a = 0;
+            b = 0;
+            return;
+        }
+
+        T roe = fabs(a) > fabs(b) ? a : b;
+        T r   = scale * sqrt((a / scale) * (a / scale) + (b / scale) * (b / scale));
+        r     = roe < T(0) ? -r : r;
+        c     = a / r;
+        s     = b / r;
+        T z   = 1;
+        if(fabs(a) > fabs(b))
+            z = s;
+        else if(c != T(0))
+            z = 1 / c;
+        a = r;
+        b = z;
+    }
+
+    template <typename T>
+    HIPBLAS_CUDA_FN void rotg(cuda_complex<T>& a, cuda_complex<T>& b, T& c, cuda_complex<T>& s)
+    {
+        T abs_a = hypot(a.re, a.im);
+        if(abs_a == T(0))
+        {
+            c = 0;
+            s = {1, 0};
+            a = b;
+            return;
+        }
+
+        T abs_b = hypot(b.re, b.im);
+        T scale = abs_a + abs_b;
+        T norm
+            = scale * sqrt((abs_a / scale) * (abs_a / scale) + (abs_b / scale) * (abs_b / scale));
+        cuda_complex<T> alpha = {a.re / abs_a, a.im / abs_a};
+        c                     = abs_a / norm;
+        s                     = alpha * cuda_conj(b);
+        s                     = {s.re / norm, s.im / norm};
+        a                     = {alpha.re * norm, alpha.im * norm};
+    }
+
+    // Modified Givens rotation of the reference BLAS
+    template <typename T>
+    HIPBLAS_CUDA_FN void rotmg(T& d1, T& d2, T& x1, T y1, T* param)
+    {
+        const T gam    = 4096;
+        const T gamsq  = gam * gam;
+        const T rgamsq = 1 / gamsq;
+
+        T flag = -1;
+        T h11 = 0, h12 = 0, h21 = 0, h22 = 0;
+
+        if(d1 < T(0))
+        {
+            d1 = d2 = x1 = 0;
+        }
+        else
+        {
+            T p2 = d2 * y1;
+            if(p2 == T(0))
+            {
+                param[0] = -2;
+                return;
+            }
+
+            T p1 = d1 * x1;
+            T q2 = p2 * y1;
+            T q1 = p1 * x1;
+            if(fabs(q1) > fabs(q2))
+            {
+                h21 = -y1 / x1;
+                h12 = p2 / p1;
+                T u = 1 - h12 * h21;
+                if(u > T(0))
+                {
+                    flag = 0;
+                    d1 /= u;
+                    d2 /= u;
+                    x1 *= u;
+                }
+                else
+                {
+                    h11 = h12 = h21 = h22 = 0;
+                    d1 = d2 = x1 = 0;
+                }
+            }
+            else if(q2 < T(0))
+            {
+                d1 = d2 = x1 = 0;
+            }
+            else
+            {
+                flag   = 1;
+                h11    = p1 / p2;
+                h22    = x1 / y1;
+                T u    = 1 + h11 * h22;
+                T temp = d2 / u;
+                d2     = d1 / u;
+                d1     = temp;
+                x1     = y1 * u;
+            }
+
+            // Make the implicit elements explicit before rescaling
+            auto explicit_h = [&]() {
+                if(flag == T(0))
+                    h11 = h22 = 1;
+                else if(flag == T(1))
+                {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+            };
+
+            if(d1 != T(0))
+                while(d1 <= rgamsq || d1 >= gamsq)
+                {
+                    explicit_h();
+                    if(d1 <= rgamsq)
+                    {
+                        d1 *= gamsq;
+                        x1 /= gam;
+                        h11 /= gam;
+                        h12 /= gam;
+                    }
+                    else
+                    {
+                        d1 /= gamsq;
+                        x1 *= gam;
+                        h11 *= gam;
+                        h12 *= gam;
+                    }
+                }
+
+            if(d2 != T(0))
+                while(fabs(d2) <= rgamsq || fabs(d2) >= gamsq)
+                {
+                    explicit_h();
+                    if(fabs(d2) <= rgamsq)
+                    {
+                        d2 *= gamsq;
+                        h21 /= gam;
+                        h22 /= gam;
+                    }
+                    else
+                    {
+                        d2 /= gamsq;
+                        h21 *= gam;
+                        h22 *= gam;
+                    }
+                }
+        }
+
+        if(flag < T(0))
+        {
+            param[1] = h11;
+            param[2] = h21;
+            param[3] = h12;
+            param[4] = h22;
+        }
+        else if(flag == T(0))
+        {
+            param[2] = h21;
+            param[3] = h12;
+        }
+        else
+        {
+            param[1] = h11;
+            param[4] = h22;
+        }
+        param[0] = flag;
+    }
+
+    template <typename T, typename Tc>
+    __global__ void rotg_kernel(cuda_operand<T>  a,
+                                cuda_operand<T>  b,
+                                cuda_operand<Tc> c,
+                                cuda_operand<T>  s,
+                                int              batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i < batch_count)
+            rotg(*a[i], *b[i], *c[i], *s[i]);
+    }
+
+    template <typename T>
+    __global__ void rotmg_kernel(cuda_operand<T>       d1,
+                                 cuda_operand<T>       d2,
+                                 cuda_operand<T>       x1,
+                                 cuda_operand<const T> y1,
+                                 cuda_operand<T>       param,
+                                 int                   batch_count)
+    {
+        int64_t i = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(i < batch_count)
+            rotmg(*d1[i], *d2[i], *x1[i], *y1[i], param[i]);
+    }
+}
+
+template <typename T>
+hipblasStatus_t hipblas_axpy_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    using U = cuda_t<T>;
+
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto a = context.scalar(alpha);
+    if(context.host_mode && a.value == U(0))
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipLaunchKernelGGL((axpy_kernel<U, U>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       a,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_scal_batched_cuda(hipblasHandle_t          handle,
+                                          int                      n,
+                                          const Ta*                alpha,
+                                          hipblas_batch_operand<T> x,
+                                          int                      incx,
+                                          int                      batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || cuda_null(x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipLaunchKernelGGL((scal_kernel<cuda_t<T>, cuda_t<Ta>>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       context.scalar(alpha),
+                       cuda_cast(x),
+                       incx,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T>
+hipblasStatus_t hipblas_copy_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipLaunchKernelGGL((copy_kernel<cuda_t<T>>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T>
+hipblasStatus_t hipblas_swap_batched_cuda(hipblasHandle_t          handle,
+                                          int                      n,
+                                          hipblas_batch_operand<T> x,
+                                          int                      incx,
+                                          hipblas_batch_operand<T> y,
+                                          int                      incy,
+                                          int                      batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipLaunchKernelGGL((swap_kernel<cuda_t<T>>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T>
+hipblasStatus_t hipblas_dot_batched_cuda(hipblasHandle_t                handle,
+                                         bool                           conj,
+                                         int                            n,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<const T> y,
+                                         int                            incy,
+                                         int                            batch_count,
+                                         T*                             result)
+{
+    using U = cuda_t<T>;
+
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return result_zero(context, result, batch_count);
+    if(!result || cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    T* target = result_target(context, result, batch_count);
+    if(!target)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipLaunchKernelGGL((conj ? dot_kernel<true, U> : dot_kernel<false, U>),
+                       dim3(cuda_batch_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       batch_count,
+                       cuda_cast(target));
+    return result_finish(context, target, result, batch_count);
+}
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblas_nrm2_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          int                            batch_count,
+                                          Tr*                            result)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return result_zero(context, result, batch_count);
+    if(!result || cuda_null(x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    Tr* target = result_target(context, result, batch_count);
+    if(!target)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipLaunchKernelGGL((sum_kernel<cuda_t<T>, Tr, norm_op, sqrt_op>),
+                       dim3(cuda_batch_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       incx,
+                       batch_count,
+                       target,
+                       norm_op{},
+                       sqrt_op{});
+    return result_finish(context, target, result, batch_count);
+}
+
+template <typename T, typename Tr>
+hipblasStatus_t hipblas_asum_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          int                            batch_count,
+                                          Tr*                            result)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return result_zero(context, result, batch_count);
+    if(!result || cuda_null(x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    Tr* target = result_target(context, result, batch_count);
+    if(!target)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipLaunchKernelGGL((sum_kernel<cuda_t<T>, Tr, abs1_op, identity_op>),
+                       dim3(cuda_batch_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       incx,
+                       batch_count,
+                       target,
+                       abs1_op{},
+                       identity_op{});
+    return result_finish(context, target, result, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_iamax_iamin_batched_cuda(hipblasHandle_t                handle,
+                                                 bool                           max,
+                                                 int                            n,
+                                                 hipblas_batch_operand<const T> x,
+                                                 int                            incx,
+                                                 int                            batch_count,
+                                                 int*                           result)
+{
+    using U = cuda_t<T>;
+
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return result_zero(context, result, batch_count);
+    if(!result || cuda_null(x))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int* target = result_target(context, result, batch_count);
+    if(!target)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipLaunchKernelGGL((max ? iamax_kernel<true, U> : iamax_kernel<false, U>),
+                       dim3(cuda_batch_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       incx,
+                       batch_count,
+                       target);
+    return result_finish(context, target, result, batch_count);
+}
+
+template <typename T, typename Tc, typename Ts>
+hipblasStatus_t hipblas_rot_batched_cuda(hipblasHandle_t          handle,
+                                         int                      n,
+                                         hipblas_batch_operand<T> x,
+                                         int                      incx,
+                                         hipblas_batch_operand<T> y,
+                                         int                      incy,
+                                         const Tc*                c,
+                                         const Ts*                s,
+                                         int                      batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!c || !s || cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipLaunchKernelGGL((rot_kernel<cuda_t<T>, cuda_t<Tc>, cuda_t<Ts>>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       context.scalar(c),
+                       context.scalar(s),
+                       batch_count);
+    return cuda_launch_status();
+}
+
+// In host pointer mode the operands of rotg and rotmg are host memory, and
+// the few flops of each batch member are done on the host
+template <typename T, typename Tc>
+hipblasStatus_t hipblas_rotg_batched_cuda(hipblasHandle_t           handle,
+                                          hipblas_batch_operand<T>  a,
+                                          hipblas_batch_operand<T>  b,
+                                          hipblas_batch_operand<Tc> c,
+                                          hipblas_batch_operand<T>  s,
+                                          int                       batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(a) || cuda_null(b) || cuda_null(c) || cuda_null(s))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto ua = cuda_cast(a);
+    auto ub = cuda_cast(b);
+    auto uc = cuda_cast(c);
+    auto us = cuda_cast(s);
+    if(context.host_mode)
+    {
+        for(int i = 0; i < batch_count; i++)
+            rotg(*ua[i], *ub[i], *uc[i], *us[i]);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipLaunchKernelGGL((rotg_kernel<cuda_t<T>, cuda_t<Tc>>),
+                       dim3(cuda_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       ua,
+                       ub,
+                       uc,
+                       us,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T>
+hipblasStatus_t hipblas_rotm_batched_cuda(hipblasHandle_t                handle,
+                                          int                            n,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          hipblas_batch_operand<const T> param,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(param) || cuda_null(x) || cuda_null(y))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Host parameters are gathered into device memory for the kernel
+    cuda_operand<const T> device_param = cuda_cast(param);
+    if(context.host_mode)
+    {
+        std::vector<T> gathered(size_t(batch_count) * 5);
+        for(int b = 0; b < batch_count; b++)
+            std::copy(device_param[b], device_param[b] + 5, gathered.begin() + size_t(b) * 5);
+
+        // A captured copy would read the vector after it is gone, so captured
+        // parameters live in staging the device reads directly
+        T* staged = hipblas_is_capturing(handle)
+                        ? static_cast<T*>(
+                            hipblas_capture_staging(handle, sizeof(T) * gathered.size()))
+                        : context.scratch<T>(gathered.size());
+        if(!staged)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(hipblas_is_capturing(handle))
+            std::copy(gathered.begin(), gathered.end(), staged);
+        else if(hipMemcpyAsync(staged,
+                               gathered.data(),
+                               sizeof(T) * gathered.size(),
+                               hipMemcpyHostToDevice,
+                               context.stream)
+                != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        device_param = {staged, nullptr, 5};
+    }
+
+    hipLaunchKernelGGL((rotm_kernel<T>),
+                       element_grid(n, batch_count),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       n,
+                       cuda_cast(x),
+                       cuda_vector_offset(n, incx),
+                       incx,
+                       cuda_cast(y),
+                       cuda_vector_offset(n, incy),
+                       incy,
+                       device_param,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+template <typename T>
+hipblasStatus_t hipblas_rotmg_batched_cuda(hipblasHandle_t                handle,
+                                           hipblas_batch_operand<T>       d1,
+                                           hipblas_batch_operand<T>       d2,
+                                           hipblas_batch_operand<T>       x1,
+                                           hipblas_batch_operand<const T> y1,
+                                           hipblas_batch_operand<T>       param,
+                                           int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(d1) || cuda_null(d2) || cuda_null(x1) || cuda_null(y1)
+       || cuda_null(param))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto ud1    = cuda_cast(d1);
+    auto ud2    = cuda_cast(d2);
+    auto ux1    = cuda_cast(x1);
+    auto uy1    = cuda_cast(y1);
+    auto uparam = cuda_cast(param);
+    if(context.host_mode)
+    {
+        for(int i = 0; i < batch_count; i++)
+            rotmg(*ud1[i], *ud2[i], *ux1[i], *uy1[i], uparam[i]);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipLaunchKernelGGL((rotmg_kernel<T>),
+                       dim3(cuda_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       context.stream,
+                       ud1,
+                       ud2,
+                       ux1,
+                       uy1,
+                       uparam,
+                       batch_count);
+    return cuda_launch_status();
+}
+
+// Instantiations for the types of the hipBLAS API
+#define HIPBLAS_INSTANTIATE_LEVEL1(T__, Tr__)                                                   \
+    template hipblasStatus_t hipblas_axpy_batched_cuda<T__>(                                    \
+        hipblasHandle_t,                                                                        \
+        int,                                                                                    \
+        const T__*,                                                                             \
+        hipblas_batch_operand<const T__>,                                                       \
+        int,                                                                                    \
+        hipblas_batch_operand<T__>,                                                             \
+        int,                                                                                    \
+        int);                                                                                   \
+    template hipblasStatus_t hipblas_scal_batched_cuda<T__, T__>(                               \
+        hipblasHandle_t, int, const T__*, hipblas_batch_operand<T__>, int, int);                \
+    template hipblasStatus_t hipblas_copy_batched_cuda<T__>(hipblasHandle_t,                    \
+                                                            int,                                \
+                                                            hipblas_batch_operand<const T__>,   \
+                                                            int,                                \
+                                                            hipblas_batch_operand<T__>,         \
+                                                            int,                                \
+                                                            int);                               \
+    template hipblasStatus_t hipblas_swap_batched_cuda<T__>(hipblasHandle_t,                    \
+                                                            int,                                \
+                                                            hipblas_batch_operand<T__>,         \
+                                                            int,                                \
+                                                            hipblas_batch_operand<T__>,         \
+                                                            int,                                \
+                                                            int);                               \
+    template hipblasStatus_t hipblas_dot_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                           bool,                                \
+                                                           int,                                 \
+                                                           hipblas_batch_operand<const T__>,    \
+                                                           int,                                 \
+                                                           hipblas_batch_operand<const T__>,    \
+                                                           int,                                 \
+                                                           int,                                 \
+                                                           T__*);                               \
+    template hipblasStatus_t hipblas_nrm2_batched_cuda<T__, Tr__>(                              \
+        hipblasHandle_t, int, hipblas_batch_operand<const T__>, int, int, Tr__*);               \
+    template hipblasStatus_t hipblas_asum_batched_cuda<T__, Tr__>(                              \
+        hipblasHandle_t, int, hipblas_batch_operand<const T__>, int, int, Tr__*);               \
+    template hipblasStatus_t hipblas_iamax_iamin_batched_cuda<T__>(                             \
+        hipblasHandle_t, bool, int, hipblas_batch_operand<const T__>, int, int, int*);          \
+    template hipblasStatus_t hipblas_rot_batched_cuda<T__, Tr__, T__>(                          \
+        hipblasHandle_t,                                                                        \
+        int,                                                                                    \
+        hipblas_batch_operand<T__>,                                                             \
+        int,                                                                                    \
+        hipblas_batch_operand<T__>,                                                             \
+        int,                                                                                    \
+        const Tr__*,                                                                            \
+        const T__*,                                                                             \
+        int);                                                                                   \
+    template hipblasStatus_t hipblas_rotg_batched_cuda<T__, Tr__>(hipblasHandle_t,              \
+                                                                  hipblas_batch_operand<T__>,   \
+                                                                  hipblas_batch_operand<T__>,   \
+                                                                  hipblas_batch_operand<Tr__>,  \
+                                                                  hipblas_batch_operand<T__>,   \
+                                                                  int);
+
+HIPBLAS_INSTANTIATE_LEVEL1(float, float)
+HIPBLAS_INSTANTIATE_LEVEL1(double, double)
+HIPBLAS_INSTANTIATE_LEVEL1(hipblasComplex, float)
+HIPBLAS_INSTANTIATE_LEVEL1(hipblasDoubleComplex, double)
+
+// csscal, zdscal, csrot and zdrot take real scalars
+#define HIPBLAS_INSTANTIATE_REAL_SCALARS(T__, Tr__)                                             \
+    template hipblasStatus_t hipblas_scal_batched_cuda<T__, Tr__>(                              \
+        hipblasHandle_t, int, const Tr__*, hipblas_batch_operand<T__>, int, int);               \
+    template hipblasStatus_t hipblas_rot_batched_cuda<T__, Tr__, Tr__>(                         \
+        hipblasHandle_t,                                                                        \
+        int,                                                                                    \
+        hipblas_batch_operand<T__>,                                                             \
+        int,                                                                                    \
+        hipblas_batch_operand<T__>,                                                             \
+        int,                                                                                    \
+        const Tr__*,                                                                            \
+        const Tr__*,                                                                            \
+        int);
+
+HIPBLAS_INSTANTIATE_REAL_SCALARS(hipblasComplex, float)
+HIPBLAS_INSTANTIATE_REAL_SCALARS(hipblasDoubleComplex, double)
+
+// The modified Givens rotations are real only
+#define HIPBLAS_INSTANTIATE_ROTM(T__)                                                         \
+    template hipblasStatus_t hipblas_rotm_batched_cuda<T__>(hipblasHandle_t,                  \
+                                                            int,                              \
+                                                            hipblas_batch_operand<T__>,       \
+                                                            int,                              \
+                                                            hipblas_batch_operand<T__>,       \
+                                                            int,                              \
+                                                            hipblas_batch_operand<const T__>, \
+                                                            int);                             \
+    template hipblasStatus_t hipblas_rotmg_batched_cuda<T__>(hipblasHandle_t,                 \
+                                                             hipblas_batch_operand<T__>,      \
+                                                             hipblas_batch_operand<T__>,      \
+                                                             hipblas_batch_operand<T__>,      \
+                                                             hipblas_batch_operand<const T__>, \
+                                                             hipblas_batch_operand<T__>,      \
+                                                             int);
+
+HIPBLAS_INSTANTIATE_ROTM(float)
+HIPBLAS_INSTANTIATE_ROTM(double)
@@ -0,0 +1,1321 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Batched and strided batched level 2 routines of the CUDA backend.
+//
+// Every storage scheme of the level 2 API is read through cuda_matrix, so one
+// matrix-vector kernel, one rank update kernel and one triangular solve
+// kernel serve all routines. Loops over a row are limited to the bandwidth of
+// the operand, which keeps the band and triangular routines at their flops.
+
+#include "batched_device.hpp"
+
+namespace
+{
+    enum class cuda_matrix_kind
+    {
+        general,
+        symmetric,
+        hermitian,
+        triangular
+    };
+
+    // Layout of a level 2 matrix operand, and the operation applied to it
+    struct cuda_matrix
+    {
+        cuda_matrix_kind kind;
+        bool             packed; // packed triangle of an n x n matrix
+        bool             band; // band with kl sub and ku super diagonals stored
+        bool             upper; // triangle stored, unless general
+        bool             trans;
+        bool             conj;
+        bool             unit;
+        int              n;
+        int              lda;
+        int              kl;
+        int              ku;
+
+        HIPBLAS_CUDA_FN bool stored(int i, int j) const
+        {
+            return kind == cuda_matrix_kind::general || (upper ? i <= j : i >= j);
+        }
+
+        HIPBLAS_CUDA_FN int64_t offset(int64_t i, int64_t j) const
+        {
+            if(band)
+                return ku + i - j + j * lda;
+            if(packed)
+                return upper ? i + j * (j + 1) / 2 : i + j * (2 * n - j - 1) / 2;
+            return i + j * lda;
+        }
+
+        // Element (i, j) of op(A), where (i, j) is within the bandwidths
+        template <typename T>
+        __device__ T operator()(const T* A, int i, int j) const
+        {
+            if(trans)
+            {
+                int t = i;
+                i     = j;
+                j     = t;
+            }
+
+            T value(0);
+            switch(kind)
+            {
+            case cuda_matrix_kind::general:
+                if(!band || (i - j <= kl && j - i <= ku))
+                    value = A[offset(i, j)];
+                break;
+
+            case cuda_matrix_kind::triangular:
+                if(!stored(i, j))
+                    return T(0);
+                if(i == j && unit)
+                    return T(1);
+                if(!band || (i - j <= kl && j - i <= ku))
+                    value = A[offset(i, j)];
+                break;
+
+            case cuda_matrix_kind::symmetric:
+            case cuda_matrix_kind::hermitian:
+            {
+                bool swapped = !stored(i, j);
+                if(swapped)
+                {
+                    int t = i;
+                    i     = j;
+                    j     = t;
+                }
+                if(!band || (i - j <= kl && j - i <= ku))
+                    value = A[offset(i, j)];
+                if(kind == cuda_matrix_kind::hermitian)
+                {
+                    if(i == j)
+                        value = T(cuda_real(value));
+                    else if(swapped)
+                        value = cuda_conj(value);
+                }
+                break;
+            }
+            }
+            return conj ? cuda_conj(value) : value;
+        }
+    };
+
+    cuda_matrix make_matrix(cuda_matrix_kind  kind,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            int               lda,
+                            int               kl = 0,
+                            int               ku = 0,
+                            bool              band   = false,
+                            bool              packed = false)
+    {
+        cuda_matrix mat = {};
+        mat.kind        = kind;
+        mat.packed      = packed;
+        mat.band        = band;
+        mat.upper       = uplo == HIPBLAS_FILL_MODE_UPPER;
+        mat.n           = n;
+        mat.lda         = lda;
+        mat.kl          = kl;
+        mat.ku          = ku;
+        return mat;
+    }
+
+    // Band storage of a triangle with k off diagonals
+    cuda_matrix
+        make_band_triangle(cuda_matrix_kind kind, hipblasFillMode_t uplo, int n, int k, int lda)
+    {
+        bool upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+        return make_matrix(kind, uplo, n, lda, upper ? 0 : k, upper ? k : 0, true);
+    }
+
+    void set_operation(cuda_matrix& mat, hipblasOperation_t trans, hipblasDiagType_t diag)
+    {
+        mat.trans = trans != HIPBLAS_OP_N;
+        mat.conj  = trans == HIPBLAS_OP_C;
+        mat.unit  = diag == HIPBLAS_DIAG_UNIT;
+    }
+
+    // Sub and super diagonals of op(A) for a triangular A with k off diagonals
+    void triangle_bandwidths(const cuda_matrix& mat, int k, int& sub, int& super)
+    {
+        sub   = mat.upper == mat.trans ? k : 0;
+        super = mat.upper == mat.trans ? 0 : k;
+    }
+
+    template <typename T>
+    cuda_operand<const T> cuda_const(cuda_operand<T> x)
+    {
+        return {x.p, x.array, x.stride};
+    }
+
+    // y = alpha * op(A) * x + beta * y, a thread per row of op(A)
+    template <typename T>
+    __global__ void mv_kernel(cuda_matrix           mat,
+                              int                   rows,
+                              int                   cols,
+                              int                   sub,
+                              int                   super,
+                              cuda_scalar<T>        alpha,
+                              cuda_operand<const T> A,
+                              cuda_operand<const T> x,
+                              int64_t               offset_x,
+                              int                   incx,
+                              cuda_scalar<T>        beta,
+                              cuda_operand<T>       y,
+                              int64_t               offset_y,
+                              int                   incy,
+                              int                   batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        T   a  = alpha.get();
+        T   bv = beta.get();
+        int lo = i > sub ? i - sub : 0;
+        int hi = cols - i > super ? i + super + 1 : cols;
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* Ab = A[b];
+            const T* xb = x[b] + offset_x;
+            T*       yi = y[b] + offset_y + int64_t(i) * incy;
+
+            T sum(0);
+            for(int j = lo; j < hi; j++)
+                sum = sum + mat(Ab, i, j) * xb[int64_t(j) * incx];
+            *yi = bv == T(0) ? a * sum : a * sum + bv * *yi;
+        }
+    }
+
+    // As mv_kernel with a block per row, for transposed operands whose rows
+    // are contiguous columns of A
+    template <typename T>
+    __global__ void mv_block_kernel(cuda_matrix           mat,
+                                    int                   rows,
+                                    int                   cols,
+                                    int                   sub,
+                                    int                   super,
+                                    cuda_scalar<T>        alpha,
+                                    cuda_operand<const T> A,
+                                    cuda_operand<const T> x,
+                                    int64_t               offset_x,
+                                    int                   incx,
+                                    cuda_scalar<T>        beta,
+                                    cuda_operand<T>       y,
+                                    int64_t               offset_y,
+                                    int                   incy,
+                                    int                   batch_count)
+    {
+        int i = blockIdx.x;
+
+        T   a  = alpha.get();
+        T   bv = beta.get();
+        int lo = i > sub ? i - sub : 0;
+        int hi = cols - i > super ? i + super + 1 : cols;
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* Ab = A[b];
+            const T* xb = x[b] + offset_x;
+
+            T sum(0);
+            for(int j = lo + threadIdx.x; j < hi; j += blockDim.x)
+                sum = sum + mat(Ab, i, j) * xb[int64_t(j) * incx];
+            sum = cuda_block_sum(sum);
+            if(threadIdx.x == 0)
+            {
+                T* yi = y[b] + offset_y + int64_t(i) * incy;
+                *yi   = bv == T(0) ? a * sum : a * sum + bv * *yi;
+            }
+        }
+    }
+
+    template <typename T>
+    __global__ void copy_back_kernel(
+        int n, const T* work, cuda_operand<T> x, int64_t offset_x, int incx, int batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+            (x[b] + offset_x)[int64_t(i) * incx] = work[int64_t(b) * n + i];
+    }
+
+    template <typename T>
+    hipblasStatus_t launch_mv(const cuda_context&   context,
+                              const cuda_matrix&    mat,
+                              int                   rows,
+                              int                   cols,
+                              int                   sub,
+                              int                   super,
+                              cuda_scalar<T>        alpha,
+                              cuda_operand<const T> A,
+                              cuda_operand<const T> x,
+                              int                   incx,
+                              cuda_scalar<T>        beta,
+                              cuda_operand<T>       y,
+                              int                   incy,
+                              int                   batch_count)
+    {
+        if(mat.trans)
+            hipLaunchKernelGGL((mv_block_kernel<T>),
+                               dim3(rows, cuda_batch_blocks(batch_count)),
+                               dim3(hipblas_cuda_threads),
+                               0,
+                               context.stream,
+                               mat,
+                               rows,
+                               cols,
+                               sub,
+                               super,
+                               alpha,
+                               A,
+                               x,
+                               cuda_vector_offset(cols, incx),
+                               incx,
+                               beta,
+                               y,
+                               cuda_vector_offset(rows, incy),
+                               incy,
+                               batch_count);
+        else
+            hipLaunchKernelGGL((mv_kernel<T>),
+                               dim3(cuda_blocks(rows), cuda_batch_blocks(batch_count)),
+                               dim3(hipblas_cuda_threads),
+                               0,
+                               context.stream,
+                               mat,
+                               rows,
+                               cols,
+                               sub,
+                               super,
+                               alpha,
+                               A,
+                               x,
+                               cuda_vector_offset(cols, incx),
+                               incx,
+                               beta,
+                               y,
+                               cuda_vector_offset(rows, incy),
+                               incy,
+                               batch_count);
+        return cuda_launch_status();
+    }
+
+    // Scalars and operand checks shared by the routines computing
+    // y = alpha * op(A) * x + beta * y
+    template <typename T>
+    hipblasStatus_t matrix_vector(const cuda_context&            context,
+                                  const cuda_matrix&             mat,
+                                  int                            rows,
+                                  int                            cols,
+                                  int                            sub,
+                                  int                            super,
+                                  const T*                       alpha,
+                                  hipblas_batch_operand<const T> A,
+                                  hipblas_batch_operand<const T> x,
+                                  int                            incx,
+                                  const T*                       beta,
+                                  hipblas_batch_operand<T>       y,
+                                  int                            incy,
+                                  int                            batch_count)
+    {
+        if(!alpha || !beta)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto a = context.scalar(alpha);
+        auto b = context.scalar(beta);
+        if(context.host_mode && a.value == cuda_t<T>(0) && b.value == cuda_t<T>(1))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(cuda_null(A) || cuda_null(x) || cuda_null(y))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        return launch_mv(context,
+                         mat,
+                         rows,
+                         cols,
+                         sub,
+                         super,
+                         a,
+                         cuda_cast(A),
+                         cuda_cast(x),
+                         incx,
+                         b,
+                         cuda_cast(y),
+                         incy,
+                         batch_count);
+    }
+
+    // x = op(A) * x, through scratch of the handle
+    template <typename T>
+    hipblasStatus_t triangular_mv(const cuda_context&            context,
+                                  const cuda_matrix&             mat,
+                                  int                            m,
+                                  int                            k,
+                                  hipblas_batch_operand<const T> A,
+                                  hipblas_batch_operand<T>       x,
+                                  int                            incx,
+                                  int                            batch_count)
+    {
+        using U = cuda_t<T>;
+
+        if(cuda_null(A) || cuda_null(x))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        U* work = context.scratch<U>(size_t(m) * batch_count);
+        if(!work)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        int sub, super;
+        triangle_bandwidths(mat, k, sub, super);
+
+        auto            ux = cuda_cast(x);
+        hipblasStatus_t status
+            = launch_mv(context,
+                        mat,
+                        m,
+                        m,
+                        sub,
+                        super,
+                        cuda_scalar<U>{U(1), nullptr},
+                        cuda_cast(A),
+                        cuda_const(ux),
+                        incx,
+                        cuda_scalar<U>{U(0), nullptr},
+                        cuda_operand<U>{work, nullptr, m},
+                        1,
+                        batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL((copy_back_kernel<U>),
+                           dim3(cuda_blocks(m), cuda_batch_blocks(batch_count)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           context.stream,
+                           m,
+                           work,
+                           ux,
+                           cuda_vector_offset(m, incx),
+                           incx,
+                           batch_count);
+        return cuda_launch_status();
+    }
+
+    enum class cuda_rank_kind
+    {
+        ger,
+        gerc,
+        syr,
+        her,
+        syr2,
+        her2
+    };
+
+    // A += the rank 1 or rank 2 update of kind, on the stored elements of A
+    template <typename T, typename Ta>
+    __global__ void rank_kernel(cuda_rank_kind        kind,
+                                cuda_matrix           mat,
+                                int                   m,
+                                int                   n,
+                                cuda_scalar<Ta>       alpha,
+                                cuda_operand<const T> x,
+                                int64_t               offset_x,
+                                int                   incx,
+                                cuda_operand<const T> y,
+                                int64_t               offset_y,
+                                int                   incy,
+                                cuda_operand<T>       A,
+                                int                   batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        T    a         = T(alpha.get());
+        bool hermitian = kind == cuda_rank_kind::her || kind == cuda_rank_kind::her2;
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+        {
+            if(!mat.stored(i, j))
+                continue;
+
+            for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            {
+                const T* xb = x[b] + offset_x;
+                const T* yb = y[b] + offset_y;
+                T        xi = xb[int64_t(i) * incx];
+
+                T update(0);
+                switch(kind)
+                {
+                case cuda_rank_kind::ger:
+                    update = a * xi * yb[int64_t(j) * incy];
+                    break;
+                case cuda_rank_kind::gerc:
+                    update = a * xi * cuda_conj(yb[int64_t(j) * incy]);
+                    break;
+                case cuda_rank_kind::syr:
+                    update = a * xi * xb[int64_t(j) * incx];
+                    break;
+                case cuda_rank_kind::her:
+                    update = a * xi * cuda_conj(xb[int64_t(j) * incx]);
+                    break;
+                case cuda_rank_kind::syr2:
+                    update = a
+                             * (xi * yb[int64_t(j) * incy]
+                                + yb[int64_t(i) * incy] * xb[int64_t(j) * incx]);
+                    break;
+                case cuda_rank_kind::her2:
+                    update = a * xi * cuda_conj(yb[int64_t(j) * incy])
+                             + cuda_conj(a) * yb[int64_t(i) * incy]
+                                   * cuda_conj(xb[int64_t(j) * incx]);
+                    break;
+                }
+
+                T* aij   = A[b] + mat.offset(i, j);
+                T  value = *aij + update;
+                *aij     = hermitian && i == j ? T(cuda_real(value)) : value;
+            }
+        }
+    }
+
+    template <typename T, typename Ta>
+    hipblasStatus_t rank_update(const cuda_context&            context,
+                                cuda_rank_kind                 kind,
+                                const cuda_matrix&             mat,
+                                int                            m,
+                                int                            n,
+                                const Ta*                      alpha,
+                                hipblas_batch_operand<const T> x,
+                                int                            incx,
+                                hipblas_batch_operand<const T> y,
+                                int                            incy,
+                                hipblas_batch_operand<T>       A,
+                                int                            batch_count)
+    {
+        if(!alpha)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        auto a = context.scalar(alpha);
+        if(context.host_mode && a.value == cuda_t<Ta>(0))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(cuda_null(x) || cuda_null(y) || cuda_null(A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipLaunchKernelGGL((rank_kernel<cuda_t<T>, cuda_t<Ta>>),
+                           dim3(cuda_blocks(m),
+                                unsigned(std::min(n, hipblas_cuda_max_grid)),
+                                cuda_batch_blocks(batch_count)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           context.stream,
+                           kind,
+                           mat,
+                           m,
+                           n,
+                           a,
+                           cuda_cast(x),
+                           cuda_vector_offset(m, incx),
+                           incx,
+                           cuda_cast(y),
+                           cuda_vector_offset(n, incy),
+                           incy,
+                           cuda_cast(A),
+                           batch_count);
+        return cuda_launch_status();
+    }
+
+    // Solves op(A) * x = b in place, a block per batch member substituting a
+    // column of op(A) at a time
+    template <typename T>
+    __global__ void sv_kernel(cuda_matrix           mat,
+                              int                   n,
+                              int                   sub,
+                              int                   super,
+                              cuda_operand<const T> A,
+                              cuda_operand<T>       x,
+                              int64_t               offset_x,
+                              int                   incx,
+                              int                   batch_count)
+    {
+        bool forward = mat.upper == mat.trans;
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const T* Ab = A[b];
+            T*       xb = x[b] + offset_x;
+
+            for(int step = 0; step < n; step++)
+            {
+                int j = forward ? step : n - 1 - step;
+                if(threadIdx.x == 0 && !mat.unit)
+                    xb[int64_t(j) * incx] = xb[int64_t(j) * incx] / mat(Ab, j, j);
+                __syncthreads();
+
+                T xj = xb[int64_t(j) * incx];
+                if(forward)
+                {
+                    int last = n - 1 - j > sub ? j + sub : n - 1;
+                    for(int i = j + 1 + threadIdx.x; i <= last; i += blockDim.x)
+                        xb[int64_t(i) * incx] = xb[int64_t(i) * incx] - mat(Ab, i, j) * xj;
+                }
+                else
+                {
+                    int first = j > super ? j - super : 0;
+                    for(int i = j - 1 - int(threadIdx.x); i >= first; i -= blockDim.x)
+                        xb[int64_t(i) * incx] = xb[int64_t(i) * incx] - mat(Ab, i, j) * xj;
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t triangular_sv(const cuda_context&            context,
+                                  const cuda_matrix&             mat,
+                                  int                            m,
+                                  int                            k,
+                                  hipblas_batch_operand<const T> A,
+                                  hipblas_batch_operand<T>       x,
+                                  int                            incx,
+                                  int                            batch_count)
+    {
+        if(cuda_null(A) || cuda_null(x))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int sub, super;
+        triangle_bandwidths(mat, k, sub, super);
+        hipLaunchKernelGGL((sv_kernel<cuda_t<T>>),
+                           dim3(cuda_batch_blocks(batch_count)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           context.stream,
+                           mat,
+                           m,
+                           sub,
+                           super,
+                           cuda_cast(A),
+                           cuda_cast(x),
+                           cuda_vector_offset(m, incx),
+                           incx,
+                           batch_count);
+        return cuda_launch_status();
+    }
+}
+
+template <typename T>
+hipblasStatus_t hipblas_gemv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasOperation_t             trans,
+                                          int                            m,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_trans(trans))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(1, m) || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat = make_matrix(cuda_matrix_kind::general, HIPBLAS_FILL_MODE_FULL, m, lda);
+    set_operation(mat, trans, HIPBLAS_DIAG_NON_UNIT);
+    int rows = mat.trans ? n : m;
+    int cols = mat.trans ? m : n;
+    return matrix_vector(
+        context, mat, rows, cols, rows, cols, alpha, A, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_gbmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasOperation_t             trans,
+                                          int                            m,
+                                          int                            n,
+                                          int                            kl,
+                                          int                            ku,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_trans(trans))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || kl < 0 || ku < 0 || lda < kl + ku + 1 || !incx || !incy
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat
+        = make_matrix(cuda_matrix_kind::general, HIPBLAS_FILL_MODE_FULL, m, lda, kl, ku, true);
+    set_operation(mat, trans, HIPBLAS_DIAG_NON_UNIT);
+    int rows = mat.trans ? n : m;
+    int cols = mat.trans ? m : n;
+    int sub  = mat.trans ? ku : kl;
+    int sup  = mat.trans ? kl : ku;
+    return matrix_vector(
+        context, mat, rows, cols, sub, sup, alpha, A, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_symv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || lda < std::max(1, n) || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat = make_matrix(
+        hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric, uplo, n, lda);
+    return matrix_vector(context, mat, n, n, n, n, alpha, A, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_spmv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat
+        = make_matrix(hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric,
+                      uplo,
+                      n,
+                      n,
+                      0,
+                      0,
+                      false,
+                      true);
+    return matrix_vector(context, mat, n, n, n, n, alpha, AP, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_sbmv_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          int                            k,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          const T*                       beta,
+                                          hipblas_batch_operand<T>       y,
+                                          int                            incy,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || k < 0 || lda < k + 1 || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat = make_band_triangle(
+        hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric, uplo, n, k, lda);
+    return matrix_vector(context, mat, n, n, k, k, alpha, A, x, incx, beta, y, incy, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_ger_batched_cuda(hipblasHandle_t                handle,
+                                         bool                           conj,
+                                         int                            m,
+                                         int                            n,
+                                         const T*                       alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<const T> y,
+                                         int                            incy,
+                                         hipblas_batch_operand<T>       A,
+                                         int                            lda,
+                                         int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(m < 0 || n < 0 || !incx || !incy || lda < std::max(1, m) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat = make_matrix(cuda_matrix_kind::general, HIPBLAS_FILL_MODE_FULL, m, lda);
+    return rank_update(context,
+                       conj ? cuda_rank_kind::gerc : cuda_rank_kind::ger,
+                       mat,
+                       m,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       A,
+                       batch_count);
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_syr_batched_cuda(hipblasHandle_t                handle,
+                                         hipblasFillMode_t              uplo,
+                                         int                            n,
+                                         const Ta*                      alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<T>       A,
+                                         int                            lda,
+                                         int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || !incx || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool        hermitian = !std::is_same<T, Ta>::value;
+    cuda_matrix mat       = make_matrix(
+        hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric, uplo, n, lda);
+    return rank_update(context,
+                       hermitian ? cuda_rank_kind::her : cuda_rank_kind::syr,
+                       mat,
+                       n,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       x,
+                       incx,
+                       A,
+                       batch_count);
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_spr_batched_cuda(hipblasHandle_t                handle,
+                                         hipblasFillMode_t              uplo,
+                                         int                            n,
+                                         const Ta*                      alpha,
+                                         hipblas_batch_operand<const T> x,
+                                         int                            incx,
+                                         hipblas_batch_operand<T>       AP,
+                                         int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || !incx || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    bool        hermitian = !std::is_same<T, Ta>::value;
+    cuda_matrix mat
+        = make_matrix(hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric,
+                      uplo,
+                      n,
+                      n,
+                      0,
+                      0,
+                      false,
+                      true);
+    return rank_update(context,
+                       hermitian ? cuda_rank_kind::her : cuda_rank_kind::syr,
+                       mat,
+                       n,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       x,
+                       incx,
+                       AP,
+                       batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_syr2_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<const T> y,
+                                          int                            incy,
+                                          hipblas_batch_operand<T>       A,
+                                          int                            lda,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || !incx || !incy || lda < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat = make_matrix(
+        hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric, uplo, n, lda);
+    return rank_update(context,
+                       hermitian ? cuda_rank_kind::her2 : cuda_rank_kind::syr2,
+                       mat,
+                       n,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       A,
+                       batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_spr2_batched_cuda(hipblasHandle_t                handle,
+                                          bool                           hermitian,
+                                          hipblasFillMode_t              uplo,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> x,
+                                          int                            incx,
+                                          hipblas_batch_operand<const T> y,
+                                          int                            incy,
+                                          hipblas_batch_operand<T>       AP,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || n < 0 || !incx || !incy || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    cuda_matrix mat
+        = make_matrix(hermitian ? cuda_matrix_kind::hermitian : cuda_matrix_kind::symmetric,
+                      uplo,
+                      n,
+                      n,
+                      0,
+                      0,
+                      false,
+                      true);
+    return rank_update(context,
+                       hermitian ? cuda_rank_kind::her2 : cuda_rank_kind::syr2,
+                       mat,
+                       n,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       AP,
+                       batch_count);
+}
+
+// Argument checks of the triangular routines; a nonzero status ends the call
+#define HIPBLAS_CHECK_TRIANGULAR(m__, lda_ok__)                                         \
+    cuda_context    context;                                                            \
+    hipblasStatus_t status = cuda_get_context(handle, context);                         \
+    if(status != HIPBLAS_STATUS_SUCCESS)                                                \
+        return status;                                                                  \
+    if(!valid_uplo(uplo) || !valid_trans(transA) || !valid_diag(diag) || (m__) < 0      \
+       || !(lda_ok__) || !incx || batch_count < 0)                                      \
+        return HIPBLAS_STATUS_INVALID_VALUE;                                            \
+    if(!(m__) || !batch_count)                                                          \
+        return HIPBLAS_STATUS_SUCCESS;
+
+template <typename T>
+hipblasStatus_t hipblas_trmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(m, lda >= std::max(1, m))
+
+    cuda_matrix mat = make_matrix(cuda_matrix_kind::triangular, uplo, m, lda);
+    set_operation(mat, transA, diag);
+    return triangular_mv(context, mat, m, m, A, x, incx, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_tpmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(m, true)
+
+    cuda_matrix mat
+        = make_matrix(cuda_matrix_kind::triangular, uplo, m, m, 0, 0, false, true);
+    set_operation(mat, transA, diag);
+    return triangular_mv(context, mat, m, m, AP, x, incx, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_tbmv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          int                            k,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(m, k >= 0 && lda >= k + 1)
+
+    cuda_matrix mat = make_band_triangle(cuda_matrix_kind::triangular, uplo, m, k, lda);
+    set_operation(mat, transA, diag);
+    return triangular_mv(context, mat, m, k, A, x, incx, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_trsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(m, lda >= std::max(1, m))
+
+    cuda_matrix mat = make_matrix(cuda_matrix_kind::triangular, uplo, m, lda);
+    set_operation(mat, transA, diag);
+    return triangular_sv(context, mat, m, m, A, x, incx, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_tpsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          hipblas_batch_operand<const T> AP,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(m, true)
+
+    cuda_matrix mat
+        = make_matrix(cuda_matrix_kind::triangular, uplo, m, m, 0, 0, false, true);
+    set_operation(mat, transA, diag);
+    return triangular_sv(context, mat, m, m, AP, x, incx, batch_count);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_tbsv_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            n,
+                                          int                            k,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       x,
+                                          int                            incx,
+                                          int                            batch_count)
+{
+    HIPBLAS_CHECK_TRIANGULAR(n, k >= 0 && lda >= k + 1)
+
+    cuda_matrix mat = make_band_triangle(cuda_matrix_kind::triangular, uplo, n, k, lda);
+    set_operation(mat, transA, diag);
+    return triangular_sv(context, mat, n, k, A, x, incx, batch_count);
+}
+
+#undef HIPBLAS_CHECK_TRIANGULAR
+
+// Instantiations for the types of the hipBLAS API
+#define HIPBLAS_OPERAND(T__) hipblas_batch_operand<T__>
+#define HIPBLAS_CONST_OPERAND(T__) hipblas_batch_operand<const T__>
+
+#define HIPBLAS_INSTANTIATE_LEVEL2(T__, Tr__)                                                    \
+    template hipblasStatus_t hipblas_gemv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasOperation_t,                  \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_gbmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasOperation_t,                  \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_symv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            bool,                                \
+                                                            hipblasFillMode_t,                   \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_spmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            bool,                                \
+                                                            hipblasFillMode_t,                   \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_sbmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            bool,                                \
+                                                            hipblasFillMode_t,                   \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_ger_batched_cuda<T__>(hipblasHandle_t,                      \
+                                                           bool,                                 \
+                                                           int,                                  \
+                                                           int,                                  \
+                                                           const T__*,                           \
+                                                           HIPBLAS_CONST_OPERAND(T__),           \
+                                                           int,                                  \
+                                                           HIPBLAS_CONST_OPERAND(T__),           \
+                                                           int,                                  \
+                                                           HIPBLAS_OPERAND(T__),                 \
+                                                           int,                                  \
+                                                           int);                                 \
+    template hipblasStatus_t hipblas_syr_batched_cuda<T__, T__>(hipblasHandle_t,                 \
+                                                                hipblasFillMode_t,               \
+                                                                int,                             \
+                                                                const T__*,                      \
+                                                                HIPBLAS_CONST_OPERAND(T__),      \
+                                                                int,                             \
+                                                                HIPBLAS_OPERAND(T__),            \
+                                                                int,                             \
+                                                                int);                            \
+    template hipblasStatus_t hipblas_spr_batched_cuda<T__, T__>(hipblasHandle_t,                 \
+                                                                hipblasFillMode_t,               \
+                                                                int,                             \
+                                                                const T__*,                      \
+                                                                HIPBLAS_CONST_OPERAND(T__),      \
+                                                                int,                             \
+                                                                HIPBLAS_OPERAND(T__),            \
+                                                                int);                            \
+    template hipblasStatus_t hipblas_syr2_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            bool,                                \
+                                                            hipblasFillMode_t,                   \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_spr2_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            bool,                                \
+                                                            hipblasFillMode_t,                   \
+                                                            int,                                 \
+                                                            const T__*,                          \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_trmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_tpmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_tbmv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_trsv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_tpsv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);                                \
+    template hipblasStatus_t hipblas_tbsv_batched_cuda<T__>(hipblasHandle_t,                     \
+                                                            hipblasFillMode_t,                   \
+                                                            hipblasOperation_t,                  \
+                                                            hipblasDiagType_t,                   \
+                                                            int,                                 \
+                                                            int,                                 \
+                                                            HIPBLAS_CONST_OPERAND(T__),          \
+                                                            int,                                 \
+                                                            HIPBLAS_OPERAND(T__),                \
+                                                            int,                                 \
+                                                            int);
+
+HIPBLAS_INSTANTIATE_LEVEL2(float, float)
+HIPBLAS_INSTANTIATE_LEVEL2(double, double)
+HIPBLAS_INSTANTIATE_LEVEL2(hipblasComplex, float)
+HIPBLAS_INSTANTIATE_LEVEL2(hipblasDoubleComplex, double)
+
+// her and hpr take a real alpha
+#define HIPBLAS_INSTANTIATE_HER(T__, Tr__)                                                  \
+    template hipblasStatus_t hipblas_syr_batched_cuda<T__, Tr__>(hipblasHandle_t,           \
+                                                                 hipblasFillMode_t,         \
+                                                                 int,                       \
+                                                                 const Tr__*,               \
+                                                                 HIPBLAS_CONST_OPERAND(T__), \
+                                                                 int,                       \
+                                                                 HIPBLAS_OPERAND(T__),      \
+                                                                 int,                       \
+                                                                 int);                      \
+    template hipblasStatus_t hipblas_spr_batched_cuda<T__, Tr__>(hipblasHandle_t,           \
+                                                                 hipblasFillMode_t,         \
+                                                                 int,                       \
+                                                                 const Tr__*,               \
+                                                                 HIPBLAS_CONST_OPERAND(T__), \
+                                                                 int,                       \
+                                                                 HIPBLAS_OPERAND(T__),      \
+                                                                 int);
+
+HIPBLAS_INSTANTIATE_HER(hipblasComplex, float)
+HIPBLAS_INSTANTIATE_HER(hipblasDoubleComplex, double)
@@ -0,0 +1,1211 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Batched and strided batched level 3 routines, and trtri, of the CUDA backend.
+//
+// cuBLAS has no batched trmm, syrk or herk, and no trtri. Each routine halves
+// its triangular operand recursively, on multiples of level3_nb, until the
+// diagonal blocks fit one kernel block. The products coupling the halves run
+// as one batched gemm of cuBLAS over the whole batch, so for large orders
+// nearly all flops are gemm flops.
+
+#include "batched_device.hpp"
+
+namespace
+{
+    // Order of the diagonal blocks the kernels compute directly
+    constexpr int level3_nb = 32;
+    // Lines of B a trmm kernel block takes, one per y thread
+    constexpr int level3_lines = hipblas_cuda_threads / level3_nb;
+
+    // Order of the leading half of an order n > level3_nb
+    int split(int n)
+    {
+        return ((n / 2 - 1) / level3_nb + 1) * level3_nb;
+    }
+
+    // Submatrix of a batched operand; element (i, j) of member b is at
+    // op[b][offset + i + j * ld]
+    template <typename T>
+    struct cuda_view
+    {
+        hipblas_batch_operand<T> op;
+        int64_t                  offset;
+        int                      ld;
+
+        cuda_view at(int64_t i, int64_t j) const
+        {
+            return {op, offset + i + j * ld, ld};
+        }
+    };
+
+    template <typename T>
+    cuda_view<T> make_view(hipblas_batch_operand<T> op, int ld)
+    {
+        return {op, 0, ld};
+    }
+
+    template <typename T>
+    cuda_view<const T> as_const(const cuda_view<T>& x)
+    {
+        return {{x.op.p, x.op.array, x.op.stride}, x.offset, x.ld};
+    }
+
+    // A triangular operand and the operation applied to it
+    struct cuda_triangle
+    {
+        bool upper; // triangle stored
+        bool trans;
+        bool conj;
+        bool unit;
+
+        // Element (i, j) of op(A)
+        template <typename T>
+        __device__ T operator()(const T* A, int lda, int i, int j) const
+        {
+            if(trans)
+            {
+                int t = i;
+                i     = j;
+                j     = t;
+            }
+            if(upper ? i > j : i < j)
+                return T(0);
+            if(i == j && unit)
+                return T(1);
+
+            T value = A[i + int64_t(j) * lda];
+            return conj ? cuda_conj(value) : value;
+        }
+
+        // Whether op(A) is upper triangular
+        bool op_upper() const
+        {
+            return upper != trans;
+        }
+    };
+
+    cuda_triangle
+        make_triangle(hipblasFillMode_t uplo, hipblasOperation_t trans, hipblasDiagType_t diag)
+    {
+        return {uplo == HIPBLAS_FILL_MODE_UPPER,
+                trans != HIPBLAS_OP_N,
+                trans == HIPBLAS_OP_C,
+                diag == HIPBLAS_DIAG_UNIT};
+    }
+
+    // Typed batched gemm of cuBLAS
+    cublasStatus_t gemm_strided(cublasHandle_t    handle,
+                                cublasOperation_t transA,
+                                cublasOperation_t transB,
+                                int               m,
+                                int               n,
+                                int               k,
+                                const float*      alpha,
+                                const float*      A,
+                                int               lda,
+                                long long         strideA,
+                                const float*      B,
+                                int               ldb,
+                                long long         strideB,
+                                const float*      beta,
+                                float*            C,
+                                int               ldc,
+                                long long         strideC,
+                                int               batch_count)
+    {
+        return cublasSgemmStridedBatched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+    }
+
+    cublasStatus_t gemm_strided(cublasHandle_t    handle,
+                                cublasOperation_t transA,
+                                cublasOperation_t transB,
+                                int               m,
+                                int               n,
+                                int               k,
+                                const double*     alpha,
+                                const double*     A,
+                                int               lda,
+                                long long         strideA,
+                                const double*     B,
+                                int               ldb,
+                                long long         strideB,
+                                const double*     beta,
+                                double*           C,
+                                int               ldc,
+                                long long         strideC,
+                                int               batch_count)
+    {
+        return cublasDgemmStridedBatched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+    }
+
+    cublasStatus_t gemm_strided(cublasHandle_t        handle,
+                                cublasOperation_t     transA,
+                                cublasOperation_t     transB,
+                                int                   m,
+                                int                   n,
+                                int                   k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                long long             strideA,
+                                const hipblasComplex* B,
+                                int                   ldb,
+                                long long             strideB,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int                   ldc,
+                                long long             strideC,
+                                int                   batch_count)
+    {
+        return cublasCgemmStridedBatched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         (const cuComplex*)alpha,
+                                         (const cuComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const cuComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const cuComplex*)beta,
+                                         (cuComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+    }
+
+    cublasStatus_t gemm_strided(cublasHandle_t              handle,
+                                cublasOperation_t           transA,
+                                cublasOperation_t           transB,
+                                int                         m,
+                                int                         n,
+                                int                         k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                long long                   strideA,
+                                const hipblasDoubleComplex* B,
+                                int                         ldb,
+                                long long                   strideB,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int                         ldc,
+                                long long                   strideC,
+                                int                         batch_count)
+    {
+        return cublasZgemmStridedBatched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         (const cuDoubleComplex*)alpha,
+                                         (const cuDoubleComplex*)A,
+                                         lda,
+                                         strideA,
+                                         (const cuDoubleComplex*)B,
+                                         ldb,
+                                         strideB,
+                                         (const cuDoubleComplex*)beta,
+                                         (cuDoubleComplex*)C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+    }
+
+    cublasStatus_t gemm_batched(cublasHandle_t      handle,
+                                cublasOperation_t   transA,
+                                cublasOperation_t   transB,
+                                int                 m,
+                                int                 n,
+                                int                 k,
+                                const float*        alpha,
+                                const float* const* A,
+                                int                 lda,
+                                const float* const* B,
+                                int                 ldb,
+                                const float*        beta,
+                                float* const*       C,
+                                int                 ldc,
+                                int                 batch_count)
+    {
+        return cublasSgemmBatched(
+            handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    }
+
+    cublasStatus_t gemm_batched(cublasHandle_t       handle,
+                                cublasOperation_t    transA,
+                                cublasOperation_t    transB,
+                                int                  m,
+                                int                  n,
+                                int                  k,
+                                const double*        alpha,
+                                const double* const* A,
+                                int                  lda,
+                                const double* const* B,
+                                int                  ldb,
+                                const double*        beta,
+                                double* const*       C,
+                                int                  ldc,
+                                int                  batch_count)
+    {
+        return cublasDgemmBatched(
+            handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    }
+
+    cublasStatus_t gemm_batched(cublasHandle_t               handle,
+                                cublasOperation_t            transA,
+                                cublasOperation_t            transB,
+                                int                          m,
+                                int                          n,
+                                int                          k,
+                                const hipblasComplex*        alpha,
+                                const hipblasComplex* const* A,
+                                int                          lda,
+                                const hipblasComplex* const* B,
+                                int                          ldb,
+                                const hipblasComplex*        beta,
+                                hipblasComplex* const*       C,
+                                int                          ldc,
+                                int                          batch_count)
+    {
+        return cublasCgemmBatched(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  (const cuComplex*)alpha,
+                                  (const cuComplex* const*)A,
+                                  lda,
+                                  (const cuComplex* const*)B,
+                                  ldb,
+                                  (const cuComplex*)beta,
+                                  (cuComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+    }
+
+    cublasStatus_t gemm_batched(cublasHandle_t                     handle,
+                                cublasOperation_t                  transA,
+                                cublasOperation_t                  transB,
+                                int                                m,
+                                int                                n,
+                                int                                k,
+                                const hipblasDoubleComplex*        alpha,
+                                const hipblasDoubleComplex* const* A,
+                                int                                lda,
+                                const hipblasDoubleComplex* const* B,
+                                int                                ldb,
+                                const hipblasDoubleComplex*        beta,
+                                hipblasDoubleComplex* const*       C,
+                                int                                ldc,
+                                int                                batch_count)
+    {
+        return cublasZgemmBatched(handle,
+                                  transA,
+                                  transB,
+                                  m,
+                                  n,
+                                  k,
+                                  (const cuDoubleComplex*)alpha,
+                                  (const cuDoubleComplex* const*)A,
+                                  lda,
+                                  (const cuDoubleComplex* const*)B,
+                                  ldb,
+                                  (const cuDoubleComplex*)beta,
+                                  (cuDoubleComplex* const*)C,
+                                  ldc,
+                                  batch_count);
+    }
+
+    // One level 3 call: the handle, and the device memory its gemm calls use
+    template <typename T>
+    struct level3_call
+    {
+        cuda_context context;
+        int          batch_count;
+        T*           scalars; // two elements
+        const T**    arrays; // 3 * batch_count pointers when the operands are arrays
+    };
+
+    template <typename T>
+    hipblasStatus_t make_call(const cuda_context& context,
+                              bool                arrays,
+                              int                 batch_count,
+                              level3_call<T>&     call)
+    {
+        call.context = context;
+
+        // The scalars come first, a slot of the widest pointer-aligned element
+        // each, then the arrays
+        constexpr size_t slot  = 16;
+        size_t           count = arrays ? 3 * size_t(batch_count) : 0;
+        char*            work  = context.scratch<char>(2 * slot + count * sizeof(const T*));
+        if(!work)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        call.batch_count = batch_count;
+        call.scalars     = reinterpret_cast<T*>(work);
+        call.arrays      = arrays ? reinterpret_cast<const T**>(work + 2 * slot) : nullptr;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    cuda_operand<T> kernel_operand(hipblas_batch_operand<T> x)
+    {
+        return {x.p, x.array, x.stride};
+    }
+
+    // The pointers of a batched gemm call over arrays of pointers
+    template <typename T>
+    __global__ void pointers_kernel(cuda_operand<const T> A,
+                                    int64_t               offset_A,
+                                    cuda_operand<const T> B,
+                                    int64_t               offset_B,
+                                    cuda_operand<T>       C,
+                                    int64_t               offset_C,
+                                    const T**             arrays,
+                                    int                   batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        arrays[b]                   = A[b] + offset_A;
+        arrays[batch_count + b]     = B[b] + offset_B;
+        arrays[2 * batch_count + b] = C[b] + offset_C;
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C over the batch
+    template <typename T>
+    hipblasStatus_t gemm(const level3_call<T>& call,
+                         hipblasOperation_t    transA,
+                         hipblasOperation_t    transB,
+                         int                   m,
+                         int                   n,
+                         int                   k,
+                         const T*              alpha,
+                         cuda_view<const T>    A,
+                         cuda_view<const T>    B,
+                         const T*              beta,
+                         cuda_view<T>          C)
+    {
+        cublasHandle_t handle = (cublasHandle_t)call.context.handle;
+        int            batch  = call.batch_count;
+        if(!call.arrays)
+            return hipCUBLASStatusToHIPStatus(gemm_strided(handle,
+                                                           hipOperationToCudaOperation(transA),
+                                                           hipOperationToCudaOperation(transB),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           A.op.p + A.offset,
+                                                           A.ld,
+                                                           A.op.stride,
+                                                           B.op.p + B.offset,
+                                                           B.ld,
+                                                           B.op.stride,
+                                                           beta,
+                                                           C.op.p + C.offset,
+                                                           C.ld,
+                                                           C.op.stride,
+                                                           batch));
+
+        hipLaunchKernelGGL((pointers_kernel<T>),
+                           dim3(cuda_blocks(batch)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           call.context.stream,
+                           kernel_operand(A.op),
+                           A.offset,
+                           kernel_operand(B.op),
+                           B.offset,
+                           kernel_operand(C.op),
+                           C.offset,
+                           call.arrays,
+                           batch);
+        hipblasStatus_t status = cuda_launch_status();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return hipCUBLASStatusToHIPStatus(gemm_batched(handle,
+                                                       hipOperationToCudaOperation(transA),
+                                                       hipOperationToCudaOperation(transB),
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       call.arrays,
+                                                       A.ld,
+                                                       call.arrays + batch,
+                                                       B.ld,
+                                                       beta,
+                                                       const_cast<T* const*>(call.arrays + 2 * batch),
+                                                       C.ld,
+                                                       batch));
+    }
+
+    // B = alpha * A over an m x n matrix, writing zeros for a zero alpha; A
+    // may be B
+    template <typename T>
+    __global__ void scale_kernel(int                   m,
+                                 int                   n,
+                                 cuda_scalar<T>        alpha,
+                                 cuda_operand<const T> A,
+                                 int64_t               offset_A,
+                                 int                   lda,
+                                 cuda_operand<T>       B,
+                                 int64_t               offset_B,
+                                 int                   ldb,
+                                 int                   batch_count)
+    {
+        int64_t tid = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+        if(tid >= int64_t(m) * n)
+            return;
+
+        int64_t i = tid % m;
+        int64_t j = tid / m;
+        T       a = alpha.get();
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            T& x = B[b][offset_B + i + j * ldb];
+            x    = a == T(0) ? T(0) : a * A[b][offset_A + i + j * lda];
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t scale(const level3_call<T>&  call,
+                          int                    m,
+                          int                    n,
+                          cuda_scalar<cuda_t<T>> alpha,
+                          cuda_view<const T>     A,
+                          cuda_view<T>           B)
+    {
+        hipLaunchKernelGGL((scale_kernel<cuda_t<T>>),
+                           dim3(cuda_blocks(int64_t(m) * n), cuda_batch_blocks(call.batch_count)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           call.context.stream,
+                           m,
+                           n,
+                           alpha,
+                           cuda_cast(A.op),
+                           A.offset,
+                           A.ld,
+                           cuda_cast(B.op),
+                           B.offset,
+                           B.ld,
+                           call.batch_count);
+        return cuda_launch_status();
+    }
+
+    // B = op(A) * B for left, else B = B * op(A), in place for an op(A) of
+    // order k <= level3_nb. Each y thread of a block takes a line of B, a
+    // column for left and a row for right, through shared memory.
+    template <typename T>
+    __global__ void trmm_kernel(cuda_triangle         tri,
+                                bool                  left,
+                                int                   k,
+                                int                   lines,
+                                cuda_operand<const T> A,
+                                int64_t               offset_A,
+                                int                   lda,
+                                cuda_operand<T>       B,
+                                int64_t               offset_B,
+                                int                   ldb,
+                                int                   batch_count)
+    {
+        __shared__ T line[level3_lines][level3_nb];
+
+        int  t      = threadIdx.x;
+        int  l      = blockIdx.x * level3_lines + threadIdx.y;
+        bool active = t < k && l < lines;
+        // Element t of line l
+        int64_t element = left ? t + int64_t(l) * ldb : l + int64_t(t) * ldb;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* Ab = A[b] + offset_A;
+            T*       Bb = B[b] + offset_B;
+            if(active)
+                line[threadIdx.y][t] = Bb[element];
+            __syncthreads();
+
+            if(active)
+            {
+                T sum(0);
+                for(int s = 0; s < k; s++)
+                    sum = sum
+                          + (left ? tri(Ab, lda, t, s) : tri(Ab, lda, s, t)) * line[threadIdx.y][s];
+                Bb[element] = sum;
+            }
+            // The next member reloads line
+            __syncthreads();
+        }
+    }
+
+    // B = op(A) * B for left, else B = B * op(A), without alpha. The handle
+    // must be in host pointer mode.
+    template <typename T>
+    hipblasStatus_t trmm_recursive(const level3_call<T>& call,
+                                   bool                  left,
+                                   const cuda_triangle&  tri,
+                                   hipblasOperation_t    transA,
+                                   int                   m,
+                                   int                   n,
+                                   cuda_view<const T>    A,
+                                   cuda_view<T>          B)
+    {
+        int k = left ? m : n;
+        if(k <= level3_nb)
+        {
+            int lines = left ? n : m;
+            hipLaunchKernelGGL((trmm_kernel<cuda_t<T>>),
+                               dim3(cuda_blocks(lines, level3_lines),
+                                    cuda_batch_blocks(call.batch_count)),
+                               dim3(level3_nb, level3_lines),
+                               0,
+                               call.context.stream,
+                               tri,
+                               left,
+                               k,
+                               lines,
+                               cuda_cast(A.op),
+                               A.offset,
+                               A.ld,
+                               cuda_cast(B.op),
+                               B.offset,
+                               B.ld,
+                               call.batch_count);
+            return cuda_launch_status();
+        }
+
+        // Block of op(A) at row r and column c of op(A)
+        auto block = [&](int r, int c) { return tri.trans ? A.at(c, r) : A.at(r, c); };
+        static const T one(1);
+
+        // Each half of B is multiplied by its diagonal block of op(A) once the
+        // other half no longer needs its old value, then gets the product
+        // with the off-diagonal block added
+        int             k1 = split(k);
+        int             k2 = k - k1;
+        hipblasStatus_t status;
+        if(left && tri.op_upper())
+        {
+            if((status = trmm_recursive(call, left, tri, transA, k1, n, block(0, 0), B))
+                   != HIPBLAS_STATUS_SUCCESS
+               || (status = gemm(call,
+                                 transA,
+                                 HIPBLAS_OP_N,
+                                 k1,
+                                 n,
+                                 k2,
+                                 &one,
+                                 block(0, k1),
+                                 as_const(B.at(k1, 0)),
+                                 &one,
+                                 B))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return trmm_recursive(call, left, tri, transA, k2, n, block(k1, k1), B.at(k1, 0));
+        }
+        if(left)
+        {
+            if((status
+                = trmm_recursive(call, left, tri, transA, k2, n, block(k1, k1), B.at(k1, 0)))
+                   != HIPBLAS_STATUS_SUCCESS
+               || (status = gemm(call,
+                                 transA,
+                                 HIPBLAS_OP_N,
+                                 k2,
+                                 n,
+                                 k1,
+                                 &one,
+                                 block(k1, 0),
+                                 as_const(B),
+                                 &one,
+                                 B.at(k1, 0)))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return trmm_recursive(call, left, tri, transA, k1, n, block(0, 0), B);
+        }
+        if(tri.op_upper())
+        {
+            if((status
+                = trmm_recursive(call, left, tri, transA, m, k2, block(k1, k1), B.at(0, k1)))
+                   != HIPBLAS_STATUS_SUCCESS
+               || (status = gemm(call,
+                                 HIPBLAS_OP_N,
+                                 transA,
+                                 m,
+                                 k2,
+                                 k1,
+                                 &one,
+                                 as_const(B),
+                                 block(0, k1),
+                                 &one,
+                                 B.at(0, k1)))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return trmm_recursive(call, left, tri, transA, m, k1, block(0, 0), B);
+        }
+        if((status = trmm_recursive(call, left, tri, transA, m, k1, block(0, 0), B))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = gemm(call,
+                             HIPBLAS_OP_N,
+                             transA,
+                             m,
+                             k1,
+                             k2,
+                             &one,
+                             as_const(B.at(0, k1)),
+                             block(k1, 0),
+                             &one,
+                             B))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return trmm_recursive(call, left, tri, transA, m, k2, block(k1, k1), B.at(0, k1));
+    }
+
+    // The diagonal blocks of order level3_nb of C, a kernel block each. A
+    // zero alpha leaves A unread and a zero beta leaves C unread.
+    template <typename T, typename Ta>
+    __global__ void syrk_diagonal_kernel(bool                  upper,
+                                         bool                  hermitian,
+                                         bool                  trans,
+                                         int                   n,
+                                         int                   k,
+                                         cuda_scalar<Ta>       alpha,
+                                         cuda_operand<const T> A,
+                                         int                   lda,
+                                         cuda_scalar<Ta>       beta,
+                                         cuda_operand<T>       C,
+                                         int                   ldc,
+                                         int                   batch_count)
+    {
+        int first = blockIdx.x * level3_nb;
+        int order = n - first < level3_nb ? n - first : level3_nb;
+        Ta  a     = alpha.get();
+        Ta  be    = beta.get();
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* Ab = A[b];
+            T*       Cb = C[b];
+            for(int e = threadIdx.x; e < order * order; e += blockDim.x)
+            {
+                int i = first + e % order;
+                int j = first + e / order;
+                if(upper ? i > j : i < j)
+                    continue;
+
+                T sum(0);
+                if(a != Ta(0))
+                {
+                    for(int l = 0; l < k; l++)
+                    {
+                        // Elements (i, l) and (j, l) of A, or (l, i) and (l, j)
+                        // for trans
+                        T x = trans ? Ab[l + int64_t(i) * lda] : Ab[i + int64_t(l) * lda];
+                        T y = trans ? Ab[l + int64_t(j) * lda] : Ab[j + int64_t(l) * lda];
+                        if(hermitian)
+                            sum = sum + (trans ? cuda_conj(x) * y : x * cuda_conj(y));
+                        else
+                            sum = sum + x * y;
+                    }
+                }
+
+                T& c     = Cb[i + int64_t(j) * ldc];
+                T  value = T(a) * sum;
+                if(be != Ta(0))
+                    value = value + T(be) * c;
+                c = hermitian && i == j ? T(cuda_real(value)) : value;
+            }
+        }
+    }
+
+    // The gemm products of the blocks of C off the diagonal blocks, with the
+    // rows of op(A) at the row of C as the first factor
+    template <typename T>
+    hipblasStatus_t syrk_off_diagonal(const level3_call<T>& call,
+                                      bool                  upper,
+                                      hipblasOperation_t    transA,
+                                      hipblasOperation_t    trans_second,
+                                      int                   n,
+                                      int                   k,
+                                      const T*              alpha,
+                                      cuda_view<const T>    A,
+                                      const T*              beta,
+                                      cuda_view<T>          C)
+    {
+        if(n <= level3_nb)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // Rows of op(A) from row r
+        auto rows = [&](int r) { return transA == HIPBLAS_OP_N ? A.at(r, 0) : A.at(0, r); };
+
+        int             n1 = split(n);
+        int             n2 = n - n1;
+        hipblasStatus_t status;
+        if((status = syrk_off_diagonal(
+                call, upper, transA, trans_second, n1, k, alpha, rows(0), beta, C))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = syrk_off_diagonal(call,
+                                          upper,
+                                          transA,
+                                          trans_second,
+                                          n2,
+                                          k,
+                                          alpha,
+                                          rows(n1),
+                                          beta,
+                                          C.at(n1, n1)))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(upper)
+            return gemm(
+                call, transA, trans_second, n1, n2, k, alpha, rows(0), rows(n1), beta, C.at(0, n1));
+        return gemm(
+            call, transA, trans_second, n2, n1, k, alpha, rows(n1), rows(0), beta, C.at(n1, 0));
+    }
+
+    // alpha and beta of the gemm calls of syrk
+    template <typename T>
+    void gemm_scalars(const level3_call<T>& call,
+                      const T*              alpha,
+                      const T*              beta,
+                      T*                    host,
+                      const T*&             gemm_alpha,
+                      const T*&             gemm_beta)
+    {
+        gemm_alpha = alpha;
+        gemm_beta  = beta;
+    }
+
+    template <typename T, typename Tr>
+    __global__ void complex_scalars_kernel(const Tr* alpha, const Tr* beta, T* scalars)
+    {
+        scalars[0] = T(*alpha);
+        scalars[1] = T(*beta);
+    }
+
+    // herk takes them real, and gemm complex
+    template <typename T, typename Tr>
+    void gemm_scalars(const level3_call<T>& call,
+                      const Tr*             alpha,
+                      const Tr*             beta,
+                      T*                    host,
+                      const T*&             gemm_alpha,
+                      const T*&             gemm_beta)
+    {
+        if(call.context.host_mode)
+        {
+            host[0] = T(*alpha);
+            host[1] = T(*beta);
+            gemm_alpha = host;
+            gemm_beta  = host + 1;
+            return;
+        }
+
+        hipLaunchKernelGGL((complex_scalars_kernel<cuda_t<T>, Tr>),
+                           dim3(1),
+                           dim3(1),
+                           0,
+                           call.context.stream,
+                           alpha,
+                           beta,
+                           cuda_cast(call.scalars));
+        gemm_alpha = call.scalars;
+        gemm_beta  = call.scalars + 1;
+    }
+
+    // Inverts the diagonal blocks of order level3_nb, a kernel block of
+    // level3_nb threads each, thread i computing row i of the inverse a
+    // column at a time
+    template <typename T>
+    __global__ void trtri_diagonal_kernel(bool                  upper,
+                                          bool                  unit,
+                                          int                   n,
+                                          cuda_operand<const T> A,
+                                          int                   lda,
+                                          cuda_operand<T>       invA,
+                                          int                   ldinvA,
+                                          int                   batch_count)
+    {
+        __shared__ T a[level3_nb][level3_nb + 1];
+        __shared__ T x[level3_nb][level3_nb + 1];
+
+        int first = blockIdx.x * level3_nb;
+        int order = n - first < level3_nb ? n - first : level3_nb;
+        int i     = threadIdx.x;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* Ab = A[b] + first + int64_t(first) * lda;
+            T*       Xb = invA[b] + first + int64_t(first) * ldinvA;
+            if(i < order)
+                for(int j = 0; j < order; j++)
+                    a[i][j] = Ab[i + int64_t(j) * lda];
+            __syncthreads();
+
+            // X * A = I: column j of X needs the columns of X after it in
+            // the triangle, so upper goes forward and lower backward
+            for(int step = 0; step < order; step++)
+            {
+                int j = upper ? step : order - 1 - step;
+                T   d = unit ? T(1) : T(1) / a[j][j];
+                if(i == j)
+                    x[j][j] = d;
+                else if(i < order && (upper ? i < j : i > j))
+                {
+                    T sum(0);
+                    if(upper)
+                        for(int l = i; l < j; l++)
+                            sum = sum + x[i][l] * a[l][j];
+                    else
+                        for(int l = j + 1; l <= i; l++)
+                            sum = sum + x[i][l] * a[l][j];
+                    x[i][j] = -sum * d;
+                }
+                __syncthreads();
+            }
+
+            if(i < order)
+                for(int j = upper ? i : 0; j < (upper ? order : i + 1); j++)
+                    Xb[i + int64_t(j) * ldinvA] = x[i][j];
+            // The next member reloads a
+            __syncthreads();
+        }
+    }
+
+    // The blocks of inv(A) off the diagonal blocks, as inv(A)12 =
+    // -inv(A11) * A12 * inv(A22) for upper and inv(A)21 =
+    // -inv(A22) * A21 * inv(A11) for lower. The handle must be in host
+    // pointer mode.
+    template <typename T>
+    hipblasStatus_t trtri_off_diagonal(const level3_call<T>& call,
+                                       const cuda_triangle&  tri,
+                                       int                   n,
+                                       cuda_view<const T>    A,
+                                       cuda_view<T>          invA)
+    {
+        if(n <= level3_nb)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        int             n1 = split(n);
+        int             n2 = n - n1;
+        hipblasStatus_t status;
+        if((status = trtri_off_diagonal(call, tri, n1, A, invA)) != HIPBLAS_STATUS_SUCCESS
+           || (status = trtri_off_diagonal(call, tri, n2, A.at(n1, n1), invA.at(n1, n1)))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        cuda_scalar<cuda_t<T>> minus_one{cuda_t<T>(-1), nullptr};
+        cuda_view<const T>     inv11 = as_const(invA);
+        cuda_view<const T>     inv22 = as_const(invA.at(n1, n1));
+        if(tri.upper)
+        {
+            cuda_view<T> X = invA.at(0, n1);
+            if((status = scale(call, n1, n2, minus_one, A.at(0, n1), X)) != HIPBLAS_STATUS_SUCCESS
+               || (status = trmm_recursive(call, false, tri, HIPBLAS_OP_N, n1, n2, inv22, X))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            return trmm_recursive(call, true, tri, HIPBLAS_OP_N, n1, n2, inv11, X);
+        }
+
+        cuda_view<T> X = invA.at(n1, 0);
+        if((status = scale(call, n2, n1, minus_one, A.at(n1, 0), X)) != HIPBLAS_STATUS_SUCCESS
+           || (status = trmm_recursive(call, false, tri, HIPBLAS_OP_N, n2, n1, inv11, X))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return trmm_recursive(call, true, tri, HIPBLAS_OP_N, n2, n1, inv22, X);
+    }
+}
+
+template <typename T>
+hipblasStatus_t hipblas_trmm_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasSideMode_t              side,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          hipblasDiagType_t              diag,
+                                          int                            m,
+                                          int                            n,
+                                          const T*                       alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          hipblas_batch_operand<T>       B,
+                                          int                            ldb,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool left = side == HIPBLAS_SIDE_LEFT;
+    if(!valid_side(side) || !valid_uplo(uplo) || !valid_trans(transA) || !valid_diag(diag)
+       || m < 0 || n < 0 || lda < std::max(1, left ? m : n) || ldb < std::max(1, m)
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(A) || cuda_null(B) || !alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    level3_call<T> call;
+    if((status = make_call(context, A.array != nullptr, batch_count, call))
+       != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    cuda_view<T> viewB = make_view(B, ldb);
+    cuda_scalar<cuda_t<T>> scalar = call.context.scalar(alpha);
+    if(call.context.host_mode && scalar.value == cuda_t<T>(0))
+        return scale(call, m, n, scalar, as_const(viewB), viewB);
+
+    {
+        host_pointer_mode mode(call.context);
+        status = trmm_recursive(
+            call, left, make_triangle(uplo, transA, diag), transA, m, n, make_view(A, lda), viewB);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS
+       || (call.context.host_mode && scalar.value == cuda_t<T>(1)))
+        return status;
+    return scale(call, m, n, scalar, as_const(viewB), viewB);
+}
+
+template <typename T, typename Ta>
+hipblasStatus_t hipblas_syrk_batched_cuda(hipblasHandle_t                handle,
+                                          hipblasFillMode_t              uplo,
+                                          hipblasOperation_t             transA,
+                                          int                            n,
+                                          int                            k,
+                                          const Ta*                      alpha,
+                                          hipblas_batch_operand<const T> A,
+                                          int                            lda,
+                                          const Ta*                      beta,
+                                          hipblas_batch_operand<T>       C,
+                                          int                            ldc,
+                                          int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // syrk of a complex matrix takes no conjugate, and herk no plain transpose
+    bool hermitian = !std::is_same<T, Ta>::value;
+    bool complex   = !std::is_same<cuda_t<T>, cuda_real_t<cuda_t<T>>>::value;
+    bool trans     = transA != HIPBLAS_OP_N;
+    if(!valid_uplo(uplo) || !valid_trans(transA)
+       || (complex && transA == (hermitian ? HIPBLAS_OP_T : HIPBLAS_OP_C)) || n < 0 || k < 0
+       || lda < std::max(1, trans ? k : n) || ldc < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || cuda_null(C) || (k && cuda_null(A)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    level3_call<T> call;
+    if((status = make_call(context, C.array != nullptr, batch_count, call))
+       != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    cuda_scalar<cuda_t<Ta>> scalar_alpha = call.context.scalar(alpha);
+    cuda_scalar<cuda_t<Ta>> scalar_beta  = call.context.scalar(beta);
+    if(call.context.host_mode && (scalar_alpha.value == cuda_t<Ta>(0) || !k)
+       && scalar_beta.value == cuda_t<Ta>(1))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipLaunchKernelGGL((syrk_diagonal_kernel<cuda_t<T>, cuda_t<Ta>>),
+                       dim3(cuda_blocks(n, level3_nb), cuda_batch_blocks(batch_count)),
+                       dim3(hipblas_cuda_threads),
+                       0,
+                       call.context.stream,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       hermitian,
+                       trans,
+                       n,
+                       k,
+                       scalar_alpha,
+                       cuda_cast(A),
+                       lda,
+                       scalar_beta,
+                       cuda_cast(C),
+                       ldc,
+                       batch_count);
+    if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T        host[2];
+    const T* gemm_alpha;
+    const T* gemm_beta;
+    gemm_scalars(call, alpha, beta, host, gemm_alpha, gemm_beta);
+    if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return syrk_off_diagonal(call,
+                             uplo == HIPBLAS_FILL_MODE_UPPER,
+                             transA,
+                             trans ? HIPBLAS_OP_N : (hermitian ? HIPBLAS_OP_C : HIPBLAS_OP_T),
+                             n,
+                             k,
+                             gemm_alpha,
+                             make_view(A, lda),
+                             gemm_beta,
+                             make_view(C, ldc));
+}
+
+template <typename T>
+hipblasStatus_t hipblas_trtri_batched_cuda(hipblasHandle_t                handle,
+                                           hipblasFillMode_t              uplo,
+                                           hipblasDiagType_t              diag,
+                                           int                            n,
+                                           hipblas_batch_operand<const T> A,
+                                           int                            lda,
+                                           hipblas_batch_operand<T>       invA,
+                                           int                            ldinvA,
+                                           int                            batch_count)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_uplo(uplo) || !valid_diag(diag) || n < 0 || lda < std::max(1, n)
+       || ldinvA < std::max(1, n) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(cuda_null(A) || cuda_null(invA))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    level3_call<T> call;
+    if((status = make_call(context, A.array != nullptr, batch_count, call))
+       != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipLaunchKernelGGL((trtri_diagonal_kernel<cuda_t<T>>),
+                       dim3(cuda_blocks(n, level3_nb), cuda_batch_blocks(batch_count)),
+                       dim3(level3_nb),
+                       0,
+                       call.context.stream,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       diag == HIPBLAS_DIAG_UNIT,
+                       n,
+                       cuda_cast(A),
+                       lda,
+                       cuda_cast(invA),
+                       ldinvA,
+                       batch_count);
+    if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    host_pointer_mode mode(call.context);
+    return trtri_off_diagonal(call,
+                              make_triangle(uplo, HIPBLAS_OP_N, diag),
+                              n,
+                              make_view(A, lda),
+                              make_view(invA, ldinvA));
+}
+
+// Instantiations for the types of the hipBLAS API
+#define HIPBLAS_OPERAND(T__) hipblas_batch_operand<T__>
+#define HIPBLAS_CONST_OPERAND(T__) hipblas_batch_operand<const T__>
+
+#define HIPBLAS_INSTANTIATE_LEVEL3(T__)                                                  \
+    template hipblasStatus_t hipblas_trmm_batched_cuda<T__>(hipblasHandle_t,             \
+                                                            hipblasSideMode_t,           \
+                                                            hipblasFillMode_t,           \
+                                                            hipblasOperation_t,          \
+                                                            hipblasDiagType_t,           \
+                                                            int,                         \
+                                                            int,                         \
+                                                            const T__*,                  \
+                                                            HIPBLAS_CONST_OPERAND(T__),  \
+                                                            int,                         \
+                                                            HIPBLAS_OPERAND(T__),        \
+                                                            int,                         \
+                                                            int);                        \
+    template hipblasStatus_t hipblas_syrk_batched_cuda<T__, T__>(hipblasHandle_t,        \
+                                                                 hipblasFillMode_t,      \
+                                                                 hipblasOperation_t,     \
+                                                                 int,                    \
+                                                                 int,                    \
+                                                                 const T__*,             \
+                                                                 HIPBLAS_CONST_OPERAND(T__), \
+                                                                 int,                    \
+                                                                 const T__*,             \
+                                                                 HIPBLAS_OPERAND(T__),   \
+                                                                 int,                    \
+                                                                 int);                   \
+    template hipblasStatus_t hipblas_trtri_batched_cuda<T__>(hipblasHandle_t,            \
+                                                             hipblasFillMode_t,          \
+                                                             hipblasDiagType_t,          \
+                                                             int,                        \
+                                                             HIPBLAS_CONST_OPERAND(T__), \
+                                                             int,                        \
+                                                             HIPBLAS_OPERAND(T__),       \
+                                                             int,                        \
+                                                             int);
+
+HIPBLAS_INSTANTIATE_LEVEL3(float)
+HIPBLAS_INSTANTIATE_LEVEL3(double)
+HIPBLAS_INSTANTIATE_LEVEL3(hipblasComplex)
+HIPBLAS_INSTANTIATE_LEVEL3(hipblasDoubleComplex)
+
+// herk takes real alpha and beta
+#define HIPBLAS_INSTANTIATE_HERK(T__, Tr__)                                               \
+    template hipblasStatus_t hipblas_syrk_batched_cuda<T__, Tr__>(hipblasHandle_t,        \
+                                                                  hipblasFillMode_t,      \
+                                                                  hipblasOperation_t,     \
+                                                                  int,                    \
+                                                                  int,                    \
+                                                                  const Tr__*,            \
+                                                                  HIPBLAS_CONST_OPERAND(T__), \
+                                                                  int,                    \
+                                                                  const Tr__*,            \
+                                                                  HIPBLAS_OPERAND(T__),   \
+                                                                  int,                    \
+                                                                  int);
+
+HIPBLAS_INSTANTIATE_HERK(hipblasComplex, float)
+HIPBLAS_INSTANTIATE_HERK(hipblasDoubleComplex, double)
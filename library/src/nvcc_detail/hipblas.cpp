@@ -3,11 +3,47 @@
  * ************************************************************************ */
 
 #include "hipblas.h"
+#include "batched_kernels.hpp"
+#include "coalesce.hpp"
 #include "exceptions.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "solver.hpp"
+#include "staging.hpp"
+#include "tuning.hpp"
+#include <algorithm>
 #include <cublas.h>
 #include <cublas_v2.h>
 #include <cuda_runtime_api.h>
 #include <hip/hip_runtime.h>
+#include <vector>
+
+// cuBLAS keeps its own workspace; only the scratch hipBLAS uses for its own
+// kernels has to be in place before a capture
+hipblasStatus_t hipblas_reserve_capture_workspace(hipblasHandle_t handle, size_t size)
+{
+    hipblas_handle_state* state = hipblas_get_handle_state(handle);
+    if(size && !state->scratch.get(size, state->capture))
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Device arrays of pointers to the batch_count matrices stride_bytes apart
+// from data, to run a strided batched routine as a batched one
+static hipblasStatus_t hipblasStridedArrays(
+    hipblasHandle_t handle, void* data, size_t stride_bytes, int batch_count, void*** arrays)
+{
+    // An empty or invalid batch is left to the batched routine
+    *arrays = nullptr;
+    if(batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    std::vector<void*> host_arrays(batch_count);
+    for(size_t i = 0; i < host_arrays.size(); i++)
+        host_arrays[i] = static_cast<char*>(data) + i * stride_bytes;
+    return hipblasGetDevicePointerArray(handle, host_arrays.data(), batch_count, arrays);
+}
 
 #ifdef __cplusplus
 extern "C" {
@@ -266,6 +302,9 @@ hipblasStatus_t hipCUBLASStatusToHIPStatus(cublasStatus_t cuStatus)
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
 try
 {
+    if(hipblas_is_capturing(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblas_coalescing_dependency(handle);
     return hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, streamId));
 }
 catch(...)
@@ -276,7 +315,56 @@ catch(...)
 hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasGetStream((cublasHandle_t)handle, streamId));
+    // The application may synchronize with the stream once it has it
+    hipblas_coalescing_dependency(handle);
+    return hipblas_get_stream(handle, streamId);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle, void* workspace, size_t sizeInBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!workspace && sizeInBytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(hipblas_is_capturing(handle))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+#if CUBLAS_VER_MAJOR >= 11
+    hipblas_coalescing_dependency(handle);
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(
+        cublasSetWorkspace((cublasHandle_t)handle, workspace, sizeInBytes));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_handle_state* state        = hipblas_get_handle_state(handle);
+    state->backend_workspace.user      = workspace && sizeInBytes;
+    state->backend_workspace.user_size = state->backend_workspace.user ? sizeInBytes : 0;
+    state->capture.workspace_generation++;
+    return HIPBLAS_STATUS_SUCCESS;
+#else
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// cuBLAS does not report the size of the workspace it allocates itself
+hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle, size_t* sizeInBytes)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!sizeInBytes)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *sizeInBytes = hipblas_get_handle_state(handle)->backend_workspace.user_size;
+    return HIPBLAS_STATUS_SUCCESS;
 }
 catch(...)
 {
@@ -297,6 +385,8 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    hipblas_coalescing_dependency(handle);
+    hipblas_release_handle_state(handle);
     return hipCUBLASStatusToHIPStatus(cublasDestroy((cublasHandle_t)handle));
 }
 catch(...)
@@ -307,6 +397,7 @@ catch(...)
 hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t mode)
 try
 {
+    hipblas_coalescing_dependency(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSetPointerMode((cublasHandle_t)handle, HIPPointerModeToCudaPointerMode(mode)));
 }
@@ -332,6 +423,14 @@ catch(...)
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    // Deferred gemm calls may read or write the device vector
+    hipblas_coalescing_dependency(nullptr);
+
+    // A vector is staged as a matrix of one row
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(1, n, elemSize, x, incx, y, incy, nullptr, false);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(
         cublasSetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
 }
@@ -344,6 +443,10 @@ catch(...)
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status = hipblas_staged_get_matrix(1, n, elemSize, x, incx, y, incy, nullptr);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(
         cublasGetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
 }
@@ -357,6 +460,11 @@ hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(rows, cols, elemSize, A, lda, B, ldb, nullptr, false);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(cublasSetMatrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -369,6 +477,11 @@ hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_get_matrix(rows, cols, elemSize, A, lda, B, ldb, nullptr);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(cublasGetMatrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -380,6 +493,11 @@ hipblasStatus_t hipblasSetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(1, n, elemSize, x, incx, y, incy, stream, true);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(cublasSetVectorAsync(n, elemSize, x, incx, y, incy, stream));
 }
 catch(...)
@@ -391,6 +509,10 @@ hipblasStatus_t hipblasGetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status = hipblas_staged_get_matrix(1, n, elemSize, x, incx, y, incy, stream);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(cublasGetVectorAsync(n, elemSize, x, incx, y, incy, stream));
 }
 catch(...)
@@ -402,6 +524,11 @@ hipblasStatus_t hipblasSetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_set_matrix(rows, cols, elemSize, A, lda, B, ldb, stream, true);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(
         cublasSetMatrixAsync(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -414,6 +541,11 @@ hipblasStatus_t hipblasGetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    hipblas_coalescing_dependency(nullptr);
+    hipblasStatus_t status
+        = hipblas_staged_get_matrix(rows, cols, elemSize, A, lda, B, ldb, stream);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
     return hipCUBLASStatusToHIPStatus(
         cublasGetMatrixAsync(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -449,7 +581,10 @@ catch(...)
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasIsamax((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasIsamax((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -459,7 +594,10 @@ catch(...)
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasIdamax((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasIdamax((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -470,8 +608,10 @@ hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -482,8 +622,11 @@ hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -493,14 +636,38 @@ catch(...)
 // amax_batched
 hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
@@ -509,8 +676,20 @@ hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
@@ -519,8 +698,20 @@ hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      int*                              result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amax_strided_batched
@@ -531,8 +722,20 @@ hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
@@ -542,8 +745,20 @@ hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
@@ -553,8 +768,20 @@ hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             int*                  result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
@@ -564,15 +791,30 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            true,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amin
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasIsamin((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasIsamin((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -582,7 +824,10 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasIdamin((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasIdamin((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -593,8 +838,10 @@ hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -605,8 +852,11 @@ hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -616,14 +866,38 @@ catch(...)
 // amin_batched
 hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
@@ -632,8 +906,20 @@ hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
@@ -642,8 +928,20 @@ hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      int*                              result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_batched(x),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amin_strided_batched
@@ -654,8 +952,20 @@ hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
@@ -665,8 +975,20 @@ hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
@@ -676,8 +998,20 @@ hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             int*                  result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
@@ -687,15 +1021,30 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_iamax_iamin_batched_cuda(handle,
+                                            false,
+                                            n,
+                                            hipblas_strided(x, stridex),
+                                            incx,
+                                            batchCount,
+                                            result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ASUM
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -706,7 +1055,9 @@ hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDasum((cublasHandle_t)handle, n, x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasDasum((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -717,8 +1068,10 @@ hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -729,8 +1082,11 @@ hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -742,9 +1098,8 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_asum_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
 }
 catch(...)
 {
@@ -757,8 +1112,14 @@ hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount,
                                     double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_asum_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
@@ -767,8 +1128,14 @@ hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      float*                      result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_asum_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
@@ -777,8 +1144,14 @@ hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      double*                           result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_asum_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // asum_strided_batched
@@ -789,8 +1162,19 @@ hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_asum_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
@@ -800,8 +1184,19 @@ hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_asum_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
@@ -811,8 +1206,19 @@ hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             float*                result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_asum_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
@@ -822,8 +1228,19 @@ hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             double*                     result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_asum_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // axpy
@@ -835,6 +1252,7 @@ hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                              hipblasHalf*       y,
                              int                incy)
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -842,6 +1260,7 @@ hipblasStatus_t hipblasSaxpy(
     hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasSaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
 }
@@ -859,6 +1278,7 @@ hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                              int             incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasDaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
 }
@@ -876,6 +1296,7 @@ hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCaxpy(
         (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -893,6 +1314,7 @@ hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZaxpy((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)alpha,
@@ -916,6 +1338,7 @@ hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
                                     int                      incy,
                                     int                      batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -929,10 +1352,15 @@ hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(
-    //     cublasSaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
 }
 catch(...)
 {
@@ -947,8 +1375,21 @@ hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
@@ -959,8 +1400,21 @@ hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
@@ -971,8 +1425,21 @@ hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // axpy_strided_batched
@@ -987,6 +1454,7 @@ hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridey,
                                            int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1000,8 +1468,21 @@ hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
@@ -1014,8 +1495,21 @@ hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
@@ -1028,8 +1522,21 @@ hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
@@ -1042,8 +1549,21 @@ hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_axpy_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // copy
@@ -1073,6 +1593,7 @@ hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasCcopy((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -1089,6 +1610,7 @@ hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZcopy(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
 }
@@ -1105,8 +1627,20 @@ hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                     float* const       y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
@@ -1116,8 +1650,20 @@ hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
@@ -1127,8 +1673,20 @@ hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
@@ -1138,8 +1696,20 @@ hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // copy_strided_batched
@@ -1152,8 +1722,20 @@ hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
@@ -1165,8 +1747,20 @@ hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
@@ -1178,8 +1772,20 @@ hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
@@ -1191,8 +1797,20 @@ hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_copy_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dot
@@ -1204,6 +1822,7 @@ hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                             int                incy,
                             hipblasHalf*       result)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1215,6 +1834,7 @@ hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                              int                    incy,
                              hipblasBfloat16*       result)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1227,8 +1847,11 @@ hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                             float*          result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    });
 }
 catch(...)
 {
@@ -1244,8 +1867,11 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                             double*         result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasDdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasDdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    });
 }
 catch(...)
 {
@@ -1261,8 +1887,16 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCdotc(
-        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasCdotc((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuComplex*)x,
+                                                      incx,
+                                                      (cuComplex*)y,
+                                                      incy,
+                                                      (cuComplex*)result));
+    });
 }
 catch(...)
 {
@@ -1278,8 +1912,16 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCdotu(
-        (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasCdotu((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuComplex*)x,
+                                                      incx,
+                                                      (cuComplex*)y,
+                                                      incy,
+                                                      (cuComplex*)result));
+    });
 }
 catch(...)
 {
@@ -1295,13 +1937,16 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZdotc((cublasHandle_t)handle,
-                                                  n,
-                                                  (cuDoubleComplex*)x,
-                                                  incx,
-                                                  (cuDoubleComplex*)y,
-                                                  incy,
-                                                  (cuDoubleComplex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasZdotc((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuDoubleComplex*)x,
+                                                      incx,
+                                                      (cuDoubleComplex*)y,
+                                                      incy,
+                                                      (cuDoubleComplex*)result));
+    });
 }
 catch(...)
 {
@@ -1317,13 +1962,16 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZdotu((cublasHandle_t)handle,
-                                                  n,
-                                                  (cuDoubleComplex*)x,
-                                                  incx,
-                                                  (cuDoubleComplex*)y,
-                                                  incy,
-                                                  (cuDoubleComplex*)result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasZdotu((cublasHandle_t)handle,
+                                                      n,
+                                                      (cuDoubleComplex*)x,
+                                                      incx,
+                                                      (cuDoubleComplex*)y,
+                                                      incy,
+                                                      (cuDoubleComplex*)result));
+    });
 }
 catch(...)
 {
@@ -1341,6 +1989,7 @@ hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                    hipblasHalf*             result)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -1360,6 +2009,7 @@ hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                     int                          batchCount,
                                     hipblasBfloat16*             result)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1373,10 +2023,16 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(
-    //     cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
 }
 catch(...)
 {
@@ -1391,8 +2047,22 @@ hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                    int                 incy,
                                    int                 batchCount,
                                    double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
@@ -1403,8 +2073,22 @@ hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount,
                                     hipblasComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    true,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
@@ -1415,8 +2099,22 @@ hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount,
                                     hipblasComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
@@ -1427,8 +2125,22 @@ hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    true,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
@@ -1439,8 +2151,22 @@ hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dot_strided_batched
@@ -1455,6 +2181,7 @@ hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
                                           int                batchCount,
                                           hipblasHalf*       result)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1469,6 +2196,7 @@ hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                            int                    batchCount,
                                            hipblasBfloat16*       result)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1482,8 +2210,22 @@ hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batchCount,
                                           float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
@@ -1496,8 +2238,22 @@ hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batchCount,
                                           double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
@@ -1510,8 +2266,22 @@ hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount,
                                            hipblasComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    true,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
@@ -1524,8 +2294,22 @@ hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount,
                                            hipblasComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
@@ -1538,8 +2322,22 @@ hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    true,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
@@ -1552,15 +2350,32 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount, result);
+    return hipblas_dot_batched_cuda(handle,
+                                    false,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    batchCount,
+                                    result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // nrm2
 hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasSnrm2((cublasHandle_t)handle, n, x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasSnrm2((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -1571,7 +2386,9 @@ hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDnrm2((cublasHandle_t)handle, n, x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(cublasDnrm2((cublasHandle_t)handle, n, x, incx, result));
+    });
 }
 catch(...)
 {
@@ -1582,8 +2399,10 @@ hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -1594,8 +2413,11 @@ hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return hipblas_capture_result(handle, result, 1, [&](auto result) {
+        return hipCUBLASStatusToHIPStatus(
+            cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
+    });
 }
 catch(...)
 {
@@ -1605,8 +2427,14 @@ catch(...)
 // nrm2_batched
 hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
@@ -1615,8 +2443,14 @@ hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount,
                                     double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
@@ -1625,8 +2459,14 @@ hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      float*                      result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
@@ -1635,8 +2475,14 @@ hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      double*                           result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle, n, hipblas_batched(x), incx, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // nrm2_strided_batched
@@ -1647,8 +2493,19 @@ hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
@@ -1658,8 +2515,19 @@ hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
@@ -1669,8 +2537,19 @@ hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             float*                result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
@@ -1680,8 +2559,19 @@ hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             double*                     result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, batchCount, result);
+    return hipblas_nrm2_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount,
+                                     result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rot
@@ -1695,6 +2585,7 @@ hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                             const float*    s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(
         cublasSrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
 }
@@ -1713,6 +2604,7 @@ hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                             const double*   s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(
         cublasDrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
 }
@@ -1731,6 +2623,7 @@ hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                             const hipblasComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(cublasCrot(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
 }
@@ -1749,6 +2642,7 @@ hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                              const float*    s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(
         cublasCsrot((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
 }
@@ -1767,6 +2661,7 @@ hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                             const hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(cublasZrot((cublasHandle_t)handle,
                                                  n,
                                                  (cuDoubleComplex*)x,
@@ -1791,6 +2686,7 @@ hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                              const double*         s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s);
     return hipCUBLASStatusToHIPStatus(cublasZdrot(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
 }
@@ -1809,8 +2705,22 @@ hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                    const float*    c,
                                    const float*    s,
                                    int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
@@ -1822,8 +2732,22 @@ hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                    const double*   c,
                                    const double*   s,
                                    int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
@@ -1835,8 +2759,22 @@ hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                    const float*          c,
                                    const hipblasComplex* s,
                                    int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
@@ -1848,8 +2786,22 @@ hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                     const float*          c,
                                     const float*          s,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
@@ -1861,8 +2813,22 @@ hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                    const double*               c,
                                    const hipblasDoubleComplex* s,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
@@ -1874,8 +2840,22 @@ hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                     const double*               c,
                                     const double*               s,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rot_strided_batched
@@ -1890,8 +2870,22 @@ hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                           const float*    c,
                                           const float*    s,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
@@ -1905,8 +2899,22 @@ hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                           const double*   c,
                                           const double*   s,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
@@ -1920,8 +2928,22 @@ hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                           const float*          c,
                                           const hipblasComplex* s,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
@@ -1935,8 +2957,22 @@ hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                            const float*    c,
                                            const float*    s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
@@ -1950,8 +2986,22 @@ hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                           const double*               c,
                                           const hipblasDoubleComplex* s,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
@@ -1965,14 +3015,29 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                            const double*         c,
                                            const double*         s,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount);
+    return hipblas_rot_batched_cuda(handle,
+                                    n,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    c,
+                                    s,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotg
 hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return hipCUBLASStatusToHIPStatus(cublasSrotg((cublasHandle_t)handle, a, b, c, s));
 }
 catch(...)
@@ -1983,6 +3048,7 @@ catch(...)
 hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return hipCUBLASStatusToHIPStatus(cublasDrotg((cublasHandle_t)handle, a, b, c, s));
 }
 catch(...)
@@ -1994,6 +3060,7 @@ hipblasStatus_t hipblasCrotg(
     hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return hipCUBLASStatusToHIPStatus(
         cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
 }
@@ -2009,6 +3076,7 @@ hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
                              hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_LOG_CALL(handle, a, b, c, s);
     return hipCUBLASStatusToHIPStatus(cublasZrotg(
         (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
 }
@@ -2024,8 +3092,19 @@ hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                     float* const    c[],
                                     float* const    s[],
                                     int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_batched(a),
+                                     hipblas_batched(b),
+                                     hipblas_batched(c),
+                                     hipblas_batched(s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
@@ -2034,8 +3113,19 @@ hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                     double* const   c[],
                                     double* const   s[],
                                     int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_batched(a),
+                                     hipblas_batched(b),
+                                     hipblas_batched(c),
+                                     hipblas_batched(s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
@@ -2044,8 +3134,19 @@ hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                     float* const          c[],
                                     hipblasComplex* const s[],
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_batched(a),
+                                     hipblas_batched(b),
+                                     hipblas_batched(c),
+                                     hipblas_batched(s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
@@ -2054,8 +3155,19 @@ hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                     double* const               c[],
                                     hipblasDoubleComplex* const s[],
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, b, c, s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_batched(a),
+                                     hipblas_batched(b),
+                                     hipblas_batched(c),
+                                     hipblas_batched(s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotg_strided_batched
@@ -2069,8 +3181,19 @@ hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
                                            float*          s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_strided(a, stride_a),
+                                     hipblas_strided(b, stride_b),
+                                     hipblas_strided(c, stride_c),
+                                     hipblas_strided(s, stride_s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
@@ -2083,8 +3206,19 @@ hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                            double*         s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_strided(a, stride_a),
+                                     hipblas_strided(b, stride_b),
+                                     hipblas_strided(c, stride_c),
+                                     hipblas_strided(s, stride_s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
@@ -2097,8 +3231,19 @@ hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                            hipblasComplex* s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
+{
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_strided(a, stride_a),
+                                     hipblas_strided(b, stride_b),
+                                     hipblas_strided(c, stride_c),
+                                     hipblas_strided(s, stride_s),
+                                     batchCount);
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
@@ -2111,8 +3256,19 @@ hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                            hipblasDoubleComplex* s,
                                            hipblasStride         stride_s,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount);
+    return hipblas_rotg_batched_cuda(handle,
+                                     hipblas_strided(a, stride_a),
+                                     hipblas_strided(b, stride_b),
+                                     hipblas_strided(c, stride_c),
+                                     hipblas_strided(s, stride_s),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotm
@@ -2120,6 +3276,7 @@ hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param);
     return hipCUBLASStatusToHIPStatus(
         cublasSrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
 }
@@ -2132,6 +3289,7 @@ hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param);
     return hipCUBLASStatusToHIPStatus(
         cublasDrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
 }
@@ -2149,8 +3307,21 @@ hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     const float* const param[],
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param, batchCount);
+    return hipblas_rotm_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(param),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
@@ -2161,8 +3332,21 @@ hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     const double* const param[],
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, param, batchCount);
+    return hipblas_rotm_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(param),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotm_strided_batched
@@ -2177,8 +3361,21 @@ hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
                                            const float*    param,
                                            hipblasStride   strideParam,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, param, strideParam, batchCount);
+    return hipblas_rotm_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(param, strideParam),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
@@ -2192,8 +3389,21 @@ hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                            const double*   param,
                                            hipblasStride   strideParam,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, param, strideParam, batchCount);
+    return hipblas_rotm_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(param, strideParam),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotmg
@@ -2201,6 +3411,7 @@ hipblasStatus_t hipblasSrotmg(
     hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param);
     return hipCUBLASStatusToHIPStatus(cublasSrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -2212,6 +3423,7 @@ hipblasStatus_t hipblasDrotmg(
     hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
 try
 {
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param);
     return hipCUBLASStatusToHIPStatus(cublasDrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -2227,8 +3439,20 @@ hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                      const float* const y1[],
                                      float* const       param[],
                                      int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param, batchCount);
+    return hipblas_rotmg_batched_cuda(handle,
+                                      hipblas_batched(d1),
+                                      hipblas_batched(d2),
+                                      hipblas_batched(x1),
+                                      hipblas_batched(y1),
+                                      hipblas_batched(param),
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
@@ -2238,8 +3462,20 @@ hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                      const double* const y1[],
                                      double* const       param[],
                                      int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, d1, d2, x1, y1, param, batchCount);
+    return hipblas_rotmg_batched_cuda(handle,
+                                      hipblas_batched(d1),
+                                      hipblas_batched(d2),
+                                      hipblas_batched(x1),
+                                      hipblas_batched(y1),
+                                      hipblas_batched(param),
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotmg_strided_batched
@@ -2255,8 +3491,31 @@ hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
                                             float*          param,
                                             hipblasStride   strideParam,
                                             int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     d1,
+                     stride_d1,
+                     d2,
+                     stride_d2,
+                     x1,
+                     stride_x1,
+                     y1,
+                     stride_y1,
+                     param,
+                     strideParam,
+                     batchCount);
+    return hipblas_rotmg_batched_cuda(handle,
+                                      hipblas_strided(d1, stride_d1),
+                                      hipblas_strided(d2, stride_d2),
+                                      hipblas_strided(x1, stride_x1),
+                                      hipblas_strided(y1, stride_y1),
+                                      hipblas_strided(param, strideParam),
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
@@ -2271,14 +3530,38 @@ hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                             double*         param,
                                             hipblasStride   strideParam,
                                             int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     d1,
+                     stride_d1,
+                     d2,
+                     stride_d2,
+                     x1,
+                     stride_x1,
+                     y1,
+                     stride_y1,
+                     param,
+                     strideParam,
+                     batchCount);
+    return hipblas_rotmg_batched_cuda(handle,
+                                      hipblas_strided(d1, stride_d1),
+                                      hipblas_strided(d2, stride_d2),
+                                      hipblas_strided(x1, stride_x1),
+                                      hipblas_strided(y1, stride_y1),
+                                      hipblas_strided(param, strideParam),
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // scal
 hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -2301,6 +3584,7 @@ hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(
         cublasCscal((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
 }
@@ -2328,6 +3612,7 @@ hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(
         cublasZscal((cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
 }
@@ -2340,6 +3625,7 @@ hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(
         cublasZdscal((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
 }
@@ -2353,9 +3639,8 @@ hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
 }
 catch(...)
 {
@@ -2363,8 +3648,14 @@ catch(...)
 }
 hipblasStatus_t hipblasDscalBatched(
     hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
@@ -2373,8 +3664,14 @@ hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                     hipblasComplex* const x[],
                                     int                   incx,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
@@ -2383,8 +3680,14 @@ hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                     hipblasDoubleComplex* const x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
@@ -2393,8 +3696,14 @@ hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                      hipblasComplex* const x[],
                                      int                   incx,
                                      int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
@@ -2403,8 +3712,14 @@ hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                      hipblasDoubleComplex* const x[],
                                      int                         incx,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, batchCount);
+    return hipblas_scal_batched_cuda(handle, n, alpha, hipblas_batched(x), incx, batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // scal_strided_batched
@@ -2415,8 +3730,19 @@ hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
                                            int             incx,
                                            hipblasStride   stridex,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
@@ -2426,8 +3752,19 @@ hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                            int             incx,
                                            hipblasStride   stridex,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
@@ -2437,8 +3774,19 @@ hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
@@ -2448,8 +3796,19 @@ hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
@@ -2459,8 +3818,19 @@ hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                             int             incx,
                                             hipblasStride   stridex,
                                             int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
@@ -2470,14 +3840,26 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                             int                   incx,
                                             hipblasStride         stridex,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, batchCount);
+    return hipblas_scal_batched_cuda(handle,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // swap
 hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSswap((cublasHandle_t)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -2500,6 +3882,7 @@ hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasCswap((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -2516,6 +3899,7 @@ hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZswap(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
 }
@@ -2527,14 +3911,38 @@ catch(...)
 // swap_batched
 hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
@@ -2544,8 +3952,20 @@ hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                     hipblasComplex* y[],
                                     int             incy,
                                     int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
@@ -2555,8 +3975,20 @@ hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                     hipblasDoubleComplex* y[],
                                     int                   incy,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // swap_strided_batched
@@ -2569,8 +4001,20 @@ hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
@@ -2582,8 +4026,20 @@ hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
@@ -2595,8 +4051,20 @@ hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
@@ -2608,8 +4076,20 @@ hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, x, incx, stridex, y, incy, stridey, batchCount);
+    return hipblas_swap_batched_cuda(handle,
+                                     n,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gbmv
@@ -2629,6 +4109,7 @@ hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2665,6 +4146,7 @@ hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2701,6 +4183,7 @@ hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2737,6 +4220,7 @@ hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2773,8 +4257,29 @@ hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                     float* const       y[],
                                     int                incy,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
@@ -2792,8 +4297,29 @@ hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
@@ -2811,8 +4337,29 @@ hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
@@ -2830,8 +4377,29 @@ hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gbmv_strided_batched
@@ -2853,8 +4421,45 @@ hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasStride      stride_y,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
@@ -2875,8 +4480,45 @@ hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasStride      stride_y,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
@@ -2897,8 +4539,45 @@ hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
@@ -2919,8 +4598,45 @@ hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     kl,
+                     ku,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_gbmv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     kl,
+                                     ku,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gemv
@@ -2938,6 +4654,7 @@ hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2970,6 +4687,7 @@ hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3002,6 +4720,7 @@ hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3034,6 +4753,7 @@ hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3068,20 +4788,20 @@ hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
 }
 catch(...)
 {
@@ -3103,20 +4823,20 @@ hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
 }
 catch(...)
 {
@@ -3136,8 +4856,26 @@ hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
@@ -3153,8 +4891,26 @@ hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gemv_strided_batched
@@ -3176,20 +4932,35 @@ hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
 }
 catch(...)
 {
@@ -3214,20 +4985,35 @@ hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
 }
 catch(...)
 {
@@ -3250,8 +5036,41 @@ hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
@@ -3270,8 +5089,41 @@ hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     trans,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_gemv_batched_cuda(handle,
+                                     trans,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ger
@@ -3287,6 +5139,7 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(
         cublasSger((cublasHandle_t)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -3307,6 +5160,7 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(
         cublasDger((cublasHandle_t)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -3327,6 +5181,7 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCgeru((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3355,6 +5210,7 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCgerc((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3383,6 +5239,7 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZgeru((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3411,6 +5268,7 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZgerc((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3439,8 +5297,25 @@ hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                    float* const       A[],
                                    int                lda,
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
@@ -3454,8 +5329,25 @@ hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                    double* const       A[],
                                    int                 lda,
                                    int                 batchCount)
+try
+{
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
@@ -3469,8 +5361,25 @@ hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
@@ -3484,8 +5393,25 @@ hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    true,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
@@ -3499,8 +5425,25 @@ hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
@@ -3514,8 +5457,25 @@ hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    true,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(y),
+                                    incy,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ger_strided_batched
@@ -3533,8 +5493,26 @@ hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                           int             lda,
                                           hipblasStride   strideA,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
@@ -3551,8 +5529,26 @@ hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                           int             lda,
                                           hipblasStride   strideA,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
@@ -3569,8 +5565,26 @@ hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
@@ -3587,8 +5601,26 @@ hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    true,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
@@ -3605,8 +5637,26 @@ hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    false,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
@@ -3623,8 +5673,26 @@ hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_ger_batched_cuda(handle,
+                                    true,
+                                    m,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(y, stridey),
+                                    incy,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hbmv
@@ -3642,6 +5710,7 @@ hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasChbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3674,6 +5743,7 @@ hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZhbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3706,8 +5776,27 @@ hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
@@ -3723,8 +5812,27 @@ hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hbmv_strided_batched
@@ -3744,8 +5852,42 @@ hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
@@ -3764,8 +5906,42 @@ hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemv
@@ -3782,6 +5958,7 @@ hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasChemv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3812,6 +5989,7 @@ hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZhemv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3842,8 +6020,26 @@ hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_symv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
@@ -3858,8 +6054,26 @@ hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblas_symv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemv_strided_batched
@@ -3878,8 +6092,40 @@ hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_symv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
@@ -3897,8 +6143,40 @@ hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_a,
+                     x,
+                     incx,
+                     stride_x,
+                     beta,
+                     y,
+                     incy,
+                     stride_y,
+                     batch_count);
+    return hipblas_symv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stride_y),
+                                     incy,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her
@@ -3912,6 +6190,7 @@ hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCher((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -3936,6 +6215,7 @@ hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZher((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -3960,8 +6240,22 @@ hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       A[],
                                    int                         lda,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
@@ -3973,8 +6267,22 @@ hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       A[],
                                    int                               lda,
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her_strided_batched
@@ -3989,8 +6297,22 @@ hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
                                           int                   lda,
                                           hipblasStride         strideA,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
@@ -4004,8 +6326,22 @@ hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                           int                         lda,
                                           hipblasStride               strideA,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2
@@ -4021,6 +6357,7 @@ hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCher2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4049,6 +6386,7 @@ hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZher2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4077,8 +6415,25 @@ hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
@@ -4092,8 +6447,25 @@ hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2_strided_batched
@@ -4111,8 +6483,26 @@ hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
@@ -4129,8 +6519,26 @@ hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpmv
@@ -4146,6 +6554,7 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasChpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4174,6 +6583,7 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZhpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4202,8 +6612,25 @@ hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
@@ -4217,8 +6644,25 @@ hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpmv_strided_batched
@@ -4236,8 +6680,26 @@ hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
@@ -4254,8 +6716,26 @@ hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr
@@ -4268,6 +6748,7 @@ hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return hipCUBLASStatusToHIPStatus(cublasChpr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -4290,6 +6771,7 @@ hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return hipCUBLASStatusToHIPStatus(cublasZhpr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -4312,8 +6794,21 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    int                         incx,
                                    hipblasComplex* const       AP[],
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
@@ -4324,8 +6819,21 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    int                               incx,
                                    hipblasDoubleComplex* const       AP[],
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr_strided_batched
@@ -4339,8 +6847,21 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           hipblasComplex*       AP,
                                           hipblasStride         strideAP,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
@@ -4353,8 +6874,21 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           hipblasDoubleComplex*       AP,
                                           hipblasStride               strideAP,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr2
@@ -4369,6 +6903,7 @@ hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                              hipblasComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return hipCUBLASStatusToHIPStatus(cublasChpr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4395,6 +6930,7 @@ hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return hipCUBLASStatusToHIPStatus(cublasZhpr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4421,8 +6957,24 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     int                         incy,
                                     hipblasComplex* const       AP[],
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, yp, incy, AP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(yp),
+                                     incy,
+                                     hipblas_batched(AP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
@@ -4435,8 +6987,24 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     hipblasDoubleComplex* const       AP[],
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, yp, incy, AP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(yp),
+                                     incy,
+                                     hipblas_batched(AP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr2_strided_batched
@@ -4453,8 +7021,25 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       AP,
                                            hipblasStride         strideAP,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(AP, strideAP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
@@ -4470,8 +7055,25 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       AP,
                                            hipblasStride               strideAP,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     true,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(AP, strideAP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // sbmv
@@ -4489,6 +7091,7 @@ hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSsbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4521,6 +7124,7 @@ hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDsbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4553,8 +7157,27 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
@@ -4570,8 +7193,27 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // sbmv_strided_batched
@@ -4591,8 +7233,42 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
@@ -4611,8 +7287,42 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_sbmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spmv
@@ -4628,6 +7338,7 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSspmv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -4648,6 +7359,7 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDspmv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -4668,8 +7380,25 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
@@ -4683,8 +7412,25 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spmv_strided_batched
@@ -4702,8 +7448,26 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
@@ -4720,8 +7484,26 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblas_spmv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr
@@ -4734,6 +7516,7 @@ hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                             float*            AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return hipCUBLASStatusToHIPStatus(
         cublasSspr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, AP));
 }
@@ -4751,6 +7534,7 @@ hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                             double*           AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
     return hipCUBLASStatusToHIPStatus(
         cublasDspr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, AP));
 }
@@ -4766,8 +7550,21 @@ hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                             const hipblasComplex* x,
                             int                   incx,
                             hipblasComplex*       AP)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, 0),
+                                    incx,
+                                    hipblas_strided(AP, 0),
+                                    1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
@@ -4777,8 +7574,21 @@ hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                             const hipblasDoubleComplex* x,
                             int                         incx,
                             hipblasDoubleComplex*       AP)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, 0),
+                                    incx,
+                                    hipblas_strided(AP, 0),
+                                    1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr_batched
@@ -4790,8 +7600,21 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    int                incx,
                                    float* const       AP[],
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
@@ -4802,8 +7625,21 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    int                 incx,
                                    double* const       AP[],
                                    int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
@@ -4814,8 +7650,21 @@ hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                    int                         incx,
                                    hipblasComplex* const       AP[],
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
@@ -4826,8 +7675,21 @@ hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                    int                               incx,
                                    hipblasDoubleComplex* const       AP[],
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(AP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr_strided_batched
@@ -4841,8 +7703,21 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           float*            AP,
                                           hipblasStride     strideAP,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
@@ -4855,8 +7730,21 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           double*           AP,
                                           hipblasStride     strideAP,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
@@ -4869,8 +7757,21 @@ hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                           hipblasComplex*       AP,
                                           hipblasStride         strideAP,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
@@ -4883,8 +7784,21 @@ hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                           hipblasDoubleComplex*       AP,
                                           hipblasStride               strideAP,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblas_spr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(AP, strideAP),
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr2
@@ -4899,6 +7813,7 @@ hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                              float*            AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return hipCUBLASStatusToHIPStatus(cublasSspr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, AP));
 }
@@ -4918,6 +7833,7 @@ hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                              double*           AP)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP);
     return hipCUBLASStatusToHIPStatus(cublasDspr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, AP));
 }
@@ -4937,8 +7853,24 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     int                incy,
                                     float* const       AP[],
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(AP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
@@ -4951,8 +7883,24 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     int                 incy,
                                     double* const       AP[],
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(AP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr2_strided_batched
@@ -4969,8 +7917,25 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            float*            AP,
                                            hipblasStride     strideAP,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(AP, strideAP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
@@ -4986,8 +7951,25 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            double*           AP,
                                            hipblasStride     strideAP,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblas_spr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(AP, strideAP),
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symv
@@ -5004,6 +7986,7 @@ hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSsymv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -5025,6 +8008,7 @@ hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDsymv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -5046,6 +8030,7 @@ hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCsymv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5076,6 +8061,7 @@ hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZsymv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5106,8 +8092,26 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
@@ -5122,8 +8126,26 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
@@ -5138,8 +8160,26 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
@@ -5154,8 +8194,26 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     beta,
+                                     hipblas_batched(y),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symv_strided_batched
@@ -5174,8 +8232,40 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
@@ -5193,8 +8283,40 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
@@ -5212,8 +8334,40 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
@@ -5231,8 +8385,40 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     batchCount);
+    return hipblas_symv_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     beta,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr
@@ -5246,6 +8432,7 @@ hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(
         cublasSsyr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, A, lda));
 }
@@ -5264,6 +8451,7 @@ hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(
         cublasDsyr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, A, lda));
 }
@@ -5282,6 +8470,7 @@ hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCsyr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -5306,6 +8495,7 @@ hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZsyr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -5330,8 +8520,22 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    float* const       A[],
                                    int                lda,
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
@@ -5343,8 +8547,22 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    double* const       A[],
                                    int                 lda,
                                    int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
@@ -5356,8 +8574,22 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       A[],
                                    int                         lda,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
@@ -5369,8 +8601,22 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       A[],
                                    int                               lda,
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_batched(x),
+                                    incx,
+                                    hipblas_batched(A),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr_strided_batched
@@ -5385,8 +8631,22 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           int               lda,
                                           hipblasStride     strideA,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
@@ -5400,8 +8660,22 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           int               lda,
                                           hipblasStride     strideA,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
@@ -5415,8 +8689,22 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           int                   lda,
                                           hipblasStride         strideA,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
@@ -5430,8 +8718,22 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           int                         lda,
                                           hipblasStride               strideA,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblas_syr_batched_cuda(handle,
+                                    uplo,
+                                    n,
+                                    alpha,
+                                    hipblas_strided(x, stridex),
+                                    incx,
+                                    hipblas_strided(A, strideA),
+                                    lda,
+                                    batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2
@@ -5447,6 +8749,7 @@ hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasSsyr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, A, lda));
 }
@@ -5467,6 +8770,7 @@ hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasDsyr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, A, lda));
 }
@@ -5487,6 +8791,7 @@ hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasCsyr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5515,6 +8820,7 @@ hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
     return hipCUBLASStatusToHIPStatus(cublasZsyr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5543,8 +8849,25 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     float* const       A[],
                                     int                lda,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
@@ -5558,8 +8881,25 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     double* const       A[],
                                     int                 lda,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
@@ -5573,8 +8913,25 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
@@ -5588,8 +8945,25 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(x),
+                                     incx,
+                                     hipblas_batched(y),
+                                     incy,
+                                     hipblas_batched(A),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2_strided_batched
@@ -5607,8 +8981,26 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               lda,
                                            hipblasStride     strideA,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
@@ -5625,8 +9017,26 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               lda,
                                            hipblasStride     strideA,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
@@ -5643,8 +9053,26 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
@@ -5661,8 +9089,26 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblas_syr2_batched_cuda(handle,
+                                     false,
+                                     uplo,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     hipblas_strided(y, stridey),
+                                     incy,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbmv
@@ -5678,6 +9124,7 @@ hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5706,6 +9153,7 @@ hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5734,6 +9182,7 @@ hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5762,6 +9211,7 @@ hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5790,8 +9240,24 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
@@ -5805,8 +9271,24 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
@@ -5820,8 +9302,24 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
@@ -5835,8 +9333,24 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, k, A, lda, x, incx, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbmv_strided_batched
@@ -5853,8 +9367,25 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
@@ -5870,8 +9401,25 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
@@ -5887,8 +9435,25 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
@@ -5904,8 +9469,25 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_tbmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     k,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbsv
@@ -5921,6 +9503,7 @@ hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5949,6 +9532,7 @@ hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5977,6 +9561,7 @@ hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6005,6 +9590,7 @@ hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6033,8 +9619,24 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
@@ -6048,8 +9650,24 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
@@ -6063,8 +9681,24 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
@@ -6078,8 +9712,24 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, k, A, lda, x, incx, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbsv_strided_batched
@@ -6096,8 +9746,25 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
@@ -6113,8 +9780,25 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
@@ -6130,8 +9814,25 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
@@ -6147,8 +9848,25 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, n, k, A, lda, strideA, x, incx, stridex, batchCount);
+    return hipblas_tbsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     n,
+                                     k,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpmv
@@ -6162,6 +9880,7 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6186,6 +9905,7 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6210,6 +9930,7 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6234,6 +9955,7 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6258,8 +9980,22 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
@@ -6271,8 +10007,22 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
@@ -6284,8 +10034,22 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
@@ -6297,8 +10061,22 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpmv_strided_batched
@@ -6313,8 +10091,22 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
@@ -6328,8 +10120,22 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
@@ -6343,8 +10149,22 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
@@ -6358,8 +10178,22 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpsv
@@ -6373,6 +10207,7 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6397,6 +10232,7 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6421,6 +10257,7 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6445,6 +10282,7 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6469,8 +10307,22 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
@@ -6482,8 +10334,22 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
@@ -6495,8 +10361,22 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
@@ -6508,8 +10388,22 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, x, incx, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(AP),
+                                     hipblas_batched(x),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpsv_strided_batched
@@ -6524,8 +10418,22 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
@@ -6539,8 +10447,22 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
@@ -6554,8 +10476,22 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
@@ -6569,8 +10505,22 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, AP, strideAP, x, incx, stridex, batchCount);
+    return hipblas_tpsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(AP, strideAP),
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmv
@@ -6585,6 +10535,7 @@ hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6611,6 +10562,7 @@ hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6637,6 +10589,7 @@ hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6663,6 +10616,7 @@ hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6689,8 +10643,23 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
@@ -6703,8 +10672,23 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
@@ -6717,8 +10701,23 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
@@ -6731,8 +10730,23 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmv_strided_batched
@@ -6748,8 +10762,24 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
@@ -6764,8 +10794,24 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
@@ -6780,8 +10826,24 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
@@ -6796,8 +10858,24 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stride_x, batch_count);
+    return hipblas_trmv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, stride_a),
+                                     lda,
+                                     hipblas_strided(x, stride_x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trsv
@@ -6812,6 +10890,7 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasStrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6838,6 +10917,7 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6864,6 +10944,7 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasCtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6890,6 +10971,7 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasZtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6916,8 +10998,23 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
@@ -6930,8 +11027,23 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
@@ -6944,8 +11056,23 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
@@ -6958,8 +11085,23 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(x),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 // trsv_strided_batched
@@ -6975,8 +11117,23 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
@@ -6991,8 +11148,23 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
@@ -7007,8 +11179,23 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
@@ -7023,8 +11210,23 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblas_trsv_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(x, stridex),
+                                     incx,
+                                     batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 //------------------------------------------------------------------------------------------------------------
@@ -7043,6 +11245,7 @@ hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCherk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7073,6 +11276,7 @@ hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZherk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7103,8 +11307,25 @@ hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
@@ -7119,8 +11340,25 @@ hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // herk_strided_batched
@@ -7138,8 +11376,26 @@ hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
@@ -7156,8 +11412,26 @@ hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               strideC,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // herkx
@@ -7176,6 +11450,7 @@ hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCherkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7210,6 +11485,7 @@ hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZherkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7245,6 +11521,7 @@ hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7263,6 +11540,7 @@ hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7285,6 +11563,23 @@ hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7306,6 +11601,23 @@ hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7325,6 +11637,7 @@ hipblasStatus_t hipblasCher2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCher2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7359,6 +11672,7 @@ hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZher2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7394,6 +11708,7 @@ hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7412,6 +11727,7 @@ hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7434,6 +11750,23 @@ hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7455,6 +11788,23 @@ hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7474,6 +11824,7 @@ hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7508,6 +11859,7 @@ hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7542,6 +11894,7 @@ hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7576,6 +11929,7 @@ hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7611,6 +11965,7 @@ hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7629,6 +11984,7 @@ hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7647,6 +12003,7 @@ hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7665,6 +12022,7 @@ hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7687,6 +12045,23 @@ hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideC,
                                            int               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7708,6 +12083,23 @@ hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideC,
                                            int               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7729,6 +12121,23 @@ hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7750,6 +12159,23 @@ hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7767,6 +12193,7 @@ hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7797,6 +12224,7 @@ hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7827,6 +12255,7 @@ hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7857,6 +12286,7 @@ hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7887,8 +12317,25 @@ hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                     float* const       C[],
                                     int                ldc,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
@@ -7903,8 +12350,25 @@ hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                     double* const       C[],
                                     int                 ldc,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
@@ -7919,8 +12383,25 @@ hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
@@ -7935,8 +12416,25 @@ hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     beta,
+                                     hipblas_batched(C),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syrk_strided_batched
@@ -7954,8 +12452,26 @@ hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                ldc,
                                            hipblasStride      strideC,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
@@ -7972,8 +12488,26 @@ hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                ldc,
                                            hipblasStride      strideC,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
@@ -7990,8 +12524,26 @@ hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
@@ -8008,8 +12560,26 @@ hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               strideC,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblas_syrk_batched_cuda(handle,
+                                     uplo,
+                                     transA,
+                                     n,
+                                     k,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     beta,
+                                     hipblas_strided(C, strideC),
+                                     ldc,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2k
@@ -8028,6 +12598,7 @@ hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8062,6 +12633,7 @@ hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8096,6 +12668,7 @@ hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8130,6 +12703,7 @@ hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8165,6 +12739,7 @@ hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                      int                ldc,
                                      int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8183,6 +12758,7 @@ hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                      int                 ldc,
                                      int                 batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8201,6 +12777,7 @@ hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8219,6 +12796,7 @@ hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8241,6 +12819,23 @@ hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8262,6 +12857,23 @@ hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8283,6 +12895,23 @@ hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8304,6 +12933,23 @@ hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8323,6 +12969,7 @@ hipblasStatus_t hipblasSsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8357,6 +13004,7 @@ hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8391,6 +13039,7 @@ hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8425,6 +13074,7 @@ hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8460,6 +13110,7 @@ hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                      int                ldc,
                                      int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8478,6 +13129,7 @@ hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                      int                 ldc,
                                      int                 batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8496,6 +13148,7 @@ hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8514,6 +13167,7 @@ hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8536,6 +13190,23 @@ hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8557,6 +13228,23 @@ hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8578,6 +13266,23 @@ hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8599,6 +13304,23 @@ hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     uplo,
+                     transA,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8618,6 +13340,7 @@ hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8652,6 +13375,7 @@ hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8686,6 +13410,7 @@ hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8720,6 +13445,7 @@ hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8755,6 +13481,7 @@ hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8773,6 +13500,7 @@ hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8791,6 +13519,7 @@ hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8809,6 +13538,7 @@ hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8831,6 +13561,23 @@ hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8852,6 +13599,23 @@ hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8873,6 +13637,23 @@ hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8894,6 +13675,23 @@ hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     ldb,
+                     strideB,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8913,6 +13711,7 @@ hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasChemm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -8947,6 +13746,7 @@ hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZhemm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -8982,6 +13782,7 @@ hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9000,6 +13801,7 @@ hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9022,6 +13824,23 @@ hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9043,6 +13862,23 @@ hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     strideC,
+                     batchCount);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9061,6 +13897,8 @@ hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+
     // cuBLAS API for trmm is a bit different, you can pass in a third
     // pointer to do out-of-place trmm. If you want the in-place behaviour
     // you can pass in B as the third pointer, as seen here.
@@ -9098,6 +13936,7 @@ hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasDtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9132,6 +13971,7 @@ hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasCtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9166,6 +14006,7 @@ hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasZtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9200,8 +14041,26 @@ hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                     float* const       B[],
                                     int                ldb,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(B),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
@@ -9217,8 +14076,26 @@ hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                     double* const       B[],
                                     int                 ldb,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(B),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
@@ -9234,8 +14111,26 @@ hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       B[],
                                     int                         ldb,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(B),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
@@ -9251,8 +14146,26 @@ hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       B[],
                                     int                               ldb,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_batched(A),
+                                     lda,
+                                     hipblas_batched(B),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmm_strided_batched
@@ -9271,8 +14184,40 @@ hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(B, strideB),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
@@ -9290,8 +14235,40 @@ hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(B, strideB),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
@@ -9309,8 +14286,40 @@ hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldb,
                                            hipblasStride         strideB,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(B, strideB),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
@@ -9328,8 +14337,40 @@ hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                            int                         ldb,
                                            hipblasStride               strideB,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batchCount);
+    return hipblas_trmm_batched_cuda(handle,
+                                     side,
+                                     uplo,
+                                     transA,
+                                     diag,
+                                     m,
+                                     n,
+                                     alpha,
+                                     hipblas_strided(A, strideA),
+                                     lda,
+                                     hipblas_strided(B, strideB),
+                                     ldb,
+                                     batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trsm
@@ -9347,6 +14388,7 @@ hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasStrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9379,6 +14421,7 @@ hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasDtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9411,6 +14454,7 @@ hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasCtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9443,6 +14487,7 @@ hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
     return hipCUBLASStatusToHIPStatus(cublasZtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9477,6 +14522,7 @@ hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasStrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9511,6 +14557,7 @@ hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasDtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9545,6 +14592,7 @@ hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                     int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasCtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9579,6 +14627,7 @@ hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasZtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9615,6 +14664,21 @@ hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batch_count)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9634,6 +14698,21 @@ hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batch_count)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9653,6 +14732,21 @@ hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideB,
                                            int                   batch_count)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9672,6 +14766,21 @@ hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideB,
                                            int                         batch_count)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9684,8 +14793,22 @@ hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                               int               lda,
                               float*            invA,
                               int               ldinvA)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, 0),
+                                      lda,
+                                      hipblas_strided(invA, 0),
+                                      ldinvA,
+                                      1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
@@ -9696,8 +14819,22 @@ hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                               int               lda,
                               double*           invA,
                               int               ldinvA)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, 0),
+                                      lda,
+                                      hipblas_strided(invA, 0),
+                                      ldinvA,
+                                      1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
@@ -9708,8 +14845,22 @@ hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                               int                   lda,
                               hipblasComplex*       invA,
                               int                   ldinvA)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, 0),
+                                      lda,
+                                      hipblas_strided(invA, 0),
+                                      ldinvA,
+                                      1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
@@ -9720,8 +14871,22 @@ hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                               int                         lda,
                               hipblasDoubleComplex*       invA,
                               int                         ldinvA)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, 0),
+                                      lda,
+                                      hipblas_strided(invA, 0),
+                                      ldinvA,
+                                      1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trtri_batched
@@ -9734,8 +14899,22 @@ hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
                                      float*             invA[],
                                      int                ldinvA,
                                      int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_batched(A),
+                                      lda,
+                                      hipblas_batched(invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
@@ -9747,8 +14926,22 @@ hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                      double*             invA[],
                                      int                 ldinvA,
                                      int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_batched(A),
+                                      lda,
+                                      hipblas_batched(invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
@@ -9760,8 +14953,22 @@ hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
                                      hipblasComplex*             invA[],
                                      int                         ldinvA,
                                      int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_batched(A),
+                                      lda,
+                                      hipblas_batched(invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
@@ -9773,8 +14980,22 @@ hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
                                      hipblasDoubleComplex*             invA[],
                                      int                               ldinvA,
                                      int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, uplo, diag, n, A, lda, invA, ldinvA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_batched(A),
+                                      lda,
+                                      hipblas_batched(invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trtri_strided_batched
@@ -9789,8 +15010,23 @@ hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
                                             int               ldinvA,
                                             hipblasStride     stride_invA,
                                             int               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, stride_A),
+                                      lda,
+                                      hipblas_strided(invA, stride_invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
@@ -9804,8 +15040,23 @@ hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
                                             int               ldinvA,
                                             hipblasStride     stride_invA,
                                             int               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, stride_A),
+                                      lda,
+                                      hipblas_strided(invA, stride_invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
@@ -9819,8 +15070,23 @@ hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
                                             int                   ldinvA,
                                             hipblasStride         stride_invA,
                                             int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, stride_A),
+                                      lda,
+                                      hipblas_strided(invA, stride_invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
@@ -9834,8 +15100,23 @@ hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
                                             int                         ldinvA,
                                             hipblasStride               stride_invA,
                                             int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(
+        handle, uplo, diag, n, A, lda, stride_A, invA, ldinvA, stride_invA, batch_count);
+    return hipblas_trtri_batched_cuda(handle,
+                                      uplo,
+                                      diag,
+                                      n,
+                                      hipblas_strided(A, stride_A),
+                                      lda,
+                                      hipblas_strided(invA, stride_invA),
+                                      ldinvA,
+                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dgmm
@@ -9851,6 +15132,7 @@ hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasSdgmm(
         (cublasHandle_t)handle, hipSideToCudaSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -9871,6 +15153,7 @@ hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasDdgmm(
         (cublasHandle_t)handle, hipSideToCudaSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -9891,6 +15174,7 @@ hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasCdgmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   m,
@@ -9919,6 +15203,7 @@ hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasZdgmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   m,
@@ -9948,6 +15233,7 @@ hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9963,6 +15249,7 @@ hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9978,6 +15265,7 @@ hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9993,6 +15281,7 @@ hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, side, m, n, A, lda, x, incx, C, ldc, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10012,6 +15301,8 @@ hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stride_C,
                                            int               batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10030,6 +15321,8 @@ hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stride_C,
                                            int               batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10048,6 +15341,8 @@ hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_C,
                                            int                   batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10066,6 +15361,8 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_C,
                                            int                         batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, side, m, n, A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10074,20 +15371,38 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
 // getrf
 hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+    return hipblas_getrf_cuda(handle, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrf(
     hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+    return hipblas_getrf_cuda(handle, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrf(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+    return hipblas_getrf_cuda(handle, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
@@ -10096,8 +15411,14 @@ hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
                               const int             lda,
                               int*                  ipiv,
                               int*                  info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info);
+    return hipblas_getrf_cuda(handle, n, A, lda, ipiv, info);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getrf_batched
@@ -10110,6 +15431,7 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10127,6 +15449,7 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10144,6 +15467,7 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
         (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10161,6 +15485,7 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
         (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10180,6 +15505,7 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10193,6 +15519,7 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10206,6 +15533,7 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10219,6 +15547,7 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             int*                  info,
                                             const int             batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10233,8 +15562,34 @@ hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               float*                   B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL)
+        *info = -6;
+    else if(B == NULL)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    return hipblas_getrs_cuda(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
@@ -10247,8 +15602,34 @@ hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
                               double*                  B,
                               const int                ldb,
                               int*                     info)
+try
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL)
+        *info = -6;
+    else if(B == NULL)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    return hipblas_getrs_cuda(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
@@ -10261,8 +15642,34 @@ hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
                               hipblasComplex*          B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL)
+        *info = -6;
+    else if(B == NULL)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    return hipblas_getrs_cuda(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
@@ -10275,8 +15682,34 @@ hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
                               hipblasDoubleComplex*    B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -2;
+    else if(nrhs < 0)
+        *info = -3;
+    else if(A == NULL)
+        *info = -4;
+    else if(lda < std::max(1, n))
+        *info = -5;
+    else if(ipiv == NULL)
+        *info = -6;
+    else if(B == NULL)
+        *info = -7;
+    else if(ldb < std::max(1, n))
+        *info = -8;
+    else
+        *info = 0;
+
+    return hipblas_getrs_cuda(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getrs_batched
@@ -10293,6 +15726,7 @@ hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10323,6 +15757,7 @@ hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10353,6 +15788,7 @@ hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10383,6 +15819,7 @@ hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10416,6 +15853,8 @@ hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10434,6 +15873,8 @@ hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10452,6 +15893,8 @@ hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10470,9 +15913,365 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_LOG_CALL(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
+// gesv_batched
+hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    float* const    A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    float* const    B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cuBLAS only pivots when given the pivots
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(
+        cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, pivots, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Argument errors were caught by getrf; a singular A_i is reported in info
+    int getrs_info;
+    return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          pivots,
+                                                          B,
+                                                          ldb,
+                                                          &getrs_info,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    const int       nrhs,
+                                    double* const   A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    double* const   B[],
+                                    const int       ldb,
+                                    int*            info,
+                                    const int       batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cuBLAS only pivots when given the pivots
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(
+        cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, pivots, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Argument errors were caught by getrf; a singular A_i is reported in info
+    int getrs_info;
+    return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          pivots,
+                                                          B,
+                                                          ldb,
+                                                          &getrs_info,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                    const int             n,
+                                    const int             nrhs,
+                                    hipblasComplex* const A[],
+                                    const int             lda,
+                                    int*                  ipiv,
+                                    hipblasComplex* const B[],
+                                    const int             ldb,
+                                    int*                  info,
+                                    const int             batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cuBLAS only pivots when given the pivots
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+        (cublasHandle_t)handle, n, (cuComplex**)A, lda, pivots, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Argument errors were caught by getrf; a singular A_i is reported in info
+    int getrs_info;
+    return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          (cuComplex**)A,
+                                                          lda,
+                                                          pivots,
+                                                          (cuComplex**)B,
+                                                          ldb,
+                                                          &getrs_info,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                    const int                   n,
+                                    const int                   nrhs,
+                                    hipblasDoubleComplex* const A[],
+                                    const int                   lda,
+                                    int*                        ipiv,
+                                    hipblasDoubleComplex* const B[],
+                                    const int                   ldb,
+                                    int*                        info,
+                                    const int                   batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // cuBLAS only pivots when given the pivots
+    int* pivots = hipblas_gesv_pivots(handle, n, batch_count, ipiv);
+    if(!pivots && n > 0)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    hipblasStatus_t status = hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+        (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, pivots, info, batch_count));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Argument errors were caught by getrf; a singular A_i is reported in info
+    int getrs_info;
+    return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                          CUBLAS_OP_N,
+                                                          n,
+                                                          nrhs,
+                                                          (cuDoubleComplex**)A,
+                                                          lda,
+                                                          pivots,
+                                                          (cuDoubleComplex**)B,
+                                                          ldb,
+                                                          &getrs_info,
+                                                          batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gesv_strided_batched
+hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           float*              A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           float*              B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    // Run as the batched call, as cuBLAS has no strided batched getrf
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(ipiv && strideP != n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    float**         A_array;
+    float**         B_array;
+    hipblasStatus_t status
+        = hipblasStridedArrays(handle, A, sizeof(*A) * strideA, batch_count, (void***)&A_array);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasStridedArrays(
+            handle, B, sizeof(*B) * strideB, batch_count, (void***)&B_array);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasSgesvBatched(
+        handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, info, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           double*             A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           double*             B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    // Run as the batched call, as cuBLAS has no strided batched getrf
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(ipiv && strideP != n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    double**        A_array;
+    double**        B_array;
+    hipblasStatus_t status
+        = hipblasStridedArrays(handle, A, sizeof(*A) * strideA, batch_count, (void***)&A_array);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasStridedArrays(
+            handle, B, sizeof(*B) * strideB, batch_count, (void***)&B_array);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasDgesvBatched(
+        handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, info, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           const int           nrhs,
+                                           hipblasComplex*     A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           hipblasComplex*     B,
+                                           const int           ldb,
+                                           const hipblasStride strideB,
+                                           int*                info,
+                                           const int           batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    // Run as the batched call, as cuBLAS has no strided batched getrf
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(ipiv && strideP != n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasComplex** A_array;
+    hipblasComplex** B_array;
+    hipblasStatus_t  status
+        = hipblasStridedArrays(handle, A, sizeof(*A) * strideA, batch_count, (void***)&A_array);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasStridedArrays(
+            handle, B, sizeof(*B) * strideB, batch_count, (void***)&B_array);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasCgesvBatched(
+        handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, info, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                           const int             n,
+                                           const int             nrhs,
+                                           hipblasDoubleComplex* A,
+                                           const int             lda,
+                                           const hipblasStride   strideA,
+                                           int*                  ipiv,
+                                           const hipblasStride   strideP,
+                                           hipblasDoubleComplex* B,
+                                           const int             ldb,
+                                           const hipblasStride   strideB,
+                                           int*                  info,
+                                           const int             batch_count)
+try
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+
+    // Run as the batched call, as cuBLAS has no strided batched getrf
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(ipiv && strideP != n)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblasDoubleComplex** A_array;
+    hipblasDoubleComplex** B_array;
+    hipblasStatus_t        status
+        = hipblasStridedArrays(handle, A, sizeof(*A) * strideA, batch_count, (void***)&A_array);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasStridedArrays(
+            handle, B, sizeof(*B) * strideB, batch_count, (void***)&B_array);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasZgesvBatched(
+        handle, n, nrhs, A_array, lda, ipiv, B_array, ldb, info, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // getri_batched
 hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       n,
@@ -10485,6 +16284,7 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
@@ -10504,6 +16304,7 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
@@ -10523,6 +16324,7 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
                                                           n,
                                                           (cuComplex**)A,
@@ -10549,6 +16351,7 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, C, ldc, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
                                                           n,
                                                           (cuDoubleComplex**)A,
@@ -10570,10 +16373,32 @@ hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               const int       n,
                               float*          A,
                               const int       lda,
-                              float*          ipiv,
+                              float*          tau,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL)
+        *info = -5;
+    else
+        *info = 0;
+
+    return hipblas_geqrf_cuda(handle, m, n, A, lda, tau);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
@@ -10581,10 +16406,32 @@ hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
                               const int       n,
                               double*         A,
                               const int       lda,
-                              double*         ipiv,
+                              double*         tau,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL)
+        *info = -5;
+    else
+        *info = 0;
+
+    return hipblas_geqrf_cuda(handle, m, n, A, lda, tau);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
@@ -10592,10 +16439,32 @@ hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
                               const int       n,
                               hipblasComplex* A,
                               const int       lda,
-                              hipblasComplex* ipiv,
+                              hipblasComplex* tau,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL)
+        *info = -5;
+    else
+        *info = 0;
+
+    return hipblas_geqrf_cuda(handle, m, n, A, lda, tau);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
@@ -10603,10 +16472,32 @@ hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
                               const int             n,
                               hipblasDoubleComplex* A,
                               const int             lda,
-                              hipblasDoubleComplex* ipiv,
+                              hipblasDoubleComplex* tau,
                               int*                  info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, tau, info);
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0)
+        *info = -2;
+    else if(A == NULL)
+        *info = -3;
+    else if(lda < std::max(1, m))
+        *info = -4;
+    else if(tau == NULL)
+        *info = -5;
+    else
+        *info = 0;
+
+    return hipblas_geqrf_cuda(handle, m, n, A, lda, tau);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // geqrf_batched
@@ -10620,6 +16511,7 @@ hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasSgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
@@ -10638,6 +16530,7 @@ hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(
         cublasDgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
@@ -10656,6 +16549,7 @@ hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
         (cublasHandle_t)handle, m, n, (cuComplex**)A, lda, (cuComplex**)ipiv, info, batch_count));
 }
@@ -10674,6 +16568,7 @@ hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, ipiv, info, batch_count);
     return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
                                                           m,
                                                           n,
@@ -10700,6 +16595,7 @@ hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10714,6 +16610,7 @@ hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10728,6 +16625,7 @@ hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10742,6 +16640,7 @@ hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
                                             int*                  info,
                                             const int             batch_count)
 {
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, ipiv, strideP, info, batch_count);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10764,6 +16663,7 @@ hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
     return hipCUBLASStatusToHIPStatus(cublasHgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -10800,6 +16700,8 @@ hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_R_32F);
     return hipCUBLASStatusToHIPStatus(cublasSgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -10836,6 +16738,8 @@ hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_R_64F);
     return hipCUBLASStatusToHIPStatus(cublasDgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -10872,6 +16776,8 @@ hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_C_32F);
     return hipCUBLASStatusToHIPStatus(cublasCgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -10908,6 +16814,8 @@ hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    HIPBLAS_COALESCE_GEMM(HIPBLAS_C_64F);
     return hipCUBLASStatusToHIPStatus(cublasZgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -10946,6 +16854,8 @@ hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return hipCUBLASStatusToHIPStatus(cublasHgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -10984,6 +16894,8 @@ hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return hipCUBLASStatusToHIPStatus(cublasSgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11022,6 +16934,8 @@ hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return hipCUBLASStatusToHIPStatus(cublasDgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11060,6 +16974,8 @@ hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return hipCUBLASStatusToHIPStatus(cublasCgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11098,6 +17014,8 @@ hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
     return hipCUBLASStatusToHIPStatus(cublasZgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11140,6 +17058,24 @@ hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
     return hipCUBLASStatusToHIPStatus(cublasHgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11184,6 +17120,24 @@ hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
     return hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11228,6 +17182,24 @@ hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
     return hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11272,6 +17244,24 @@ hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
     return hipCUBLASStatusToHIPStatus(cublasCgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11316,6 +17306,24 @@ hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
     return hipCUBLASStatusToHIPStatus(cublasZgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11362,6 +17370,74 @@ hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     compute_type,
+                     algo);
+
+    hipblasStatus_t coalesce_status;
+    if(hipblas_coalesce_gemm(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             a_type,
+                             lda,
+                             B,
+                             b_type,
+                             ldb,
+                             beta,
+                             C,
+                             c_type,
+                             ldc,
+                             compute_type,
+                             algo,
+                             coalesce_status))
+        return coalesce_status;
+
+    // A solution chosen by hipblasGemmExTune for this problem takes precedence
+    hipblas_tuning_key tuning_key = hipblas_make_tuning_key(
+        transa, transb, m, n, k, lda, ldb, ldc, a_type, b_type, c_type, compute_type);
+    int tuned_solution;
+    if(algo == HIPBLAS_GEMM_DEFAULT && hipblas_find_tuned_gemm(tuning_key, tuned_solution))
+        return hipblas_gemm_ex_solution(handle,
+                                        transa,
+                                        transb,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_type,
+                                        lda,
+                                        B,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        c_type,
+                                        ldc,
+                                        compute_type,
+                                        tuned_solution);
+
     return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
                                                    hipOperationToCudaOperation(transa),
                                                    hipOperationToCudaOperation(transb),
@@ -11387,6 +17463,138 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+} // extern "C"
+
+// Declared in coalesce.hpp, so not extern "C"
+hipblasStatus_t hipblas_get_stream(hipblasHandle_t handle, hipStream_t* stream)
+{
+    return hipCUBLASStatusToHIPStatus(cublasGetStream((cublasHandle_t)handle, stream));
+}
+
+// Declared in tuning.hpp, so not extern "C"
+hipblasStatus_t hipblas_gemm_ex_solution(hipblasHandle_t    handle,
+                                         hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A,
+                                         hipblasDatatype_t  a_type,
+                                         int                lda,
+                                         const void*        B,
+                                         hipblasDatatype_t  b_type,
+                                         int                ldb,
+                                         const void*        beta,
+                                         void*              C,
+                                         hipblasDatatype_t  c_type,
+                                         int                ldc,
+                                         hipblasDatatype_t  compute_type,
+                                         int                solution)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
+                                                   hipOperationToCudaOperation(transa),
+                                                   hipOperationToCudaOperation(transb),
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   alpha,
+                                                   A,
+                                                   HIPDatatypeToCudaDatatype(a_type),
+                                                   lda,
+                                                   B,
+                                                   HIPDatatypeToCudaDatatype(b_type),
+                                                   ldb,
+                                                   beta,
+                                                   C,
+                                                   HIPDatatypeToCudaDatatype(c_type),
+                                                   ldc,
+                                                   HIPDatatypeToCudaDatatype(compute_type),
+                                                   cublasGemmAlgo_t(solution)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmExGetSolutions(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  a_type,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int                ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo,
+                                          int*               solutions,
+                                          int*               size)
+try
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     compute_type,
+                     algo,
+                     solutions,
+                     size);
+
+    if(!size || (solutions && *size < 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    HIPGemmAlgoToCudaGemmAlgo(algo); // throws for an invalid algo
+    HIPDatatypeToCudaDatatype(a_type);
+    HIPDatatypeToCudaDatatype(b_type);
+    HIPDatatypeToCudaDatatype(c_type);
+    HIPDatatypeToCudaDatatype(compute_type);
+
+    // cuBLAS has no query of the algorithms that suit a problem, so list all of
+    // them; hipblasGemmExTune skips those cublasGemmEx turns down
+    std::vector<int> all{CUBLAS_GEMM_DEFAULT, CUBLAS_GEMM_DEFAULT_TENSOR_OP};
+    for(int a = CUBLAS_GEMM_ALGO0; a <= CUBLAS_GEMM_ALGO23; a++)
+        all.push_back(a);
+    for(int a = CUBLAS_GEMM_ALGO0_TENSOR_OP; a <= CUBLAS_GEMM_ALGO15_TENSOR_OP; a++)
+        all.push_back(a);
+
+    if(solutions)
+    {
+        *size = std::min(*size, int(all.size()));
+        std::copy(all.begin(), all.begin() + *size, solutions);
+    }
+    else
+        *size = int(all.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasOperation_t transa,
                                      hipblasOperation_t transb,
@@ -11409,6 +17617,26 @@ hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     B,
+                     b_type,
+                     ldb,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     batch_count,
+                     compute_type,
+                     algo);
     return hipCUBLASStatusToHIPStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(transa),
                                                           hipOperationToCudaOperation(transb),
@@ -11460,6 +17688,29 @@ hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     stride_A,
+                     B,
+                     b_type,
+                     ldb,
+                     stride_B,
+                     beta,
+                     C,
+                     c_type,
+                     ldc,
+                     stride_C,
+                     batch_count,
+                     compute_type,
+                     algo);
     return hipCUBLASStatusToHIPStatus(
         cublasGemmStridedBatchedEx((cublasHandle_t)handle,
                                    hipOperationToCudaOperation(transa),
@@ -11507,6 +17758,21 @@ hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               int                invA_size,
                               hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     invA,
+                     invA_size,
+                     compute_type);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11527,6 +17793,22 @@ hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
                                      int                invA_size,
                                      hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     batch_count,
+                     invA,
+                     invA_size,
+                     compute_type);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11550,6 +17832,25 @@ hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasStride      stride_invA,
                                             hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     side,
+                     uplo,
+                     transA,
+                     diag,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     batch_count,
+                     invA,
+                     invA_size,
+                     stride_invA,
+                     compute_type);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11637,6 +17938,7 @@ hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, executionType);
     return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
                                                    n,
                                                    alpha,
@@ -11667,6 +17969,8 @@ hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                      int               batch_count,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, alphaType, x, xType, incx, y, yType, incy, batch_count, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11685,6 +17989,20 @@ hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
                                             int               batch_count,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     alphaType,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11702,17 +18020,21 @@ hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
-                                                  n,
-                                                  x,
-                                                  HIPDatatypeToCudaDatatype(xType),
-                                                  incx,
-                                                  y,
-                                                  HIPDatatypeToCudaDatatype(yType),
-                                                  incy,
-                                                  result,
-                                                  HIPDatatypeToCudaDatatype(resultType),
-                                                  HIPDatatypeToCudaDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
+                                                      n,
+                                                      x,
+                                                      HIPDatatypeToCudaDatatype(xType),
+                                                      incx,
+                                                      y,
+                                                      HIPDatatypeToCudaDatatype(yType),
+                                                      incy,
+                                                      result,
+                                                      HIPDatatypeToCudaDatatype(resultType),
+                                                      HIPDatatypeToCudaDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -11732,17 +18054,21 @@ hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   y,
-                                                   HIPDatatypeToCudaDatatype(yType),
-                                                   incy,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype(resultType),
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
+                                                       n,
+                                                       x,
+                                                       HIPDatatypeToCudaDatatype(xType),
+                                                       incx,
+                                                       y,
+                                                       HIPDatatypeToCudaDatatype(yType),
+                                                       incy,
+                                                       result,
+                                                       HIPDatatypeToCudaDatatype(resultType),
+                                                       HIPDatatypeToCudaDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -11762,6 +18088,8 @@ hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t resultType,
                                     hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, batch_count, result, resultType, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11778,6 +18106,8 @@ hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t resultType,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, batch_count, result, resultType, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11796,6 +18126,20 @@ hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t resultType,
                                            hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     result,
+                     resultType,
+                     executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11814,6 +18158,20 @@ hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     batch_count,
+                     result,
+                     resultType,
+                     executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11828,14 +18186,18 @@ hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
-                                                   n,
-                                                   x,
-                                                   HIPDatatypeToCudaDatatype(xType),
-                                                   incx,
-                                                   result,
-                                                   HIPDatatypeToCudaDatatype(resultType),
-                                                   HIPDatatypeToCudaDatatype(executionType)));
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, result, resultType, executionType);
+    size_t size = hipblas_datatype_size(resultType);
+    return hipblas_capture_result_bytes(handle, result, size, [&](void* result) {
+        return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
+                                                       n,
+                                                       x,
+                                                       HIPDatatypeToCudaDatatype(xType),
+                                                       incx,
+                                                       result,
+                                                       HIPDatatypeToCudaDatatype(resultType),
+                                                       HIPDatatypeToCudaDatatype(executionType)));
+    });
 }
 catch(...)
 {
@@ -11852,6 +18214,7 @@ hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t resultType,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, batch_count, result, resultType, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11866,6 +18229,8 @@ hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, stridex, batch_count, result, resultType, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11884,6 +18249,7 @@ hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, x, xType, incx, y, yType, incy, c, s, csType, executionType);
     return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
                                                   n,
                                                   x,
@@ -11916,6 +18282,8 @@ hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                     int               batch_count,
                                     hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, x, xType, incx, y, yType, incy, c, s, csType, batch_count, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11935,6 +18303,21 @@ hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
                                            int               batch_count,
                                            hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     x,
+                     xType,
+                     incx,
+                     stridex,
+                     y,
+                     yType,
+                     incy,
+                     stridey,
+                     c,
+                     s,
+                     csType,
+                     batch_count,
+                     executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11949,6 +18332,7 @@ hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, executionType);
     return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
                                                    n,
                                                    alpha,
@@ -11973,6 +18357,7 @@ hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                      int               batch_count,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(handle, n, alpha, alphaType, x, xType, incx, batch_count, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11987,6 +18372,8 @@ hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
                                             int               batch_count,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, alphaType, x, xType, incx, stridex, batch_count, executionType);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -0,0 +1,860 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Non-batched getrf, getrs and geqrf of the CUDA backend; see solver.hpp.
+//
+// The fallback follows LAPACK: getrf and geqrf factorize a panel of
+// solver_nb columns in one kernel block, then update the trailing matrix with
+// trsm and gemm, or with the block reflector of the panel, so the bulk of the
+// flops are cuBLAS level 3 flops.
+
+#include "solver.hpp"
+#include "batched_device.hpp"
+
+#ifdef HIPBLAS_HAS_CUSOLVER
+#include <cusolverDn.h>
+#endif
+
+namespace
+{
+    // Columns of a panel
+    constexpr int solver_nb = 32;
+
+    // The typed cuBLAS and cuSOLVER functions for a hipBLAS type, and the
+    // element type they take
+    template <typename T>
+    struct solver_api;
+
+    template <>
+    struct solver_api<float>
+    {
+        using type                      = float;
+        static constexpr char precision = 's';
+        static constexpr auto gemm      = cublasSgemm;
+        static constexpr auto trsm      = cublasStrsm;
+        static constexpr auto trmm      = cublasStrmm;
+#ifdef HIPBLAS_HAS_CUSOLVER
+        static constexpr auto getrf_buffer_size = cusolverDnSgetrf_bufferSize;
+        static constexpr auto getrf             = cusolverDnSgetrf;
+        static constexpr auto getrs             = cusolverDnSgetrs;
+        static constexpr auto geqrf_buffer_size = cusolverDnSgeqrf_bufferSize;
+        static constexpr auto geqrf             = cusolverDnSgeqrf;
+#endif
+    };
+
+    template <>
+    struct solver_api<double>
+    {
+        using type                      = double;
+        static constexpr char precision = 'd';
+        static constexpr auto gemm      = cublasDgemm;
+        static constexpr auto trsm      = cublasDtrsm;
+        static constexpr auto trmm      = cublasDtrmm;
+#ifdef HIPBLAS_HAS_CUSOLVER
+        static constexpr auto getrf_buffer_size = cusolverDnDgetrf_bufferSize;
+        static constexpr auto getrf             = cusolverDnDgetrf;
+        static constexpr auto getrs             = cusolverDnDgetrs;
+        static constexpr auto geqrf_buffer_size = cusolverDnDgeqrf_bufferSize;
+        static constexpr auto geqrf             = cusolverDnDgeqrf;
+#endif
+    };
+
+    template <>
+    struct solver_api<hipblasComplex>
+    {
+        using type                      = cuComplex;
+        static constexpr char precision = 'c';
+        static constexpr auto gemm      = cublasCgemm;
+        static constexpr auto trsm      = cublasCtrsm;
+        static constexpr auto trmm      = cublasCtrmm;
+#ifdef HIPBLAS_HAS_CUSOLVER
+        static constexpr auto getrf_buffer_size = cusolverDnCgetrf_bufferSize;
+        static constexpr auto getrf             = cusolverDnCgetrf;
+        static constexpr auto getrs             = cusolverDnCgetrs;
+        static constexpr auto geqrf_buffer_size = cusolverDnCgeqrf_bufferSize;
+        static constexpr auto geqrf             = cusolverDnCgeqrf;
+#endif
+    };
+
+    template <>
+    struct solver_api<hipblasDoubleComplex>
+    {
+        using type                      = cuDoubleComplex;
+        static constexpr char precision = 'z';
+        static constexpr auto gemm      = cublasZgemm;
+        static constexpr auto trsm      = cublasZtrsm;
+        static constexpr auto trmm      = cublasZtrmm;
+#ifdef HIPBLAS_HAS_CUSOLVER
+        static constexpr auto getrf_buffer_size = cusolverDnZgetrf_bufferSize;
+        static constexpr auto getrf             = cusolverDnZgetrf;
+        static constexpr auto getrs             = cusolverDnZgetrs;
+        static constexpr auto geqrf_buffer_size = cusolverDnZgeqrf_bufferSize;
+        static constexpr auto geqrf             = cusolverDnZgeqrf;
+#endif
+    };
+
+    // Element of real and imaginary part re and im; im is dropped for real T
+    template <typename T>
+    struct solver_element
+    {
+        static HIPBLAS_CUDA_FN T make(T re, T)
+        {
+            return re;
+        }
+    };
+
+    template <typename T>
+    struct solver_element<cuda_complex<T>>
+    {
+        static HIPBLAS_CUDA_FN cuda_complex<T> make(T re, T im)
+        {
+            return {re, im};
+        }
+    };
+
+    template <typename T>
+    typename solver_api<T>::type* api_cast(T* p)
+    {
+        return reinterpret_cast<typename solver_api<T>::type*>(p);
+    }
+
+    template <typename T>
+    const typename solver_api<T>::type* api_cast(const T* p)
+    {
+        return reinterpret_cast<const typename solver_api<T>::type*>(p);
+    }
+
+    // Index of the entry of largest |re| + |im| among x[first, n) of a one
+    // dimensional block of hipblas_cuda_threads, the first of equal ones,
+    // returned to every thread
+    template <typename T>
+    __device__ int block_iamax(const T* x, int first, int n)
+    {
+        __shared__ cuda_real_t<T> value[hipblas_cuda_threads];
+        __shared__ int            index[hipblas_cuda_threads];
+
+        cuda_real_t<T> best = -1;
+        int            at   = first;
+        for(int i = first + threadIdx.x; i < n; i += blockDim.x)
+        {
+            cuda_real_t<T> v = cuda_abs1(x[i]);
+            if(v > best)
+            {
+                best = v;
+                at   = i;
+            }
+        }
+        value[threadIdx.x] = best;
+        index[threadIdx.x] = at;
+        __syncthreads();
+
+        for(unsigned s = hipblas_cuda_threads / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+            {
+                cuda_real_t<T> v = value[threadIdx.x + s];
+                int            i = index[threadIdx.x + s];
+                if(v > value[threadIdx.x] || (v == value[threadIdx.x] && i < index[threadIdx.x]))
+                {
+                    value[threadIdx.x] = v;
+                    index[threadIdx.x] = i;
+                }
+            }
+            __syncthreads();
+        }
+        int result = index[0];
+        // The next call may overwrite index
+        __syncthreads();
+        return result;
+    }
+
+    // Unblocked LU of an m x jb panel whose first row is row first of the
+    // matrix. ipiv, when set, and info take global 1-based rows.
+    template <typename T>
+    __global__ void getf2_kernel(int m, int jb, T* A, int lda, int* ipiv, int* info, int first)
+    {
+        for(int c = 0; c < jb && c < m; c++)
+        {
+            T* col = A + int64_t(c) * lda;
+            if(ipiv)
+            {
+                int p = block_iamax(col, c, m);
+                if(threadIdx.x == 0)
+                    ipiv[c] = first + p + 1;
+                if(p != c)
+                    for(int k = threadIdx.x; k < jb; k += blockDim.x)
+                    {
+                        T t                     = A[c + int64_t(k) * lda];
+                        A[c + int64_t(k) * lda] = A[p + int64_t(k) * lda];
+                        A[p + int64_t(k) * lda] = t;
+                    }
+                __syncthreads();
+            }
+
+            T d = col[c];
+            if(d == T(0))
+            {
+                if(threadIdx.x == 0 && *info == 0)
+                    *info = first + c + 1;
+            }
+            else
+            {
+                for(int i = c + 1 + threadIdx.x; i < m; i += blockDim.x)
+                    col[i] = col[i] / d;
+            }
+            __syncthreads();
+
+            for(int k = c + 1; k < jb; k++)
+            {
+                T* target = A + int64_t(k) * lda;
+                T  u      = target[c];
+                for(int i = c + 1 + threadIdx.x; i < m; i += blockDim.x)
+                    target[i] = target[i] - col[i] * u;
+            }
+            __syncthreads();
+        }
+    }
+
+    // Row interchanges k1 to k2 - 1 of ipiv, in that order when forward and
+    // reversed otherwise, on the n columns of A; a thread per column
+    template <typename T>
+    __global__ void
+        laswp_kernel(int n, T* A, int lda, int k1, int k2, const int* ipiv, bool forward)
+    {
+        int j = blockIdx.x * blockDim.x + threadIdx.x;
+        if(j >= n)
+            return;
+
+        T* col = A + int64_t(j) * lda;
+        for(int step = 0; step < k2 - k1; step++)
+        {
+            int k = forward ? k1 + step : k2 - 1 - step;
+            int p = ipiv[k] - 1;
+            if(p != k)
+            {
+                T t    = col[k];
+                col[k] = col[p];
+                col[p] = t;
+            }
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t laswp(const cuda_context& context,
+                          int                 n,
+                          T*                  A,
+                          int                 lda,
+                          int                 k1,
+                          int                 k2,
+                          const int*          ipiv,
+                          bool                forward)
+    {
+        if(n <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipLaunchKernelGGL((laswp_kernel<cuda_t<T>>),
+                           dim3(cuda_blocks(n)),
+                           dim3(hipblas_cuda_threads),
+                           0,
+                           context.stream,
+                           n,
+                           cuda_cast(A),
+                           lda,
+                           k1,
+                           k2,
+                           ipiv,
+                           forward);
+        return cuda_launch_status();
+    }
+
+    // Unblocked QR of an m x jb panel as LAPACK geqr2 does it: each column
+    // becomes beta and the tail of the Householder vector v with v[0] = 1,
+    // and H^H = I - conj(tau) * v * v^H is applied to the columns after it
+    template <typename T>
+    __global__ void geqr2_kernel(int m, int jb, T* A, int lda, T* tau)
+    {
+        using R = cuda_real_t<T>;
+
+        for(int c = 0; c < jb && c < m; c++)
+        {
+            T* col   = A + c + int64_t(c) * lda;
+            int rows = m - c;
+
+            R partial = 0;
+            for(int i = 1 + threadIdx.x; i < rows; i += blockDim.x)
+                partial += cuda_norm(col[i]);
+            R xnorm2 = cuda_block_sum(partial);
+
+            T alpha = col[0];
+            R re    = cuda_real(alpha);
+            R im    = cuda_imag(alpha);
+            T t(0);
+            if(xnorm2 != 0 || im != 0)
+            {
+                R beta = sqrt(re * re + im * im + xnorm2);
+                beta   = re >= 0 ? -beta : beta;
+                t      = solver_element<T>::make((beta - re) / beta, -im / beta);
+                T s    = T(1) / (alpha - T(beta));
+                for(int i = 1 + threadIdx.x; i < rows; i += blockDim.x)
+                    col[i] = col[i] * s;
+                __syncthreads();
+                if(threadIdx.x == 0)
+                    col[0] = T(beta);
+            }
+            if(threadIdx.x == 0)
+                tau[c] = t;
+            __syncthreads();
+
+            if(t == T(0))
+                continue;
+            for(int k = c + 1; k < jb; k++)
+            {
+                T* target = A + c + int64_t(k) * lda;
+                T  w(0);
+                for(int i = threadIdx.x; i < rows; i += blockDim.x)
+                    w = w + (i ? cuda_conj(col[i]) : T(1)) * target[i];
+                w = cuda_block_sum(w) * cuda_conj(t);
+                for(int i = threadIdx.x; i < rows; i += blockDim.x)
+                    target[i] = target[i] - (i ? col[i] : T(1)) * w;
+                __syncthreads();
+            }
+        }
+    }
+
+    // The explicit m x jb unit lower trapezoidal V of a factorized panel, and
+    // the jb x jb upper triangular T of its block reflector H = I - V T V^H
+    // as LAPACK larft forms it column by column
+    template <typename T>
+    __global__ void
+        larft_kernel(int m, int jb, const T* A, int lda, const T* tau, T* V, T* Tm)
+    {
+        __shared__ T column[solver_nb];
+
+        for(int64_t e = threadIdx.x; e < int64_t(m) * jb; e += blockDim.x)
+        {
+            int i = e % m;
+            int j = e / m;
+            V[e]  = i < j ? T(0) : (i == j ? T(1) : A[i + int64_t(j) * lda]);
+        }
+        __syncthreads();
+
+        int l = threadIdx.x;
+        for(int i = 0; i < jb; i++)
+        {
+            // column = -tau[i] * V(:, 0:i)^H * v_i
+            if(l < i)
+            {
+                T dot(0);
+                for(int r = i; r < m; r++)
+                    dot = dot + cuda_conj(V[r + int64_t(l) * m]) * V[r + int64_t(i) * m];
+                column[l] = -tau[i] * dot;
+            }
+            __syncthreads();
+
+            // T(0:i, i) = T(0:i, 0:i) * column
+            if(l < i)
+            {
+                T sum(0);
+                for(int p = l; p < i; p++)
+                    sum = sum + Tm[l + p * jb] * column[p];
+                Tm[l + i * jb] = sum;
+            }
+            if(l == i)
+                Tm[i + i * jb] = tau[i];
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    hipblasStatus_t getrf_blocked(const cuda_context& context,
+                                  int                 n,
+                                  T*                  A,
+                                  int                 lda,
+                                  int*                ipiv,
+                                  int*                info)
+    {
+        using api             = solver_api<T>;
+        cublasHandle_t handle = (cublasHandle_t)context.handle;
+        if(hipMemsetAsync(info, 0, sizeof(int), context.stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        host_pointer_mode mode(context);
+        const T           one(1);
+        const T           minus_one(-1);
+        hipblasStatus_t   status;
+        for(int j = 0; j < n; j += solver_nb)
+        {
+            int jb   = std::min(solver_nb, n - j);
+            int rest = n - j - jb;
+            T*  Ajj  = A + j + int64_t(j) * lda;
+            T*  A12  = A + j + int64_t(j + jb) * lda;
+            hipLaunchKernelGGL((getf2_kernel<cuda_t<T>>),
+                               dim3(1),
+                               dim3(hipblas_cuda_threads),
+                               0,
+                               context.stream,
+                               n - j,
+                               jb,
+                               cuda_cast(Ajj),
+                               lda,
+                               ipiv ? ipiv + j : nullptr,
+                               info,
+                               j);
+            if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            if(ipiv
+               && ((status = laswp(context, j, A, lda, j, j + jb, ipiv, true))
+                       != HIPBLAS_STATUS_SUCCESS
+                   || (status = laswp(context, rest, A12 - j, lda, j, j + jb, ipiv, true))
+                          != HIPBLAS_STATUS_SUCCESS))
+                return status;
+            if(!rest)
+                break;
+
+            // U12 = L11^-1 * A12 and A22 -= L21 * U12
+            if((status = hipCUBLASStatusToHIPStatus(api::trsm(handle,
+                                                              CUBLAS_SIDE_LEFT,
+                                                              CUBLAS_FILL_MODE_LOWER,
+                                                              CUBLAS_OP_N,
+                                                              CUBLAS_DIAG_UNIT,
+                                                              jb,
+                                                              rest,
+                                                              api_cast(&one),
+                                                              api_cast(Ajj),
+                                                              lda,
+                                                              api_cast(A12),
+                                                              lda)))
+                   != HIPBLAS_STATUS_SUCCESS
+               || (status = hipCUBLASStatusToHIPStatus(api::gemm(handle,
+                                                                 CUBLAS_OP_N,
+                                                                 CUBLAS_OP_N,
+                                                                 rest,
+                                                                 rest,
+                                                                 jb,
+                                                                 api_cast(&minus_one),
+                                                                 api_cast(Ajj + jb),
+                                                                 lda,
+                                                                 api_cast(A12),
+                                                                 lda,
+                                                                 api_cast(&one),
+                                                                 api_cast(A12 + jb),
+                                                                 lda)))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t getrs_blocked(const cuda_context& context,
+                                  hipblasOperation_t  trans,
+                                  int                 n,
+                                  int                 nrhs,
+                                  const T*            A,
+                                  int                 lda,
+                                  const int*          ipiv,
+                                  T*                  B,
+                                  int                 ldb)
+    {
+        using api             = solver_api<T>;
+        cublasHandle_t handle = (cublasHandle_t)context.handle;
+        host_pointer_mode mode(context);
+        const T           one(1);
+        bool              notrans = trans == HIPBLAS_OP_N;
+        cublasOperation_t op      = hipOperationToCudaOperation(trans);
+
+        // P * L * U * X = B, or U^T * L^T * P^T * X = B
+        hipblasStatus_t status;
+        if(notrans
+           && (status = laswp(context, nrhs, B, ldb, 0, n, ipiv, true)) != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if((status = hipCUBLASStatusToHIPStatus(
+                api::trsm(handle,
+                          CUBLAS_SIDE_LEFT,
+                          notrans ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER,
+                          op,
+                          notrans ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT,
+                          n,
+                          nrhs,
+                          api_cast(&one),
+                          api_cast(A),
+                          lda,
+                          api_cast(B),
+                          ldb)))
+               != HIPBLAS_STATUS_SUCCESS
+           || (status = hipCUBLASStatusToHIPStatus(
+                   api::trsm(handle,
+                             CUBLAS_SIDE_LEFT,
+                             notrans ? CUBLAS_FILL_MODE_UPPER : CUBLAS_FILL_MODE_LOWER,
+                             op,
+                             notrans ? CUBLAS_DIAG_NON_UNIT : CUBLAS_DIAG_UNIT,
+                             n,
+                             nrhs,
+                             api_cast(&one),
+                             api_cast(A),
+                             lda,
+                             api_cast(B),
+                             ldb)))
+                  != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return notrans ? HIPBLAS_STATUS_SUCCESS
+                       : laswp(context, nrhs, B, ldb, 0, n, ipiv, false);
+    }
+
+    template <typename T>
+    hipblasStatus_t
+        geqrf_blocked(const cuda_context& context, int m, int n, T* A, int lda, T* tau)
+    {
+        using api             = solver_api<T>;
+        cublasHandle_t handle = (cublasHandle_t)context.handle;
+        int            k      = std::min(m, n);
+
+        // V, T and V^H * A22 of a panel
+        T* V = context.scratch<T>(size_t(m) * solver_nb + solver_nb * solver_nb
+                                  + size_t(solver_nb) * n);
+        if(!V)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        T* Tm = V + size_t(m) * solver_nb;
+        T* W  = Tm + solver_nb * solver_nb;
+
+        host_pointer_mode mode(context);
+        const T           one(1);
+        const T           zero(0);
+        const T           minus_one(-1);
+        hipblasStatus_t   status;
+        for(int j = 0; j < k; j += solver_nb)
+        {
+            int jb   = std::min(solver_nb, k - j);
+            int rows = m - j;
+            int rest = n - j - jb;
+            T*  Ajj  = A + j + int64_t(j) * lda;
+            T*  A12  = A + j + int64_t(j + jb) * lda;
+            hipLaunchKernelGGL((geqr2_kernel<cuda_t<T>>),
+                               dim3(1),
+                               dim3(hipblas_cuda_threads),
+                               0,
+                               context.stream,
+                               rows,
+                               jb,
+                               cuda_cast(Ajj),
+                               lda,
+                               cuda_cast(tau + j));
+            if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(!rest)
+                break;
+
+            // A2 = H^H * A2 = A2 - V * (T^H * (V^H * A2))
+            hipLaunchKernelGGL((larft_kernel<cuda_t<T>>),
+                               dim3(1),
+                               dim3(hipblas_cuda_threads),
+                               0,
+                               context.stream,
+                               rows,
+                               jb,
+                               cuda_cast((const T*)Ajj),
+                               lda,
+                               cuda_cast((const T*)tau + j),
+                               cuda_cast(V),
+                               cuda_cast(Tm));
+            if((status = cuda_launch_status()) != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if((status = hipCUBLASStatusToHIPStatus(api::gemm(handle,
+                                                              CUBLAS_OP_C,
+                                                              CUBLAS_OP_N,
+                                                              jb,
+                                                              rest,
+                                                              rows,
+                                                              api_cast(&one),
+                                                              api_cast(V),
+                                                              rows,
+                                                              api_cast(A12),
+                                                              lda,
+                                                              api_cast(&zero),
+                                                              api_cast(W),
+                                                              jb)))
+                   != HIPBLAS_STATUS_SUCCESS
+               || (status = hipCUBLASStatusToHIPStatus(api::trmm(handle,
+                                                                 CUBLAS_SIDE_LEFT,
+                                                                 CUBLAS_FILL_MODE_UPPER,
+                                                                 CUBLAS_OP_C,
+                                                                 CUBLAS_DIAG_NON_UNIT,
+                                                                 jb,
+                                                                 rest,
+                                                                 api_cast(&one),
+                                                                 api_cast(Tm),
+                                                                 jb,
+                                                                 api_cast(W),
+                                                                 jb,
+                                                                 api_cast(W),
+                                                                 jb)))
+                      != HIPBLAS_STATUS_SUCCESS
+               || (status = hipCUBLASStatusToHIPStatus(api::gemm(handle,
+                                                                 CUBLAS_OP_N,
+                                                                 CUBLAS_OP_N,
+                                                                 rows,
+                                                                 rest,
+                                                                 jb,
+                                                                 api_cast(&minus_one),
+                                                                 api_cast(V),
+                                                                 rows,
+                                                                 api_cast(W),
+                                                                 jb,
+                                                                 api_cast(&one),
+                                                                 api_cast(A12),
+                                                                 lda)))
+                      != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+#ifdef HIPBLAS_HAS_CUSOLVER
+    hipblasStatus_t cusolver_status(cusolverStatus_t status)
+    {
+        switch(status)
+        {
+        case CUSOLVER_STATUS_SUCCESS:
+            return HIPBLAS_STATUS_SUCCESS;
+        case CUSOLVER_STATUS_NOT_INITIALIZED:
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        case CUSOLVER_STATUS_ALLOC_FAILED:
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        case CUSOLVER_STATUS_INVALID_VALUE:
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        case CUSOLVER_STATUS_ARCH_MISMATCH:
+            return HIPBLAS_STATUS_ARCH_MISMATCH;
+        case CUSOLVER_STATUS_EXECUTION_FAILED:
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        case CUSOLVER_STATUS_INTERNAL_ERROR:
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        case CUSOLVER_STATUS_NOT_SUPPORTED:
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        default:
+            return HIPBLAS_STATUS_UNKNOWN;
+        }
+    }
+
+    void* create_cusolver()
+    {
+        cusolverDnHandle_t handle;
+        return cusolverDnCreate(&handle) == CUSOLVER_STATUS_SUCCESS ? handle : nullptr;
+    }
+
+    void destroy_cusolver(void* handle)
+    {
+        cusolverDnDestroy(cusolverDnHandle_t(handle));
+    }
+
+    // The cuSOLVER handle of a hipBLAS handle, on its stream, or nullptr
+    cusolverDnHandle_t get_cusolver(const cuda_context& context)
+    {
+        hipblas_backend_solver& solver = hipblas_get_handle_state(context.handle)->solver;
+        cusolverDnHandle_t      handle
+            = cusolverDnHandle_t(solver.get(create_cusolver, destroy_cusolver));
+        if(handle && cusolverDnSetStream(handle, context.stream) != CUSOLVER_STATUS_SUCCESS)
+            return nullptr;
+        return handle;
+    }
+
+    // Workspace of a cuSOLVER call, preceded by a slot for its device info.
+    // The size query only runs for a shape new to the handle.
+    template <typename F>
+    hipblasStatus_t cusolver_workspace(const cuda_context&          context,
+                                       const hipblas_workspace_key& key,
+                                       F&&                          query,
+                                       size_t                       element_size,
+                                       int*&                        info,
+                                       void*&                       work,
+                                       int&                         lwork)
+    {
+        hipblas_workspace_cache& cache = hipblas_get_handle_state(context.handle)->workspace_cache;
+
+        size_t size = 0;
+        if(!cache.find(key, size))
+        {
+            int             elements = 0;
+            hipblasStatus_t status   = cusolver_status(query(&elements));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            size = size_t(elements) * element_size;
+            cache.insert(key, size);
+        }
+
+        // 16 bytes keep the workspace aligned for any element type
+        char* scratch = context.scratch<char>(16 + size);
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        info  = reinterpret_cast<int*>(scratch);
+        work  = scratch + 16;
+        lwork = int(size / element_size);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+#endif
+}
+
+template <typename T>
+hipblasStatus_t
+    hipblas_getrf_cuda(hipblasHandle_t handle, int n, T* A, int lda, int* ipiv, int* info)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(n < 0 || lda < std::max(1, n) || !info || (n && !A))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n)
+        return hipMemsetAsync(info, 0, sizeof(int), context.stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_EXECUTION_FAILED;
+
+#ifdef HIPBLAS_HAS_CUSOLVER
+    using api                 = solver_api<T>;
+    cusolverDnHandle_t solver = get_cusolver(context);
+    if(solver)
+    {
+        int*  unused_info;
+        void* work;
+        int   lwork;
+        if((status = cusolver_workspace(
+                context,
+                hipblas_workspace_key{ipiv ? hipblas_solver_routine::getrf
+                                           : hipblas_solver_routine::getrf_npvt,
+                                      api::precision,
+                                      n,
+                                      n,
+                                      0,
+                                      1},
+                [&](int* elements) {
+                    return api::getrf_buffer_size(solver, n, n, api_cast(A), lda, elements);
+                },
+                sizeof(T),
+                unused_info,
+                work,
+                lwork))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // getrf reports to the caller's device info. A null devIpiv makes
+        // cuSOLVER factorize without pivoting.
+        return cusolver_status(api::getrf(solver,
+                                          n,
+                                          n,
+                                          api_cast(A),
+                                          lda,
+                                          static_cast<typename api::type*>(work),
+                                          ipiv,
+                                          info));
+    }
+#endif
+    return getrf_blocked(context, n, A, lda, ipiv, info);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_getrs_cuda(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                n,
+                                   int                nrhs,
+                                   const T*           A,
+                                   int                lda,
+                                   const int*         ipiv,
+                                   T*                 B,
+                                   int                ldb)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_trans(trans))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n)
+       || (n && (!A || !ipiv)) || (n && nrhs && !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!n || !nrhs)
+        return HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_HAS_CUSOLVER
+    using api                 = solver_api<T>;
+    cusolverDnHandle_t solver = get_cusolver(context);
+    if(solver)
+    {
+        // getrs needs no workspace
+        int* dev_info = context.scratch<int>(1);
+        if(!dev_info)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        return cusolver_status(api::getrs(solver,
+                                          hipOperationToCudaOperation(trans),
+                                          n,
+                                          nrhs,
+                                          api_cast(A),
+                                          lda,
+                                          ipiv,
+                                          api_cast(B),
+                                          ldb,
+                                          dev_info));
+    }
+#endif
+    return getrs_blocked(context, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+template <typename T>
+hipblasStatus_t hipblas_geqrf_cuda(hipblasHandle_t handle, int m, int n, T* A, int lda, T* tau)
+{
+    cuda_context    context;
+    hipblasStatus_t status = cuda_get_context(handle, context);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(m < 0 || n < 0 || lda < std::max(1, m) || (m && n && (!A || !tau)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+#ifdef HIPBLAS_HAS_CUSOLVER
+    using api                 = solver_api<T>;
+    cusolverDnHandle_t solver = get_cusolver(context);
+    if(solver)
+    {
+        int*  dev_info;
+        void* work;
+        int   lwork;
+        if((status = cusolver_workspace(
+                context,
+                hipblas_workspace_key{hipblas_solver_routine::geqrf, api::precision, m, n, 0, 1},
+                [&](int* elements) {
+                    return api::geqrf_buffer_size(solver, m, n, api_cast(A), lda, elements);
+                },
+                sizeof(T),
+                dev_info,
+                work,
+                lwork))
+           != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return cusolver_status(api::geqrf(solver,
+                                          m,
+                                          n,
+                                          api_cast(A),
+                                          lda,
+                                          api_cast(tau),
+                                          static_cast<typename api::type*>(work),
+                                          lwork,
+                                          dev_info));
+    }
+#endif
+    return geqrf_blocked(context, m, n, A, lda, tau);
+}
+
+// Instantiations for the types of the hipBLAS API
+#define HIPBLAS_INSTANTIATE_SOLVER(T__)                                                      \
+    template hipblasStatus_t hipblas_getrf_cuda<T__>(hipblasHandle_t, int, T__*, int, int*, int*); \
+    template hipblasStatus_t hipblas_getrs_cuda<T__>(                                        \
+        hipblasHandle_t, hipblasOperation_t, int, int, const T__*, int, const int*, T__*, int); \
+    template hipblasStatus_t hipblas_geqrf_cuda<T__>(hipblasHandle_t, int, int, T__*, int, T__*);
+
+HIPBLAS_INSTANTIATE_SOLVER(float)
+HIPBLAS_INSTANTIATE_SOLVER(double)
+HIPBLAS_INSTANTIATE_SOLVER(hipblasComplex)
+HIPBLAS_INSTANTIATE_SOLVER(hipblasDoubleComplex)
@@ -0,0 +1,35 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+// Non-batched solver routines of the CUDA backend. They run cuSOLVER when the
+// library is built with it (HIPBLAS_HAS_CUSOLVER), with its workspace size
+// memoized per handle and the workspace taken from the handle scratch.
+// Otherwise, or if no cuSOLVER handle can be created, they run a blocked
+// right-looking factorization whose trailing updates are cuBLAS level 3 calls.
+//
+// Entry points take the arguments of the hipBLAS API in the same order and
+// are instantiated for float, double, hipblasComplex and hipblasDoubleComplex.
+
+#include "hipblas.h"
+
+// A null ipiv factorizes without pivoting; info is a device pointer
+template <typename T>
+hipblasStatus_t
+    hipblas_getrf_cuda(hipblasHandle_t handle, int n, T* A, int lda, int* ipiv, int* info);
+
+template <typename T>
+hipblasStatus_t hipblas_getrs_cuda(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                n,
+                                   int                nrhs,
+                                   const T*           A,
+                                   int                lda,
+                                   const int*         ipiv,
+                                   T*                 B,
+                                   int                ldb);
+
+template <typename T>
+hipblasStatus_t hipblas_geqrf_cuda(hipblasHandle_t handle, int m, int n, T* A, int lda, T* tau);
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// The gemm post-op of the GPU backends, a kernel of hipBLAS' own since
+// neither rocBLAS nor cuBLAS gemm takes one. A thread per element of C reads
+// it once, adds the bias, writes aux, applies the activation and the scale
+// and writes it back. hipcc compiles this source for the GPU.
+
+#include "post_op.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int post_op_threads  = 256;
+    constexpr int post_op_max_grid = 65535;
+
+    // Storage type T as loaded to, and stored from, the type computed with
+    template <typename T>
+    struct device_value
+    {
+        using work = T;
+
+        static __device__ work load(T x)
+        {
+            return x;
+        }
+
+        static __device__ T store(work x)
+        {
+            return x;
+        }
+    };
+
+    template <>
+    struct device_value<hipblasHalf>
+    {
+        using work = float;
+
+        static __device__ float load(hipblasHalf x)
+        {
+            return __half2float(__ushort_as_half(x));
+        }
+
+        static __device__ hipblasHalf store(float x)
+        {
+            return __half_as_ushort(__float2half(x));
+        }
+    };
+
+    template <>
+    struct device_value<hipblasBfloat16>
+    {
+        using work = float;
+
+        static __device__ float load(hipblasBfloat16 x)
+        {
+            uint32_t bits = uint32_t(x.data) << 16;
+            float    f;
+            memcpy(&f, &bits, sizeof(f));
+            return f;
+        }
+
+        // Round to nearest even; NaN stays a quiet NaN
+        static __device__ hipblasBfloat16 store(float f)
+        {
+            uint32_t bits;
+            memcpy(&bits, &f, sizeof(bits));
+            hipblasBfloat16 x;
+            if((bits & 0x7fffffff) > 0x7f800000)
+                x.data = uint16_t((bits >> 16) | 0x40);
+            else
+                x.data = uint16_t((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+            return x;
+        }
+    };
+
+    template <typename T, typename S>
+    __global__ void post_op_kernel(int                 m,
+                                   int                 n,
+                                   T*                  c,
+                                   int                 ldc,
+                                   hipblasStride       stride_c,
+                                   hipblasActivation_t activation,
+                                   const T*            bias,
+                                   hipblasStride       stride_bias,
+                                   const S*            scale,
+                                   hipblasStride       stride_scale,
+                                   T*                  aux,
+                                   int                 ld_aux,
+                                   hipblasStride       stride_aux,
+                                   int                 batch_count)
+    {
+        using value = device_value<T>;
+        using W     = typename value::work;
+
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int j = blockIdx.y; j < n; j += gridDim.y)
+            {
+                T& cij = c[b * stride_c + i + int64_t(j) * ldc];
+                W  z   = value::load(cij);
+                if(bias)
+                    z += value::load(bias[b * stride_bias + i]);
+                if(aux)
+                    aux[b * stride_aux + i + int64_t(j) * ld_aux] = value::store(z);
+
+                W r = hipblas_activation(activation, z);
+                if(scale)
+                    r *= W(device_value<S>::load(scale[b * stride_scale + j]));
+                cij = value::store(r);
+            }
+    }
+
+    template <typename T, typename S>
+    hipblasStatus_t run_post_op(hipStream_t stream, const hipblas_post_op_args& args)
+    {
+        const hipblasPostOp_t& e = args.post_op;
+
+        dim3 grid((args.m - 1) / post_op_threads + 1,
+                  std::min(args.n, post_op_max_grid),
+                  std::min(args.batch_count, post_op_max_grid));
+        hipLaunchKernelGGL((post_op_kernel<T, S>),
+                           grid,
+                           dim3(post_op_threads),
+                           0,
+                           stream,
+                           args.m,
+                           args.n,
+                           static_cast<T*>(args.c),
+                           args.ldc,
+                           args.stride_c,
+                           e.activation,
+                           static_cast<const T*>(e.bias),
+                           e.stride_bias,
+                           static_cast<const S*>(e.scale),
+                           e.stride_scale,
+                           static_cast<T*>(e.aux),
+                           e.ld_aux,
+                           e.stride_aux,
+                           args.batch_count);
+        return hipGetLastError() == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                               : HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+hipblasStatus_t hipblas_run_post_op(hipblasHandle_t handle, const hipblas_post_op_args& args)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    switch(args.c_type)
+    {
+    case HIPBLAS_R_16F:
+        return args.compute_type == HIPBLAS_R_16F
+                   ? run_post_op<hipblasHalf, hipblasHalf>(stream, args)
+                   : run_post_op<hipblasHalf, float>(stream, args);
+    case HIPBLAS_R_16B:
+        return run_post_op<hipblasBfloat16, float>(stream, args);
+    case HIPBLAS_R_32F:
+        return run_post_op<float, float>(stream, args);
+    case HIPBLAS_R_64F:
+        return run_post_op<double, double>(stream, args);
+    default:
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+}
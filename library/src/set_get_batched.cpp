@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Batched transfers of matrices between the host and the device. The copies
+// themselves are staged by each backend (staging.hpp); this file only checks
+// the arguments and describes the batches, so that both backends share it.
+
+#include "hipblas.h"
+#include "coalesce.hpp"
+#include "exceptions.hpp"
+#include "staging.hpp"
+#include <algorithm>
+
+namespace
+{
+    enum class transfer
+    {
+        set,
+        get,
+    };
+
+    hipblasStatus_t set_get_matrices(hipblasHandle_t             handle,
+                                     transfer                    direction,
+                                     int                         rows,
+                                     int                         cols,
+                                     int                         elem_size,
+                                     const hipblas_matrix_batch& a,
+                                     const hipblas_matrix_batch& b,
+                                     int                         batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(rows < 0 || cols < 0 || elem_size <= 0 || a.ld < std::max(1, rows)
+           || b.ld < std::max(1, rows) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!rows || !cols || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if((!a.data && !a.array) || (!b.data && !b.array))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // Deferred gemm calls may read or write the device matrices, and would
+        // use the scratch memory
+        hipblas_coalescing_dependency(handle);
+
+        if(direction == transfer::set)
+            return hipblas_staged_set_matrices(handle, rows, cols, elem_size, a, b, batch_count);
+        return hipblas_staged_get_matrices(handle, rows, cols, elem_size, a, b, batch_count);
+    }
+
+    // The type of the batches is not used by the staged copies
+    hipblas_matrix_batch batch_of(const void* const* array, int ld)
+    {
+        return {HIPBLAS_R_8I, nullptr, const_cast<void* const*>(array), ld, 0};
+    }
+
+    hipblas_matrix_batch batch_of(const void* data, int ld, hipblasStride stride)
+    {
+        return {HIPBLAS_R_8I, const_cast<void*>(data), nullptr, ld, stride};
+    }
+}
+
+hipblasStatus_t hipblasSetMatrixBatched(hipblasHandle_t   handle,
+                                        int               rows,
+                                        int               cols,
+                                        int               elemSize,
+                                        const void* const AP[],
+                                        int               lda,
+                                        void* const       BP[],
+                                        int               ldb,
+                                        int               batchCount)
+try
+{
+    return set_get_matrices(handle,
+                            transfer::set,
+                            rows,
+                            cols,
+                            elemSize,
+                            batch_of(AP, lda),
+                            batch_of(BP, ldb),
+                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixBatched(hipblasHandle_t   handle,
+                                        int               rows,
+                                        int               cols,
+                                        int               elemSize,
+                                        const void* const AP[],
+                                        int               lda,
+                                        void* const       BP[],
+                                        int               ldb,
+                                        int               batchCount)
+try
+{
+    return set_get_matrices(handle,
+                            transfer::get,
+                            rows,
+                            cols,
+                            elemSize,
+                            batch_of(AP, lda),
+                            batch_of(BP, ldb),
+                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetMatrixStridedBatched(hipblasHandle_t handle,
+                                               int             rows,
+                                               int             cols,
+                                               int             elemSize,
+                                               const void*     A,
+                                               int             lda,
+                                               hipblasStride   strideA,
+                                               void*           B,
+                                               int             ldb,
+                                               hipblasStride   strideB,
+                                               int             batchCount)
+try
+{
+    return set_get_matrices(handle,
+                            transfer::set,
+                            rows,
+                            cols,
+                            elemSize,
+                            batch_of(A, lda, strideA),
+                            batch_of(B, ldb, strideB),
+                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixStridedBatched(hipblasHandle_t handle,
+                                               int             rows,
+                                               int             cols,
+                                               int             elemSize,
+                                               const void*     A,
+                                               int             lda,
+                                               hipblasStride   strideA,
+                                               void*           B,
+                                               int             ldb,
+                                               hipblasStride   strideB,
+                                               int             batchCount)
+try
+{
+    return set_get_matrices(handle,
+                            transfer::get,
+                            rows,
+                            cols,
+                            elemSize,
+                            batch_of(A, lda, strideA),
+                            batch_of(B, ldb, strideB),
+                            batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Transfers of matrices between the host and the device that convert the
+// elements to another type. As for the batched transfers, the copies are
+// staged by each backend (staging.hpp) and this file only checks the arguments.
+
+#include "hipblas.h"
+#include "coalesce.hpp"
+#include "convert.hpp"
+#include "exceptions.hpp"
+#include "staging.hpp"
+#include <algorithm>
+
+namespace
+{
+    enum class transfer
+    {
+        set,
+        get,
+    };
+
+    hipblasStatus_t set_get_matrix_ex(hipblasHandle_t   handle,
+                                      transfer          direction,
+                                      int               rows,
+                                      int               cols,
+                                      hipblasDatatype_t a_type,
+                                      const void*       a,
+                                      int               lda,
+                                      hipblasDatatype_t b_type,
+                                      void*             b,
+                                      int               ldb)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(rows < 0 || cols < 0 || lda < std::max(1, rows) || ldb < std::max(1, rows))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!rows || !cols)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!a || !b)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!hipblas_convert_supported(a_type, b_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // Deferred gemm calls may read or write the device matrix, and would
+        // use the scratch memory
+        hipblas_coalescing_dependency(handle);
+
+        if(direction == transfer::set)
+            return hipblas_staged_set_matrix_ex(
+                handle, rows, cols, a_type, a, lda, b_type, b, ldb);
+        return hipblas_staged_get_matrix_ex(handle, rows, cols, a_type, a, lda, b_type, b, ldb);
+    }
+}
+
+hipblasStatus_t hipblasSetMatrixEx(hipblasHandle_t   handle,
+                                   int               rows,
+                                   int               cols,
+                                   hipblasDatatype_t srcType,
+                                   const void*       A,
+                                   int               lda,
+                                   hipblasDatatype_t dstType,
+                                   void*             B,
+                                   int               ldb)
+try
+{
+    return set_get_matrix_ex(handle, transfer::set, rows, cols, srcType, A, lda, dstType, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixEx(hipblasHandle_t   handle,
+                                   int               rows,
+                                   int               cols,
+                                   hipblasDatatype_t srcType,
+                                   const void*       A,
+                                   int               lda,
+                                   hipblasDatatype_t dstType,
+                                   void*             B,
+                                   int               ldb)
+try
+{
+    return set_get_matrix_ex(handle, transfer::get, rows, cols, srcType, A, lda, dstType, B, ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
@@ -0,0 +1,891 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// Staged transfers on the GPU backends, see staging.hpp
+
+#include "staging.hpp"
+#include "graph.hpp"
+#include "handle.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    // Bytes of each pinned slot, and slots per device: one being packed while
+    // the copies out of the others are in flight
+    constexpr size_t staging_slot_bytes = size_t(8) << 20;
+    constexpr int    staging_slots      = 3;
+
+    // Below this the backend's copy costs less than waking the packing threads
+    constexpr size_t staging_min_bytes = size_t(1) << 20;
+
+    // Bytes each packing thread copies at least
+    constexpr size_t pack_grain_bytes = size_t(256) << 10;
+
+    // The pinned slots of one device, each with an event recorded after the
+    // last copy into or out of it. Allocated by the first staged transfer.
+    struct staging_pool
+    {
+        std::mutex mutex;
+        char*      memory             = nullptr;
+        hipEvent_t done[staging_slots] = {};
+
+        bool reserve()
+        {
+            if(memory)
+                return true;
+            for(hipEvent_t& event : done)
+                if(!event && hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                {
+                    event = nullptr;
+                    return false;
+                }
+            if(hipHostMalloc(&memory, staging_slot_bytes * staging_slots) != hipSuccess)
+            {
+                memory = nullptr;
+                return false;
+            }
+            return true;
+        }
+
+        char* slot(int64_t chunk)
+        {
+            return memory + staging_slot_bytes * (chunk % staging_slots);
+        }
+
+        hipEvent_t slot_done(int64_t chunk)
+        {
+            return done[chunk % staging_slots];
+        }
+    };
+
+    // The pool of the current device. Never freed, as the runtime may be gone
+    // by the time statics are destroyed.
+    staging_pool* device_staging_pool()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return nullptr;
+
+        static std::mutex                             mutex;
+        static std::unordered_map<int, staging_pool*> pools;
+        std::lock_guard<std::mutex>                   lock(mutex);
+
+        staging_pool*& pool = pools[device];
+        if(!pool)
+            pool = new staging_pool;
+        return pool;
+    }
+
+    // Whether host is pageable memory, which the runtime does not know of
+    bool is_pageable(const void* host)
+    {
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, host) == hipSuccess)
+            return false;
+
+        // The query fails for pageable memory
+        (void)hipGetLastError();
+        return true;
+    }
+
+    bool is_capturing(hipStream_t stream)
+    {
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        return hipStreamIsCapturing(stream, &capture) != hipSuccess
+               || capture != hipStreamCaptureStatusNone;
+    }
+
+    bool worth_staging(int         rows,
+                       int         cols,
+                       int         elem_size,
+                       const void* host,
+                       int         host_ld,
+                       const void* device,
+                       int         device_ld,
+                       hipStream_t stream)
+    {
+        if(rows <= 0 || cols <= 0 || elem_size <= 0 || host_ld < rows || device_ld < rows || !host
+           || !device)
+            return false;
+
+        // Contiguous host data is one copy already
+        if(host_ld == rows || cols == 1)
+            return false;
+        if(size_t(rows) * cols * elem_size < staging_min_bytes)
+            return false;
+
+        // Waiting for the slots would break a capture
+        return !is_capturing(stream) && is_pageable(host);
+    }
+
+    // Columns col to col + cols - 1 of a chunk, or bytes offset to offset +
+    // bytes - 1 of column col when a whole column does not fit in a slot
+    struct staged_chunk
+    {
+        int64_t col;
+        int64_t cols;
+        size_t  offset;
+        size_t  bytes;
+    };
+
+    // The chunks filling a slot each that a matrix of cols columns of
+    // col_bytes bytes is staged in
+    class staged_copy
+    {
+    public:
+        staged_copy(int rows, int cols, int elem_size)
+            : m_col_bytes(size_t(rows) * elem_size)
+            , m_cols(cols)
+        {
+            if(m_col_bytes <= staging_slot_bytes)
+            {
+                m_chunk_cols = staging_slot_bytes / m_col_bytes;
+                m_col_pieces = 1;
+                m_chunks     = (m_cols - 1) / m_chunk_cols + 1;
+            }
+            else
+            {
+                m_chunk_cols = 1;
+                m_col_pieces = (m_col_bytes - 1) / staging_slot_bytes + 1;
+                m_chunks     = m_cols * m_col_pieces;
+            }
+        }
+
+        int64_t chunks() const
+        {
+            return m_chunks;
+        }
+
+        staged_chunk chunk(int64_t k) const
+        {
+            if(m_col_pieces == 1)
+            {
+                int64_t col = k * m_chunk_cols;
+                return {col, std::min(m_chunk_cols, m_cols - col), 0, m_col_bytes};
+            }
+            size_t offset = (k % m_col_pieces) * staging_slot_bytes;
+            size_t bytes  = std::min(staging_slot_bytes, m_col_bytes - offset);
+            return {k / m_col_pieces, 1, offset, bytes};
+        }
+
+    private:
+        size_t  m_col_bytes;
+        int64_t m_cols;
+        int64_t m_chunk_cols;
+        int64_t m_col_pieces;
+        int64_t m_chunks;
+    };
+
+    // Columns of N bytes, such as the elements of a strided vector, are copied
+    // with fixed size copies the compiler turns into vector loads and stores
+    template <size_t N>
+    void copy_fixed(
+        char* dst, size_t dst_ld, const char* src, size_t src_ld, int64_t begin, int64_t end)
+    {
+        for(int64_t j = begin; j < end; j++)
+            std::memcpy(dst + j * dst_ld, src + j * src_ld, N);
+    }
+
+    // Copy cols columns of bytes bytes between host memory, on the host pool
+    void copy_columns(
+        char* dst, size_t dst_ld, const char* src, size_t src_ld, size_t bytes, int64_t cols)
+    {
+        // A single column is split by bytes instead
+        if(cols == 1)
+        {
+            hipblas_host_parallel_for(bytes, pack_grain_bytes, [=](int64_t begin, int64_t end) {
+                std::memcpy(dst + begin, src + begin, end - begin);
+            });
+            return;
+        }
+
+        int64_t grain = std::max<int64_t>(1, pack_grain_bytes / bytes);
+        hipblas_host_parallel_for(cols, grain, [=](int64_t begin, int64_t end) {
+            switch(bytes)
+            {
+            case 2:
+                return copy_fixed<2>(dst, dst_ld, src, src_ld, begin, end);
+            case 4:
+                return copy_fixed<4>(dst, dst_ld, src, src_ld, begin, end);
+            case 8:
+                return copy_fixed<8>(dst, dst_ld, src, src_ld, begin, end);
+            case 16:
+                return copy_fixed<16>(dst, dst_ld, src, src_ld, begin, end);
+            default:
+                for(int64_t j = begin; j < end; j++)
+                    std::memcpy(dst + j * dst_ld, src + j * src_ld, bytes);
+            }
+        });
+    }
+
+    // Copy a chunk between a packed slot and the device on stream
+    hipError_t copy_chunk(char*               dst,
+                          size_t              dst_ld,
+                          const char*         src,
+                          size_t              src_ld,
+                          const staged_chunk& c,
+                          hipMemcpyKind       kind,
+                          hipStream_t         stream)
+    {
+        if(c.cols == 1 || (dst_ld == c.bytes && src_ld == c.bytes))
+            return hipMemcpyAsync(dst, src, c.bytes * c.cols, kind, stream);
+        return hipMemcpy2DAsync(dst, dst_ld, src, src_ld, c.bytes, c.cols, kind, stream);
+    }
+}
+
+hipblasStatus_t hipblas_staged_set_matrix(int         rows,
+                                          int         cols,
+                                          int         elem_size,
+                                          const void* a,
+                                          int         lda,
+                                          void*       b,
+                                          int         ldb,
+                                          hipStream_t stream,
+                                          bool        async)
+{
+    if(!worth_staging(rows, cols, elem_size, a, lda, b, ldb, stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    const char* host      = static_cast<const char*>(a);
+    char*       device    = static_cast<char*>(b);
+    size_t      host_ld   = size_t(lda) * elem_size;
+    size_t      device_ld = size_t(ldb) * elem_size;
+
+    staged_copy copy(rows, cols, elem_size);
+    for(int64_t k = 0; k < copy.chunks(); k++)
+    {
+        staged_chunk c    = copy.chunk(k);
+        char*        slot = pool->slot(k);
+
+        // Wait for the copy out of the slot staging_slots chunks ago, or by
+        // an earlier transfer
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        copy_columns(slot, c.bytes, host + c.col * host_ld + c.offset, host_ld, c.bytes, c.cols);
+        if(copy_chunk(device + c.col * device_ld + c.offset,
+                      device_ld,
+                      slot,
+                      c.bytes,
+                      c,
+                      hipMemcpyHostToDevice,
+                      stream)
+               != hipSuccess
+           || hipEventRecord(pool->slot_done(k), stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(!async && hipEventSynchronize(pool->slot_done(copy.chunks() - 1)) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_staged_get_matrix(int         rows,
+                                          int         cols,
+                                          int         elem_size,
+                                          const void* a,
+                                          int         lda,
+                                          void*       b,
+                                          int         ldb,
+                                          hipStream_t stream)
+{
+    if(!worth_staging(rows, cols, elem_size, b, ldb, a, lda, stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    const char* device    = static_cast<const char*>(a);
+    char*       host      = static_cast<char*>(b);
+    size_t      device_ld = size_t(lda) * elem_size;
+    size_t      host_ld   = size_t(ldb) * elem_size;
+
+    staged_copy copy(rows, cols, elem_size);
+    auto        issue = [&](int64_t k) {
+        staged_chunk c = copy.chunk(k);
+        return hipEventSynchronize(pool->slot_done(k)) == hipSuccess
+               && copy_chunk(pool->slot(k),
+                             c.bytes,
+                             device + c.col * device_ld + c.offset,
+                             device_ld,
+                             c,
+                             hipMemcpyDeviceToHost,
+                             stream)
+                      == hipSuccess
+               && hipEventRecord(pool->slot_done(k), stream) == hipSuccess;
+    };
+
+    // Keep every slot in flight: while one chunk is unpacked the next ones
+    // are being copied
+    for(int64_t k = 0; k < std::min<int64_t>(copy.chunks(), staging_slots); k++)
+        if(!issue(k))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int64_t k = 0; k < copy.chunks(); k++)
+    {
+        staged_chunk c = copy.chunk(k);
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        copy_columns(
+            host + c.col * host_ld + c.offset, host_ld, pool->slot(k), c.bytes, c.bytes, c.cols);
+        if(k + staging_slots < copy.chunks() && !issue(k + staging_slots))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // Matrix b of a batch of elem_size byte elements
+    char* batch_matrix(const hipblas_matrix_batch& x, int64_t b, int elem_size)
+    {
+        return x.array ? static_cast<char*>(x.array[b])
+                       : static_cast<char*>(x.data) + b * x.stride * elem_size;
+    }
+
+    // The batch x from matrix first on
+    hipblas_matrix_batch batch_from(const hipblas_matrix_batch& x, int64_t first, int elem_size)
+    {
+        hipblas_matrix_batch rest = x;
+        if(x.array)
+            rest.array = x.array + first;
+        else
+            rest.data = batch_matrix(x, first, elem_size);
+        return rest;
+    }
+
+    // Copy count matrices of the host batch x, from matrix first on, into
+    // packed, or out of it if unpack is set, on the host pool
+    void copy_host_batch(char*                       packed,
+                         const hipblas_matrix_batch& x,
+                         int64_t                     first,
+                         int64_t                     count,
+                         int                         rows,
+                         int                         cols,
+                         int                         elem_size,
+                         bool                        unpack)
+    {
+        size_t  col_bytes = size_t(rows) * elem_size;
+        size_t  ld_bytes  = size_t(x.ld) * elem_size;
+        int64_t grain     = std::max<int64_t>(1, pack_grain_bytes / col_bytes);
+        hipblas_host_parallel_for(count * cols, grain, [&](int64_t begin, int64_t end) {
+            for(int64_t i = begin; i < end; i++)
+            {
+                char* host = batch_matrix(x, first + i / cols, elem_size) + (i % cols) * ld_bytes;
+                char* slot = packed + i * col_bytes;
+                if(unpack)
+                    std::memcpy(host, slot, col_bytes);
+                else
+                    std::memcpy(slot, host, col_bytes);
+            }
+        });
+    }
+
+    // Whether matrices follow each other without gaps, so that a packed copy
+    // can go to or come from them directly
+    bool is_packed(const hipblas_matrix_batch& x, int rows, int cols)
+    {
+        return !x.array && (x.ld == rows || cols == 1) && x.stride == hipblasStride(rows) * cols;
+    }
+
+    // The device pointers of the matrices of a batch, read back from the
+    // device array of them if there is one
+    hipblasStatus_t device_matrices(const hipblas_matrix_batch& x,
+                                    int                         elem_size,
+                                    int                         batch_count,
+                                    hipStream_t                 stream,
+                                    std::vector<char*>&         matrices)
+    {
+        matrices.resize(batch_count);
+        if(!x.array)
+        {
+            for(int b = 0; b < batch_count; b++)
+                matrices[b] = batch_matrix(x, b, elem_size);
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(hipMemcpyAsync(matrices.data(),
+                          x.array,
+                          sizeof(char*) * batch_count,
+                          hipMemcpyDeviceToHost,
+                          stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Matrices larger than a slot gain nothing from being batched, and are
+    // each copied as by hipblasSetMatrixAsync, which stages padded ones
+    hipblasStatus_t set_each_matrix(int                         rows,
+                                    int                         cols,
+                                    int                         elem_size,
+                                    const hipblas_matrix_batch& a,
+                                    const hipblas_matrix_batch& b,
+                                    int                         batch_count,
+                                    hipStream_t                 stream)
+    {
+        std::vector<char*> device;
+        hipblasStatus_t    status = device_matrices(b, elem_size, batch_count, stream, device);
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            const char* host = batch_matrix(a, i, elem_size);
+            status = hipblasSetMatrixAsync(
+                rows, cols, elem_size, host, a.ld, device[i], b.ld, stream);
+        }
+        return status;
+    }
+
+    hipblasStatus_t get_each_matrix(int                         rows,
+                                    int                         cols,
+                                    int                         elem_size,
+                                    const hipblas_matrix_batch& a,
+                                    const hipblas_matrix_batch& b,
+                                    int                         batch_count,
+                                    hipStream_t                 stream)
+    {
+        std::vector<char*> device;
+        hipblasStatus_t    status = device_matrices(a, elem_size, batch_count, stream, device);
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            char* host = batch_matrix(b, i, elem_size);
+            status = hipblasGetMatrixAsync(
+                rows, cols, elem_size, device[i], a.ld, host, b.ld, stream);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+}
+
+hipblasStatus_t hipblas_staged_set_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count)
+{
+    if(rows <= 0 || cols <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(is_capturing(stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    size_t matrix_bytes = size_t(rows) * cols * elem_size;
+    if(matrix_bytes > staging_slot_bytes)
+        return set_each_matrix(rows, cols, elem_size, a, b, batch_count, stream);
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    int64_t chunk_matrices = std::min<int64_t>(staging_slot_bytes / matrix_bytes, batch_count);
+    int64_t chunks         = (batch_count - 1) / chunk_matrices + 1;
+
+    // Unless b is packed, each chunk lands in the scratch memory of the handle
+    // and is spread over b from there. The next chunk is copied after that on
+    // the stream, so one chunk of scratch is enough.
+    bool                 packed  = is_packed(b, rows, cols);
+    char*                scratch = nullptr;
+    hipblas_matrix_batch scratch_batch{b.type, nullptr, nullptr, rows, hipblasStride(rows) * cols};
+    if(!packed)
+    {
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        scratch = static_cast<char*>(
+            state->scratch.get(matrix_bytes * chunk_matrices, state->capture));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        scratch_batch.data = scratch;
+    }
+
+    for(int64_t k = 0; k < chunks; k++)
+    {
+        int64_t first = k * chunk_matrices;
+        int64_t count = std::min(chunk_matrices, batch_count - first);
+        char*   slot  = pool->slot(k);
+        char*   dst   = packed ? batch_matrix(b, first, elem_size) : scratch;
+
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        copy_host_batch(slot, a, first, count, rows, cols, elem_size, false);
+        if(hipMemcpyAsync(dst, slot, matrix_bytes * count, hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || hipEventRecord(pool->slot_done(k), stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        if(!packed)
+        {
+            status = hipblas_copy_matrices(handle,
+                                           rows,
+                                           cols,
+                                           elem_size,
+                                           scratch_batch,
+                                           batch_from(b, first, elem_size),
+                                           int(count));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_staged_get_matrices(hipblasHandle_t             handle,
+                                            int                         rows,
+                                            int                         cols,
+                                            int                         elem_size,
+                                            const hipblas_matrix_batch& a,
+                                            const hipblas_matrix_batch& b,
+                                            int                         batch_count)
+{
+    if(rows <= 0 || cols <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(is_capturing(stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    size_t matrix_bytes = size_t(rows) * cols * elem_size;
+    if(matrix_bytes > staging_slot_bytes)
+        return get_each_matrix(rows, cols, elem_size, a, b, batch_count, stream);
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    int64_t chunk_matrices = std::min<int64_t>(staging_slot_bytes / matrix_bytes, batch_count);
+    int64_t chunks         = (batch_count - 1) / chunk_matrices + 1;
+
+    // Unless a is packed, each chunk is gathered into the scratch memory of
+    // the handle first. The next chunk is gathered after the copy out of it
+    // on the stream, so one chunk of scratch is enough.
+    bool                 packed  = is_packed(a, rows, cols);
+    char*                scratch = nullptr;
+    hipblas_matrix_batch scratch_batch{a.type, nullptr, nullptr, rows, hipblasStride(rows) * cols};
+    if(!packed)
+    {
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        scratch = static_cast<char*>(
+            state->scratch.get(matrix_bytes * chunk_matrices, state->capture));
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        scratch_batch.data = scratch;
+    }
+
+    auto issue = [&](int64_t k) {
+        int64_t     first = k * chunk_matrices;
+        int64_t     count = std::min(chunk_matrices, batch_count - first);
+        const char* src   = packed ? batch_matrix(a, first, elem_size) : scratch;
+
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        if(!packed)
+        {
+            hipblasStatus_t status = hipblas_copy_matrices(handle,
+                                                           rows,
+                                                           cols,
+                                                           elem_size,
+                                                           batch_from(a, first, elem_size),
+                                                           scratch_batch,
+                                                           int(count));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        if(hipMemcpyAsync(pool->slot(k), src, matrix_bytes * count, hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipEventRecord(pool->slot_done(k), stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    for(int64_t k = 0; k < std::min<int64_t>(chunks, staging_slots); k++)
+    {
+        status = issue(k);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    for(int64_t k = 0; k < chunks; k++)
+    {
+        int64_t first = k * chunk_matrices;
+        int64_t count = std::min(chunk_matrices, batch_count - first);
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        copy_host_batch(pool->slot(k), b, first, count, rows, cols, elem_size, true);
+        if(k + staging_slots < chunks)
+        {
+            status = issue(k + staging_slots);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // Convert cols columns of rows elements between host memory, on the host
+    // pool
+    void convert_columns(char*             dst,
+                         size_t            dst_ld,
+                         hipblasDatatype_t dst_type,
+                         const char*       src,
+                         size_t            src_ld,
+                         hipblasDatatype_t src_type,
+                         int64_t           rows,
+                         int64_t           cols)
+    {
+        size_t dst_size  = hipblas_datatype_size(dst_type);
+        size_t src_size  = hipblas_datatype_size(src_type);
+        size_t elem_size = std::max(dst_size, src_size);
+
+        // A single column is split by elements instead
+        if(cols == 1)
+        {
+            int64_t grain = pack_grain_bytes / elem_size;
+            hipblas_host_parallel_for(rows, grain, [=](int64_t begin, int64_t end) {
+                const char* from = src + begin * src_size;
+                hipblas_host_convert(src_type, from, dst_type, dst + begin * dst_size, end - begin);
+            });
+            return;
+        }
+
+        int64_t grain = std::max<int64_t>(1, pack_grain_bytes / (rows * elem_size));
+        hipblas_host_parallel_for(cols, grain, [=](int64_t begin, int64_t end) {
+            for(int64_t j = begin; j < end; j++)
+                hipblas_host_convert(src_type, src + j * src_ld, dst_type, dst + j * dst_ld, rows);
+        });
+    }
+
+    // Scratch memory of the handle for a packed rows x cols matrix of type
+    void* packed_scratch(hipblasHandle_t handle, int rows, int cols, hipblasDatatype_t type)
+    {
+        hipblas_handle_state* state = hipblas_get_handle_state(handle);
+        return state->scratch.get(size_t(rows) * cols * hipblas_datatype_size(type),
+                                  state->capture);
+    }
+}
+
+hipblasStatus_t hipblas_staged_set_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb)
+{
+    if(rows <= 0 || cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(is_capturing(stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    size_t a_size = hipblas_datatype_size(a_type);
+    size_t b_size = hipblas_datatype_size(b_type);
+
+    // A wider device type is converted to on the device, from a packed copy
+    // of a in scratch memory
+    if(b_size > a_size)
+    {
+        void* scratch = packed_scratch(handle, rows, cols, a_type);
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        status = hipblasSetMatrixAsync(rows, cols, a_size, a, lda, scratch, rows, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_convert_matrices(handle,
+                                              rows,
+                                              cols,
+                                              {a_type, scratch, nullptr, rows, 0},
+                                              {b_type, b, nullptr, ldb, 0},
+                                              1,
+                                              nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    const char* host      = static_cast<const char*>(a);
+    char*       device    = static_cast<char*>(b);
+    size_t      host_ld   = size_t(lda) * a_size;
+    size_t      device_ld = size_t(ldb) * b_size;
+
+    // The chunks are of the device type, which the host packs them in
+    staged_copy copy(rows, cols, b_size);
+    for(int64_t k = 0; k < copy.chunks(); k++)
+    {
+        staged_chunk c     = copy.chunk(k);
+        int64_t      first = c.offset / b_size;
+        char*        slot  = pool->slot(k);
+
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        convert_columns(slot,
+                        c.bytes,
+                        b_type,
+                        host + c.col * host_ld + first * a_size,
+                        host_ld,
+                        a_type,
+                        c.bytes / b_size,
+                        c.cols);
+        if(copy_chunk(device + c.col * device_ld + c.offset,
+                      device_ld,
+                      slot,
+                      c.bytes,
+                      c,
+                      hipMemcpyHostToDevice,
+                      stream)
+               != hipSuccess
+           || hipEventRecord(pool->slot_done(k), stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+
+    if(hipEventSynchronize(pool->slot_done(copy.chunks() - 1)) != hipSuccess)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_staged_get_matrix_ex(hipblasHandle_t   handle,
+                                             int               rows,
+                                             int               cols,
+                                             hipblasDatatype_t a_type,
+                                             const void*       a,
+                                             int               lda,
+                                             hipblasDatatype_t b_type,
+                                             void*             b,
+                                             int               ldb)
+{
+    if(rows <= 0 || cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(is_capturing(stream))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    size_t a_size = hipblas_datatype_size(a_type);
+    size_t b_size = hipblas_datatype_size(b_type);
+
+    // A narrower host type is converted to on the device, into a packed
+    // matrix in scratch memory which is then copied
+    if(a_size > b_size)
+    {
+        void* scratch = packed_scratch(handle, rows, cols, b_type);
+        if(!scratch)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+
+        status = hipblas_convert_matrices(handle,
+                                          rows,
+                                          cols,
+                                          {a_type, const_cast<void*>(a), nullptr, lda, 0},
+                                          {b_type, scratch, nullptr, rows, 0},
+                                          1,
+                                          nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetMatrixAsync(rows, cols, b_size, scratch, rows, b, ldb, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+        return status;
+    }
+
+    staging_pool* pool = device_staging_pool();
+    if(!pool)
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    if(!pool->reserve())
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    const char* device    = static_cast<const char*>(a);
+    char*       host      = static_cast<char*>(b);
+    size_t      device_ld = size_t(lda) * a_size;
+    size_t      host_ld   = size_t(ldb) * b_size;
+
+    // The chunks are of the device type, which the host unpacks them from
+    staged_copy copy(rows, cols, a_size);
+    auto        issue = [&](int64_t k) {
+        staged_chunk c = copy.chunk(k);
+        return hipEventSynchronize(pool->slot_done(k)) == hipSuccess
+               && copy_chunk(pool->slot(k),
+                             c.bytes,
+                             device + c.col * device_ld + c.offset,
+                             device_ld,
+                             c,
+                             hipMemcpyDeviceToHost,
+                             stream)
+                      == hipSuccess
+               && hipEventRecord(pool->slot_done(k), stream) == hipSuccess;
+    };
+
+    for(int64_t k = 0; k < std::min<int64_t>(copy.chunks(), staging_slots); k++)
+        if(!issue(k))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+    for(int64_t k = 0; k < copy.chunks(); k++)
+    {
+        staged_chunk c     = copy.chunk(k);
+        int64_t      first = c.offset / a_size;
+        if(hipEventSynchronize(pool->slot_done(k)) != hipSuccess)
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+
+        convert_columns(host + c.col * host_ld + first * b_size,
+                        host_ld,
+                        b_type,
+                        pool->slot(k),
+                        c.bytes,
+                        a_type,
+                        c.bytes / a_size,
+                        c.cols);
+        if(k + staging_slots < copy.chunks() && !issue(k + staging_slots))
+            return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "parallel.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Set on pool threads and on a thread running a parallel loop, whose
+    // nested loops then run serially
+    thread_local bool in_parallel_loop = false;
+
+    // Worker threads of the host backend and of staged transfers, started on
+    // first use. One loop runs at a time; the calling thread takes chunks along
+    // with the workers. HIPBLAS_HOST_THREADS overrides the number of threads,
+    // counting the caller.
+    class host_thread_pool
+    {
+    public:
+        host_thread_pool()
+        {
+            int         threads = int(std::max(1u, std::thread::hardware_concurrency()));
+            const char* env     = std::getenv("HIPBLAS_HOST_THREADS");
+            if(env && std::atoi(env) > 0)
+                threads = std::atoi(env);
+
+            for(int i = 1; i < threads; i++)
+                m_workers.emplace_back([this] { work(); });
+        }
+
+        ~host_thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for(auto& worker : m_workers)
+                worker.join();
+        }
+
+        int threads() const
+        {
+            return int(m_workers.size()) + 1;
+        }
+
+        void run(int64_t n, int64_t chunk, const std::function<void(int64_t, int64_t)>& body)
+        {
+            std::lock_guard<std::mutex> loop_lock(m_loop_mutex);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_body    = &body;
+                m_n       = n;
+                m_chunk   = chunk;
+                m_next    = 0;
+                m_pending = int(m_workers.size());
+                m_generation++;
+            }
+            m_wake.notify_all();
+
+            in_parallel_loop = true;
+            take_chunks();
+            in_parallel_loop = false;
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_pending == 0; });
+            m_body = nullptr;
+        }
+
+    private:
+        void take_chunks()
+        {
+            for(;;)
+            {
+                int64_t begin = m_next.fetch_add(m_chunk);
+                if(begin >= m_n)
+                    return;
+                (*m_body)(begin, std::min(m_n, begin + m_chunk));
+            }
+        }
+
+        void work()
+        {
+            in_parallel_loop    = true;
+            uint64_t generation = 0;
+            for(;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [&] { return m_stop || m_generation != generation; });
+                    if(m_stop)
+                        return;
+                    generation = m_generation;
+                }
+
+                take_chunks();
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(--m_pending == 0)
+                    m_done.notify_one();
+            }
+        }
+
+        std::vector<std::thread> m_workers;
+        // Serializes loops started by different application threads
+        std::mutex              m_loop_mutex;
+        std::mutex              m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+        bool                    m_stop       = false;
+        uint64_t                m_generation = 0;
+        int                     m_pending    = 0;
+
+        const std::function<void(int64_t, int64_t)>* m_body = nullptr;
+        int64_t                                      m_n     = 0;
+        int64_t                                      m_chunk = 1;
+        std::atomic<int64_t>                         m_next{0};
+    };
+
+    host_thread_pool& thread_pool()
+    {
+        static host_thread_pool pool;
+        return pool;
+    }
+}
+
+void hipblas_host_parallel_for(int64_t                                     n,
+                               int64_t                                     grain,
+                               const std::function<void(int64_t, int64_t)>& body)
+{
+    if(n <= 0)
+        return;
+
+    grain = std::max<int64_t>(1, grain);
+    if(in_parallel_loop || n <= grain)
+    {
+        body(0, n);
+        return;
+    }
+
+    host_thread_pool& pool = thread_pool();
+    if(pool.threads() == 1)
+    {
+        body(0, n);
+        return;
+    }
+
+    // A few chunks per thread balance uneven chunks without much overhead
+    int64_t chunk = std::max(grain, (n + 4 * pool.threads() - 1) / (4 * pool.threads()));
+    pool.run(n, chunk, body);
+}